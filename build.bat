@@ -26,6 +26,8 @@ cd /D "%~dp0"
 :: - `asan`: enable address sanitizer
 :: - `telemetry`: enable RAD telemetry profiling support
 :: - `spall`: enable spall profiling support
+:: - `profile_stats`: enable built-in per-zone timing statistics (for benchmarks)
+:: - `no_trace`: compile out the built-in trace profiler (on by default, when no other profiler is enabled)
 
 :: --- Unpack Arguments -------------------------------------------------------
 for %%a in (%*) do set "%%~a=1"
@@ -42,6 +44,8 @@ if "%~1"=="release" if "%~2"=="" echo [default mode, assuming `raddbg` build] &&
 set auto_compile_flags=
 if "%telemetry%"=="1"               set auto_compile_flags=%auto_compile_flags% -DPROFILE_TELEMETRY=1 && echo [telemetry profiling enabled]
 if "%spall%"=="1"                   set auto_compile_flags=%auto_compile_flags% -DPROFILE_SPALL=1 && echo [spall profiling enabled]
+if "%profile_stats%"=="1"           set auto_compile_flags=%auto_compile_flags% -DPROFILE_STATS=1 && echo [zone stats profiling enabled]
+if "%no_trace%"=="1"                set auto_compile_flags=%auto_compile_flags% -DPROFILE_TRACE=0 && echo [built-in trace profiling disabled]
 if "%asan%"=="1"                    set auto_compile_flags=%auto_compile_flags% -fsanitize=address && echo [asan enabled]
 if "%opengl%"=="1"                  set auto_compile_flags=%auto_compile_flags% -DR_BACKEND=R_BACKEND_OPENGL && echo [opengl render backend]
 if "%dwarf%"=="1" if "%clang%"=="1" set auto_compile_flags=%auto_compile_flags% -gdwarf && echo [dwarf debug info]
@@ -130,6 +134,7 @@ if "%meta%"=="1" (
 :: --- Build Everything (@build_targets) --------------------------------------
 pushd build
 if "%raddbg%"=="1"                     set didbuild=1 && %compile% ..\src\raddbg\raddbg_main.c                               %compile_link% %link_icon% %out%raddbg.exe || exit /b 1
+if "%raddbg_uibench%"=="1"             set didbuild=1 && %compile% -DOS_GFX_STUB=1 -DR_BACKEND=0 ..\src\raddbg\raddbg_main.c %compile_link% %out%raddbg_uibench.exe || exit /b 1
 if "%radlink%"=="1"                    set didbuild=1 && %compile% ..\src\linker\lnk.c                                       %compile_link% %linker% /NOIMPLIB %linker% /NATVIS:"%~dp0\src\linker\linker.natvis" %out%radlink.exe || exit /b 1
 if "%radbin%"=="1"                     set didbuild=1 && %compile% ..\src\radbin\radbin_main.c                               %compile_link% %out%radbin.exe || exit /b 1
 if "%raddump%"=="1"                    set didbuild=1 && %compile% ..\src\raddump\raddump_main.c                             %compile_link% %out%raddump.exe || exit /b 1
@@ -138,7 +143,11 @@ if "%ryan_scratch%"=="1"               set didbuild=1 && %compile% ..\src\scratc
 if "%eval_scratch%"=="1"               set didbuild=1 && %compile% ..\src\scratch\eval_scratch.c                             %compile_link% %out%eval_scratch.exe || exit /b 1
 if "%textperf%"=="1"                   set didbuild=1 && %compile% ..\src\scratch\textperf.c                                 %compile_link% %out%textperf.exe || exit /b 1
 if "%convertperf%"=="1"                set didbuild=1 && %compile% ..\src\scratch\convertperf.c                              %compile_link% %out%convertperf.exe || exit /b 1
+if "%synthbin%"=="1"                   set didbuild=1 && %compile% ..\src\scratch\synthbin.c                                 %compile_link% %out%synthbin.exe || exit /b 1
 if "%debugstringperf%"=="1"            set didbuild=1 && %compile% ..\src\scratch\debugstringperf.c                          %compile_link% %out%debugstringperf.exe || exit /b 1
+if "%strsearchperf%"=="1"              set didbuild=1 && %compile% ..\src\scratch\strsearchperf.c                            %compile_link% %out%strsearchperf.exe || exit /b 1
+if "%rdidecodeperf%"=="1"              set didbuild=1 && %compile% ..\src\scratch\rdidecodeperf.c                            %compile_link% %out%rdidecodeperf.exe || exit /b 1
+if "%msfparsecheck%"=="1"              set didbuild=1 && %compile% ..\src\scratch\msfparsecheck.c                            %compile_link% %out%msfparsecheck.exe || exit /b 1
 if "%parse_inline_sites%"=="1"         set didbuild=1 && %compile% ..\src\scratch\parse_inline_sites.c                       %compile_link% %out%parse_inline_sites.exe || exit /b 1
 if "%strip_lib_debug%"=="1"            set didbuild=1 && %compile% ..\src\strip_lib_debug\strip_lib_debug.c                  %compile_link% %out%strip_lib_debug.exe || exit /b 1
 if "%mule_main%"=="1"                  set didbuild=1 && del vc*.pdb mule*.pdb && %compile_release% %only_compile% ..\src\mule\mule_inline.cpp && %compile_release% %only_compile% ..\src\mule\mule_o2.cpp && %compile_debug% %EHsc% ..\src\mule\mule_main.cpp ..\src\mule\mule_c.c mule_inline.obj mule_o2.obj %compile_link% %no_aslr% %out%mule_main.exe || exit /b 1
@@ -13,6 +13,8 @@ if [ -v gcc ];       then compiler="${CC:-gcc}"; echo "[gcc compile]"; fi
 
 # --- Unpack Command Line Build Arguments -------------------------------------
 auto_compile_flags=''
+if [ -v profile_stats ]; then auto_compile_flags="$auto_compile_flags -DPROFILE_STATS=1"; echo "[zone stats profiling enabled]"; fi
+if [ -v no_trace ];      then auto_compile_flags="$auto_compile_flags -DPROFILE_TRACE=0"; echo "[built-in trace profiling disabled]"; fi
 
 # --- Get Current Git Commit Id -----------------------------------------------
 git_hash=$(git describe --always --dirty)
@@ -67,8 +69,14 @@ fi
 # --- Build Everything (@build_targets) ---------------------------------------
 cd build
 if [ -v raddbg ];                then didbuild=1 && $compile ../src/raddbg/raddbg_main.c                                    $compile_link $link_os_gfx $link_render $link_font_provider $pkgconfig_opts $out raddbg; fi
+if [ -v raddbg_uibench ];        then didbuild=1 && $compile -DOS_GFX_STUB=1 -DR_BACKEND=0 ../src/raddbg/raddbg_main.c      $compile_link $link_font_provider $out raddbg_uibench; fi
 if [ -v radbin ];                then didbuild=1 && $compile ../src/radbin/radbin_main.c                                    $compile_link $out radbin; fi
 if [ -v radlink ];               then didbuild=1 && $compile ../src/linker/lnk.c                                            $compile_link $out radlink; fi
+if [ -v strsearchperf ];         then didbuild=1 && $compile ../src/scratch/strsearchperf.c                                 $compile_link $out strsearchperf; fi
+if [ -v rdidecodeperf ];         then didbuild=1 && $compile ../src/scratch/rdidecodeperf.c                                 $compile_link $out rdidecodeperf; fi
+if [ -v msfparsecheck ];         then didbuild=1 && $compile ../src/scratch/msfparsecheck.c                                 $compile_link $out msfparsecheck; fi
+if [ -v convertperf ];           then didbuild=1 && $compile ../src/scratch/convertperf.c                                   $compile_link $out convertperf; fi
+if [ -v synthbin ];              then didbuild=1 && $compile ../src/scratch/synthbin.c                                      $compile_link $out synthbin; fi
 cd ..
 
 # --- Warn On No Builds -------------------------------------------------------
@@ -12,7 +12,7 @@ ac_init(void)
   ac_shared->arena = arena;
   ac_shared->cache_slots_count = 256;
   ac_shared->cache_slots = push_array(arena, AC_Cache *, ac_shared->cache_slots_count);
-  ac_shared->cache_stripes = stripe_array_alloc(arena);
+  ac_shared->cache_stripes = stripe_array_alloc(arena, str8_lit("artifact_cache (caches)"));
   for EachElement(idx, ac_shared->req_batches)
   {
     ac_shared->req_batches[idx].mutex = mutex_alloc();
@@ -57,7 +57,7 @@ ac_artifact_from_key_(Access *access, String8 key, AC_ArtifactParams *params, U6
           cache->destroy = params->destroy;
           cache->slots_count = Max(256, params->slots_count);
           cache->slots = push_array(cache_stripe->arena, AC_Slot, cache->slots_count);
-          cache->stripes = stripe_array_alloc(cache_stripe->arena);
+          cache->stripes = stripe_array_alloc(cache_stripe->arena, str8_lit("artifact_cache"));
         }
       }
       if(cache != 0)
@@ -204,6 +204,13 @@ ac_artifact_from_key_(Access *access, String8 key, AC_ArtifactParams *params, U6
   return artifact;
 }
 
+internal U64
+ac_completion_gen(void)
+{
+  U64 result = ins_atomic_u64_eval(&ac_shared->completion_gen);
+  return result;
+}
+
 ////////////////////////////////
 //~ rjf: Asynchronous Tick
 
@@ -429,6 +436,7 @@ ac_async_tick(void)
               }
             }
           }
+          ins_atomic_u64_inc_eval(&ac_shared->completion_gen);
           cond_var_broadcast(stripe->cv);
         }
         
@@ -538,6 +546,7 @@ ac_async_tick(void)
               }
             }
           }
+          ins_atomic_u64_inc_eval(&ac_shared->completion_gen);
           cond_var_broadcast(stripe->cv);
         }
       }
@@ -127,6 +127,9 @@ struct AC_Shared
   // rjf: requests
   AC_RequestBatch req_batches[2]; // 0: high priority, 1: low priority
   
+  // rjf: completion counter
+  U64 completion_gen;
+  
   // rjf: cancel thread
   Thread cancel_thread;
   Semaphore cancel_thread_semaphore;
@@ -146,6 +149,7 @@ internal void ac_init(void);
 //~ rjf: Cache Lookups
 
 internal AC_Artifact ac_artifact_from_key_(Access *access, String8 key, AC_ArtifactParams *params, U64 endt_us);
+internal U64 ac_completion_gen(void);
 #define ac_artifact_from_key(access, key, create_fn, destroy_fn, endt_us, ...) ac_artifact_from_key_((access), (key), &(AC_ArtifactParams){.create = (create_fn), .destroy = (destroy_fn), .evict_threshold_us = (2000000), __VA_ARGS__}, (endt_us))
 
 ////////////////////////////////
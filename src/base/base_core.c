@@ -229,6 +229,43 @@ clz64(U64 val)
 # error "Bit intrinsic functions not defined for this compiler."
 #endif
 
+////////////////////////////////
+//~ rjf: CPU Feature Detection
+
+internal CPUFeatureFlags
+cpu_feature_flags(void)
+{
+  local_persist CPUFeatureFlags flags = 0;
+  local_persist B32 flags_computed = 0;
+  if(!flags_computed)
+  {
+    CPUFeatureFlags f = 0;
+#if ARCH_X64 && COMPILER_MSVC
+    int regs[4] = {0};
+    __cpuid(regs, 0);
+    int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    B32 has_osxsave = !!(regs[2] & (1<<27));
+    B32 has_avx     = !!(regs[2] & (1<<28));
+    f |= CPUFeatureFlag_SSE2;
+    if(regs[2] & (1<<20)) { f |= CPUFeatureFlag_SSE42; }
+    if(max_leaf >= 7 && has_osxsave && has_avx && (_xgetbv(0) & 0x6) == 0x6)
+    {
+      __cpuidex(regs, 7, 0);
+      if(regs[1] & (1<<5)) { f |= CPUFeatureFlag_AVX2; }
+    }
+#elif ARCH_X64 && (COMPILER_CLANG || COMPILER_GCC)
+    __builtin_cpu_init();
+    f |= CPUFeatureFlag_SSE2;
+    if(__builtin_cpu_supports("sse4.2")) { f |= CPUFeatureFlag_SSE42; }
+    if(__builtin_cpu_supports("avx2"))   { f |= CPUFeatureFlag_AVX2; }
+#endif
+    flags = f;
+    flags_computed = 1;
+  }
+  return flags;
+}
+
 ////////////////////////////////
 //~ rjf: Enum -> Sign
 
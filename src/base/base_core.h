@@ -12,6 +12,9 @@
 #include <math.h>
 #include <string.h>
 #include <stdint.h>
+#if ARCH_X64 && (COMPILER_CLANG || COMPILER_GCC)
+# include <immintrin.h>
+#endif
 
 ////////////////////////////////
 //~ rjf: Third Party Includes
@@ -115,6 +118,17 @@
 # define NO_OPTIMIZE_END
 #endif
 
+////////////////////////////////
+//~ rjf: Instruction Set Target Markup
+
+// NOTE(rjf): functions marked with these may use instructions beyond the
+// build's baseline, and must only be called after checking cpu_feature_flags().
+#if COMPILER_CLANG || COMPILER_GCC
+# define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+# define TARGET_AVX2
+#endif
+
 ////////////////////////////////
 //~ rjf: Versions
 
@@ -962,6 +976,19 @@ internal U64 ctz64(U64 val);
 internal U64 clz32(U32 val);
 internal U64 clz64(U64 val);
 
+////////////////////////////////
+//~ rjf: CPU Feature Detection
+
+typedef U32 CPUFeatureFlags;
+enum
+{
+  CPUFeatureFlag_SSE2  = (1<<0),
+  CPUFeatureFlag_SSE42 = (1<<1),
+  CPUFeatureFlag_AVX2  = (1<<2),
+};
+
+internal CPUFeatureFlags cpu_feature_flags(void);
+
 ////////////////////////////////
 //~ rjf: Enum -> Sign
 
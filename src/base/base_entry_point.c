@@ -45,6 +45,13 @@ main_thread_base_entry_point(int arguments_count, char **arguments)
   }
   CmdLine cmdline = cmd_line_from_string_list(scratch.arena, command_line_argument_strings);
   
+  //- rjf: enable lock contention statistics
+  B32 lock_stats = cmd_line_has_flag(&cmdline, str8_lit("lock_stats"));
+  if(lock_stats)
+  {
+    lock_stats_enabled = 1;
+  }
+  
   //- rjf: begin captures
   B32 capture = cmd_line_has_flag(&cmdline, str8_lit("capture"));
   if(capture)
@@ -69,6 +76,9 @@ main_thread_base_entry_point(int arguments_count, char **arguments)
 #if defined(DBG_INFO_H) && !defined(DI_INIT_MANUAL)
   di_init(&cmdline);
 #endif
+#if defined(SYMBOL_STORE_H) && !defined(SS_INIT_MANUAL)
+  ss_init();
+#endif
 #if defined(DEMON_CORE_H) && !defined(DMN_INIT_MANUAL)
   dmn_init();
 #endif
@@ -142,6 +152,18 @@ main_thread_base_entry_point(int arguments_count, char **arguments)
     ProfEndCapture();
   }
   
+  //- rjf: report lock contention statistics
+#if BUILD_CONSOLE_INTERFACE
+  if(lock_stats)
+  {
+    String8List report = lock_stats_report(scratch.arena);
+    for EachNode(n, String8Node, report.first)
+    {
+      fwrite(n->string.str, 1, n->string.size, stderr);
+    }
+  }
+#endif
+  
   scratch_end(scratch);
 }
 
@@ -161,14 +183,24 @@ update_tick_idx(void)
   return result;
 }
 
-internal B32
-update(void)
+internal void
+update_tick_advance(void)
 {
-  ProfTick(0);
   ins_atomic_u64_inc_eval(&global_update_tick_idx);
 #if defined(FONT_CACHE_H)
   fnt_frame();
 #endif
+}
+
+internal B32
+update(void)
+{
+  // NOTE(rjf): the frame advances the update tick itself (update_tick_advance),
+  // once it knows it will do its usual work. a frame which decides to skip
+  // that work touches nothing, and so must not count as an update - otherwise
+  // access points, font styles, & glyphs which only that work touches would
+  // age (and be evicted) while still in use.
+  ProfTick(0);
 #if OS_FEATURE_GRAPHICAL
   B32 result = frame();
 #else
@@ -7,6 +7,7 @@
 internal void main_thread_base_entry_point(int argc, char **argv);
 internal void supplement_thread_base_entry_point(void (*entry_point)(void *params), void *params);
 internal U64 update_tick_idx(void);
+internal void update_tick_advance(void);
 internal B32 update(void);
 internal void async_thread_entry_point(void *params);
 
@@ -828,3 +828,24 @@ m_range_from_n_idx_m_count(U64 n_idx, U64 n_count, U64 m_count)
   Rng1U64 result = r1u64(lane_base_idx__clamped, lane_opl_idx__clamped);
   return result;
 }
+
+internal U64
+n_idx_from_m_idx_n_count_m_count(U64 m_idx, U64 n_count, U64 m_count)
+{
+  // NOTE(rjf): inverse of m_range_from_n_idx_m_count - returns the n whose
+  // range contains m_idx.
+  U64 main_idxes_per_lane = m_count/n_count;
+  U64 leftover_idxes_count = m_count - main_idxes_per_lane*n_count;
+  U64 leftover_lanes_idxes_count = leftover_idxes_count*(main_idxes_per_lane+1);
+  U64 result = 0;
+  if(m_idx < leftover_lanes_idxes_count)
+  {
+    result = m_idx/(main_idxes_per_lane+1);
+  }
+  else if(main_idxes_per_lane != 0)
+  {
+    result = leftover_idxes_count + (m_idx - leftover_lanes_idxes_count)/main_idxes_per_lane;
+  }
+  result = Min(result, n_count-1);
+  return result;
+}
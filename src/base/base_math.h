@@ -691,5 +691,6 @@ internal Rng1S64Array rng1s64_array_from_list(Arena *arena, Rng1S64List *list);
 //~ rjf: N -> M Element Subdivision
 
 internal Rng1U64 m_range_from_n_idx_m_count(U64 n_idx, U64 n_count, U64 m_count);
+internal U64 n_idx_from_m_idx_n_count_m_count(U64 m_idx, U64 n_count, U64 m_count);
 
 #endif //BASE_MATH_H
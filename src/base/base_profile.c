@@ -29,3 +29,341 @@ spall_begin(char *fmt, ...)
   scratch_end(scratch);
 }
 #endif
+
+#if PROFILE_STATS
+internal void
+prof_stats_begin(const char *fmt, ...)
+{
+  //- rjf: first zone on this thread? -> allocate & register thread's stats
+  ProfStatsThread *t = prof_stats_thread;
+  if(t == 0)
+  {
+    t = prof_stats_thread = (ProfStatsThread *)os_reserve(sizeof(ProfStatsThread));
+    os_commit(t, sizeof(ProfStatsThread));
+    for(;;)
+    {
+      ProfStatsThread *first = (ProfStatsThread *)ins_atomic_ptr_eval(&prof_stats_first_thread);
+      t->next = first;
+      if(ins_atomic_ptr_eval_cond_assign(&prof_stats_first_thread, t, first) == first)
+      {
+        break;
+      }
+    }
+  }
+  
+  //- rjf: find zone slot, by format string pointer
+  ProfStatsZone *zone = 0;
+  {
+    U64 hash = ((U64)fmt >> 3) * 0x9e3779b97f4a7c15ull;
+    for(U64 probe_idx = 0; probe_idx < PROF_STATS_ZONES_CAP; probe_idx += 1)
+    {
+      ProfStatsZone *slot = &t->zones[(hash + probe_idx) % PROF_STATS_ZONES_CAP];
+      if(slot->name == fmt || slot->name == 0)
+      {
+        slot->name = (char *)fmt;
+        zone = slot;
+        break;
+      }
+    }
+  }
+  
+  //- rjf: push
+  if(t->stack_count < PROF_STATS_STACK_CAP)
+  {
+    t->stack_zones[t->stack_count] = zone;
+    t->stack_begin_us[t->stack_count] = os_now_microseconds();
+  }
+  t->stack_count += 1;
+}
+
+internal void
+prof_stats_end(void)
+{
+  ProfStatsThread *t = prof_stats_thread;
+  if(t != 0 && t->stack_count != 0)
+  {
+    t->stack_count -= 1;
+    if(t->stack_count < PROF_STATS_STACK_CAP && t->stack_zones[t->stack_count] != 0)
+    {
+      ProfStatsZone *zone = t->stack_zones[t->stack_count];
+      U64 elapsed_us = os_now_microseconds() - t->stack_begin_us[t->stack_count];
+      zone->hit_count += 1;
+      zone->total_us += elapsed_us;
+      zone->max_us = Max(zone->max_us, elapsed_us);
+    }
+  }
+}
+
+internal void
+prof_stats_reset(void)
+{
+  for(ProfStatsThread *t = (ProfStatsThread *)ins_atomic_ptr_eval(&prof_stats_first_thread); t != 0; t = t->next)
+  {
+    for(U64 idx = 0; idx < PROF_STATS_ZONES_CAP; idx += 1)
+    {
+      t->zones[idx].hit_count = 0;
+      t->zones[idx].total_us = 0;
+      t->zones[idx].max_us = 0;
+    }
+  }
+}
+#endif
+
+#if PROFILE_TRACE
+
+//- rjf: timestamps
+
+internal inline U64
+prof_trace_tsc(void)
+{
+#if ARCH_X64
+  return __rdtsc();
+#else
+  return os_now_microseconds();
+#endif
+}
+
+//- rjf: per-thread rings
+
+internal ProfTraceThread *
+prof_trace_thread_get(void)
+{
+  ProfTraceThread *t = prof_trace_thread;
+  if(t == 0)
+  {
+    t = prof_trace_thread = (ProfTraceThread *)os_reserve(sizeof(ProfTraceThread));
+    os_commit(t, sizeof(ProfTraceThread));
+    t->tid = os_tid();
+    for(;;)
+    {
+      ProfTraceThread *first = (ProfTraceThread *)ins_atomic_ptr_eval(&prof_trace_first_thread);
+      t->next = first;
+      if(ins_atomic_ptr_eval_cond_assign(&prof_trace_first_thread, t, first) == first)
+      {
+        break;
+      }
+    }
+  }
+  return t;
+}
+
+internal inline void
+prof_trace_push(ProfTraceEventKind kind, char *name)
+{
+  ProfTraceThread *t = prof_trace_thread_get();
+  if(t->events == 0)
+  {
+    t->events = (ProfTraceEvent *)os_reserve(sizeof(ProfTraceEvent)*PROF_TRACE_EVENTS_CAP);
+    os_commit(t->events, sizeof(ProfTraceEvent)*PROF_TRACE_EVENTS_CAP);
+  }
+  U64 idx = t->events_count;
+  ProfTraceEvent *event = &t->events[idx%PROF_TRACE_EVENTS_CAP];
+  event->tsc  = prof_trace_tsc();
+  event->name = name;
+  event->kind = kind;
+  ins_atomic_u64_eval_assign(&t->events_count, idx+1);
+}
+
+//- rjf: events
+
+internal void
+prof_trace_begin(const char *fmt, ...)
+{
+  prof_trace_depth += 1;
+  prof_trace_push(ProfTraceEventKind_Begin, (char *)fmt);
+}
+
+internal void
+prof_trace_end(void)
+{
+  prof_trace_depth -= 1;
+  prof_trace_push(ProfTraceEventKind_End, 0);
+}
+
+internal void
+prof_trace_begin_lock_wait(void *lock, const char *fmt, ...)
+{
+  prof_trace_lock_wait_depth += 1;
+  prof_trace_push(ProfTraceEventKind_LockWaitBegin, (char *)fmt);
+}
+
+internal void
+prof_trace_end_lock_wait(void)
+{
+  prof_trace_lock_wait_depth -= 1;
+  
+  // rjf: uncontended? -> rewind over the begin event, rather than recording
+  // a zero-length wait
+  ProfTraceThread *t = prof_trace_thread_get();
+  U64 idx = t->events_count;
+  if(idx != 0)
+  {
+    ProfTraceEvent *begin = &t->events[(idx-1)%PROF_TRACE_EVENTS_CAP];
+    if(begin->kind == ProfTraceEventKind_LockWaitBegin &&
+       (F64)(prof_trace_tsc() - begin->tsc) < PROF_TRACE_LOCK_WAIT_MIN_US*prof_trace_tsc_per_us)
+    {
+      ins_atomic_u64_eval_assign(&t->events_count, idx-1);
+      return;
+    }
+  }
+  prof_trace_push(ProfTraceEventKind_LockWaitEnd, 0);
+}
+
+internal void
+prof_trace_msg(const char *fmt, ...)
+{
+  prof_trace_push(ProfTraceEventKind_Msg, (char *)fmt);
+}
+
+internal void
+prof_trace_thread_name(const char *fmt, ...)
+{
+  ProfTraceThread *t = prof_trace_thread_get();
+  va_list args;
+  va_start(args, fmt);
+  U64 size = raddbg_vsnprintf((char *)t->name, sizeof(t->name), fmt, args);
+  va_end(args);
+  t->name_size = (U32)Min(size, sizeof(t->name)-1);
+}
+
+//- rjf: captures
+
+internal void
+prof_trace_begin_capture(char *name)
+{
+  //- rjf: calibrate timestamp frequency against the OS clock
+#if ARCH_X64
+  if(prof_trace_base_tsc == 0)
+  {
+    U64 begin_us = os_now_microseconds();
+    U64 begin_tsc = prof_trace_tsc();
+    U64 end_us = begin_us;
+    for(;end_us < begin_us + 1000;)
+    {
+      end_us = os_now_microseconds();
+    }
+    U64 end_tsc = prof_trace_tsc();
+    prof_trace_tsc_per_us = (F64)(end_tsc - begin_tsc) / (F64)(end_us - begin_us);
+  }
+#endif
+  if(prof_trace_base_tsc == 0)
+  {
+    prof_trace_base_tsc = prof_trace_tsc();
+  }
+  prof_trace_capture_name = name;
+  ins_atomic_u32_eval_assign(&prof_trace_capturing, 1);
+}
+
+internal void
+prof_trace_end_capture(void)
+{
+  ins_atomic_u32_eval_assign(&prof_trace_capturing, 0);
+  prof_trace_dump(0);
+}
+
+internal B32
+prof_trace_dump(char *path)
+{
+  Temp scratch = scratch_begin(0, 0);
+  U32 pid = os_get_process_info()->pid;
+  
+  //- rjf: pick default path, from capture name
+  String8 path_string = str8_cstring(path);
+  if(path_string.size == 0)
+  {
+    String8 name = str8_skip_last_slash(str8_chop_last_dot(str8_cstring(prof_trace_capture_name)));
+    if(name.size == 0)
+    {
+      name = str8_lit("capture");
+    }
+    path_string = push_str8f(scratch.arena, "%S_trace.json", name);
+  }
+  
+  //- rjf: build json
+  String8List json = {0};
+  str8_list_pushf(scratch.arena, &json, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+  str8_list_pushf(scratch.arena, &json, " {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %u, \"args\": {\"name\": \"%S\"}}",
+                  pid, escaped_from_raw_str8(scratch.arena, str8_cstring(prof_trace_capture_name)));
+  for(ProfTraceThread *t = (ProfTraceThread *)ins_atomic_ptr_eval(&prof_trace_first_thread); t != 0; t = t->next)
+  {
+    //- rjf: thread name
+    if(t->name_size != 0)
+    {
+      str8_list_pushf(scratch.arena, &json, ",\n {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %u, \"tid\": %u, \"args\": {\"name\": \"%S\"}}",
+                      pid, t->tid, escaped_from_raw_str8(scratch.arena, str8(t->name, t->name_size)));
+    }
+    if(t->events == 0)
+    {
+      continue;
+    }
+    
+    //- rjf: snapshot ring; drop any events which the owning thread overwrote
+    // while we were copying
+    U64 events_count = ins_atomic_u64_eval(&t->events_count);
+    U64 first_idx = events_count > PROF_TRACE_EVENTS_CAP ? events_count - PROF_TRACE_EVENTS_CAP : 0;
+    ProfTraceEvent *events = push_array_no_zero(scratch.arena, ProfTraceEvent, events_count - first_idx);
+    for(U64 idx = first_idx; idx < events_count; idx += 1)
+    {
+      events[idx - first_idx] = t->events[idx%PROF_TRACE_EVENTS_CAP];
+    }
+    U64 events_count_after = ins_atomic_u64_eval(&t->events_count);
+    U64 valid_first_idx = events_count_after > PROF_TRACE_EVENTS_CAP ? events_count_after - PROF_TRACE_EVENTS_CAP : 0;
+    valid_first_idx = Clamp(first_idx, valid_first_idx, events_count);
+    
+    //- rjf: pair begins with ends, emit complete events
+    ProfTraceEvent **stack = push_array_no_zero(scratch.arena, ProfTraceEvent *, events_count - first_idx);
+    U64 stack_count = 0;
+    for(U64 idx = valid_first_idx; idx < events_count; idx += 1)
+    {
+      ProfTraceEvent *event = &events[idx - first_idx];
+      F64 ts = (F64)(event->tsc - prof_trace_base_tsc) / prof_trace_tsc_per_us;
+      switch((ProfTraceEventKind)event->kind)
+      {
+        case ProfTraceEventKind_Begin:
+        case ProfTraceEventKind_LockWaitBegin:
+        {
+          stack[stack_count] = event;
+          stack_count += 1;
+        }break;
+        case ProfTraceEventKind_End:
+        case ProfTraceEventKind_LockWaitEnd:
+        if(stack_count != 0)
+        {
+          stack_count -= 1;
+          ProfTraceEvent *begin = stack[stack_count];
+          B32 is_lock_wait = (begin->kind == ProfTraceEventKind_LockWaitBegin);
+          F64 begin_ts = (F64)(begin->tsc - prof_trace_base_tsc) / prof_trace_tsc_per_us;
+          str8_list_pushf(scratch.arena, &json, ",\n {\"name\": \"%s%S\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": %u, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}",
+                          is_lock_wait ? "wait: " : "",
+                          escaped_from_raw_str8(scratch.arena, str8_cstring(begin->name)),
+                          is_lock_wait ? "lock" : "zone",
+                          pid, t->tid, begin_ts, ts - begin_ts);
+        }break;
+        case ProfTraceEventKind_Msg:
+        {
+          str8_list_pushf(scratch.arena, &json, ",\n {\"name\": \"%S\", \"cat\": \"msg\", \"ph\": \"i\", \"s\": \"t\", \"pid\": %u, \"tid\": %u, \"ts\": %.3f}",
+                          escaped_from_raw_str8(scratch.arena, str8_cstring(event->name)),
+                          pid, t->tid, ts);
+        }break;
+      }
+    }
+    
+    //- rjf: zones still open at the end of the snapshot -> emit as begins
+    for(U64 stack_idx = 0; stack_idx < stack_count; stack_idx += 1)
+    {
+      ProfTraceEvent *begin = stack[stack_idx];
+      F64 begin_ts = (F64)(begin->tsc - prof_trace_base_tsc) / prof_trace_tsc_per_us;
+      str8_list_pushf(scratch.arena, &json, ",\n {\"name\": \"%S\", \"cat\": \"zone\", \"ph\": \"B\", \"pid\": %u, \"tid\": %u, \"ts\": %.3f}",
+                      escaped_from_raw_str8(scratch.arena, str8_cstring(begin->name)),
+                      pid, t->tid, begin_ts);
+    }
+  }
+  str8_list_pushf(scratch.arena, &json, "\n]}\n");
+  
+  //- rjf: write
+  B32 result = os_write_data_list_to_file_path(path_string, json);
+  scratch_end(scratch);
+  return result;
+}
+
+#endif
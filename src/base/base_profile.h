@@ -13,6 +13,16 @@
 #if !defined(PROFILE_SPALL)
 # define PROFILE_SPALL 0
 #endif
+#if !defined(PROFILE_STATS)
+# define PROFILE_STATS 0
+#endif
+#if !defined(PROFILE_TRACE)
+# if PROFILE_TELEMETRY || PROFILE_SPALL || PROFILE_STATS
+#  define PROFILE_TRACE 0
+# else
+#  define PROFILE_TRACE 1
+# endif
+#endif
 
 ////////////////////////////////
 //~ rjf: Third Party Includes
@@ -38,6 +48,7 @@
 # define ProfIsCapturing(...)      tmRunning()
 # define ProfBeginCapture(...)     tmOpen(0, __VA_ARGS__, __DATE__, "localhost", TMCT_TCP, TELEMETRY_DEFAULT_PORT, TMOF_INIT_NETWORKING|TMOF_CAPTURE_CONTEXT_SWITCHES, 100)
 # define ProfEndCapture(...)       tmClose(0)
+# define ProfDumpCapture(...)      (0)
 # define ProfThreadName(...)       (TM_API_PTR ? TM_API_PTR->_tmThreadName(0, 0, __VA_ARGS__) : (void)0)
 # define ProfMsg(...)              (TM_API_PTR ? TM_API_PTR->_tmMessageV_Core(0, TMMF_ICON_NOTE, __FILE__, &g_telemetry_filename_id, __LINE__, __VA_ARGS__) : (void)0)
 # define ProfBeginLockWait(...)    tmStartWaitForLock(0, 0, __VA_ARGS__)
@@ -84,6 +95,60 @@ internal inline void spall_begin(char *fmt, ...);
 # define ProfIsCapturing(...)     (!!spall_capturing)
 # define ProfBeginCapture(...)    (spall_capturing = 1)
 # define ProfEndCapture(...)      (spall_capturing = 0, spall_flush(&spall_profile))
+# define ProfDumpCapture(...)     (spall_flush(&spall_profile), 1)
+# define ProfThreadName(...)
+# define ProfMsg(...)
+# define ProfBeginLockWait(...)
+# define ProfEndLockWait(...)
+# define ProfLockTake(...)
+# define ProfLockDrop(...)
+# define ProfColor(color)
+# define ProfBeginV(...)
+# define ProfNoteV(...)
+#endif
+
+////////////////////////////////
+//~ rjf: Built-In Zone Statistics Profile Defines
+//
+// NOTE(rjf): this backend keeps no trace - it just accumulates hit counts &
+// microseconds per zone, per thread, keyed by the zone's format string
+// pointer (so all instances of e.g. "sort %.*s" are aggregated together).
+// it is meant for benchmarking harnesses, which read the totals out after
+// running some workload, via `prof_stats_first_thread`.
+
+#if PROFILE_STATS
+#define PROF_STATS_STACK_CAP 256
+#define PROF_STATS_ZONES_CAP 4096
+typedef struct ProfStatsZone ProfStatsZone;
+struct ProfStatsZone
+{
+  char *name;
+  U64 hit_count;
+  U64 total_us;
+  U64 max_us;
+};
+typedef struct ProfStatsThread ProfStatsThread;
+struct ProfStatsThread
+{
+  ProfStatsThread *next;
+  U64 stack_count;
+  ProfStatsZone *stack_zones[PROF_STATS_STACK_CAP];
+  U64 stack_begin_us[PROF_STATS_STACK_CAP];
+  ProfStatsZone zones[PROF_STATS_ZONES_CAP];
+};
+global ProfStatsThread *prof_stats_first_thread = 0;
+thread_static ProfStatsThread *prof_stats_thread = 0;
+internal void prof_stats_begin(const char *fmt, ...);
+internal void prof_stats_end(void);
+internal void prof_stats_reset(void);
+# define ProfBegin(...)           (prof_stats_begin(__VA_ARGS__))
+# define ProfBeginDynamic(...)    (prof_stats_begin(__VA_ARGS__))
+# define ProfEnd(...)             (prof_stats_end())
+# define ProfTick(...)
+# define ProfIsCapturing(...)     (1)
+# define ProfBeginCapture(...)
+# define ProfEndCapture(...)
+# define ProfDumpCapture(...)     (0)
 # define ProfThreadName(...)
 # define ProfMsg(...)
 # define ProfBeginLockWait(...)
@@ -95,6 +160,85 @@ internal inline void spall_begin(char *fmt, ...);
 # define ProfNoteV(...)
 #endif
 
+////////////////////////////////
+//~ rjf: Built-In Trace Profile Defines
+//
+// NOTE(rjf): this backend is compiled in by default, and costs one branch per
+// zone until a capture is begun (`--capture`, or at runtime via
+// `ProfBeginCapture`). while capturing, each thread appends timestamped events
+// to its own ring buffer, with no locks or formatting - zones are recorded by
+// their format string pointer only. `ProfDumpCapture` snapshots the rings of
+// all threads (i.e. the last `PROF_TRACE_EVENTS_CAP` events of each) and
+// writes them as Chrome trace / Perfetto JSON; it may be called while a
+// capture is ongoing. lock waits shorter than `PROF_TRACE_LOCK_WAIT_MIN_US`
+// are dropped as they are recorded, so only contention shows up.
+
+#if PROFILE_TRACE
+#define PROF_TRACE_EVENTS_CAP (1<<16)
+#define PROF_TRACE_THREAD_NAME_CAP 64
+#define PROF_TRACE_LOCK_WAIT_MIN_US 2
+typedef enum ProfTraceEventKind
+{
+  ProfTraceEventKind_Begin,
+  ProfTraceEventKind_End,
+  ProfTraceEventKind_LockWaitBegin,
+  ProfTraceEventKind_LockWaitEnd,
+  ProfTraceEventKind_Msg,
+}
+ProfTraceEventKind;
+typedef struct ProfTraceEvent ProfTraceEvent;
+struct ProfTraceEvent
+{
+  U64 tsc;
+  char *name;
+  U64 kind;
+};
+typedef struct ProfTraceThread ProfTraceThread;
+struct ProfTraceThread
+{
+  ProfTraceThread *next;
+  U32 tid;
+  U32 name_size;
+  U8 name[PROF_TRACE_THREAD_NAME_CAP];
+  U64 events_count;
+  ProfTraceEvent *events;
+};
+global B32 prof_trace_capturing = 0;
+global char *prof_trace_capture_name = 0;
+global F64 prof_trace_tsc_per_us = 1;
+global U64 prof_trace_base_tsc = 0;
+global ProfTraceThread *prof_trace_first_thread = 0;
+thread_static ProfTraceThread *prof_trace_thread = 0;
+thread_static U32 prof_trace_depth = 0;
+thread_static U32 prof_trace_lock_wait_depth = 0;
+internal void prof_trace_begin(const char *fmt, ...);
+internal void prof_trace_end(void);
+internal void prof_trace_begin_lock_wait(void *lock, const char *fmt, ...);
+internal void prof_trace_end_lock_wait(void);
+internal void prof_trace_msg(const char *fmt, ...);
+internal void prof_trace_thread_name(const char *fmt, ...);
+internal void prof_trace_begin_capture(char *name);
+internal void prof_trace_end_capture(void);
+internal B32 prof_trace_dump(char *path);
+# define ProfBegin(...)           (prof_trace_capturing ? (prof_trace_begin(__VA_ARGS__), 0) : 0)
+# define ProfBeginDynamic(...)    (prof_trace_capturing ? (prof_trace_begin(__VA_ARGS__), 0) : 0)
+# define ProfEnd(...)             (prof_trace_depth != 0 ? (prof_trace_end(), 0) : 0)
+# define ProfTick(...)
+# define ProfIsCapturing(...)     (!!prof_trace_capturing)
+# define ProfBeginCapture(name)   (prof_trace_begin_capture(name))
+# define ProfEndCapture(...)      (prof_trace_end_capture())
+# define ProfDumpCapture(path)    (prof_trace_dump(path))
+# define ProfThreadName(...)      (prof_trace_thread_name(__VA_ARGS__))
+# define ProfMsg(...)             (prof_trace_capturing ? (prof_trace_msg(__VA_ARGS__), 0) : 0)
+# define ProfBeginLockWait(...)   (prof_trace_capturing ? (prof_trace_begin_lock_wait(__VA_ARGS__), 0) : 0)
+# define ProfEndLockWait(...)     (prof_trace_lock_wait_depth != 0 ? (prof_trace_end_lock_wait(), 0) : 0)
+# define ProfLockTake(...)
+# define ProfLockDrop(...)
+# define ProfColor(color)
+# define ProfBeginV(...)          (prof_trace_capturing ? (prof_trace_begin(__VA_ARGS__), 0) : 0)
+# define ProfNoteV(...)           (prof_trace_capturing ? (prof_trace_msg(__VA_ARGS__), 0) : 0)
+#endif
+
 ////////////////////////////////
 //~ rjf: Zeroify Undefined Defines
 
@@ -106,6 +250,7 @@ internal inline void spall_begin(char *fmt, ...);
 # define ProfIsCapturing(...)   (0)
 # define ProfBeginCapture(...)  (0)
 # define ProfEndCapture(...)    (0)
+# define ProfDumpCapture(...)   (0)
 # define ProfThreadName(...)    (0)
 # define ProfMsg(...)           (0)
 # define ProfBeginLockWait(...) (0)
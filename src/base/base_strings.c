@@ -327,6 +327,33 @@ str8_match(String8 a, String8 b, StringMatchFlags flags)
 
 internal U64
 str8_find_needle(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags)
+{
+  // NOTE(rjf): most haystacks we search (symbol names, file paths) are short,
+  // where setting up a vectorized search costs more than it saves - so only
+  // dispatch to the wide kernels once there is enough string to scan.
+  U64 result = 0;
+#if ARCH_X64
+  U64 scan_size = (start_pos < string.size ? string.size - start_pos : 0);
+  if(scan_size >= 128 && cpu_feature_flags() & CPUFeatureFlag_AVX2)
+  {
+    result = str8_find_needle__avx2(string, start_pos, needle, flags);
+  }
+  else if(scan_size >= 64)
+  {
+    result = str8_find_needle__sse2(string, start_pos, needle, flags);
+  }
+  else
+  {
+    result = str8_find_needle__scalar(string, start_pos, needle, flags);
+  }
+#else
+  result = str8_find_needle__scalar(string, start_pos, needle, flags);
+#endif
+  return result;
+}
+
+internal U64
+str8_find_needle__scalar(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags)
 {
   U8 *p = string.str + start_pos;
   U64 stop_offset = Max(string.size + 1, needle.size) - needle.size;
@@ -365,6 +392,153 @@ str8_find_needle(String8 string, U64 start_pos, String8 needle, StringMatchFlags
   return result;
 }
 
+#if ARCH_X64
+
+// NOTE(rjf): the vectorized needle searches test a whole register's worth of
+// candidate positions at once, checking both the needle's first character and
+// its last character (at the appropriate offset) before falling back to a full
+// match on each surviving candidate. character adjustment mirrors the scalar
+// path exactly: the first character is only case-folded, while the remainder
+// of the needle is case- and slash-folded, per str8_match.
+
+internal U64
+str8_find_needle__sse2(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags)
+{
+  U64 result = string.size;
+  B32 found = 0;
+  U64 pos = start_pos;
+  U64 stop_offset = Max(string.size + 1, needle.size) - needle.size;
+  if(needle.size > 0 && pos < stop_offset)
+  {
+    U8 *string_opl = string.str + string.size;
+    String8 needle_tail = str8_skip(needle, 1);
+    StringMatchFlags adjusted_flags = flags | StringMatchFlag_RightSideSloppy;
+    B32 fold_case = !!(flags & StringMatchFlag_CaseInsensitive);
+    B32 fold_last_slash = (needle.size > 1 && (flags & StringMatchFlag_SlashInsensitive));
+    U8 first_char = needle.str[0];
+    U8 last_char = needle.str[needle.size-1];
+    if(fold_case)
+    {
+      first_char = upper_from_char(first_char);
+      last_char = upper_from_char(last_char);
+    }
+    if(fold_last_slash)
+    {
+      last_char = correct_slash_from_char(last_char);
+    }
+    __m128i first_v = _mm_set1_epi8((char)first_char);
+    __m128i last_v = _mm_set1_epi8((char)last_char);
+    __m128i lower_bias_v = _mm_set1_epi8((char)(0x80 - 'a'));
+    __m128i lower_limit_v = _mm_set1_epi8((char)(0x80 + 26));
+    __m128i case_bit_v = _mm_set1_epi8(0x20);
+    __m128i backslash_v = _mm_set1_epi8('\\');
+    __m128i slash_v = _mm_set1_epi8('/');
+    for(; !found && pos + 16 <= stop_offset; pos += 16)
+    {
+      __m128i a = _mm_loadu_si128((__m128i *)(string.str + pos));
+      __m128i b = _mm_loadu_si128((__m128i *)(string.str + pos + needle.size - 1));
+      if(fold_case)
+      {
+        __m128i a_is_lower = _mm_cmplt_epi8(_mm_add_epi8(a, lower_bias_v), lower_limit_v);
+        __m128i b_is_lower = _mm_cmplt_epi8(_mm_add_epi8(b, lower_bias_v), lower_limit_v);
+        a = _mm_sub_epi8(a, _mm_and_si128(a_is_lower, case_bit_v));
+        b = _mm_sub_epi8(b, _mm_and_si128(b_is_lower, case_bit_v));
+      }
+      if(fold_last_slash)
+      {
+        __m128i b_is_backslash = _mm_cmpeq_epi8(b, backslash_v);
+        b = _mm_or_si128(_mm_andnot_si128(b_is_backslash, b), _mm_and_si128(b_is_backslash, slash_v));
+      }
+      U32 candidates = (U32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first_v), _mm_cmpeq_epi8(b, last_v)));
+      for(;candidates != 0; candidates &= (candidates - 1))
+      {
+        U64 candidate_pos = pos + ctz32(candidates);
+        if(str8_match(str8_range(string.str + candidate_pos + 1, string_opl), needle_tail, adjusted_flags))
+        {
+          result = candidate_pos;
+          found = 1;
+          break;
+        }
+      }
+    }
+  }
+  if(!found)
+  {
+    result = str8_find_needle__scalar(string, pos, needle, flags);
+  }
+  return result;
+}
+
+TARGET_AVX2 internal U64
+str8_find_needle__avx2(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags)
+{
+  U64 result = string.size;
+  B32 found = 0;
+  U64 pos = start_pos;
+  U64 stop_offset = Max(string.size + 1, needle.size) - needle.size;
+  if(needle.size > 0 && pos < stop_offset)
+  {
+    U8 *string_opl = string.str + string.size;
+    String8 needle_tail = str8_skip(needle, 1);
+    StringMatchFlags adjusted_flags = flags | StringMatchFlag_RightSideSloppy;
+    B32 fold_case = !!(flags & StringMatchFlag_CaseInsensitive);
+    B32 fold_last_slash = (needle.size > 1 && (flags & StringMatchFlag_SlashInsensitive));
+    U8 first_char = needle.str[0];
+    U8 last_char = needle.str[needle.size-1];
+    if(fold_case)
+    {
+      first_char = upper_from_char(first_char);
+      last_char = upper_from_char(last_char);
+    }
+    if(fold_last_slash)
+    {
+      last_char = correct_slash_from_char(last_char);
+    }
+    __m256i first_v = _mm256_set1_epi8((char)first_char);
+    __m256i last_v = _mm256_set1_epi8((char)last_char);
+    __m256i lower_bias_v = _mm256_set1_epi8((char)(0x80 - 'a'));
+    __m256i lower_limit_v = _mm256_set1_epi8((char)(0x80 + 26));
+    __m256i case_bit_v = _mm256_set1_epi8(0x20);
+    __m256i backslash_v = _mm256_set1_epi8('\\');
+    __m256i slash_v = _mm256_set1_epi8('/');
+    for(; !found && pos + 32 <= stop_offset; pos += 32)
+    {
+      __m256i a = _mm256_loadu_si256((__m256i *)(string.str + pos));
+      __m256i b = _mm256_loadu_si256((__m256i *)(string.str + pos + needle.size - 1));
+      if(fold_case)
+      {
+        __m256i a_is_lower = _mm256_cmpgt_epi8(lower_limit_v, _mm256_add_epi8(a, lower_bias_v));
+        __m256i b_is_lower = _mm256_cmpgt_epi8(lower_limit_v, _mm256_add_epi8(b, lower_bias_v));
+        a = _mm256_sub_epi8(a, _mm256_and_si256(a_is_lower, case_bit_v));
+        b = _mm256_sub_epi8(b, _mm256_and_si256(b_is_lower, case_bit_v));
+      }
+      if(fold_last_slash)
+      {
+        __m256i b_is_backslash = _mm256_cmpeq_epi8(b, backslash_v);
+        b = _mm256_blendv_epi8(b, slash_v, b_is_backslash);
+      }
+      U32 candidates = (U32)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first_v), _mm256_cmpeq_epi8(b, last_v)));
+      for(;candidates != 0; candidates &= (candidates - 1))
+      {
+        U64 candidate_pos = pos + ctz32(candidates);
+        if(str8_match(str8_range(string.str + candidate_pos + 1, string_opl), needle_tail, adjusted_flags))
+        {
+          result = candidate_pos;
+          found = 1;
+          break;
+        }
+      }
+    }
+  }
+  if(!found)
+  {
+    result = str8_find_needle__sse2(string, pos, needle, flags);
+  }
+  return result;
+}
+
+#endif
+
 internal U64
 str8_find_needle_reverse(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags)
 {
@@ -198,6 +198,11 @@ internal String8 backslashed_from_str8(Arena *arena, String8 string);
 #define str8_match_cstr(a_cstr, b, flags) str8_match(str8_cstring(a_cstr), (b), (flags))
 internal B32 str8_match(String8 a, String8 b, StringMatchFlags flags);
 internal U64 str8_find_needle(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags);
+internal U64 str8_find_needle__scalar(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags);
+#if ARCH_X64
+internal U64 str8_find_needle__sse2(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags);
+internal U64 str8_find_needle__avx2(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags);
+#endif
 internal U64 str8_find_needle_reverse(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags);
 internal B32 str8_is_before(String8 a, String8 b);
 #define str8_ends_with(string, end, flags) str8_match(str8_postfix((string), (end).size), (end), (flags))
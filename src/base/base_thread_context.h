@@ -103,6 +103,7 @@ internal void tctx_lane_barrier_wait(void *broadcast_ptr, U64 broadcast_size, U6
 #define lane_sync() tctx_lane_barrier_wait(0, 0, 0)
 #define lane_sync_u64(ptr, src_lane_idx) tctx_lane_barrier_wait((ptr), sizeof(*(ptr)), (src_lane_idx))
 #define lane_range(count) m_range_from_n_idx_m_count(lane_idx(), lane_count(), (count))
+#define lane_from_range_idx(idx, count) n_idx_from_m_idx_n_count_m_count((idx), lane_count(), (count))
 
 //- rjf: thread names
 internal void tctx_set_thread_name(String8 name);
@@ -31,16 +31,41 @@ thread_detach(Thread thread)
 
 internal Mutex mutex_alloc(void)                 {return os_mutex_alloc();}
 internal void  mutex_release(Mutex mutex)        {os_mutex_release(mutex);}
-internal void  mutex_take(Mutex mutex)           {os_mutex_take(mutex);}
+internal void  mutex_take(Mutex mutex)           {ProfBeginLockWait((void *)mutex.u64[0], "mutex"); os_mutex_take(mutex); ProfEndLockWait();}
 internal void  mutex_drop(Mutex mutex)           {os_mutex_drop(mutex);}
 
 //- rjf: reader/writer mutexes
 
 internal RWMutex rw_mutex_alloc(void)            {return os_rw_mutex_alloc();}
 internal void    rw_mutex_release(RWMutex mutex) {os_rw_mutex_release(mutex);}
-internal void    rw_mutex_take(RWMutex mutex, B32 write_mode) {os_rw_mutex_take(mutex, write_mode);}
 internal void    rw_mutex_drop(RWMutex mutex, B32 write_mode) {os_rw_mutex_drop(mutex, write_mode);}
 
+internal void
+rw_mutex_take(RWMutex mutex, B32 write_mode)
+{
+  LockStats *stats = (LockStats *)mutex.u64[1];
+  if(stats != 0 && lock_stats_enabled)
+  {
+    ins_atomic_u64_inc_eval(&stats->take_count);
+    if(!os_rw_mutex_try_take(mutex, write_mode))
+    {
+      U64 begin_us = os_now_microseconds();
+      ProfBeginLockWait((void *)mutex.u64[0], "rw_mutex");
+      os_rw_mutex_take(mutex, write_mode);
+      ProfEndLockWait();
+      U64 end_us = os_now_microseconds();
+      ins_atomic_u64_inc_eval(&stats->contended_count);
+      ins_atomic_u64_add_eval(&stats->wait_us, end_us - begin_us);
+    }
+  }
+  else
+  {
+    ProfBeginLockWait((void *)mutex.u64[0], "rw_mutex");
+    os_rw_mutex_take(mutex, write_mode);
+    ProfEndLockWait();
+  }
+}
+
 //- rjf: condition variables
 
 internal CondVar   cond_var_alloc(void)                                                        {return os_cond_var_alloc();}
@@ -65,20 +90,162 @@ internal Barrier   barrier_alloc(U64 count)         {return os_barrier_alloc(cou
 internal void      barrier_release(Barrier barrier) {os_barrier_release(barrier);}
 internal void      barrier_wait(Barrier barrier)    {os_barrier_wait(barrier);}
 
+////////////////////////////////
+//~ rjf: Lock Contention Statistics Functions
+
+internal LockStatsGroup *
+lock_stats_group_alloc(String8 name, U64 count)
+{
+  // NOTE(rjf): groups are never unregistered, so that readers can walk the
+  // list without locking - they live in their own allocation, rather than in
+  // the owning table's arena.
+  U64 size = sizeof(LockStatsGroup) + sizeof(LockStats)*count + name.size;
+  LockStatsGroup *group = (LockStatsGroup *)os_reserve(size);
+  os_commit(group, size);
+  group->count = count;
+  group->v = (LockStats *)(group + 1);
+  group->name = str8((U8 *)(group->v + count), name.size);
+  MemoryCopy(group->name.str, name.str, name.size);
+  for(;;)
+  {
+    LockStatsGroup *first = (LockStatsGroup *)ins_atomic_ptr_eval(&lock_stats_first_group);
+    group->next = first;
+    if(ins_atomic_ptr_eval_cond_assign(&lock_stats_first_group, group, first) == first)
+    {
+      break;
+    }
+  }
+  return group;
+}
+
+internal void
+rw_mutex_set_stats(RWMutex *mutex, LockStats *stats)
+{
+  mutex->u64[1] = (U64)stats;
+}
+
+internal int
+lock_stats_group_summary_qsort_compare__wait_descending(LockStatsGroupSummary *a, LockStatsGroupSummary *b)
+{
+  int result = 0;
+  if(a->total.wait_us > b->total.wait_us)
+  {
+    result = -1;
+  }
+  else if(a->total.wait_us < b->total.wait_us)
+  {
+    result = +1;
+  }
+  else if(a->total.contended_count > b->total.contended_count)
+  {
+    result = -1;
+  }
+  else if(a->total.contended_count < b->total.contended_count)
+  {
+    result = +1;
+  }
+  return result;
+}
+
+internal LockStatsGroupSummaryArray
+lock_stats_group_summaries(Arena *arena)
+{
+  //- rjf: gather groups, merging those which share a name (e.g. the
+  // per-cache stripes of the artifact cache)
+  LockStatsGroupSummaryArray array = {0};
+  for(LockStatsGroup *g = (LockStatsGroup *)ins_atomic_ptr_eval(&lock_stats_first_group); g != 0; g = g->next)
+  {
+    array.count += 1;
+  }
+  array.v = push_array(arena, LockStatsGroupSummary, array.count);
+  U64 summaries_count = 0;
+  for(LockStatsGroup *g = (LockStatsGroup *)ins_atomic_ptr_eval(&lock_stats_first_group); g != 0 && summaries_count < array.count; g = g->next)
+  {
+    LockStatsGroupSummary *summary = 0;
+    for EachIndex(idx, summaries_count)
+    {
+      if(str8_match(array.v[idx].name, g->name, 0))
+      {
+        summary = &array.v[idx];
+        break;
+      }
+    }
+    if(summary == 0)
+    {
+      summary = &array.v[summaries_count];
+      summaries_count += 1;
+      summary->name = g->name;
+      summary->count = g->count;
+    }
+    for EachIndex(idx, g->count)
+    {
+      LockStats *stats = &g->v[idx];
+      U64 wait_us = ins_atomic_u64_eval(&stats->wait_us);
+      summary->total.take_count      += ins_atomic_u64_eval(&stats->take_count);
+      summary->total.contended_count += ins_atomic_u64_eval(&stats->contended_count);
+      summary->total.wait_us         += wait_us;
+      if(wait_us > summary->hottest_wait_us)
+      {
+        summary->hottest_idx = idx;
+        summary->hottest_wait_us = wait_us;
+      }
+    }
+  }
+  array.count = summaries_count;
+  
+  //- rjf: rank by time spent waiting
+  quick_sort(array.v, array.count, sizeof(array.v[0]), lock_stats_group_summary_qsort_compare__wait_descending);
+  return array;
+}
+
+internal String8List
+lock_stats_report(Arena *arena)
+{
+  String8List strings = {0};
+  LockStatsGroupSummaryArray summaries = lock_stats_group_summaries(arena);
+  str8_list_pushf(arena, &strings, "%-32s %8s %12s %12s %8s %12s %16s\n", "table", "stripes", "takes", "contended", "rate", "wait (ms)", "hottest stripe");
+  for EachIndex(idx, summaries.count)
+  {
+    LockStatsGroupSummary *s = &summaries.v[idx];
+    F64 rate = s->total.take_count ? (F64)s->total.contended_count / (F64)s->total.take_count : 0;
+    F64 hottest_share = s->total.wait_us ? (F64)s->hottest_wait_us / (F64)s->total.wait_us : 0;
+    str8_list_pushf(arena, &strings, "%-32.*s %8I64u %12I64u %12I64u %7.2f%% %12.3f %8I64u (%3.0f%%)\n",
+                    str8_varg(s->name), s->count, s->total.take_count, s->total.contended_count,
+                    rate*100.0, s->total.wait_us/1000.0, s->hottest_idx, hottest_share*100.0);
+  }
+  return strings;
+}
+
+internal void
+lock_stats_reset(void)
+{
+  for(LockStatsGroup *g = (LockStatsGroup *)ins_atomic_ptr_eval(&lock_stats_first_group); g != 0; g = g->next)
+  {
+    for EachIndex(idx, g->count)
+    {
+      ins_atomic_u64_eval_assign(&g->v[idx].take_count, 0);
+      ins_atomic_u64_eval_assign(&g->v[idx].contended_count, 0);
+      ins_atomic_u64_eval_assign(&g->v[idx].wait_us, 0);
+    }
+  }
+}
+
 ////////////////////////////////
 //~ rjf: Table Stripe Functions
 
 internal StripeArray
-stripe_array_alloc(Arena *arena)
+stripe_array_alloc(Arena *arena, String8 name)
 {
   StripeArray array = {0};
   array.count = os_get_system_info()->logical_processor_count;
   array.v = push_array(arena, Stripe, array.count);
+  LockStatsGroup *stats = lock_stats_group_alloc(name, array.count);
   for EachIndex(idx, array.count)
   {
     array.v[idx].arena = arena_alloc();
     array.v[idx].rw_mutex = rw_mutex_alloc();
     array.v[idx].cv = cond_var_alloc();
+    rw_mutex_set_stats(&array.v[idx].rw_mutex, &stats->v[idx]);
   }
   return array;
 }
@@ -26,7 +26,7 @@ struct Mutex
 typedef struct RWMutex RWMutex;
 struct RWMutex
 {
-  U64 u64[1];
+  U64 u64[2];
 };
 
 typedef struct CondVar CondVar;
@@ -66,6 +66,55 @@ struct StripeArray
   U64 count;
 };
 
+////////////////////////////////
+//~ rjf: Lock Contention Statistics Types
+//
+// NOTE(rjf): reader/writer mutexes may point at a `LockStats` (in their
+// second handle slot), which are registered in named groups - one group per
+// striped table. when `lock_stats_enabled` is set, takes of those mutexes
+// first try to take without blocking, and count how often that fails, &
+// how long the blocking take waited. otherwise they cost one extra branch.
+
+typedef struct LockStats LockStats;
+struct LockStats
+{
+  U64 take_count;
+  U64 contended_count;
+  U64 wait_us;
+};
+
+typedef struct LockStatsGroup LockStatsGroup;
+struct LockStatsGroup
+{
+  LockStatsGroup *next;
+  String8 name;
+  U64 count;
+  LockStats *v;
+};
+
+typedef struct LockStatsGroupSummary LockStatsGroupSummary;
+struct LockStatsGroupSummary
+{
+  String8 name;
+  U64 count;
+  LockStats total;
+  U64 hottest_idx;
+  U64 hottest_wait_us;
+};
+
+typedef struct LockStatsGroupSummaryArray LockStatsGroupSummaryArray;
+struct LockStatsGroupSummaryArray
+{
+  LockStatsGroupSummary *v;
+  U64 count;
+};
+
+////////////////////////////////
+//~ rjf: Lock Contention Statistics Globals
+
+global B32 lock_stats_enabled = 0;
+global LockStatsGroup *lock_stats_first_group = 0;
+
 ////////////////////////////////
 //~ rjf: Thread Functions
 
@@ -123,10 +172,19 @@ internal void      barrier_wait(Barrier barrier);
 #define MutexScopeW(mutex) DeferLoop(rw_mutex_take_w(mutex), rw_mutex_drop_w(mutex))
 #define MutexScopeRWPromote(mutex) DeferLoop((rw_mutex_drop_r(mutex), rw_mutex_take_w(mutex)), (rw_mutex_drop_w(mutex), rw_mutex_take_r(mutex)))
 
+////////////////////////////////
+//~ rjf: Lock Contention Statistics Functions
+
+internal LockStatsGroup *lock_stats_group_alloc(String8 name, U64 count);
+internal void rw_mutex_set_stats(RWMutex *mutex, LockStats *stats);
+internal LockStatsGroupSummaryArray lock_stats_group_summaries(Arena *arena);
+internal String8List lock_stats_report(Arena *arena);
+internal void lock_stats_reset(void);
+
 ////////////////////////////////
 //~ rjf: Table Stripe Functions
 
-internal StripeArray stripe_array_alloc(Arena *arena);
+internal StripeArray stripe_array_alloc(Arena *arena, String8 name);
 internal void stripe_array_release(StripeArray *stripes);
 internal Stripe *stripe_from_slot_idx(StripeArray *stripes, U64 slot_idx);
 
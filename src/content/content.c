@@ -50,36 +50,42 @@ c_init(void)
   c_shared->blob_slots = push_array(arena, C_BlobSlot, c_shared->blob_slots_count);
   c_shared->blob_stripes = push_array(arena, C_Stripe, c_shared->blob_stripes_count);
   c_shared->blob_stripes_free_nodes = push_array(arena, C_BlobNode *, c_shared->blob_stripes_count);
+  LockStatsGroup *blob_stripes_stats = lock_stats_group_alloc(str8_lit("content (blobs)"), c_shared->blob_stripes_count);
   for(U64 idx = 0; idx < c_shared->blob_stripes_count; idx += 1)
   {
     C_Stripe *stripe = &c_shared->blob_stripes[idx];
     stripe->arena = arena_alloc();
     stripe->rw_mutex = rw_mutex_alloc();
     stripe->cv = cond_var_alloc();
+    rw_mutex_set_stats(&stripe->rw_mutex, &blob_stripes_stats->v[idx]);
   }
   c_shared->key_slots_count = 4096;
   c_shared->key_stripes_count = Min(c_shared->key_slots_count, os_get_system_info()->logical_processor_count);
   c_shared->key_slots = push_array(arena, C_KeySlot, c_shared->key_slots_count);
   c_shared->key_stripes = push_array(arena, C_Stripe, c_shared->key_stripes_count);
   c_shared->key_stripes_free_nodes = push_array(arena, C_KeyNode *, c_shared->key_stripes_count);
+  LockStatsGroup *key_stripes_stats = lock_stats_group_alloc(str8_lit("content (keys)"), c_shared->key_stripes_count);
   for(U64 idx = 0; idx < c_shared->key_stripes_count; idx += 1)
   {
     C_Stripe *stripe = &c_shared->key_stripes[idx];
     stripe->arena = arena_alloc();
     stripe->rw_mutex = rw_mutex_alloc();
     stripe->cv = cond_var_alloc();
+    rw_mutex_set_stats(&stripe->rw_mutex, &key_stripes_stats->v[idx]);
   }
   c_shared->root_slots_count = 4096;
   c_shared->root_stripes_count = Min(c_shared->root_slots_count, os_get_system_info()->logical_processor_count);
   c_shared->root_slots = push_array(arena, C_RootSlot, c_shared->root_slots_count);
   c_shared->root_stripes = push_array(arena, C_Stripe, c_shared->root_stripes_count);
   c_shared->root_stripes_free_nodes = push_array(arena, C_RootNode *, c_shared->root_stripes_count);
+  LockStatsGroup *root_stripes_stats = lock_stats_group_alloc(str8_lit("content (roots)"), c_shared->root_stripes_count);
   for(U64 idx = 0; idx < c_shared->root_stripes_count; idx += 1)
   {
     C_Stripe *stripe = &c_shared->root_stripes[idx];
     stripe->arena = arena_alloc();
     stripe->rw_mutex = rw_mutex_alloc();
     stripe->cv = cond_var_alloc();
+    rw_mutex_set_stats(&stripe->rw_mutex, &root_stripes_stats->v[idx]);
   }
 }
 
@@ -322,9 +328,19 @@ c_submit_data(C_Key key, Arena **data_arena, String8 data)
     }
   }
   
+  //- rjf: bump submission counter
+  ins_atomic_u64_inc_eval(&c_shared->submit_gen);
+  
   return hash;
 }
 
+internal U64
+c_submit_gen(void)
+{
+  U64 result = ins_atomic_u64_eval(&c_shared->submit_gen);
+  return result;
+}
+
 ////////////////////////////////
 //~ rjf: Key Closing
 
@@ -187,6 +187,9 @@ struct C_Shared
   C_Stripe *root_stripes;
   C_RootNode **root_stripes_free_nodes;
   U64 root_id_gen;
+  
+  // rjf: submission counter
+  U64 submit_gen;
 };
 
 ////////////////////////////////
@@ -217,6 +220,7 @@ internal void c_root_release(C_Root root);
 //~ rjf: Cache Submission
 
 internal U128 c_submit_data(C_Key key, Arena **data_arena, String8 data);
+internal U64 c_submit_gen(void);
 
 ////////////////////////////////
 //~ rjf: Key Closing
@@ -100,6 +100,7 @@ ctrl_string_from_msg_kind(CTRL_MsgKind kind)
     case CTRL_MsgKind_Kill:                      {result = str8_lit("Kill");}break;
     case CTRL_MsgKind_KillAll:                   {result = str8_lit("KillAll");}break;
     case CTRL_MsgKind_Detach:                    {result = str8_lit("Detach");}break;
+    case CTRL_MsgKind_SaveCoreDump:              {result = str8_lit("SaveCoreDump");}break;
     case CTRL_MsgKind_Run:                       {result = str8_lit("Run");}break;
     case CTRL_MsgKind_SingleStep:                {result = str8_lit("SingleStep");}break;
     case CTRL_MsgKind_SetUserEntryPoints:        {result = str8_lit("SetUserEntryPoints");}break;
@@ -360,6 +361,7 @@ ctrl_serialized_string_from_msg_list(Arena *arena, CTRL_MsgList *msgs)
       // rjf: write flat parts
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->kind);
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->run_flags);
+      str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->save_core_flags);
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->msg_id);
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->entity);
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->parent);
@@ -367,6 +369,8 @@ ctrl_serialized_string_from_msg_list(Arena *arena, CTRL_MsgList *msgs)
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->exit_code);
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->env_inherit);
       str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->debug_subprocesses);
+      str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->sample_interval_us);
+      str8_serial_push_struct(scratch.arena, &msgs_srlzed, &msg->sample_overhead_pct);
       str8_serial_push_array (scratch.arena, &msgs_srlzed, &msg->exception_code_filters[0], ArrayCount(msg->exception_code_filters));
       
       // rjf: write path string
@@ -459,6 +463,7 @@ ctrl_msg_list_from_serialized_string(Arena *arena, String8 string)
       // rjf: read flat data
       read_off += str8_deserial_read_struct(string, read_off, &msg->kind);
       read_off += str8_deserial_read_struct(string, read_off, &msg->run_flags);
+      read_off += str8_deserial_read_struct(string, read_off, &msg->save_core_flags);
       read_off += str8_deserial_read_struct(string, read_off, &msg->msg_id);
       read_off += str8_deserial_read_struct(string, read_off, &msg->entity);
       read_off += str8_deserial_read_struct(string, read_off, &msg->parent);
@@ -466,6 +471,8 @@ ctrl_msg_list_from_serialized_string(Arena *arena, String8 string)
       read_off += str8_deserial_read_struct(string, read_off, &msg->exit_code);
       read_off += str8_deserial_read_struct(string, read_off, &msg->env_inherit);
       read_off += str8_deserial_read_struct(string, read_off, &msg->debug_subprocesses);
+      read_off += str8_deserial_read_struct(string, read_off, &msg->sample_interval_us);
+      read_off += str8_deserial_read_struct(string, read_off, &msg->sample_overhead_pct);
       read_off += str8_deserial_read_array (string, read_off, &msg->exception_code_filters[0], ArrayCount(msg->exception_code_filters));
       
       // rjf: read path string
@@ -1462,19 +1469,23 @@ ctrl_init(void)
   ctrl_state->thread_reg_cache.slots = push_array(arena, CTRL_ThreadRegCacheSlot, ctrl_state->thread_reg_cache.slots_count);
   ctrl_state->thread_reg_cache.stripes_count = os_get_system_info()->logical_processor_count;
   ctrl_state->thread_reg_cache.stripes = push_array(arena, CTRL_ThreadRegCacheStripe, ctrl_state->thread_reg_cache.stripes_count);
+  LockStatsGroup *thread_reg_cache_stats = lock_stats_group_alloc(str8_lit("ctrl (thread registers)"), ctrl_state->thread_reg_cache.stripes_count);
   for(U64 idx = 0; idx < ctrl_state->thread_reg_cache.stripes_count; idx += 1)
   {
     ctrl_state->thread_reg_cache.stripes[idx].arena = arena_alloc();
     ctrl_state->thread_reg_cache.stripes[idx].rw_mutex = rw_mutex_alloc();
+    rw_mutex_set_stats(&ctrl_state->thread_reg_cache.stripes[idx].rw_mutex, &thread_reg_cache_stats->v[idx]);
   }
   ctrl_state->module_image_info_cache.slots_count = 1024;
   ctrl_state->module_image_info_cache.slots = push_array(arena, CTRL_ModuleImageInfoCacheSlot, ctrl_state->module_image_info_cache.slots_count);
   ctrl_state->module_image_info_cache.stripes_count = os_get_system_info()->logical_processor_count;
   ctrl_state->module_image_info_cache.stripes = push_array(arena, CTRL_ModuleImageInfoCacheStripe, ctrl_state->module_image_info_cache.stripes_count);
+  LockStatsGroup *module_image_info_cache_stats = lock_stats_group_alloc(str8_lit("ctrl (module image info)"), ctrl_state->module_image_info_cache.stripes_count);
   for(U64 idx = 0; idx < ctrl_state->module_image_info_cache.stripes_count; idx += 1)
   {
     ctrl_state->module_image_info_cache.stripes[idx].arena = arena_alloc();
     ctrl_state->module_image_info_cache.stripes[idx].rw_mutex = rw_mutex_alloc();
+    rw_mutex_set_stats(&ctrl_state->module_image_info_cache.stripes[idx].rw_mutex, &module_image_info_cache_stats->v[idx]);
   }
   ctrl_state->u2c_ring_size = KB(64);
   ctrl_state->u2c_ring_base = push_array_no_zero(arena, U8, ctrl_state->u2c_ring_size);
@@ -1501,6 +1512,14 @@ ctrl_init(void)
   ctrl_state->dmn_event_arena = arena_alloc();
   ctrl_state->user_entry_point_arena = arena_alloc();
   ctrl_state->dbg_dir_arena = arena_alloc();
+  ctrl_state->sample_thread_mutex = mutex_alloc();
+  ctrl_state->sample_thread_cv = cond_var_alloc();
+  ctrl_state->sample_mutex = mutex_alloc();
+  ctrl_state->sample_arena = arena_alloc();
+  ctrl_state->sample_slots_count = 16384;
+  ctrl_state->sample_slots = push_array(arena, CTRL_SampleNode *, ctrl_state->sample_slots_count);
+  ctrl_state->sample_root = push_array(ctrl_state->sample_arena, CTRL_SampleNode, 1);
+  ctrl_state->sample_nodes_count = 1;
   for(CTRL_ExceptionCodeKind k = (CTRL_ExceptionCodeKind)0; k < CTRL_ExceptionCodeKind_COUNT; k = (CTRL_ExceptionCodeKind)(k+1))
   {
     if(ctrl_exception_code_kind_default_enable_table[k])
@@ -1763,6 +1782,27 @@ ctrl_initial_debug_info_path_from_module(Arena *arena, CTRL_Handle module_handle
   return result;
 }
 
+internal SS_Key
+ctrl_symbol_store_key_from_module(Arena *arena, CTRL_Handle module_handle)
+{
+  SS_Key result = {0};
+  U64 hash = ctrl_hash_from_handle(module_handle);
+  U64 slot_idx = hash%ctrl_state->module_image_info_cache.slots_count;
+  U64 stripe_idx = slot_idx%ctrl_state->module_image_info_cache.stripes_count;
+  CTRL_ModuleImageInfoCacheSlot *slot = &ctrl_state->module_image_info_cache.slots[slot_idx];
+  CTRL_ModuleImageInfoCacheStripe *stripe = &ctrl_state->module_image_info_cache.stripes[stripe_idx];
+  MutexScopeR(stripe->rw_mutex) for(CTRL_ModuleImageInfoCacheNode *n = slot->first; n != 0; n = n->next)
+  {
+    if(ctrl_handle_match(n->module, module_handle))
+    {
+      result = n->symbol_store_key;
+      result.name = push_str8_copy(arena, n->symbol_store_key.name);
+      break;
+    }
+  }
+  return result;
+}
+
 internal String8
 ctrl_raddbg_data_from_module(Arena *arena, CTRL_Handle module_handle)
 {
@@ -3209,9 +3249,38 @@ ctrl_call_stack_frame_from_unwind_and_inline_depth(CTRL_CallStack *call_stack, U
 internal void
 ctrl_halt(void)
 {
+  ins_atomic_u64_inc_eval(&ctrl_state->halt_request_count);
   dmn_halt(0, 0);
 }
 
+////////////////////////////////
+//~ rjf: Sampling Profiler Functions
+
+internal U64
+ctrl_sample_gen(void)
+{
+  U64 result = 0;
+  MutexScope(ctrl_state->sample_mutex)
+  {
+    result = ctrl_state->sample_gen;
+  }
+  return result;
+}
+
+internal void
+ctrl_sample_profile_clear(void)
+{
+  MutexScope(ctrl_state->sample_mutex)
+  {
+    arena_clear(ctrl_state->sample_arena);
+    MemoryZero(ctrl_state->sample_slots, sizeof(ctrl_state->sample_slots[0])*ctrl_state->sample_slots_count);
+    ctrl_state->sample_root = push_array(ctrl_state->sample_arena, CTRL_SampleNode, 1);
+    ctrl_state->sample_nodes_count = 1;
+    ctrl_state->sample_count = 0;
+    ctrl_state->sample_gen += 1;
+  }
+}
+
 ////////////////////////////////
 //~ rjf: Shared Accessor Functions
 
@@ -3504,6 +3573,7 @@ ctrl_thread__entry_point(void *p)
           case CTRL_MsgKind_Kill:              {ctrl_thread__kill                (ctrl_ctx, msg);}break;
           case CTRL_MsgKind_KillAll:           {ctrl_thread__kill_all            (ctrl_ctx, msg);}break;
           case CTRL_MsgKind_Detach:            {ctrl_thread__detach              (ctrl_ctx, msg);}break;
+          case CTRL_MsgKind_SaveCoreDump:      {ctrl_thread__save_core_dump      (ctrl_ctx, msg);}break;
           case CTRL_MsgKind_Run:               {ctrl_thread__run                 (ctrl_ctx, msg);}break;
           case CTRL_MsgKind_SingleStep:        {ctrl_thread__single_step         (ctrl_ctx, msg);}break;
           
@@ -3750,6 +3820,9 @@ ctrl_thread__module_open(CTRL_Handle process, CTRL_Handle module, Rng1U64 vaddr_
   Guid           pdb_dbg_guid = {0};
   String8        pdb_dbg_path = {0};
 
+  U32 elf_build_id_size = 0;
+  U8  elf_build_id[SS_BUILD_ID_MAX] = {0};
+
   U64         cfi_rebase   = 0;
   B32         is_unwind_eh = 0;
   EH_FrameHdr eh_frame_hdr = {0};
@@ -4001,8 +4074,9 @@ ctrl_thread__module_open(CTRL_Handle process, CTRL_Handle module, Rng1U64 vaddr_
   //
   else if(str8_match(str8(module_sig_bytes, elf_magic_string.size), elf_magic_string, 0))
   {
-    U64      e_entry = 0;
-    ELF_Type e_type  = ELF_Type_None;
+    U64             e_entry   = 0;
+    ELF_Type        e_type    = ELF_Type_None;
+    ELF_MachineKind e_machine = ELF_MachineKind_None;
     {
       U8 *elf_sig = dmn_process_read_raw(scratch.arena, process.dmn_handle, rng_1u64(vaddr_range.min, vaddr_range.min + sizeof(elf_sig[0]) * ELF_Identifier_Max));
       if(elf_sig == 0) { goto elf_exit; }
@@ -4018,8 +4092,9 @@ ctrl_thread__module_open(CTRL_Handle process, CTRL_Handle module, Rng1U64 vaddr_
       {
         ELF_Hdr64 *ehdr = dmn_process_read_raw(scratch.arena, process.dmn_handle, rng_1u64(vaddr_range.min, vaddr_range.min + sizeof(*ehdr)));
         if(ehdr == 0) { goto elf_exit; }
-        e_entry = ehdr->e_entry;
-        e_type  = ehdr->e_type;
+        e_entry   = ehdr->e_entry;
+        e_type    = ehdr->e_type;
+        e_machine = ehdr->e_machine;
       }break;
       }
     }
@@ -4047,12 +4122,28 @@ ctrl_thread__module_open(CTRL_Handle process, CTRL_Handle module, Rng1U64 vaddr_
         for EachIndex(phdr_idx, elf_phcount)
         {
           ELF_Phdr64 *phdr = phdrs64 + phdr_idx;
-          if(phdr->p_type == ELF_PType_GnuEHFrame)
+          if(phdr->p_type == ELF_PType_GnuEHFrame && !is_unwind_eh)
           {
             eh_frame_hdr_vrange = r1u64(cfi_rebase + phdr->p_vaddr, cfi_rebase + phdr->p_vaddr + phdr->p_memsz);
             eh_frame_hdr_data   = dmn_process_read_block(arena, process.dmn_handle, eh_frame_hdr_vrange);
             is_unwind_eh        = 1;
-            break;
+          }
+          
+          // rjf: gather GNU build-id from loaded notes, for symbol store lookups
+          else if(phdr->p_type == ELF_PType_Note && elf_build_id_size == 0)
+          {
+            Rng1U64 note_vrange = r1u64(cfi_rebase + phdr->p_vaddr, cfi_rebase + phdr->p_vaddr + Min(phdr->p_memsz, KB(64)));
+            String8 note_data = dmn_process_read_block(scratch.arena, process.dmn_handle, note_vrange);
+            ELF_NoteList notes = elf_parse_note(scratch.arena, note_data, ELF_Class_64, e_machine);
+            for EachNode(n, ELF_NoteNode, notes.first)
+            {
+              if(n->v.type == GNU_NoteType_BuildId && str8_match(n->v.owner, str8_lit("GNU"), 0))
+              {
+                elf_build_id_size = (U32)Min(n->v.desc.size, sizeof(elf_build_id));
+                MemoryCopy(elf_build_id, n->v.desc.str, elf_build_id_size);
+                break;
+              }
+            }
           }
         }
       }
@@ -4125,6 +4216,48 @@ ctrl_thread__module_open(CTRL_Handle process, CTRL_Handle module, Rng1U64 vaddr_
     }
   }
   
+  //////////////////////////////
+  //- rjf: build symbol store key, for modules whose debug info lives elsewhere
+  //
+  SS_Key symbol_store_key = {0};
+  {
+    // rjf: PE with a PDB70 reference, which wasn't found at any candidate path
+    // -> look up PDB by name/GUID/age
+    if(initial_debug_info_path.size == 0 && pdb_dbg_path.size != 0 && !MemoryIsZeroStruct(&pdb_dbg_guid))
+    {
+      symbol_store_key.kind = SS_KeyKind_PDB;
+      symbol_store_key.guid = pdb_dbg_guid;
+      symbol_store_key.age  = pdb_dbg_age;
+      symbol_store_key.name = push_str8_copy(arena, str8_skip_last_slash(pdb_dbg_path));
+    }
+    
+    // rjf: ELF with a build-id, whose image on disk has no DWARF (i.e. it has
+    // been stripped) -> look up separate debug info by build-id
+    else if(elf_build_id_size != 0)
+    {
+      B32 image_has_dwarf = 0;
+      OS_Handle file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_ShareRead, path);
+      FileProperties props = os_properties_from_file(file);
+      OS_Handle map = os_file_map_open(OS_AccessFlag_Read, file);
+      void *base = os_file_map_view_open(map, OS_AccessFlag_Read, r1u64(0, props.size));
+      if(base != 0)
+      {
+        String8 data = str8((U8 *)base, props.size);
+        ELF_Bin bin = elf_bin_from_data(scratch.arena, data);
+        image_has_dwarf = dw_is_dwarf_present_from_elf_bin(data, &bin);
+        os_file_map_view_close(map, base, r1u64(0, props.size));
+      }
+      os_file_map_close(map);
+      os_file_close(file);
+      if(!image_has_dwarf && !os_handle_match(file, os_handle_zero()))
+      {
+        symbol_store_key.kind = SS_KeyKind_BuildId;
+        symbol_store_key.build_id_size = elf_build_id_size;
+        MemoryCopy(symbol_store_key.build_id, elf_build_id, elf_build_id_size);
+      }
+    }
+  }
+  
   //////////////////////////////
   //- rjf: insert info into cache
   //
@@ -4159,6 +4292,7 @@ ctrl_thread__module_open(CTRL_Handle process, CTRL_Handle module, Rng1U64 vaddr_
         node->eh_ptr_ctx              = eh_ptr_ctx;
         node->entry_point_voff        = entry_point_voff;
         node->initial_debug_info_path = initial_debug_info_path;
+        node->symbol_store_key        = symbol_store_key;
       }
     }
   }
@@ -5268,6 +5402,25 @@ ctrl_thread__detach(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
   ProfEnd();
 }
 
+internal void
+ctrl_thread__save_core_dump(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
+{
+  ProfBeginFunction();
+  
+  //- rjf: the process is stopped whenever the ctrl thread is processing
+  // messages, so we can just snapshot it in place - failures are reported via
+  // the user error log, and nothing about the process' state changes, so no
+  // stop event is needed
+  DMN_CoreFlags flags = 0;
+  if(msg->save_core_flags & CTRL_SaveCoreFlag_Compress)
+  {
+    flags |= DMN_CoreFlag_Compress;
+  }
+  dmn_ctrl_save_core(ctrl_ctx, msg->entity.dmn_handle, msg->path, flags);
+  
+  ProfEnd();
+}
+
 internal void
 ctrl_thread__run(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
 {
@@ -5280,6 +5433,7 @@ ctrl_thread__run(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
   CTRL_Handle target_process = msg->parent;
   CTRL_Entity *target_process_entity = ctrl_entity_from_handle(entity_ctx, target_process);
   U64 spoof_ip_vaddr = 911;
+  U64 run_halt_request_count = ins_atomic_u64_eval(&ctrl_state->halt_request_count);
   log_infof("ctrl_thread__run:\n{\n");
   
   //////////////////////////////
@@ -5502,6 +5656,23 @@ ctrl_thread__run(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
     ctrl_c2u_push_events(&evts);
   }
   
+  //////////////////////////////
+  //- rjf: begin sampling, if this is a sampling run
+  //
+  // The sampler thread periodically halts all attached processes; those
+  // halts are absorbed by the run loop below, which records every thread's
+  // call stack & resumes. The time spent halted is kept within the requested
+  // overhead percentage by pushing out the next halt as needed.
+  //
+  B32 sampling = (stop_event == 0 && !!(msg->run_flags & CTRL_RunFlag_Sample));
+  U64 sample_interval_us = (msg->sample_interval_us != 0 ? msg->sample_interval_us : CTRL_SAMPLE_DEFAULT_INTERVAL_US);
+  U64 sample_overhead_pct = Clamp(1, (msg->sample_overhead_pct != 0 ? msg->sample_overhead_pct : CTRL_SAMPLE_DEFAULT_OVERHEAD_PCT), 100);
+  if(sampling)
+  {
+    log_infof("sampling: interval %I64u us, overhead %I64u%%\n", sample_interval_us, sample_overhead_pct);
+    ctrl_thread__sampler_begin(sample_interval_us);
+  }
+  
   //////////////////////////////
   //- rjf: run loop
   //
@@ -5570,13 +5741,42 @@ ctrl_thread__run(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
       {
         default:{}break;
         case DMN_EventKind_Error:
-        case DMN_EventKind_Halt:
         case DMN_EventKind_SingleStep:
         case DMN_EventKind_Trap:
         {
           hard_stop = 1;
           log_infof("step_rule: unexpected -> hard_stop\n");
         }break;
+        case DMN_EventKind_Halt:
+        {
+          // NOTE(rjf): any halt consumes an outstanding sampler halt, since
+          // the demon coalesces halt requests. if nobody else asked for a halt
+          // since this run began, then this halt was the sampler's.
+          B32 is_sampler_halt = (ins_atomic_u64_eval_assign(&ctrl_state->sample_halt_pending, 0) != 0 &&
+                                 ins_atomic_u64_eval(&ctrl_state->halt_request_count) == run_halt_request_count);
+          if(is_sampler_halt)
+          {
+            if(sampling)
+            {
+              ctrl_thread__record_samples();
+              U64 sample_end_us = os_now_microseconds();
+              U64 sample_begin_us = ins_atomic_u64_eval(&ctrl_state->sample_halt_issue_us);
+              U64 sample_cost_us = (sample_begin_us != 0 && sample_begin_us < sample_end_us) ? (sample_end_us - sample_begin_us) : 0;
+              U64 wait_us = Max(sample_interval_us, sample_cost_us*100/sample_overhead_pct);
+              MutexScope(ctrl_state->sample_thread_mutex)
+              {
+                ins_atomic_u64_eval_assign(&ctrl_state->sample_next_halt_us, sample_end_us + wait_us);
+                cond_var_broadcast(ctrl_state->sample_thread_cv);
+              }
+            }
+            log_infof("step_rule: sampler halt -> record samples, keep running\n");
+          }
+          else
+          {
+            hard_stop = 1;
+            log_infof("step_rule: halt -> hard_stop\n");
+          }
+        }break;
         case DMN_EventKind_Exception:
         case DMN_EventKind_Breakpoint:
         {
@@ -6333,6 +6533,14 @@ ctrl_thread__run(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
     }
   }
   
+  //////////////////////////////
+  //- rjf: end sampling
+  //
+  if(sampling)
+  {
+    ctrl_thread__sampler_end();
+  }
+  
   //////////////////////////////
   //- rjf: record stop
   //
@@ -6439,6 +6647,239 @@ ctrl_thread__single_step(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg)
   ProfEnd();
 }
 
+//- rjf: sampling profiler
+
+internal void
+ctrl_sample_thread__entry_point(void *p)
+{
+  ThreadNameF("ctrl_sample_thread");
+  MutexScope(ctrl_state->sample_thread_mutex) for(;ctrl_state->sample_thread_active;)
+  {
+    U64 now_us = os_now_microseconds();
+    U64 next_halt_us = ins_atomic_u64_eval(&ctrl_state->sample_next_halt_us);
+    U64 halt_issue_us = ins_atomic_u64_eval(&ctrl_state->sample_halt_issue_us);
+    B32 halt_pending = (ins_atomic_u64_eval(&ctrl_state->sample_halt_pending) != 0);
+    
+    // rjf: time for the next sample -> halt all processes; the control thread
+    // will take the sample & resume them when it receives the halt event
+    if(!halt_pending && next_halt_us <= now_us)
+    {
+      ins_atomic_u64_eval_assign(&ctrl_state->sample_halt_issue_us, now_us);
+      ins_atomic_u64_eval_assign(&ctrl_state->sample_halt_pending, 1);
+      dmn_halt(0, 0);
+    }
+    
+    // rjf: halt outstanding for a long time -> the request may have been
+    // dropped (e.g. raced with process creation), so re-issue it. the demon
+    // ignores redundant halt requests.
+    else if(halt_pending && halt_issue_us + 1000000 <= now_us)
+    {
+      ins_atomic_u64_eval_assign(&ctrl_state->sample_halt_issue_us, now_us);
+      dmn_halt(0, 0);
+    }
+    
+    // rjf: otherwise -> sleep until there's something to do
+    else
+    {
+      U64 wait_endt_us = halt_pending ? halt_issue_us + 1000000 : next_halt_us;
+      cond_var_wait(ctrl_state->sample_thread_cv, ctrl_state->sample_thread_mutex, wait_endt_us);
+    }
+  }
+}
+
+internal void
+ctrl_thread__sampler_begin(U64 interval_us)
+{
+  MutexScope(ctrl_state->sample_thread_mutex)
+  {
+    ctrl_state->sample_thread_active = 1;
+    ctrl_state->sample_interval_us = interval_us;
+    ins_atomic_u64_eval_assign(&ctrl_state->sample_next_halt_us, os_now_microseconds() + interval_us);
+  }
+  ctrl_state->sample_thread = thread_launch(ctrl_sample_thread__entry_point, 0);
+}
+
+internal void
+ctrl_thread__sampler_end(void)
+{
+  MutexScope(ctrl_state->sample_thread_mutex)
+  {
+    ctrl_state->sample_thread_active = 0;
+    cond_var_broadcast(ctrl_state->sample_thread_cv);
+  }
+  thread_join(ctrl_state->sample_thread, max_U64);
+  MemoryZeroStruct(&ctrl_state->sample_thread);
+}
+
+internal U64
+ctrl_thread__sample_unwind(Arch arch, CTRL_Entity *process, DMN_Handle thread, U64 *vaddrs_out, U64 vaddrs_cap)
+{
+  // NOTE(rjf): this is a deliberately simple & fast frame-pointer walk, which
+  // reads the stack directly from the demon. the full unwinder reads memory
+  // through the process memory cache, which is allowed to return stale pages
+  // while the target is running, and which is too slow to hit at sampling
+  // rates. for code compiled without frame pointers, this will only produce
+  // the leaf-most frames - which is still enough for a flat profile.
+  //
+  // return addresses are recorded minus one, so that they symbolize to the
+  // call instruction, rather than to whatever follows it.
+  Temp scratch = scratch_begin(0, 0);
+  U64 count = 0;
+  U64 regs_size = regs_block_size_from_arch(arch);
+  U64 addr_size = bit_size_from_arch(arch)/8;
+  void *regs = push_array(scratch.arena, U8, regs_size);
+  if(regs_size != 0 && addr_size != 0 && vaddrs_cap != 0 && dmn_thread_read_reg_block(thread, regs))
+  {
+    U64 ip = regs_rip_from_arch_block(arch, regs);
+    U64 sp = regs_rsp_from_arch_block(arch, regs);
+    U64 fp = 0;
+    switch(arch)
+    {
+      default:{}break;
+      case Arch_x64:{fp = ((REGS_RegBlockX64 *)regs)->rbp.u64;}break;
+      case Arch_x86:{fp = (U64)((REGS_RegBlockX86 *)regs)->ebp.u32;}break;
+    }
+    U64 stack_base = dmn_stack_base_vaddr_from_thread(thread);
+    if(ip != 0)
+    {
+      vaddrs_out[count] = ip;
+      count += 1;
+    }
+    
+    // rjf: walk frame records: [saved frame pointer, return address]
+    for(;count < vaddrs_cap;)
+    {
+      if(fp < sp || fp % addr_size != 0 || (stack_base != 0 && fp + 2*addr_size > stack_base))
+      {
+        break;
+      }
+      U64 record[2] = {0};
+      if(addr_size == 8)
+      {
+        if(dmn_process_read(process->handle.dmn_handle, r1u64(fp, fp+16), record) != 16) { break; }
+      }
+      else
+      {
+        U32 record32[2] = {0};
+        if(dmn_process_read(process->handle.dmn_handle, r1u64(fp, fp+8), record32) != 8) { break; }
+        record[0] = record32[0];
+        record[1] = record32[1];
+      }
+      U64 next_fp = record[0];
+      U64 return_vaddr = record[1];
+      if(return_vaddr == 0 || ctrl_module_from_process_vaddr(process, return_vaddr) == &ctrl_entity_nil)
+      {
+        break;
+      }
+      vaddrs_out[count] = return_vaddr - 1;
+      count += 1;
+      if(next_fp <= fp)
+      {
+        break;
+      }
+      sp = fp + 2*addr_size;
+      fp = next_fp;
+    }
+  }
+  scratch_end(scratch);
+  return count;
+}
+
+internal void
+ctrl_thread__record_samples(void)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  CTRL_EntityCtx *entity_ctx = &ctrl_state->ctrl_thread_entity_store->ctx;
+  
+  //- rjf: unwind all running threads
+  typedef struct SampleStackNode SampleStackNode;
+  struct SampleStackNode
+  {
+    SampleStackNode *next;
+    CTRL_Handle process;
+    U64 *vaddrs;
+    U64 vaddrs_count;
+  };
+  SampleStackNode *first_stack = 0;
+  SampleStackNode *last_stack = 0;
+  CTRL_EntityArray threads = ctrl_entity_array_from_kind(entity_ctx, CTRL_EntityKind_Thread);
+  for EachIndex(idx, threads.count)
+  {
+    CTRL_Entity *thread = threads.v[idx];
+    if(thread->is_frozen)
+    {
+      continue;
+    }
+    CTRL_Entity *process = ctrl_process_from_entity(thread);
+    U64 *vaddrs = push_array_no_zero(scratch.arena, U64, CTRL_SAMPLE_MAX_FRAMES);
+    U64 vaddrs_count = ctrl_thread__sample_unwind(thread->arch, process, thread->handle.dmn_handle, vaddrs, CTRL_SAMPLE_MAX_FRAMES);
+    if(vaddrs_count != 0)
+    {
+      SampleStackNode *n = push_array(scratch.arena, SampleStackNode, 1);
+      n->process = process->handle;
+      n->vaddrs = vaddrs;
+      n->vaddrs_count = vaddrs_count;
+      SLLQueuePush(first_stack, last_stack, n);
+    }
+  }
+  
+  //- rjf: merge stacks into sample tree, outermost frame first
+  MutexScope(ctrl_state->sample_mutex)
+  {
+    for EachNode(n, SampleStackNode, first_stack)
+    {
+      CTRL_SampleNode *node = ctrl_state->sample_root;
+      node->total_count += 1;
+      for(U64 frame_num = n->vaddrs_count; frame_num > 0; frame_num -= 1)
+      {
+        U64 vaddr = n->vaddrs[frame_num-1];
+        struct
+        {
+          CTRL_SampleNode *parent;
+          CTRL_Handle process;
+          U64 vaddr;
+        }
+        key;
+        MemoryZeroStruct(&key);
+        key.parent = node;
+        key.process = n->process;
+        key.vaddr = vaddr;
+        U64 hash = u64_hash_from_str8(str8_struct(&key));
+        U64 slot_idx = hash%ctrl_state->sample_slots_count;
+        CTRL_SampleNode *child = 0;
+        for(CTRL_SampleNode *c = ctrl_state->sample_slots[slot_idx]; c != 0; c = c->hash_next)
+        {
+          if(c->parent == node && c->vaddr == vaddr && ctrl_handle_match(c->process, n->process))
+          {
+            child = c;
+            break;
+          }
+        }
+        if(child == 0)
+        {
+          child = push_array(ctrl_state->sample_arena, CTRL_SampleNode, 1);
+          child->parent = node;
+          child->idx = ctrl_state->sample_nodes_count;
+          child->process = n->process;
+          child->vaddr = vaddr;
+          SLLStackPush_N(ctrl_state->sample_slots[slot_idx], child, hash_next);
+          SLLStackPush(node->first, child);
+          ctrl_state->sample_nodes_count += 1;
+        }
+        child->total_count += 1;
+        node = child;
+      }
+      node->self_count += 1;
+      ctrl_state->sample_count += 1;
+    }
+    ctrl_state->sample_gen += 1;
+  }
+  
+  scratch_end(scratch);
+  ProfEnd();
+}
+
 ////////////////////////////////
 //~ rjf: Process Memory Artifact Cache Hooks / Lookups
 
@@ -6832,6 +7273,411 @@ ctrl_process_write(CTRL_Handle process, Rng1U64 range, void *src)
   return result;
 }
 
+////////////////////////////////
+//~ rjf: Process Memory Search Artifact Cache Hooks / Lookups
+
+//- rjf: search kernel
+
+internal B32
+ctrl_memory_search_pattern_match(U8 *data, U8 *pattern, U8 *mask, U64 pattern_size)
+{
+  B32 result = 1;
+  for EachIndex(idx, pattern_size)
+  {
+    if((data[idx] ^ pattern[idx]) & mask[idx])
+    {
+      result = 0;
+      break;
+    }
+  }
+  return result;
+}
+
+internal U64
+ctrl_memory_search_hits_from_data(U8 *data, U64 data_size, U64 scan_size, U8 *pattern, U8 *mask, U64 pattern_size, U64 base_vaddr, U64 align, U64 *hits_out, U64 hits_cap)
+{
+  U64 hits_count = 0;
+  if(pattern_size != 0 && data_size >= pattern_size)
+  {
+    U64 positions_count = Min(scan_size, data_size - pattern_size + 1);
+    
+    //- rjf: pick the first & last fully-masked bytes as anchors - candidates
+    // must match both, which rejects most positions even for common bytes
+    U64 anchor_first = max_U64;
+    U64 anchor_last = max_U64;
+    for EachIndex(idx, pattern_size)
+    {
+      if(mask[idx] == 0xff)
+      {
+        if(anchor_first == max_U64) { anchor_first = idx; }
+        anchor_last = idx;
+      }
+    }
+    
+    //- rjf: scan 16 positions at a time for anchor matches
+    U64 pos = 0;
+#if ARCH_X64
+    if(anchor_first != max_U64)
+    {
+      __m128i first = _mm_set1_epi8((char)pattern[anchor_first]);
+      __m128i last  = _mm_set1_epi8((char)pattern[anchor_last]);
+      for(; pos+16 <= positions_count && hits_count < hits_cap; pos += 16)
+      {
+        __m128i first_eq = _mm_cmpeq_epi8(first, _mm_loadu_si128((__m128i *)(data + pos + anchor_first)));
+        __m128i last_eq  = _mm_cmpeq_epi8(last,  _mm_loadu_si128((__m128i *)(data + pos + anchor_last)));
+        U32 candidates = (U32)_mm_movemask_epi8(_mm_and_si128(first_eq, last_eq));
+        for(;candidates != 0 && hits_count < hits_cap; candidates &= candidates-1)
+        {
+          U64 hit_pos = pos + ctz32(candidates);
+          if(ctrl_memory_search_pattern_match(data + hit_pos, pattern, mask, pattern_size) &&
+             (align <= 1 || (base_vaddr + hit_pos)%align == 0))
+          {
+            hits_out[hits_count] = base_vaddr + hit_pos;
+            hits_count += 1;
+          }
+        }
+      }
+    }
+#endif
+    
+    //- rjf: scalar tail (or everything, if no byte is fully masked)
+    for(; pos < positions_count && hits_count < hits_cap; pos += 1)
+    {
+      if((anchor_first == max_U64 || data[pos+anchor_first] == pattern[anchor_first]) &&
+         ctrl_memory_search_pattern_match(data + pos, pattern, mask, pattern_size) &&
+         (align <= 1 || (base_vaddr + pos)%align == 0))
+      {
+        hits_out[hits_count] = base_vaddr + pos;
+        hits_count += 1;
+      }
+    }
+  }
+  return hits_count;
+}
+
+//- rjf: readable ranges
+
+internal AC_Artifact
+ctrl_readable_ranges_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  Temp scratch = scratch_begin(0, 0);
+  CTRL_Handle process = {0};
+  str8_deserial_read_struct(key, 0, &process);
+  U64 pre_mem_gen = ctrl_mem_gen();
+  DMN_MemoryRegionArray regions = dmn_process_memory_regions(scratch.arena, process.dmn_handle);
+  
+  //- rjf: gather readable regions, merging adjacent ones, so that searches
+  // can find matches which straddle region boundaries
+  Arena *arena = arena_alloc();
+  Rng1U64Array *ranges = push_array(arena, Rng1U64Array, 1);
+  ranges->v = push_array(arena, Rng1U64, regions.count);
+  for EachIndex(idx, regions.count)
+  {
+    DMN_MemoryRegion *region = &regions.v[idx];
+    if(!(region->flags & OS_AccessFlag_Read) || region->vaddr_range.max <= region->vaddr_range.min)
+    {
+      continue;
+    }
+    if(ranges->count != 0 && ranges->v[ranges->count-1].max == region->vaddr_range.min)
+    {
+      ranges->v[ranges->count-1].max = region->vaddr_range.max;
+    }
+    else
+    {
+      ranges->v[ranges->count] = region->vaddr_range;
+      ranges->count += 1;
+    }
+  }
+  gen_out[0] = pre_mem_gen;
+  AC_Artifact artifact = {0};
+  artifact.u64[0] = (U64)arena;
+  artifact.u64[1] = (U64)ranges;
+  scratch_end(scratch);
+  return artifact;
+}
+
+internal void
+ctrl_readable_ranges_artifact_destroy(AC_Artifact artifact)
+{
+  Arena *arena = (Arena *)artifact.u64[0];
+  if(arena != 0)
+  {
+    arena_release(arena);
+  }
+}
+
+internal Rng1U64Array
+ctrl_readable_ranges_from_process(Access *access, CTRL_Handle process, U64 endt_us)
+{
+  Rng1U64Array result = {0};
+  AC_Artifact artifact = ac_artifact_from_key(access, str8_struct(&process), ctrl_readable_ranges_artifact_create, ctrl_readable_ranges_artifact_destroy, endt_us,
+                                              .gen = ctrl_mem_gen(),
+                                              .evict_threshold_us = 10000000);
+  if(artifact.u64[1] != 0)
+  {
+    MemoryCopyStruct(&result, (Rng1U64Array *)artifact.u64[1]);
+  }
+  return result;
+}
+
+//- rjf: searches
+
+internal AC_Artifact
+ctrl_memory_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  
+  //- rjf: unpack key
+  CTRL_Handle process = {0};
+  U64 align = 0;
+  String8 pattern = {0};
+  String8 mask = {0};
+  U64 ranges_count = 0;
+  CTRL_MemorySearchRange *ranges = 0;
+  {
+    U64 key_read_off = 0;
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &process);
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &align);
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &pattern.size);
+    key_read_off += str8_deserial_read_block(key, key_read_off, pattern.size, &pattern);
+    key_read_off += str8_deserial_read_block(key, key_read_off, pattern.size, &mask);
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &ranges_count);
+    ranges = push_array(scratch.arena, CTRL_MemorySearchRange, ranges_count);
+    key_read_off += str8_deserial_read_array(key, key_read_off, ranges, ranges_count);
+  }
+  
+  //- rjf: split ranges into blocks
+  U64 blocks_count = 0;
+  CTRL_MemorySearchRange *blocks = 0;
+  if(lane_idx() == 0)
+  {
+    for EachIndex(idx, ranges_count)
+    {
+      blocks_count += (dim_1u64(ranges[idx].vaddr_range) + CTRL_MEMORY_SEARCH_BLOCK_SIZE-1) / CTRL_MEMORY_SEARCH_BLOCK_SIZE;
+    }
+    blocks = push_array(scratch.arena, CTRL_MemorySearchRange, blocks_count);
+    U64 block_idx = 0;
+    for EachIndex(idx, ranges_count)
+    {
+      for(U64 off = ranges[idx].vaddr_range.min; off < ranges[idx].vaddr_range.max; off += CTRL_MEMORY_SEARCH_BLOCK_SIZE, block_idx += 1)
+      {
+        blocks[block_idx].vaddr_range = r1u64(off, Min(off + CTRL_MEMORY_SEARCH_BLOCK_SIZE, ranges[idx].vaddr_range.max));
+        blocks[block_idx].read_opl = ranges[idx].read_opl;
+      }
+    }
+  }
+  lane_sync_u64(&blocks_count, 0);
+  lane_sync_u64(&blocks, 0);
+  
+  //- rjf: set up per-lane hits
+  U64 **lanes_hits = 0;
+  U64 *lanes_hits_counts = 0;
+  if(lane_idx() == 0)
+  {
+    lanes_hits = push_array(scratch.arena, U64 *, lane_count());
+    lanes_hits_counts = push_array(scratch.arena, U64, lane_count());
+  }
+  lane_sync_u64(&lanes_hits, 0);
+  lane_sync_u64(&lanes_hits_counts, 0);
+  
+  //- rjf: read & scan this lane's contiguous run of blocks, a batch at a time,
+  // so lane results concatenate in address order
+  ProfScope("search %I64u blocks", blocks_count)
+  {
+    U64 hits_cap = CTRL_MEMORY_SEARCH_CHUNK_HITS_MAX;
+    U64 *hits = push_array_no_zero(scratch.arena, U64, hits_cap);
+    U64 hits_count = 0;
+    U64 block_stride = CTRL_MEMORY_SEARCH_BLOCK_SIZE + pattern.size;
+    U8 *buffer = push_array_no_zero(scratch.arena, U8, block_stride*CTRL_MEMORY_SEARCH_BATCH_COUNT);
+    Rng1U64 range = lane_range(blocks_count);
+    for(U64 batch_base = range.min; batch_base < range.max && hits_count < hits_cap; batch_base += CTRL_MEMORY_SEARCH_BATCH_COUNT)
+    {
+      if(ins_atomic_u32_eval(cancel_signal))
+      {
+        break;
+      }
+      U64 batch_count = Min(range.max - batch_base, CTRL_MEMORY_SEARCH_BATCH_COUNT);
+      Rng1U64 read_ranges[CTRL_MEMORY_SEARCH_BATCH_COUNT];
+      void *read_dsts[CTRL_MEMORY_SEARCH_BATCH_COUNT];
+      U64 read_sizes[CTRL_MEMORY_SEARCH_BATCH_COUNT];
+      for EachIndex(idx, batch_count)
+      {
+        CTRL_MemorySearchRange *block = &blocks[batch_base + idx];
+        read_ranges[idx] = r1u64(block->vaddr_range.min, Min(block->vaddr_range.max + pattern.size - 1, block->read_opl));
+        read_dsts[idx] = buffer + idx*block_stride;
+      }
+      dmn_process_read_batch(process.dmn_handle, batch_count, read_ranges, read_dsts, read_sizes);
+      for EachIndex(idx, batch_count)
+      {
+        CTRL_MemorySearchRange *block = &blocks[batch_base + idx];
+        hits_count += ctrl_memory_search_hits_from_data((U8 *)read_dsts[idx], read_sizes[idx], dim_1u64(block->vaddr_range),
+                                                        pattern.str, mask.str, pattern.size,
+                                                        block->vaddr_range.min, align,
+                                                        hits + hits_count, hits_cap - hits_count);
+      }
+    }
+    lanes_hits[lane_idx()] = hits;
+    lanes_hits_counts[lane_idx()] = hits_count;
+  }
+  lane_sync();
+  
+  //- rjf: join lanes' hits; drop everything if cancelled
+  CTRL_MemorySearchChunk *chunk = 0;
+  if(lane_idx() == 0 && !ins_atomic_u32_eval(cancel_signal))
+  {
+    Arena *arena = arena_alloc();
+    chunk = push_array(arena, CTRL_MemorySearchChunk, 1);
+    chunk->arena = arena;
+    U64 total_count = 0;
+    for EachIndex(idx, lane_count())
+    {
+      total_count += lanes_hits_counts[idx];
+      chunk->truncated = (chunk->truncated || lanes_hits_counts[idx] == CTRL_MEMORY_SEARCH_CHUNK_HITS_MAX);
+    }
+    chunk->vaddrs = push_array_no_zero(arena, U64, Min(total_count, CTRL_MEMORY_SEARCH_CHUNK_HITS_MAX));
+    for EachIndex(idx, lane_count())
+    {
+      U64 copy_count = Min(lanes_hits_counts[idx], CTRL_MEMORY_SEARCH_CHUNK_HITS_MAX - chunk->count);
+      MemoryCopy(chunk->vaddrs + chunk->count, lanes_hits[idx], sizeof(U64)*copy_count);
+      chunk->count += copy_count;
+    }
+    chunk->truncated = (chunk->truncated || chunk->count < total_count);
+  }
+  lane_sync_u64(&chunk, 0);
+  
+  //- rjf: broadcast update
+  if(lane_idx() == 0 && chunk != 0 && ctrl_state->wakeup_hook != 0)
+  {
+    ctrl_state->wakeup_hook();
+  }
+  
+  AC_Artifact artifact = {0};
+  artifact.u64[0] = (U64)chunk;
+  scratch_end(scratch);
+  ProfEnd();
+  return artifact;
+}
+
+internal void
+ctrl_memory_search_artifact_destroy(AC_Artifact artifact)
+{
+  CTRL_MemorySearchChunk *chunk = (CTRL_MemorySearchChunk *)artifact.u64[0];
+  if(chunk != 0)
+  {
+    arena_release(chunk->arena);
+  }
+}
+
+internal CTRL_MemorySearchResults
+ctrl_memory_search_results_from_process(Arena *arena, Access *access, CTRL_Handle process, CTRL_MemorySearchParams *params, U64 endt_us)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(&arena, 1);
+  CTRL_MemorySearchResults results = {0};
+  
+  //- rjf: unpack params; fill out mask
+  String8 pattern = params->pattern;
+  String8 mask = push_str8_copy(scratch.arena, params->mask);
+  if(mask.size != pattern.size)
+  {
+    mask.str = push_array_no_zero(scratch.arena, U8, pattern.size);
+    mask.size = pattern.size;
+    MemorySet(mask.str, 0xff, mask.size);
+    MemoryCopy(mask.str, params->mask.str, Min(params->mask.size, mask.size));
+  }
+  
+  //- rjf: gather readable ranges
+  Rng1U64Array ranges = {0};
+  if(pattern.size != 0)
+  {
+    ranges = ctrl_readable_ranges_from_process(access, process, endt_us);
+  }
+  for EachIndex(idx, ranges.count)
+  {
+    results.total_size += dim_1u64(ranges.v[idx]);
+  }
+  
+  //- rjf: split ranges into fixed-size chunks, & gather all finished chunks
+  U64 chunks_count = (results.total_size + CTRL_MEMORY_SEARCH_CHUNK_SIZE-1) / CTRL_MEMORY_SEARCH_CHUNK_SIZE;
+  CTRL_MemorySearchChunk **chunks = push_array(scratch.arena, CTRL_MemorySearchChunk *, chunks_count);
+  Rng1U64List pending_ranges = {0};
+  U64 hits_count = 0;
+  {
+    U64 range_idx = 0;
+    U64 range_off = 0;
+    for EachIndex(chunk_idx, chunks_count)
+    {
+      // rjf: build chunk key
+      String8List srl = {0};
+      str8_serial_begin(scratch.arena, &srl);
+      str8_serial_push_struct(scratch.arena, &srl, &process);
+      str8_serial_push_struct(scratch.arena, &srl, &params->align);
+      str8_serial_push_struct(scratch.arena, &srl, &pattern.size);
+      str8_serial_push_data(scratch.arena, &srl, pattern.str, pattern.size);
+      str8_serial_push_data(scratch.arena, &srl, mask.str, mask.size);
+      U64 *chunk_ranges_count = (U64 *)str8_serial_push_size(scratch.arena, &srl, sizeof(U64));
+      chunk_ranges_count[0] = 0;
+      U64 chunk_size = 0;
+      Rng1U64 chunk_span = {max_U64, 0};
+      for(;chunk_size < CTRL_MEMORY_SEARCH_CHUNK_SIZE && range_idx < ranges.count;)
+      {
+        Rng1U64 range = ranges.v[range_idx];
+        U64 piece_size = Min(dim_1u64(range) - range_off, CTRL_MEMORY_SEARCH_CHUNK_SIZE - chunk_size);
+        CTRL_MemorySearchRange piece = {r1u64(range.min + range_off, range.min + range_off + piece_size), range.max};
+        str8_serial_push_struct(scratch.arena, &srl, &piece);
+        chunk_ranges_count[0] += 1;
+        chunk_span = union_1u64(chunk_span, piece.vaddr_range);
+        chunk_size += piece_size;
+        range_off += piece_size;
+        if(range_off == dim_1u64(range))
+        {
+          range_idx += 1;
+          range_off = 0;
+        }
+      }
+      String8 key = str8_serial_end(scratch.arena, &srl);
+      
+      // rjf: chunk key -> results
+      AC_Artifact artifact = ac_artifact_from_key(access, key, ctrl_memory_search_artifact_create, ctrl_memory_search_artifact_destroy, endt_us,
+                                                  .flags = AC_Flag_Wide,
+                                                  .gen = ctrl_mem_gen(),
+                                                  .slots_count = 1024,
+                                                  .evict_threshold_us = 1000000);
+      chunks[chunk_idx] = (CTRL_MemorySearchChunk *)artifact.u64[0];
+      if(chunks[chunk_idx] != 0)
+      {
+        results.searched_size += chunk_size;
+        results.truncated = (results.truncated || chunks[chunk_idx]->truncated);
+        hits_count += chunks[chunk_idx]->count;
+      }
+      else
+      {
+        rng1u64_list_push(scratch.arena, &pending_ranges, chunk_span);
+      }
+    }
+  }
+  results.pending_ranges = rng1u64_array_from_list(arena, &pending_ranges);
+  
+  //- rjf: join finished chunks' hits
+  results.vaddrs = push_array_no_zero(arena, U64, Min(hits_count, CTRL_MEMORY_SEARCH_HITS_MAX));
+  for EachIndex(chunk_idx, chunks_count)
+  {
+    CTRL_MemorySearchChunk *chunk = chunks[chunk_idx];
+    if(chunk != 0)
+    {
+      U64 copy_count = Min(chunk->count, CTRL_MEMORY_SEARCH_HITS_MAX - results.count);
+      MemoryCopy(results.vaddrs + results.count, chunk->vaddrs, sizeof(U64)*copy_count);
+      results.count += copy_count;
+    }
+  }
+  results.truncated = (results.truncated || results.count < hits_count);
+  
+  scratch_end(scratch);
+  ProfEnd();
+  return results;
+}
+
 ////////////////////////////////
 //~ rjf: Call Stack Artifact Cache Hooks / Lookups
 
@@ -7177,3 +8023,232 @@ ctrl_call_stack_tree(Access *access, U64 endt_us)
   }
   return result;
 }
+
+////////////////////////////////
+//~ rjf: Sample Tree Artifact Cache Hooks / Lookups
+
+internal AC_Artifact
+ctrl_sample_tree_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  Temp scratch = scratch_begin(0, 0);
+  Access *access = access_open();
+  
+  //- rjf: copy out raw sample nodes, indexed by creation order (parents
+  // are always created before their children)
+  U64 raw_count = 0;
+  U64 sample_count = 0;
+  CTRL_SampleNode *raw_nodes = 0;
+  U64 *raw_parent_idxs = 0;
+  MutexScope(ctrl_state->sample_mutex)
+  {
+    raw_count = ctrl_state->sample_nodes_count;
+    sample_count = ctrl_state->sample_count;
+    raw_nodes = push_array(scratch.arena, CTRL_SampleNode, raw_count);
+    raw_parent_idxs = push_array(scratch.arena, U64, raw_count);
+    raw_nodes[0] = *ctrl_state->sample_root;
+    for EachIndex(slot_idx, ctrl_state->sample_slots_count)
+    {
+      for(CTRL_SampleNode *n = ctrl_state->sample_slots[slot_idx]; n != 0; n = n->hash_next)
+      {
+        raw_nodes[n->idx] = *n;
+        raw_parent_idxs[n->idx] = n->parent->idx;
+      }
+    }
+  }
+  
+  //- rjf: map raw addresses to debug info keys & voffs
+  DI_Key *raw_dbgi_keys = push_array(scratch.arena, DI_Key, raw_count);
+  U64 *raw_voffs = push_array(scratch.arena, U64, raw_count);
+  MutexScopeR(ctrl_state->ctrl_thread_entity_ctx_rw_mutex)
+  {
+    CTRL_EntityCtx *ctx = &ctrl_state->ctrl_thread_entity_store->ctx;
+    for(U64 idx = 1; idx < raw_count; idx += 1)
+    {
+      CTRL_Entity *process = ctrl_entity_from_handle(ctx, raw_nodes[idx].process);
+      CTRL_Entity *module = ctrl_module_from_process_vaddr(process, raw_nodes[idx].vaddr);
+      if(module != &ctrl_entity_nil)
+      {
+        raw_dbgi_keys[idx] = ctrl_dbgi_key_from_module(module);
+        raw_voffs[idx] = ctrl_voff_from_vaddr(module, raw_nodes[idx].vaddr);
+      }
+    }
+  }
+  
+  //- rjf: build symbolized tree - each raw frame expands to a procedure node,
+  // followed by one node per inline site, outermost to innermost
+  Arena *arena = arena_alloc();
+  CTRL_SampleTree *tree = push_array(arena, CTRL_SampleTree, 1);
+  U64 id_gen = 0;
+  tree->root = push_array(arena, CTRL_SampleTreeNode, 1);
+  MemoryCopyStruct(tree->root, &ctrl_sample_tree_node_nil);
+  tree->root->id = id_gen;
+  tree->root->total_count = raw_nodes[0].total_count;
+  tree->root->self_count = raw_nodes[0].self_count;
+  tree->slots_count = Max(1, raw_count);
+  tree->slots = push_array(arena, CTRL_SampleTreeNode *, tree->slots_count);
+  tree->sample_count = sample_count;
+  id_gen += 1;
+  CTRL_SampleTreeNode **raw_leaf_nodes = push_array(scratch.arena, CTRL_SampleTreeNode *, raw_count);
+  raw_leaf_nodes[0] = tree->root;
+  for(U64 idx = 1; idx < raw_count && !ins_atomic_u32_eval(cancel_signal); idx += 1)
+  {
+    typedef struct ChainLink ChainLink;
+    struct ChainLink
+    {
+      ChainLink *next;
+      U64 procedure_idx;
+      U64 inline_site_idx;
+      String8 name;
+    };
+    ChainLink *first_link = 0;
+    ChainLink *last_link = 0;
+    
+    //- rjf: symbolize raw frame
+    CTRL_SampleNode *raw = &raw_nodes[idx];
+    DI_Key dbgi_key = raw_dbgi_keys[idx];
+    RDI_Parsed *rdi = di_rdi_from_key(access, dbgi_key, 0, 0);
+    RDI_Scope *scope = rdi_scope_from_voff(rdi, raw_voffs[idx]);
+    RDI_Procedure *procedure = rdi_procedure_from_scope(rdi, scope);
+    if(scope->proc_idx != 0)
+    {
+      ChainLink *proc_link = push_array(scratch.arena, ChainLink, 1);
+      proc_link->procedure_idx = scope->proc_idx;
+      proc_link->name.str = rdi_name_from_procedure(rdi, procedure, &proc_link->name.size);
+      SLLQueuePush(first_link, last_link, proc_link);
+      ChainLink *first_inline_link = 0;
+      for(RDI_Scope *s = scope;
+          s->inline_site_idx != 0;
+          s = rdi_element_from_name_idx(rdi, Scopes, s->parent_scope_idx))
+      {
+        RDI_InlineSite *inline_site = rdi_element_from_name_idx(rdi, InlineSites, s->inline_site_idx);
+        ChainLink *inline_link = push_array(scratch.arena, ChainLink, 1);
+        inline_link->procedure_idx = scope->proc_idx;
+        inline_link->inline_site_idx = s->inline_site_idx;
+        inline_link->name.str = rdi_string_from_idx(rdi, inline_site->name_string_idx, &inline_link->name.size);
+        SLLStackPush(first_inline_link, inline_link);
+      }
+      proc_link->next = first_inline_link;
+    }
+    else
+    {
+      ChainLink *addr_link = push_array(scratch.arena, ChainLink, 1);
+      SLLQueuePush(first_link, last_link, addr_link);
+    }
+    
+    //- rjf: insert chain below parent
+    CTRL_SampleTreeNode *node = raw_leaf_nodes[raw_parent_idxs[idx]];
+    for EachNode(link, ChainLink, first_link)
+    {
+      B32 is_unresolved = (link->procedure_idx == 0);
+      CTRL_SampleTreeNode *child = &ctrl_sample_tree_node_nil;
+      for(CTRL_SampleTreeNode *c = node->first; c != &ctrl_sample_tree_node_nil; c = c->next)
+      {
+        if(c->procedure_idx == link->procedure_idx &&
+           c->inline_site_idx == link->inline_site_idx &&
+           di_key_match(c->dbgi_key, dbgi_key) &&
+           (!is_unresolved || c->vaddr == raw->vaddr))
+        {
+          child = c;
+          break;
+        }
+      }
+      if(child == &ctrl_sample_tree_node_nil)
+      {
+        child = push_array(arena, CTRL_SampleTreeNode, 1);
+        MemoryCopyStruct(child, &ctrl_sample_tree_node_nil);
+        child->id = id_gen;
+        child->dbgi_key = dbgi_key;
+        child->procedure_idx = link->procedure_idx;
+        child->inline_site_idx = link->inline_site_idx;
+        child->vaddr = raw->vaddr;
+        child->name = (is_unresolved ? push_str8f(arena, "0x%I64x", raw->vaddr) : push_str8_copy(arena, link->name));
+        SLLStackPush_N(tree->slots[child->id%tree->slots_count], child, hash_next);
+        id_gen += 1;
+        SLLQueuePush_NZ(&ctrl_sample_tree_node_nil, node->first, node->last, child, next);
+        child->parent = node;
+        node->child_count += 1;
+      }
+      child->total_count += raw->total_count;
+      node = child;
+    }
+    node->self_count += raw->self_count;
+    raw_leaf_nodes[idx] = node;
+  }
+  
+  //- rjf: produce artifact
+  AC_Artifact artifact = {0};
+  {
+    artifact.u64[0] = (U64)arena;
+    artifact.u64[1] = (U64)tree;
+  }
+  
+  access_close(access);
+  scratch_end(scratch);
+  return artifact;
+}
+
+internal void
+ctrl_sample_tree_artifact_destroy(AC_Artifact artifact)
+{
+  Arena *arena = (Arena *)artifact.u64[0];
+  if(arena != 0)
+  {
+    arena_release(arena);
+  }
+}
+
+internal CTRL_SampleTree
+ctrl_sample_tree(Access *access, U64 endt_us)
+{
+  CTRL_SampleTree result = {&ctrl_sample_tree_node_nil};
+  {
+    AC_Artifact artifact = ac_artifact_from_key(access, str8_zero(), ctrl_sample_tree_artifact_create, ctrl_sample_tree_artifact_destroy, endt_us, .gen = ctrl_sample_gen() + di_load_gen());
+    if(artifact.u64[1] != 0)
+    {
+      MemoryCopyStruct(&result, (CTRL_SampleTree *)artifact.u64[1]);
+    }
+  }
+  return result;
+}
+
+internal String8
+ctrl_folded_stacks_string_from_sample_tree(Arena *arena, CTRL_SampleTree *tree)
+{
+  // NOTE(rjf): this produces the "folded stacks" format, consumed by most
+  // flame graph tools - one line per unique stack, root-most frame first,
+  // frames separated by ';', followed by the number of samples.
+  Temp scratch = scratch_begin(&arena, 1);
+  String8List lines = {0};
+  for(CTRL_SampleTreeNode *n = tree->root; n != &ctrl_sample_tree_node_nil;)
+  {
+    if(n->self_count != 0 && n != tree->root)
+    {
+      String8List parts = {0};
+      for(CTRL_SampleTreeNode *p = n; p != tree->root && p != &ctrl_sample_tree_node_nil; p = p->parent)
+      {
+        str8_list_push_front(scratch.arena, &parts, p->inline_site_idx != 0 ? push_str8f(scratch.arena, "%S [inlined]", p->name) : p->name);
+      }
+      StringJoin join = {0};
+      join.sep = str8_lit(";");
+      String8 stack = str8_list_join(scratch.arena, &parts, &join);
+      str8_list_pushf(scratch.arena, &lines, "%S %I64u\n", stack, n->self_count);
+    }
+    
+    //- rjf: iterate depth-first
+    if(n->first != &ctrl_sample_tree_node_nil)
+    {
+      n = n->first;
+    }
+    else for(;n != &ctrl_sample_tree_node_nil; n = n->parent)
+    {
+      if(n->next != &ctrl_sample_tree_node_nil)
+      {
+        n = n->next;
+        break;
+      }
+    }
+  }
+  String8 result = str8_list_join(arena, &lines, 0);
+  scratch_end(scratch);
+  return result;
+}
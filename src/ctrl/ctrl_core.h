@@ -306,6 +306,61 @@ struct CTRL_CallStackTree
   CTRL_CallStackTreeNode **slots;
 };
 
+////////////////////////////////
+//~ rjf: Sampling Profiler Types
+
+#define CTRL_SAMPLE_DEFAULT_INTERVAL_US  1000
+#define CTRL_SAMPLE_DEFAULT_OVERHEAD_PCT 5
+#define CTRL_SAMPLE_MAX_FRAMES           256
+
+// NOTE(rjf): samples are recorded by the control thread into a tree of raw
+// (process, vaddr) frames, with the outermost frame at the root - this is
+// cheap enough to do while the target is halted. the symbolized tree, keyed
+// by debug info procedures & inline sites, is built from that lazily, off of
+// the control thread.
+
+typedef struct CTRL_SampleNode CTRL_SampleNode;
+struct CTRL_SampleNode
+{
+  CTRL_SampleNode *hash_next;
+  CTRL_SampleNode *first;
+  CTRL_SampleNode *next;
+  CTRL_SampleNode *parent;
+  U64 idx;
+  CTRL_Handle process;
+  U64 vaddr;
+  U64 self_count;
+  U64 total_count;
+};
+
+typedef struct CTRL_SampleTreeNode CTRL_SampleTreeNode;
+struct CTRL_SampleTreeNode
+{
+  CTRL_SampleTreeNode *hash_next;
+  CTRL_SampleTreeNode *first;
+  CTRL_SampleTreeNode *last;
+  CTRL_SampleTreeNode *next;
+  CTRL_SampleTreeNode *parent;
+  U64 child_count;
+  U64 id;
+  DI_Key dbgi_key;
+  U64 procedure_idx;
+  U64 inline_site_idx;
+  U64 vaddr;
+  String8 name;
+  U64 self_count;
+  U64 total_count;
+};
+
+typedef struct CTRL_SampleTree CTRL_SampleTree;
+struct CTRL_SampleTree
+{
+  CTRL_SampleTreeNode *root;
+  U64 slots_count;
+  CTRL_SampleTreeNode **slots;
+  U64 sample_count;
+};
+
 ////////////////////////////////
 //~ rjf: Trap Types
 
@@ -371,6 +426,7 @@ typedef enum CTRL_MsgKind
   CTRL_MsgKind_Kill,
   CTRL_MsgKind_KillAll,
   CTRL_MsgKind_Detach,
+  CTRL_MsgKind_SaveCoreDump,
   CTRL_MsgKind_Run,
   CTRL_MsgKind_SingleStep,
   CTRL_MsgKind_SetUserEntryPoints,
@@ -385,6 +441,13 @@ typedef U32 CTRL_RunFlags;
 enum
 {
   CTRL_RunFlag_StopOnEntryPoint = (1<<0),
+  CTRL_RunFlag_Sample           = (1<<1),
+};
+
+typedef U32 CTRL_SaveCoreFlags;
+enum
+{
+  CTRL_SaveCoreFlag_Compress = (1<<0),
 };
 
 typedef struct CTRL_Msg CTRL_Msg;
@@ -392,6 +455,7 @@ struct CTRL_Msg
 {
   CTRL_MsgKind kind;
   CTRL_RunFlags run_flags;
+  CTRL_SaveCoreFlags save_core_flags;
   CTRL_MsgID msg_id;
   CTRL_Handle entity;
   CTRL_Handle parent;
@@ -399,6 +463,8 @@ struct CTRL_Msg
   U32 exit_code;
   B32 env_inherit;
   B32 debug_subprocesses;
+  U64 sample_interval_us;
+  U64 sample_overhead_pct;
   U64 exception_code_filters[(CTRL_ExceptionCodeKind_COUNT+63)/64];
   String8 path;
   String8List entry_points;
@@ -548,6 +614,59 @@ struct CTRL_ProcessMemorySlice
   B32 any_byte_changed;
 };
 
+////////////////////////////////
+//~ rjf: Process Memory Search Types
+
+// rjf: searches are split into chunks of the readable address space, which
+// are each searched wide & cached independently, so results stream in as
+// chunks finish. within a chunk, lanes read blocks in batches & scan them.
+#define CTRL_MEMORY_SEARCH_CHUNK_SIZE     MB(256)
+#define CTRL_MEMORY_SEARCH_BLOCK_SIZE     MB(1)
+#define CTRL_MEMORY_SEARCH_BATCH_COUNT    16
+#define CTRL_MEMORY_SEARCH_CHUNK_HITS_MAX 4096
+#define CTRL_MEMORY_SEARCH_HITS_MAX       65536
+
+// rjf: `mask` is parallel to `pattern`, and selects which bits of each
+// pattern byte must match (0xff -> exact, 0x00 -> wildcard). an empty mask
+// means all bytes must match exactly. hits are only reported at vaddrs which
+// are multiples of `align`, if it is nonzero.
+typedef struct CTRL_MemorySearchParams CTRL_MemorySearchParams;
+struct CTRL_MemorySearchParams
+{
+  String8 pattern;
+  String8 mask;
+  U64 align;
+};
+
+// rjf: one piece of a chunk - matches may begin anywhere in `vaddr_range`,
+// and may extend past it, up to the end of the readable span (`read_opl`)
+typedef struct CTRL_MemorySearchRange CTRL_MemorySearchRange;
+struct CTRL_MemorySearchRange
+{
+  Rng1U64 vaddr_range;
+  U64 read_opl;
+};
+
+typedef struct CTRL_MemorySearchChunk CTRL_MemorySearchChunk;
+struct CTRL_MemorySearchChunk
+{
+  Arena *arena;
+  U64 *vaddrs;
+  U64 count;
+  B32 truncated;
+};
+
+typedef struct CTRL_MemorySearchResults CTRL_MemorySearchResults;
+struct CTRL_MemorySearchResults
+{
+  U64 *vaddrs;
+  U64 count;
+  Rng1U64Array pending_ranges;
+  U64 searched_size;
+  U64 total_size;
+  B32 truncated;
+};
+
 ////////////////////////////////
 //~ rjf: Thread Register Cache Types
 
@@ -605,6 +724,7 @@ struct CTRL_ModuleImageInfoCacheNode
   U64 entry_point_voff;
   Rng1U64 tls_vaddr_range;
   String8 initial_debug_info_path;
+  SS_Key symbol_store_key;
   Rng1U64 raddbg_section_voff_range;
   String8 raddbg_data;
 };
@@ -740,6 +860,29 @@ struct CTRL_State
   CTRL_ModuleReqCacheNode **module_req_cache_slots;
   String8List msg_user_bp_touched_files;
   String8List msg_user_bp_touched_symbols;
+  
+  // rjf: halt requests (distinguishes user halts from sampler halts)
+  U64 halt_request_count;
+  
+  // rjf: sampler thread state
+  Thread sample_thread;
+  Mutex sample_thread_mutex;
+  CondVar sample_thread_cv;
+  B32 sample_thread_active;
+  U64 sample_halt_pending;
+  U64 sample_interval_us;
+  U64 sample_next_halt_us;
+  U64 sample_halt_issue_us;
+  
+  // rjf: recorded samples
+  Mutex sample_mutex;
+  Arena *sample_arena;
+  CTRL_SampleNode *sample_root;
+  U64 sample_nodes_count;
+  U64 sample_slots_count;
+  CTRL_SampleNode **sample_slots;
+  U64 sample_count;
+  U64 sample_gen;
 };
 
 ////////////////////////////////
@@ -762,6 +905,14 @@ read_only global CTRL_CallStackTreeNode ctrl_call_stack_tree_node_nil =
   &ctrl_call_stack_tree_node_nil,
   &ctrl_call_stack_tree_node_nil,
 };
+read_only global CTRL_SampleTreeNode ctrl_sample_tree_node_nil =
+{
+  0,
+  &ctrl_sample_tree_node_nil,
+  &ctrl_sample_tree_node_nil,
+  &ctrl_sample_tree_node_nil,
+  &ctrl_sample_tree_node_nil,
+};
 thread_static CTRL_EntityCtxLookupAccel *ctrl_entity_ctx_lookup_accel = 0;
 
 ////////////////////////////////
@@ -918,6 +1069,7 @@ internal PE_IntelPdata *ctrl_intel_pdata_from_module_voff(Arena *arena, CTRL_Han
 internal U64 ctrl_entry_point_voff_from_module(CTRL_Handle module_handle);
 internal Rng1U64 ctrl_tls_vaddr_range_from_module(CTRL_Handle module_handle);
 internal String8 ctrl_initial_debug_info_path_from_module(Arena *arena, CTRL_Handle module_handle);
+internal SS_Key ctrl_symbol_store_key_from_module(Arena *arena, CTRL_Handle module_handle);
 internal String8 ctrl_raddbg_data_from_module(Arena *arena, CTRL_Handle module_handle);
 
 ////////////////////////////////
@@ -955,6 +1107,12 @@ internal CTRL_CallStackFrame *ctrl_call_stack_frame_from_unwind_and_inline_depth
 
 internal void ctrl_halt(void);
 
+////////////////////////////////
+//~ rjf: Sampling Profiler Functions
+
+internal U64 ctrl_sample_gen(void);
+internal void ctrl_sample_profile_clear(void);
+
 ////////////////////////////////
 //~ rjf: Shared Accessor Functions
 
@@ -1010,9 +1168,17 @@ internal void ctrl_thread__attach(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
 internal void ctrl_thread__kill(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
 internal void ctrl_thread__kill_all(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
 internal void ctrl_thread__detach(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
+internal void ctrl_thread__save_core_dump(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
 internal void ctrl_thread__run(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
 internal void ctrl_thread__single_step(DMN_CtrlCtx *ctrl_ctx, CTRL_Msg *msg);
 
+//- rjf: sampling profiler
+internal void ctrl_sample_thread__entry_point(void *p);
+internal void ctrl_thread__sampler_begin(U64 interval_us);
+internal void ctrl_thread__sampler_end(void);
+internal U64 ctrl_thread__sample_unwind(Arch arch, CTRL_Entity *process, DMN_Handle thread, U64 *vaddrs_out, U64 vaddrs_cap);
+internal void ctrl_thread__record_samples(void);
+
 ////////////////////////////////
 //~ rjf: Process Memory Artifact Cache Hooks / Lookups
 
@@ -1028,6 +1194,23 @@ internal B32 ctrl_process_memory_read(CTRL_Handle process, Rng1U64 range, B32 *i
 //- rjf: process memory writing
 internal B32 ctrl_process_write(CTRL_Handle process, Rng1U64 range, void *src);
 
+////////////////////////////////
+//~ rjf: Process Memory Search Artifact Cache Hooks / Lookups
+
+//- rjf: search kernel
+internal B32 ctrl_memory_search_pattern_match(U8 *data, U8 *pattern, U8 *mask, U64 pattern_size);
+internal U64 ctrl_memory_search_hits_from_data(U8 *data, U64 data_size, U64 scan_size, U8 *pattern, U8 *mask, U64 pattern_size, U64 base_vaddr, U64 align, U64 *hits_out, U64 hits_cap);
+
+//- rjf: readable ranges
+internal AC_Artifact ctrl_readable_ranges_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
+internal void ctrl_readable_ranges_artifact_destroy(AC_Artifact artifact);
+internal Rng1U64Array ctrl_readable_ranges_from_process(Access *access, CTRL_Handle process, U64 endt_us);
+
+//- rjf: searches
+internal AC_Artifact ctrl_memory_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
+internal void ctrl_memory_search_artifact_destroy(AC_Artifact artifact);
+internal CTRL_MemorySearchResults ctrl_memory_search_results_from_process(Arena *arena, Access *access, CTRL_Handle process, CTRL_MemorySearchParams *params, U64 endt_us);
+
 ////////////////////////////////
 //~ rjf: Call Stack Artifact Cache Hooks / Lookups
 
@@ -1042,4 +1225,12 @@ internal AC_Artifact ctrl_call_stack_tree_artifact_create(String8 key, B32 *canc
 internal void ctrl_call_stack_tree_artifact_destroy(AC_Artifact artifact);
 internal CTRL_CallStackTree ctrl_call_stack_tree(Access *access, U64 endt_us);
 
+////////////////////////////////
+//~ rjf: Sample Tree Artifact Cache Hooks / Lookups
+
+internal AC_Artifact ctrl_sample_tree_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
+internal void ctrl_sample_tree_artifact_destroy(AC_Artifact artifact);
+internal CTRL_SampleTree ctrl_sample_tree(Access *access, U64 endt_us);
+internal String8 ctrl_folded_stacks_string_from_sample_tree(Arena *arena, CTRL_SampleTree *tree);
+
 #endif // CTRL_CORE_H
@@ -1073,6 +1073,102 @@ d_ctrl_last_stop_event(void)
   return d_state->ctrl_last_stop_event;
 }
 
+////////////////////////////////
+//~ rjf: Stop Prefetching
+
+internal B32
+d_prefetch_stop_state(CTRL_Handle thread_handle)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  Access *access = access_open();
+  B32 done = 1;
+  CTRL_EntityCtx *ctx = &d_state->ctrl_entity_store->ctx;
+  CTRL_Entity *thread = ctrl_entity_from_handle(ctx, thread_handle);
+  CTRL_Entity *process = ctrl_entity_ancestor_from_kind(thread, CTRL_EntityKind_Process);
+  if(thread != &ctrl_entity_nil && process != &ctrl_entity_nil)
+  {
+    //- rjf: kick off unwinds for all other threads in the stopped process, at
+    // a lower priority than the stopped thread
+    for(CTRL_Entity *child = process->first; child != &ctrl_entity_nil; child = child->next)
+    {
+      if(child->kind == CTRL_EntityKind_Thread && child != thread)
+      {
+        ctrl_call_stack_from_thread(access, child->handle, 0, 0);
+      }
+    }
+    
+    //- rjf: unwind stopped thread
+    CTRL_CallStack call_stack = ctrl_call_stack_from_thread(access, thread->handle, 1, 0);
+    if(call_stack.concrete_frames_count == 0)
+    {
+      done = 0;
+    }
+    U64 frames_count = Min(call_stack.concrete_frames_count, D_PREFETCH_FRAME_COUNT);
+    
+    //- rjf: warm stack memory for all prefetched frames - this is where the
+    // top frames' locals live. pages are requested individually, to match the
+    // granularity at which memory views & evaluation read them.
+    if(frames_count != 0)
+    {
+      U64 page_size = KB(4);
+      U64 stack_top = regs_rsp_from_arch_block(thread->arch, call_stack.concrete_frames[0]->regs);
+      U64 stack_bottom = regs_rsp_from_arch_block(thread->arch, call_stack.concrete_frames[frames_count-1]->regs) + page_size;
+      stack_bottom = Clamp(stack_top, stack_bottom, stack_top + D_PREFETCH_STACK_SIZE_MAX);
+      Rng1U64 page_range = r1u64(AlignDownPow2(stack_top, page_size), AlignPow2(stack_bottom, page_size));
+      for(U64 page_vaddr = page_range.min; page_vaddr < page_range.max; page_vaddr += page_size)
+      {
+        B32 is_stale = 0;
+        C_Key key = ctrl_key_from_process_vaddr_range(process->handle, r1u64(page_vaddr, page_vaddr+page_size), 0, 0, 0, &is_stale);
+        if(is_stale || u128_match(c_hash_from_key(key, 0), u128_zero()))
+        {
+          done = 0;
+        }
+      }
+    }
+    
+    //- rjf: warm debug info, line info, source text, & locals for top frames
+    for EachIndex(frame_idx, frames_count)
+    {
+      U64 rip_vaddr = regs_rip_from_arch_block(thread->arch, call_stack.concrete_frames[frame_idx]->regs);
+      CTRL_Entity *module = ctrl_module_from_process_vaddr(process, rip_vaddr);
+      if(module == &ctrl_entity_nil)
+      {
+        continue;
+      }
+      DI_Key dbgi_key = ctrl_dbgi_key_from_module(module);
+      U64 rip_voff = ctrl_voff_from_vaddr(module, rip_vaddr);
+      RDI_Parsed *rdi = di_rdi_from_key(access, dbgi_key, 1, 0);
+      if(rdi == &rdi_parsed_nil)
+      {
+        done = 0;
+        continue;
+      }
+      d_query_cached_locals_map_from_dbgi_key_voff(dbgi_key, rip_voff);
+      D_LineList lines = d_lines_from_dbgi_key_voff(scratch.arena, dbgi_key, rip_voff);
+      for EachNode(n, D_LineNode, lines.first)
+      {
+        String8 file_path = n->v.file_path;
+        FileProperties props = os_properties_from_file_path(file_path);
+        if(props.size != 0 && !(props.flags & FilePropertyFlag_IsFolder))
+        {
+          U128 hash = {0};
+          C_Key key = fs_key_from_path_range(file_path, r1u64(0, props.size), 0);
+          txt_text_info_from_key_lang(access, key, txt_lang_kind_from_extension(str8_skip_last_dot(file_path)), &hash);
+          if(u128_match(hash, u128_zero()))
+          {
+            done = 0;
+          }
+        }
+      }
+    }
+  }
+  access_close(access);
+  scratch_end(scratch);
+  ProfEnd();
+  return done;
+}
+
 ////////////////////////////////
 //~ rjf: Main State Accessors/Mutators
 
@@ -1104,6 +1200,12 @@ d_ctrl_targets_running(void)
   return d_state->ctrl_is_running;
 }
 
+internal U64
+d_ctrl_events_gen(void)
+{
+  return d_state->ctrl_events_gen;
+}
+
 //- rjf: active entity based queries
 
 internal DI_KeyList
@@ -1357,6 +1459,8 @@ d_init(void)
   d_state->ctrl_entity_store = ctrl_entity_ctx_rw_store_alloc();
   d_state->ctrl_stop_arena = arena_alloc();
   d_state->ctrl_msg_arena = arena_alloc();
+  d_state->redirected_module_slots_count = 256;
+  d_state->redirected_module_slots = push_array(arena, D_RedirectedModuleSlot, d_state->redirected_module_slots_count);
   
   // rjf: set up caches
   for(U64 idx = 0; idx < ArrayCount(d_state->tls_base_caches); idx += 1)
@@ -1377,7 +1481,7 @@ d_init(void)
 }
 
 internal D_EventList
-d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_PathMapArray *path_maps, U64 exception_code_filters[(CTRL_ExceptionCodeKind_COUNT+63)/64])
+d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_PathMapArray *path_maps, U64 exception_code_filters[(CTRL_ExceptionCodeKind_COUNT+63)/64], U64 sample_interval_us, U64 sample_overhead_pct)
 {
   ProfBeginFunction();
   Temp scratch = scratch_begin(&arena, 1);
@@ -1396,6 +1500,10 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
     //- rjf: consume & process events
     CTRL_EventList events = ctrl_c2u_pop_events(scratch.arena);
     ctrl_entity_store_apply_events(d_state->ctrl_entity_store, &events);
+    if(events.count != 0)
+    {
+      d_state->ctrl_events_gen += 1;
+    }
     for(CTRL_EventNode *event_n = events.first;
         event_n != 0;
         event_n = event_n->next)
@@ -1444,6 +1552,13 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
             d_state->ctrl_last_stop_event.string = push_str8_copy(d_state->ctrl_stop_arena, d_state->ctrl_last_stop_event.string);
           }
           
+          // rjf: begin prefetching state for the stopped thread, if this is not a soft-halt
+          if(should_snap)
+          {
+            d_state->ctrl_prefetch_thread = event->entity;
+            d_state->ctrl_prefetch_endt_us = os_now_microseconds() + D_PREFETCH_DURATION_US;
+          }
+          
           // rjf: push stop event to caller, if this is not a soft-halt
           if(should_snap)
           {
@@ -1498,6 +1613,21 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
           D_Event *evt = &n->v;
           evt->kind = D_EventKind_ProcessEnd;
           evt->code = event->u64_code;
+          
+          // rjf: forget this process' redirected modules
+          for EachIndex(slot_idx, d_state->redirected_module_slots_count)
+          {
+            D_RedirectedModuleSlot *slot = &d_state->redirected_module_slots[slot_idx];
+            for(D_RedirectedModuleNode *n = slot->first, *next = 0; n != 0; n = next)
+            {
+              next = n->next;
+              if(ctrl_handle_match(n->process, event->entity))
+              {
+                DLLRemove(slot->first, slot->last, n);
+                SLLStackPush(d_state->free_redirected_module, n);
+              }
+            }
+          }
         }break;
         
         case CTRL_EventKind_NewModule:
@@ -1510,6 +1640,22 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
           evt->module = event->entity;
         }break;
         
+        case CTRL_EventKind_EndModule:
+        {
+          // rjf: forget this module, if it was redirected
+          U64 hash = ctrl_hash_from_handle(event->entity);
+          D_RedirectedModuleSlot *slot = &d_state->redirected_module_slots[hash%d_state->redirected_module_slots_count];
+          for(D_RedirectedModuleNode *n = slot->first; n != 0; n = n->next)
+          {
+            if(ctrl_handle_match(n->module, event->entity))
+            {
+              DLLRemove(slot->first, slot->last, n);
+              SLLStackPush(d_state->free_redirected_module, n);
+              break;
+            }
+          }
+        }break;
+        
         //- rjf: debug strings
         
         case CTRL_EventKind_DebugString:
@@ -1567,6 +1713,28 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
     }
   }
   
+  //////////////////////////////
+  //- rjf: prefetch stop state: on each stop, concurrently request everything
+  // the first frame after the stop will want - the stopped thread's call
+  // stack, stack memory, debug info, line info, source text, & locals - so
+  // it's in flight before views start asking for it one-at-a-time. continue
+  // re-requesting (which is cheap once cached) until it's all ready, the
+  // target resumes, or we time out.
+  //
+  if(d_state->ctrl_prefetch_endt_us != 0) ProfScope("prefetch stop state")
+  {
+    B32 done = (d_ctrl_targets_running() || os_now_microseconds() >= d_state->ctrl_prefetch_endt_us);
+    if(!done)
+    {
+      done = d_prefetch_stop_state(d_state->ctrl_prefetch_thread);
+    }
+    if(done)
+    {
+      d_state->ctrl_prefetch_endt_us = 0;
+      MemoryZeroStruct(&d_state->ctrl_prefetch_thread);
+    }
+  }
+  
   //////////////////////////////
   //- rjf: hash ctrl parameterization state
   //
@@ -1766,7 +1934,32 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
             MemoryCopyArray(msg->exception_code_filters, exception_code_filters);
           }
         }break;
+        case D_CmdKind_SaveCoreDump:
+        case D_CmdKind_SaveCompressedCoreDump:
+        {
+          CTRL_Entity *process = ctrl_entity_from_handle(&d_state->ctrl_entity_store->ctx, params->process);
+          if(process == &ctrl_entity_nil)
+          {
+            log_user_error(str8_lit("Cannot save core dump; no process specified."));
+          }
+          else if(params->file_path.size == 0)
+          {
+            log_user_error(str8_lit("Cannot save core dump; no file path specified."));
+          }
+          else
+          {
+            CTRL_Msg *msg = ctrl_msg_list_push(scratch.arena, &ctrl_msgs);
+            msg->kind   = CTRL_MsgKind_SaveCoreDump;
+            msg->entity = process->handle;
+            msg->path   = params->file_path;
+            if(cmd->kind == D_CmdKind_SaveCompressedCoreDump)
+            {
+              msg->save_core_flags |= CTRL_SaveCoreFlag_Compress;
+            }
+          }
+        }break;
         case D_CmdKind_Continue:
+        case D_CmdKind_RunWithSampling:
         {
           B32 good_to_run = 0;
           CTRL_EntityArray threads = ctrl_entity_array_from_kind(&d_state->ctrl_entity_store->ctx, CTRL_EntityKind_Thread);
@@ -1786,6 +1979,10 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
               need_run = 1;
               run_kind = D_RunKind_Run;
               run_thread = ctrl_entity_from_handle(&d_state->ctrl_entity_store->ctx, params->thread);
+              if(cmd->kind == D_CmdKind_RunWithSampling)
+              {
+                run_flags |= CTRL_RunFlag_Sample;
+              }
             }
             else
             {
@@ -1793,6 +1990,10 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
             }
           }
         }break;
+        case D_CmdKind_ClearSampleProfile:
+        {
+          ctrl_sample_profile_clear();
+        }break;
         case D_CmdKind_StepIntoInst:
         case D_CmdKind_StepOverInst:
         case D_CmdKind_StepIntoLine:
@@ -2052,6 +2253,8 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
           CTRL_Entity *process = ctrl_entity_ancestor_from_kind(run_thread, CTRL_EntityKind_Process);
           msg->kind = (run_kind == D_RunKind_Run || run_kind == D_RunKind_Step) ? CTRL_MsgKind_Run : CTRL_MsgKind_SingleStep;
           msg->run_flags  = run_flags;
+          msg->sample_interval_us  = sample_interval_us;
+          msg->sample_overhead_pct = sample_overhead_pct;
           msg->entity     = run_thread->handle;
           msg->parent     = process->handle;
           MemoryCopyArray(msg->exception_code_filters, exception_code_filters);
@@ -2124,6 +2327,60 @@ d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_P
     }
   }
   
+  //////////////////////////////
+  //- rjf: redirect modules to debug info found in symbol stores - modules
+  // whose debug info wasn't found locally have a symbol store key; once it
+  // resolves to a path, swap the module's debug info over to it (which will
+  // then be converted & loaded as usual)
+  //
+  ProfScope("redirect modules to symbol store debug info")
+  {
+    Access *access = access_open();
+    CTRL_EntityArray modules = ctrl_entity_array_from_kind(&d_state->ctrl_entity_store->ctx, CTRL_EntityKind_Module);
+    for EachIndex(idx, modules.count)
+    {
+      CTRL_Entity *module = modules.v[idx];
+      U64 hash = ctrl_hash_from_handle(module->handle);
+      D_RedirectedModuleSlot *slot = &d_state->redirected_module_slots[hash%d_state->redirected_module_slots_count];
+      B32 is_redirected = 0;
+      for(D_RedirectedModuleNode *n = slot->first; n != 0; n = n->next)
+      {
+        if(ctrl_handle_match(n->module, module->handle))
+        {
+          is_redirected = 1;
+          break;
+        }
+      }
+      if(is_redirected)
+      {
+        continue;
+      }
+      SS_Key key = ctrl_symbol_store_key_from_module(scratch.arena, module->handle);
+      String8 path = ss_path_from_key(scratch.arena, access, &key, 0);
+      if(path.size != 0)
+      {
+        D_RedirectedModuleNode *n = d_state->free_redirected_module;
+        if(n != 0)
+        {
+          SLLStackPop(d_state->free_redirected_module);
+        }
+        else
+        {
+          n = push_array_no_zero(d_state->arena, D_RedirectedModuleNode, 1);
+        }
+        MemoryZeroStruct(n);
+        n->module = module->handle;
+        n->process = ctrl_process_from_entity(module)->handle;
+        DLLPushBack(slot->first, slot->last, n);
+        CTRL_Msg *msg = ctrl_msg_list_push(scratch.arena, &ctrl_msgs);
+        msg->kind   = CTRL_MsgKind_SetModuleDebugInfoPath;
+        msg->entity = module->handle;
+        msg->path   = path;
+      }
+    }
+    access_close(access);
+  }
+  
   //////////////////////////////
   //- rjf: clear command batch
   //
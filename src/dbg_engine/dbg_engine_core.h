@@ -226,6 +226,13 @@ struct D_CmdList
   U64 count;
 };
 
+////////////////////////////////
+//~ rjf: Stop Prefetching Constants
+
+#define D_PREFETCH_FRAME_COUNT 8
+#define D_PREFETCH_STACK_SIZE_MAX KB(256)
+#define D_PREFETCH_DURATION_US 2000000
+
 ////////////////////////////////
 //~ rjf: Main State Caches
 
@@ -282,6 +289,24 @@ struct D_RunLocalsCache
   D_RunLocalsCacheSlot *table;
 };
 
+//- rjf: modules redirected to symbol store debug info
+
+typedef struct D_RedirectedModuleNode D_RedirectedModuleNode;
+struct D_RedirectedModuleNode
+{
+  D_RedirectedModuleNode *next;
+  D_RedirectedModuleNode *prev;
+  CTRL_Handle module;
+  CTRL_Handle process;
+};
+
+typedef struct D_RedirectedModuleSlot D_RedirectedModuleSlot;
+struct D_RedirectedModuleSlot
+{
+  D_RedirectedModuleNode *first;
+  D_RedirectedModuleNode *last;
+};
+
 ////////////////////////////////
 //~ rjf: Main State Types
 
@@ -323,6 +348,9 @@ struct D_State
   B32 ctrl_is_running;
   B32 ctrl_thread_run_state;
   B32 ctrl_soft_halt_issued;
+  U64 ctrl_events_gen;
+  CTRL_Handle ctrl_prefetch_thread;
+  U64 ctrl_prefetch_endt_us;
   Arena *ctrl_msg_arena;
   CTRL_MsgList ctrl_msgs;
   
@@ -330,6 +358,11 @@ struct D_State
   CTRL_EntityCtxRWStore *ctrl_entity_store;
   Arena *ctrl_stop_arena;
   CTRL_Event ctrl_last_stop_event;
+  
+  // rjf: modules which have been redirected to symbol store debug info
+  U64 redirected_module_slots_count;
+  D_RedirectedModuleSlot *redirected_module_slots;
+  D_RedirectedModuleNode *free_redirected_module;
 };
 
 ////////////////////////////////
@@ -401,6 +434,11 @@ internal U64 d_tls_base_vaddr_from_process_root_rip(CTRL_Entity *process, U64 ro
 //- rjf: stopped info from the control thread
 internal CTRL_Event d_ctrl_last_stop_event(void);
 
+////////////////////////////////
+//~ rjf: Stop Prefetching
+
+internal B32 d_prefetch_stop_state(CTRL_Handle thread_handle);
+
 ////////////////////////////////
 //~ rjf: Main State Accessors/Mutators
 
@@ -411,6 +449,7 @@ internal U64 d_frame_index(void);
 internal D_RunKind d_ctrl_last_run_kind(void);
 internal U64 d_ctrl_last_run_frame_idx(void);
 internal B32 d_ctrl_targets_running(void);
+internal U64 d_ctrl_events_gen(void);
 
 //- rjf: active entity based queries
 internal DI_KeyList d_push_active_dbgi_key_list(Arena *arena);
@@ -433,6 +472,6 @@ internal B32 d_next_cmd(D_Cmd **cmd);
 //~ rjf: Main Layer Top-Level Calls
 
 internal void d_init(void);
-internal D_EventList d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_PathMapArray *path_maps, U64 exception_code_filters[(CTRL_ExceptionCodeKind_COUNT+63)/64]);
+internal D_EventList d_tick(Arena *arena, D_TargetArray *targets, D_BreakpointArray *breakpoints, D_PathMapArray *path_maps, U64 exception_code_filters[(CTRL_ExceptionCodeKind_COUNT+63)/64], U64 sample_interval_us, U64 sample_overhead_pct);
 
 #endif // DBG_ENGINE_CORE_H
@@ -14,7 +14,11 @@ D_CmdKind_LaunchAndStepInto,
 D_CmdKind_Kill,
 D_CmdKind_KillAll,
 D_CmdKind_Detach,
+D_CmdKind_SaveCoreDump,
+D_CmdKind_SaveCompressedCoreDump,
 D_CmdKind_Continue,
+D_CmdKind_RunWithSampling,
+D_CmdKind_ClearSampleProfile,
 D_CmdKind_StepIntoInst,
 D_CmdKind_StepOverInst,
 D_CmdKind_StepIntoLine,
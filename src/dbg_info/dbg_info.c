@@ -53,13 +53,16 @@ di_init(CmdLine *cmdline)
   di_shared->arena = arena;
   di_shared->key2path_slots_count = 4096;
   di_shared->key2path_slots = push_array(arena, DI_KeySlot, di_shared->key2path_slots_count);
-  di_shared->key2path_stripes = stripe_array_alloc(arena);
+  di_shared->key2path_stripes = stripe_array_alloc(arena, str8_lit("dbg_info (key -> path)"));
   di_shared->path2key_slots_count = 4096;
   di_shared->path2key_slots = push_array(arena, DI_KeySlot, di_shared->path2key_slots_count);
-  di_shared->path2key_stripes = stripe_array_alloc(arena);
+  di_shared->path2key_stripes = stripe_array_alloc(arena, str8_lit("dbg_info (path -> key)"));
   di_shared->slots_count = 4096;
   di_shared->slots = push_array(arena, DI_Slot, di_shared->slots_count);
-  di_shared->stripes = stripe_array_alloc(arena);
+  di_shared->stripes = stripe_array_alloc(arena, str8_lit("dbg_info"));
+  di_shared->text_filter_slots_count = 4096;
+  di_shared->text_filter_slots = push_array(arena, DI_TextFilterSlot, di_shared->text_filter_slots_count);
+  di_shared->text_filter_stripes = stripe_array_alloc(arena, str8_lit("dbg_info (text filters)"));
   for EachElement(idx, di_shared->req_batches)
   {
     di_shared->req_batches[idx].mutex = mutex_alloc();
@@ -98,6 +101,7 @@ di_init(CmdLine *cmdline)
   di_shared->completion_arena = arena_alloc();
   di_shared->event_mutex = mutex_alloc();
   di_shared->event_arena = arena_alloc();
+  di_shared->progress_mutex = mutex_alloc();
 }
 
 ////////////////////////////////
@@ -328,6 +332,7 @@ di_close(DI_Key key, B32 force_closed)
   FileProperties file_props = {0};
   void *file_base = 0;
   Arena *arena = 0;
+  DI_SearchIndex *search_indexes[RDI_SectionKind_COUNT] = {0};
   RWMutexScope(stripe->rw_mutex, 1)
   {
     DI_Node *node = 0;
@@ -364,6 +369,7 @@ di_close(DI_Key key, B32 force_closed)
             file_props = node->file_props;
             file_base = node->file_base;
             arena = node->arena;
+            MemoryCopyArray(search_indexes, node->search_indexes);
             break;
           }
           cond_var_wait_rw(stripe->cv, stripe->rw_mutex, 1, max_U64);
@@ -384,6 +390,13 @@ di_close(DI_Key key, B32 force_closed)
     {
       arena_release(arena);
     }
+    for EachElement(idx, search_indexes)
+    {
+      if(search_indexes[idx] != 0)
+      {
+        di_search_index_release(search_indexes[idx]);
+      }
+    }
   }
 }
 
@@ -527,6 +540,57 @@ di_get_events(Arena *arena)
   return dst;
 }
 
+////////////////////////////////
+//~ rjf: Conversion Scheduling
+
+internal U64
+di_conversion_thread_count_from_size(U64 size, U64 max_thread_count)
+{
+  U64 thread_count = 1;
+  if(0){}
+  else if(size <= MB(4))   {thread_count = 1;}
+  else if(size <= MB(256)) {thread_count = max_thread_count/4;}
+  else if(size <= MB(512)) {thread_count = max_thread_count/3;}
+  else if(size <= GB(1))   {thread_count = max_thread_count/2;}
+  else                     {thread_count = max_thread_count;}
+  thread_count = Clamp(1, thread_count, Max(1, max_thread_count));
+  return thread_count;
+}
+
+internal int
+di_conversion_candidate_qsort_compare(DI_ConversionCandidate *a, DI_ConversionCandidate *b)
+{
+  int result = 0;
+  if(a->priority_idx < b->priority_idx)
+  {
+    result = -1;
+  }
+  else if(a->priority_idx > b->priority_idx)
+  {
+    result = +1;
+  }
+  else if(a->task->og_size < b->task->og_size)
+  {
+    result = -1;
+  }
+  else if(a->task->og_size > b->task->og_size)
+  {
+    result = +1;
+  }
+  return result;
+}
+
+internal DI_ConversionProgress
+di_conversion_progress(void)
+{
+  DI_ConversionProgress progress = {0};
+  MutexScope(di_shared->progress_mutex)
+  {
+    MemoryCopyStruct(&progress, &di_shared->progress);
+  }
+  return progress;
+}
+
 ////////////////////////////////
 //~ rjf: Asynchronous Tick
 
@@ -543,6 +607,16 @@ di_async_tick(void)
   {
     DI_Key key;
     String8 rdi_path;
+    OS_Handle file;
+    OS_Handle file_map;
+    FileProperties file_props;
+    void *file_base;
+    RDI_Parsed rdi_parsed_maybe_compressed;
+    Arena *rdi_parsed_arena;
+    U8 *decompressed_data;
+    U64 decompressed_size;
+    U64 decompress_unit_base;
+    U64 decompress_unit_count;
   };
   ParseTask *parse_tasks = 0;
   U64 parse_tasks_count = 0;
@@ -626,6 +700,22 @@ di_async_tick(void)
           }
         }
         
+        // rjf: if this is a high-priority duplicate of a task which is still in the
+        // low-priority queue, promote it. this is how debug info for modules which
+        // are visible on stopped threads' call stacks jumps ahead of everything else.
+        if(request_is_duplicate && priority_idx == 0)
+        {
+          for(DI_LoadTask *t = di_shared->first_load_task[1]; t != 0; t = t->next)
+          {
+            if(di_key_match(t->key, key))
+            {
+              DLLRemove(di_shared->first_load_task[1], di_shared->last_load_task[1], t);
+              DLLPushBack(di_shared->first_load_task[0], di_shared->last_load_task[0], t);
+              break;
+            }
+          }
+        }
+        
         // rjf: if not a duplicate, create new task
         if(!request_is_duplicate)
         {
@@ -646,8 +736,17 @@ di_async_tick(void)
     }
     
     ////////////////////////////
-    //- rjf: update tasks: configure, launch if we can, & retire if we can
+    //- rjf: update tasks: analyze, gather conversions to launch, & retire if we can
     //
+    typedef struct CandidateNode CandidateNode;
+    struct CandidateNode
+    {
+      CandidateNode *next;
+      DI_ConversionCandidate v;
+    };
+    CandidateNode *first_candidate = 0;
+    CandidateNode *last_candidate = 0;
+    U64 candidates_count = 0;
     for EachElement(priority_idx, di_shared->first_load_task)
     {
       for(DI_LoadTask *t = di_shared->first_load_task[priority_idx], *next = 0; t != 0; t = next)
@@ -732,96 +831,19 @@ di_async_tick(void)
         }
         B32 rdi_is_stale = t->rdi_is_stale;
         
-        //- rjf: calculate thread counts for conversion processes
-        if(!og_is_rdi && rdi_is_stale && t->thread_count == 0)
-        {
-          U64 thread_count = 1;
-          U64 max_thread_count = os_get_system_info()->logical_processor_count/2;
-          if(priority_idx > 0)
-          {
-            max_thread_count = Max(1, max_thread_count/2);
-          }
-          {
-            if(0){}
-            else if(og_size <= MB(4))   {thread_count = 1;}
-            else if(og_size <= MB(256)) {thread_count = max_thread_count/4;}
-            else if(og_size <= MB(512)) {thread_count = max_thread_count/3;}
-            else if(og_size <= GB(1)) {thread_count = max_thread_count/2;}
-            else {thread_count = max_thread_count;}
-          }
-          thread_count = Max(1, thread_count);
-          t->thread_count = thread_count;
-        }
-        
-        //- rjf: determine if there are threads available
-        B32 threads_available = 0;
-        {
-          U64 max_threads = os_get_system_info()->logical_processor_count/2;
-          U64 current_threads = di_shared->conversion_thread_count;
-          U64 needed_threads = (current_threads + t->thread_count);
-          threads_available = (max_threads >= needed_threads);
-        }
-        
-        //- rjf: if this conversion will overwrite an RDI we already have in cache,
-        // then we need to evict the old one from the cache.
-        B32 ready_to_launch_conversion = (threads_available && !og_is_rdi && rdi_is_stale && t->thread_count != 0 && t->status != DI_LoadTaskStatus_Active);
-        if(ready_to_launch_conversion)
-        {
-          U64 path2key_hash = u64_hash_from_str8(og_path);
-          U64 path2key_slot_idx = path2key_hash%di_shared->path2key_slots_count;
-          DI_KeySlot *path2key_slot = &di_shared->path2key_slots[path2key_slot_idx];
-          Stripe *path2key_stripe = stripe_from_slot_idx(&di_shared->path2key_stripes, path2key_slot_idx);
-          RWMutexScope(path2key_stripe->rw_mutex, 0)
-          {
-            // NOTE(rjf): we need to iterate from last -> first, since we want to evict the
-            // most recent key.
-            for(DI_KeyPathNode *n = path2key_slot->last; n != 0; n = n->prev)
-            {
-              if(str8_match(n->path, og_path, 0) && !di_key_match(key, n->key))
-              {
-                di_close(n->key, 1);
-              }
-            }
-          }
-        }
-        
-        //- rjf: launch conversion processes
-        if(og_is_good && ready_to_launch_conversion)
+        //- rjf: gather conversions which need launching; these are scheduled
+        // after all tasks are updated, so that threads freed by conversions which
+        // completed this tick can be handed out immediately
+        B32 needs_conversion = (!og_is_rdi && rdi_is_stale && t->status != DI_LoadTaskStatus_Active);
+        if(og_is_good && needs_conversion)
         {
-          B32 should_compress = 0;
-          OS_ProcessLaunchParams params = {0};
-          params.path = os_get_process_info()->binary_path;
-          params.inherit_env = 1;
-          params.consoleless = 1;
-          str8_list_pushf(scratch.arena, &params.cmd_line, "raddbg");
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--bin");
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--quiet");
-          if(should_compress)
-          {
-            str8_list_pushf(scratch.arena, &params.cmd_line, "--compress");
-          }
-          // str8_list_pushf(scratch.arena, &params.cmd_line, "--capture");
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--rdi");
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--out:%S", rdi_path);
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--thread_count:%I64u", t->thread_count);
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--signal_pid:%I64u", (U64)os_get_process_info()->pid);
-          str8_list_pushf(scratch.arena, &params.cmd_line, "--signal_code:%I64u", (U64)t);
-          str8_list_pushf(scratch.arena, &params.cmd_line, "%S", og_path);
-          ProfMsg("launch creation for %.*s", str8_varg(rdi_path));
-          t->process = os_process_launch(&params);
-          t->status = DI_LoadTaskStatus_Active;
-          di_shared->conversion_process_count += 1;
-          di_shared->conversion_thread_count += t->thread_count;
-          
-          // rjf: send event
-          MutexScope(di_shared->event_mutex)
-          {
-            DI_EventNode *n = push_array(di_shared->event_arena, DI_EventNode, 1);
-            SLLQueuePush(di_shared->events.first, di_shared->events.last, n);
-            di_shared->events.count += 1;
-            n->v.kind = DI_EventKind_ConversionStarted;
-            n->v.string = str8_copy(di_shared->event_arena, rdi_path);
-          }
+          CandidateNode *n = push_array(scratch.arena, CandidateNode, 1);
+          n->v.task         = t;
+          n->v.priority_idx = priority_idx;
+          n->v.og_path      = og_path;
+          n->v.rdi_path     = rdi_path;
+          SLLQueuePush(first_candidate, last_candidate, n);
+          candidates_count += 1;
         }
         
         //- rjf: if active & process has completed, mark as done
@@ -847,12 +869,28 @@ di_async_tick(void)
               t->status = DI_LoadTaskStatus_Done;
               di_shared->conversion_process_count -= 1;
               di_shared->conversion_thread_count -= t->thread_count;
+              
+              // rjf: update measured conversion throughput (small conversions are
+              // dominated by process startup, so they're skipped)
+              U64 elapsed_us = os_now_microseconds() - t->launch_us;
+              if(t->og_size >= MB(8) && elapsed_us != 0)
+              {
+                F64 bytes_per_thread_us = (F64)t->og_size / ((F64)elapsed_us * (F64)t->thread_count);
+                if(di_shared->conversion_bytes_per_thread_us <= 0)
+                {
+                  di_shared->conversion_bytes_per_thread_us = bytes_per_thread_us;
+                }
+                else
+                {
+                  di_shared->conversion_bytes_per_thread_us = (di_shared->conversion_bytes_per_thread_us + bytes_per_thread_us)/2;
+                }
+              }
             }
           }
         }
         
-        //- rjf: ready to launch, but bad O.G. file -> just immediately mark as done
-        if(!og_is_good && ready_to_launch_conversion)
+        //- rjf: needs conversion, but bad O.G. file -> just immediately mark as done
+        if(!og_is_good && needs_conversion)
         {
           t->status = DI_LoadTaskStatus_Done;
         }
@@ -891,6 +929,162 @@ di_async_tick(void)
           SLLQueuePush(first_parse_task, last_parse_task, n);
           parse_tasks_count += 1;
         }
+      }
+    }
+    
+    ////////////////////////////
+    //- rjf: schedule & launch conversions. threads are handed out from a single
+    // global budget - high priority conversions (debug info which is visible on
+    // stopped threads) first, then everything else, smallest first, so that
+    // many small conversions don't queue up behind one enormous one. each
+    // conversion waits until at least half of its desired thread count is
+    // available, and while a high priority conversion waits, no low priority
+    // conversions are started, so the budget drains to it as others finish.
+    //
+    U64 max_threads = Max(1, os_get_system_info()->logical_processor_count/2);
+    {
+      DI_ConversionCandidate *candidates = push_array(scratch.arena, DI_ConversionCandidate, candidates_count);
+      {
+        U64 idx = 0;
+        for EachNode(n, CandidateNode, first_candidate)
+        {
+          candidates[idx] = n->v;
+          idx += 1;
+        }
+      }
+      quick_sort(candidates, candidates_count, sizeof(candidates[0]), di_conversion_candidate_qsort_compare);
+      B32 high_priority_waiting = 0;
+      for EachIndex(idx, candidates_count)
+      {
+        DI_ConversionCandidate *c = &candidates[idx];
+        DI_LoadTask *t = c->task;
+        
+        //- rjf: determine thread count
+        U64 free_threads = max_threads - Min(max_threads, di_shared->conversion_thread_count);
+        U64 desired_threads = di_conversion_thread_count_from_size(t->og_size, max_threads);
+        U64 min_threads = Max(1, desired_threads/2);
+        B32 can_launch = (free_threads >= min_threads && !(c->priority_idx != 0 && high_priority_waiting));
+        if(!can_launch)
+        {
+          if(c->priority_idx == 0)
+          {
+            high_priority_waiting = 1;
+          }
+          continue;
+        }
+        t->thread_count = Min(desired_threads, free_threads);
+        
+        //- rjf: if this conversion will overwrite an RDI we already have in cache,
+        // then we need to evict the old one from the cache.
+        {
+          U64 path2key_hash = u64_hash_from_str8(c->og_path);
+          U64 path2key_slot_idx = path2key_hash%di_shared->path2key_slots_count;
+          DI_KeySlot *path2key_slot = &di_shared->path2key_slots[path2key_slot_idx];
+          Stripe *path2key_stripe = stripe_from_slot_idx(&di_shared->path2key_stripes, path2key_slot_idx);
+          RWMutexScope(path2key_stripe->rw_mutex, 0)
+          {
+            // NOTE(rjf): we need to iterate from last -> first, since we want to evict the
+            // most recent key.
+            for(DI_KeyPathNode *n = path2key_slot->last; n != 0; n = n->prev)
+            {
+              if(str8_match(n->path, c->og_path, 0) && !di_key_match(t->key, n->key))
+              {
+                di_close(n->key, 1);
+              }
+            }
+          }
+        }
+        
+        //- rjf: launch conversion process
+        {
+          B32 should_compress = 0;
+          OS_ProcessLaunchParams params = {0};
+          params.path = os_get_process_info()->binary_path;
+          params.inherit_env = 1;
+          params.consoleless = 1;
+          str8_list_pushf(scratch.arena, &params.cmd_line, "raddbg");
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--bin");
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--quiet");
+          if(should_compress)
+          {
+            str8_list_pushf(scratch.arena, &params.cmd_line, "--compress");
+          }
+          // str8_list_pushf(scratch.arena, &params.cmd_line, "--capture");
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--rdi");
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--out:%S", c->rdi_path);
+          
+          // NOTE(rjf): a stale RDI left at the output path, from a previous build of
+          // this module, can still be used to skip re-baking everything which did
+          // not change.
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--incremental");
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--thread_count:%I64u", t->thread_count);
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--signal_pid:%I64u", (U64)os_get_process_info()->pid);
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--signal_code:%I64u", (U64)t);
+          str8_list_pushf(scratch.arena, &params.cmd_line, "%S", c->og_path);
+          ProfMsg("launch creation for %.*s", str8_varg(c->rdi_path));
+          t->process = os_process_launch(&params);
+          t->status = DI_LoadTaskStatus_Active;
+          t->launch_us = os_now_microseconds();
+          di_shared->conversion_process_count += 1;
+          di_shared->conversion_thread_count += t->thread_count;
+        }
+        
+        //- rjf: send event
+        MutexScope(di_shared->event_mutex)
+        {
+          DI_EventNode *n = push_array(di_shared->event_arena, DI_EventNode, 1);
+          SLLQueuePush(di_shared->events.first, di_shared->events.last, n);
+          di_shared->events.count += 1;
+          n->v.kind = DI_EventKind_ConversionStarted;
+          n->v.string = str8_copy(di_shared->event_arena, c->rdi_path);
+        }
+      }
+    }
+    
+    ////////////////////////////
+    //- rjf: compute global conversion progress. remaining work is estimated in
+    // thread-microseconds from the measured conversion throughput, & spread
+    // over the thread budget.
+    //
+    {
+      // NOTE(rjf): until a conversion has been measured, guess ~16 MB/s/thread.
+      F64 bytes_per_thread_us = di_shared->conversion_bytes_per_thread_us;
+      if(bytes_per_thread_us <= 0)
+      {
+        bytes_per_thread_us = 16.0;
+      }
+      U64 now_us = os_now_microseconds();
+      F64 remaining_thread_us = 0;
+      U64 longest_remaining_us = 0;
+      DI_ConversionProgress progress = {0};
+      progress.max_thread_count = max_threads;
+      for EachElement(priority_idx, di_shared->first_load_task)
+      {
+        for EachNode(t, DI_LoadTask, di_shared->first_load_task[priority_idx])
+        {
+          if(t->status == DI_LoadTaskStatus_Active)
+          {
+            U64 expected_us = (U64)((F64)t->og_size / (bytes_per_thread_us * (F64)t->thread_count));
+            U64 elapsed_us = now_us - t->launch_us;
+            U64 remaining_us = (expected_us > elapsed_us ? expected_us - elapsed_us : 0);
+            progress.active_count += 1;
+            progress.active_thread_count += t->thread_count;
+            progress.remaining_size += (expected_us != 0 ? (U64)((F64)t->og_size * ((F64)remaining_us / (F64)expected_us)) : 0);
+            remaining_thread_us += (F64)remaining_us * (F64)t->thread_count;
+            longest_remaining_us = Max(longest_remaining_us, remaining_us);
+          }
+          else if(t->og_size != 0 && !t->og_is_rdi && t->rdi_is_stale)
+          {
+            progress.pending_count += 1;
+            progress.remaining_size += t->og_size;
+            remaining_thread_us += (F64)t->og_size / bytes_per_thread_us;
+          }
+        }
+      }
+      progress.eta_us = Max(longest_remaining_us, (U64)(remaining_thread_us / (F64)max_threads));
+      MutexScope(di_shared->progress_mutex)
+      {
+        MemoryCopyStruct(&di_shared->progress, &progress);
       }
     }
     
@@ -914,112 +1108,166 @@ di_async_tick(void)
   //////////////////////////////
   //- rjf: do wide load of all prepped RDIs
   //
-  U64 parse_task_take_counter = 0;
-  U64 *parse_task_take_counter_ptr = 0;
+  // NOTE(rjf): this happens in three wide phases: (a) open, map, & parse each
+  // RDI, and lay out its decompressed buffer, (b) decompress all sections (or
+  // blocks of sections) of all RDIs, with all lanes taking independent units,
+  // so that one large RDI is not bottlenecked on one lane, and (c) re-parse &
+  // commit each RDI to the cache.
+  //
+  U64 take_counters[3] = {0};
+  U64 *take_counters_ptr = 0;
   if(lane_idx() == 0)
   {
-    parse_task_take_counter_ptr = &parse_task_take_counter;
+    take_counters_ptr = &take_counters[0];
   }
-  lane_sync_u64(&parse_task_take_counter_ptr, 0);
+  lane_sync_u64(&take_counters_ptr, 0);
+  
+  //- rjf: (a) open, map, parse, lay out decompressed buffers
+  for(;;)
   {
-    for(;;)
+    //- rjf: take next task
+    U64 parse_task_idx = ins_atomic_u64_inc_eval(&take_counters_ptr[0]) - 1;
+    if(parse_task_idx >= parse_tasks_count)
     {
-      //- rjf: take next task
-      U64 parse_task_idx = ins_atomic_u64_inc_eval(parse_task_take_counter_ptr) - 1;
-      if(parse_task_idx >= parse_tasks_count)
-      {
-        break;
-      }
-      
-      //- rjf: unpack task
-      DI_Key key = parse_tasks[parse_task_idx].key;
-      String8 rdi_path = parse_tasks[parse_task_idx].rdi_path;
-      ProfBegin("parse %.*s", str8_varg(rdi_path));
-      
-      //- rjf: open file
-      OS_Handle file = {0};
-      OS_Handle file_map = {0};
-      FileProperties file_props = {0};
-      void *file_base = 0;
+      break;
+    }
+    ParseTask *task = &parse_tasks[parse_task_idx];
+    ProfBegin("open %.*s", str8_varg(task->rdi_path));
+    
+    //- rjf: open file
+    {
+      task->file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_ShareRead|OS_AccessFlag_ShareWrite, task->rdi_path);
+      task->file_map = os_file_map_open(OS_AccessFlag_Read, task->file);
+      task->file_props = os_properties_from_file(task->file);
+      task->file_base = os_file_map_view_open(task->file_map, OS_AccessFlag_Read, r1u64(0, task->file_props.size));
+    }
+    
+    //- rjf: do initial parse of rdi
+    task->rdi_parsed_maybe_compressed = rdi_parsed_nil;
+    {
+      RDI_ParseStatus parse_status = rdi_parse((U8 *)task->file_base, task->file_props.size, &task->rdi_parsed_maybe_compressed);
+      (void)parse_status;
+    }
+    
+    //- rjf: lay out decompressed buffer, if necessary
+    {
+      U64 decompressed_size = rdi_decompressed_size_from_parsed(&task->rdi_parsed_maybe_compressed);
+      if(decompressed_size > task->file_props.size)
       {
-        file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_ShareRead|OS_AccessFlag_ShareWrite, rdi_path);
-        file_map = os_file_map_open(OS_AccessFlag_Read, file);
-        file_props = os_properties_from_file(file);
-        file_base = os_file_map_view_open(file_map, OS_AccessFlag_Read, r1u64(0, file_props.size));
+        task->rdi_parsed_arena = arena_alloc();
+        task->decompressed_data = push_array_no_zero(task->rdi_parsed_arena, U8, decompressed_size);
+        task->decompressed_size = decompressed_size;
+        task->decompress_unit_count = rdi_decompress_unit_count_from_parsed(&task->rdi_parsed_maybe_compressed);
+        rdi_decompress_parsed_layout(task->decompressed_data, decompressed_size, &task->rdi_parsed_maybe_compressed);
       }
-      
-      //- rjf: do initial parse of rdi
-      RDI_Parsed rdi_parsed_maybe_compressed = rdi_parsed_nil;
+    }
+    
+    ProfEnd();
+  }
+  lane_sync();
+  
+  //- rjf: gather decompression units across all tasks
+  U64 decompress_unit_count = 0;
+  if(lane_idx() == 0)
+  {
+    for EachIndex(idx, parse_tasks_count)
+    {
+      parse_tasks[idx].decompress_unit_base = decompress_unit_count;
+      decompress_unit_count += parse_tasks[idx].decompress_unit_count;
+    }
+  }
+  lane_sync_u64(&decompress_unit_count, 0);
+  
+  //- rjf: (b) decompress all units, wide
+  ProfScope("decompress %I64u units", decompress_unit_count)
+  {
+    U64 parse_task_idx = 0;
+    for(;;)
+    {
+      U64 unit_idx = ins_atomic_u64_inc_eval(&take_counters_ptr[1]) - 1;
+      if(unit_idx >= decompress_unit_count)
       {
-        RDI_ParseStatus parse_status = rdi_parse((U8 *)file_base, file_props.size, &rdi_parsed_maybe_compressed);
-        (void)parse_status;
+        break;
       }
-      
-      //- rjf: decompress & re-parse, if necessary
-      Arena *rdi_parsed_arena = 0;
-      RDI_Parsed rdi_parsed = rdi_parsed_maybe_compressed;
+      for(;unit_idx < parse_tasks[parse_task_idx].decompress_unit_base ||
+          parse_tasks[parse_task_idx].decompress_unit_base + parse_tasks[parse_task_idx].decompress_unit_count <= unit_idx;
+          parse_task_idx = (parse_task_idx + 1) % parse_tasks_count);
+      ParseTask *task = &parse_tasks[parse_task_idx];
+      rdi_decompress_parsed_unit(task->decompressed_data, task->decompressed_size, &task->rdi_parsed_maybe_compressed, unit_idx - task->decompress_unit_base);
+    }
+  }
+  lane_sync();
+  
+  //- rjf: (c) re-parse & commit
+  for(;;)
+  {
+    //- rjf: take next task
+    U64 parse_task_idx = ins_atomic_u64_inc_eval(&take_counters_ptr[2]) - 1;
+    if(parse_task_idx >= parse_tasks_count)
+    {
+      break;
+    }
+    ParseTask *task = &parse_tasks[parse_task_idx];
+    DI_Key key = task->key;
+    ProfBegin("parse %.*s", str8_varg(task->rdi_path));
+    
+    //- rjf: re-parse decompressed data, if necessary
+    RDI_Parsed rdi_parsed = task->rdi_parsed_maybe_compressed;
+    if(task->decompressed_data != 0)
+    {
+      RDI_ParseStatus parse_status = rdi_parse(task->decompressed_data, task->decompressed_size, &rdi_parsed);
+      (void)parse_status;
+    }
+    
+    //- rjf: commit parsed info to cache
+    {
+      ProfMsg("commit %.*s", str8_varg(task->rdi_path));
+      U64 hash = u64_hash_from_str8(str8_struct(&key));
+      U64 slot_idx = hash%di_shared->slots_count;
+      DI_Slot *slot = &di_shared->slots[slot_idx];
+      Stripe *stripe = stripe_from_slot_idx(&di_shared->stripes, slot_idx);
+      RWMutexScope(stripe->rw_mutex, 1)
       {
-        U64 decompressed_size = rdi_decompressed_size_from_parsed(&rdi_parsed_maybe_compressed);
-        if(decompressed_size > file_props.size)
-        {
-          rdi_parsed_arena = arena_alloc();
-          U8 *decompressed_data = push_array_no_zero(rdi_parsed_arena, U8, decompressed_size);
-          rdi_decompress_parsed(decompressed_data, decompressed_size, &rdi_parsed_maybe_compressed);
-          RDI_ParseStatus parse_status = rdi_parse(decompressed_data, decompressed_size, &rdi_parsed);
-          (void)parse_status;
-        }
-      }
-      
-      //- rjf: commit parsed info to cache
-      {
-        ProfMsg("commit %.*s", str8_varg(rdi_path));
-        U64 hash = u64_hash_from_str8(str8_struct(&key));
-        U64 slot_idx = hash%di_shared->slots_count;
-        DI_Slot *slot = &di_shared->slots[slot_idx];
-        Stripe *stripe = stripe_from_slot_idx(&di_shared->stripes, slot_idx);
-        RWMutexScope(stripe->rw_mutex, 1)
+        DI_Node *node = 0;
+        for(DI_Node *n = slot->first; n != 0; n = n->next)
         {
-          DI_Node *node = 0;
-          for(DI_Node *n = slot->first; n != 0; n = n->next)
+          if(di_key_match(n->key, key))
           {
-            if(di_key_match(n->key, key))
-            {
-              node = n;
-              break;
-            }
+            node = n;
+            break;
           }
-          if(node)
+        }
+        if(node)
+        {
+          node->file = task->file;
+          node->file_map = task->file_map;
+          node->file_props = task->file_props;
+          node->file_base = task->file_base;
+          node->arena = task->rdi_parsed_arena;
+          MemoryCopyStruct(&node->rdi, &rdi_parsed);
+          node->completion_count += 1;
+          node->working_count -= 1;
+          if(node->rdi.raw_data_size != 0)
           {
-            node->file = file;
-            node->file_map = file_map;
-            node->file_props = file_props;
-            node->file_base = file_base;
-            node->arena = rdi_parsed_arena;
-            MemoryCopyStruct(&node->rdi, &rdi_parsed);
-            node->completion_count += 1;
-            node->working_count -= 1;
-            if(node->rdi.raw_data_size != 0)
-            {
-              ins_atomic_u64_inc_eval(&di_shared->load_gen);
-            }
-            ins_atomic_u64_inc_eval(&di_shared->load_count);
+            ins_atomic_u64_inc_eval(&di_shared->load_gen);
           }
-          else
+          ins_atomic_u64_inc_eval(&di_shared->load_count);
+        }
+        else
+        {
+          if(task->rdi_parsed_arena != 0)
           {
-            if(rdi_parsed_arena != 0)
-            {
-              arena_release(rdi_parsed_arena);
-            }
-            os_file_map_view_close(file_map, file_base, r1u64(0, file_props.size));
-            os_file_map_close(file_map);
-            os_file_close(file);
+            arena_release(task->rdi_parsed_arena);
           }
+          os_file_map_view_close(task->file_map, task->file_base, r1u64(0, task->file_props.size));
+          os_file_map_close(task->file_map);
+          os_file_close(task->file);
         }
-        cond_var_broadcast(stripe->cv);
       }
-      
-      ProfEnd();
+      cond_var_broadcast(stripe->cv);
     }
+    
+    ProfEnd();
   }
   lane_sync();
   
@@ -1070,20 +1318,323 @@ di_conversion_completion_signal_receiver_thread_entry_point(void *p)
 }
 
 ////////////////////////////////
-//~ rjf: Search Artifact Cache Hooks / Lookups
+//~ rjf: Search Indices
 
-internal AC_Artifact
-di_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+internal U8
+di_search_char_from_char(U8 c)
+{
+  // NOTE(rjf): must agree with the case- & slash-insensitivity of fuzzy_match_find
+  U8 result = upper_from_char(c);
+  if(result == '\\')
+  {
+    result = '/';
+  }
+  return result;
+}
+
+internal U64
+di_search_trigram_slot_idx_from_chars(U8 c0, U8 c1, U8 c2)
+{
+  U32 trigram = ((U32)c0 | ((U32)c1 << 8) | ((U32)c2 << 16));
+  U64 result = ((trigram*2654435761u) >> 8) % DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT;
+  return result;
+}
+
+internal U64
+di_search_char_mask_from_string(String8 string)
+{
+  U64 result = 0;
+  for EachIndex(idx, string.size)
+  {
+    result |= (1ull << (di_search_char_from_char(string.str[idx]) & 63));
+  }
+  return result;
+}
+
+internal DI_SearchIndex *
+di_search_index_build(RDI_Parsed *rdi, RDI_SectionKind section_kind)
 {
   ProfBeginFunction();
-  Access *access = access_open();
   Temp scratch = scratch_begin(0, 0);
-  AC_Artifact artifact = {0};
+  
+  //- rjf: set up index & per-lane arenas
+  DI_SearchIndex *index = 0;
+  if(lane_idx() == 0)
   {
-    //- rjf: unpack key
-    RDI_SectionKind section_kind = RDI_SectionKind_NULL;
-    String8 query = {0};
-    {
+    Arena *arena = arena_alloc();
+    index = push_array(arena, DI_SearchIndex, 1);
+    index->arenas_count = lane_count();
+    index->arenas = push_array(arena, Arena *, index->arenas_count);
+    index->arenas[0] = arena;
+    index->section_kind = section_kind;
+    rdi_section_raw_table_from_kind(rdi, section_kind, &index->element_count);
+    index->element_names = push_array(arena, String8, index->element_count);
+    index->element_char_masks = push_array(arena, U64, index->element_count);
+    index->trigram_slot_offs = push_array(arena, U64, DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT+1);
+    index->memo_mutex = mutex_alloc();
+    index->memo_arena = arena_alloc();
+  }
+  lane_sync_u64(&index, 0);
+  if(lane_idx() != 0)
+  {
+    index->arenas[lane_idx()] = arena_alloc();
+  }
+  Arena *arena = index->arenas[lane_idx()];
+  
+  //- rjf: unpack table info
+  U64 element_count = 0;
+  void *table_base = rdi_section_raw_table_from_kind(rdi, section_kind, &element_count);
+  U64 element_size = rdi_section_element_size_table[section_kind];
+  U64 element_name_idx_off = 0;
+  switch(section_kind)
+  {
+    default:{}break;
+    case RDI_SectionKind_Procedures:
+    {
+      element_name_idx_off = OffsetOf(RDI_Procedure, name_string_idx);
+    }break;
+    case RDI_SectionKind_GlobalVariables:
+    {
+      element_name_idx_off = OffsetOf(RDI_GlobalVariable, name_string_idx);
+    }break;
+    case RDI_SectionKind_ThreadVariables:
+    {
+      element_name_idx_off = OffsetOf(RDI_ThreadVariable, name_string_idx);
+    }break;
+    case RDI_SectionKind_UDTs:
+    {
+      // NOTE(rjf): name must be determined from self_type_idx
+    }break;
+    case RDI_SectionKind_SourceFiles:
+    {
+      // NOTE(rjf): name must be determined from file path node chain
+    }break;
+  }
+  
+  //- rjf: set up per-lane trigram counting state
+  U32 **lanes_slot_counts = 0;
+  U64 **lanes_slot_offs = 0;
+  if(lane_idx() == 0)
+  {
+    lanes_slot_counts = push_array(scratch.arena, U32 *, lane_count());
+    lanes_slot_offs = push_array(scratch.arena, U64 *, lane_count());
+  }
+  lane_sync_u64(&lanes_slot_counts, 0);
+  lane_sync_u64(&lanes_slot_offs, 0);
+  lanes_slot_counts[lane_idx()] = push_array(scratch.arena, U32, DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT);
+  lanes_slot_offs[lane_idx()] = push_array(scratch.arena, U64, DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT);
+  U32 *slot_last_idx_plus_one = push_array(scratch.arena, U32, DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT);
+  Rng1U64 range = lane_range(element_count);
+  
+  //- rjf: map elements -> names & character masks; count unique trigrams per slot
+  ProfScope("map elements -> names & character masks; count unique trigrams per slot")
+  {
+    U32 *slot_counts = lanes_slot_counts[lane_idx()];
+    for EachInRange(idx, range)
+    {
+      void *element = (U8 *)table_base + element_size*idx;
+      String8 name = {0};
+      switch(section_kind)
+      {
+        case RDI_SectionKind_UDTs:
+        {
+          RDI_UDT *udt = (RDI_UDT *)element;
+          RDI_TypeNode *type_node = rdi_element_from_name_idx(rdi, TypeNodes, udt->self_type_idx);
+          name.str = rdi_string_from_idx(rdi, type_node->user_defined.name_string_idx, &name.size);
+        }break;
+        case RDI_SectionKind_SourceFiles:
+        {
+          Temp temp = temp_begin(scratch.arena);
+          RDI_SourceFile *file = (RDI_SourceFile *)element;
+          String8List path_parts = {0};
+          for(RDI_FilePathNode *fpn = rdi_element_from_name_idx(rdi, FilePathNodes, file->file_path_node_idx);
+              fpn != rdi_element_from_name_idx(rdi, FilePathNodes, 0);
+              fpn = rdi_element_from_name_idx(rdi, FilePathNodes, fpn->parent_path_node))
+          {
+            String8 path_part = {0};
+            path_part.str = rdi_string_from_idx(rdi, fpn->name_string_idx, &path_part.size);
+            str8_list_push_front(temp.arena, &path_parts, path_part);
+          }
+          StringJoin join = {0};
+          join.sep = str8_lit("/");
+          name = str8_list_join(arena, &path_parts, &join);
+          temp_end(temp);
+        }break;
+        default:
+        {
+          U32 name_idx = *(U32 *)((U8 *)element + element_name_idx_off);
+          name.str = rdi_string_from_idx(rdi, name_idx, &name.size);
+        }break;
+      }
+      index->element_names[idx] = name;
+      index->element_char_masks[idx] = di_search_char_mask_from_string(name);
+      for(U64 off = 0; off+3 <= name.size; off += 1)
+      {
+        U64 slot_idx = di_search_trigram_slot_idx_from_chars(di_search_char_from_char(name.str[off+0]),
+                                                             di_search_char_from_char(name.str[off+1]),
+                                                             di_search_char_from_char(name.str[off+2]));
+        if(slot_last_idx_plus_one[slot_idx] != idx+1)
+        {
+          slot_last_idx_plus_one[slot_idx] = idx+1;
+          slot_counts[slot_idx] += 1;
+        }
+      }
+    }
+  }
+  lane_sync();
+  
+  //- rjf: compute lane * slot *relative* offset table
+  {
+    Rng1U64 slot_range = lane_range(DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT);
+    for EachInRange(slot_idx, slot_range)
+    {
+      U64 layout_off = 0;
+      for EachIndex(lane_idx, lane_count())
+      {
+        lanes_slot_offs[lane_idx][slot_idx] = layout_off;
+        layout_off += lanes_slot_counts[lane_idx][slot_idx];
+      }
+      index->trigram_slot_offs[slot_idx+1] = layout_off;
+    }
+  }
+  lane_sync();
+  
+  //- rjf: convert per-slot sizes -> absolute offsets; allocate postings
+  if(lane_idx() == 0)
+  {
+    for EachIndex(slot_idx, DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT)
+    {
+      index->trigram_slot_offs[slot_idx+1] += index->trigram_slot_offs[slot_idx];
+    }
+    index->trigram_idxs = push_array_no_zero(arena, U32, index->trigram_slot_offs[DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT]);
+  }
+  lane_sync();
+  
+  //- rjf: fill postings; lanes own ascending element ranges, so each slot's
+  // postings come out sorted
+  ProfScope("fill trigram postings")
+  {
+    U64 *slot_offs = lanes_slot_offs[lane_idx()];
+    MemoryZero(slot_last_idx_plus_one, sizeof(slot_last_idx_plus_one[0])*DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT);
+    for EachInRange(idx, range)
+    {
+      String8 name = index->element_names[idx];
+      for(U64 off = 0; off+3 <= name.size; off += 1)
+      {
+        U64 slot_idx = di_search_trigram_slot_idx_from_chars(di_search_char_from_char(name.str[off+0]),
+                                                             di_search_char_from_char(name.str[off+1]),
+                                                             di_search_char_from_char(name.str[off+2]));
+        if(slot_last_idx_plus_one[slot_idx] != idx+1)
+        {
+          slot_last_idx_plus_one[slot_idx] = idx+1;
+          index->trigram_idxs[index->trigram_slot_offs[slot_idx] + slot_offs[slot_idx]] = (U32)idx;
+          slot_offs[slot_idx] += 1;
+        }
+      }
+    }
+  }
+  lane_sync();
+  
+  scratch_end(scratch);
+  ProfEnd();
+  return index;
+}
+
+internal void
+di_search_index_release(DI_SearchIndex *index)
+{
+  Temp scratch = scratch_begin(0, 0);
+  U64 arenas_count = index->arenas_count;
+  Arena **arenas_copy = push_array(scratch.arena, Arena *, arenas_count);
+  MemoryCopy(arenas_copy, index->arenas, sizeof(Arena *) * arenas_count);
+  mutex_release(index->memo_mutex);
+  arena_release(index->memo_arena);
+  for EachIndex(idx, arenas_count)
+  {
+    if(arenas_copy[idx])
+    {
+      arena_release(arenas_copy[idx]);
+    }
+  }
+  scratch_end(scratch);
+}
+
+internal DI_SearchIndex *
+di_search_index_from_key(Access *access, DI_Key key, RDI_SectionKind section_kind)
+{
+  DI_SearchIndex *index = 0;
+  if(section_kind < RDI_SectionKind_COUNT)
+  {
+    U64 hash = u64_hash_from_str8(str8_struct(&key));
+    U64 slot_idx = hash%di_shared->slots_count;
+    DI_Slot *slot = &di_shared->slots[slot_idx];
+    Stripe *stripe = stripe_from_slot_idx(&di_shared->stripes, slot_idx);
+    RWMutexScope(stripe->rw_mutex, 0)
+    {
+      for(DI_Node *n = slot->first; n != 0; n = n->next)
+      {
+        if(di_key_match(n->key, key) && ins_atomic_u64_eval(&n->completion_count) > 0)
+        {
+          index = n->search_indexes[section_kind];
+          if(index != 0)
+          {
+            access_touch(access, &n->access_pt, stripe->cv);
+          }
+          break;
+        }
+      }
+    }
+  }
+  return index;
+}
+
+internal DI_SearchIndex *
+di_search_index_commit(DI_Key key, DI_SearchIndex *index)
+{
+  DI_SearchIndex *result = 0;
+  {
+    U64 hash = u64_hash_from_str8(str8_struct(&key));
+    U64 slot_idx = hash%di_shared->slots_count;
+    DI_Slot *slot = &di_shared->slots[slot_idx];
+    Stripe *stripe = stripe_from_slot_idx(&di_shared->stripes, slot_idx);
+    RWMutexScope(stripe->rw_mutex, 1)
+    {
+      for(DI_Node *n = slot->first; n != 0; n = n->next)
+      {
+        if(di_key_match(n->key, key) && ins_atomic_u64_eval(&n->completion_count) > 0)
+        {
+          if(n->search_indexes[index->section_kind] == 0)
+          {
+            n->search_indexes[index->section_kind] = index;
+          }
+          result = n->search_indexes[index->section_kind];
+          break;
+        }
+      }
+    }
+  }
+  if(result != index)
+  {
+    di_search_index_release(index);
+  }
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Search Artifact Cache Hooks / Lookups
+
+internal AC_Artifact
+di_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  ProfBeginFunction();
+  Access *access = access_open();
+  Temp scratch = scratch_begin(0, 0);
+  AC_Artifact artifact = {0};
+  {
+    //- rjf: unpack key
+    RDI_SectionKind section_kind = RDI_SectionKind_NULL;
+    String8 query = {0};
+    {
       U64 key_read_off = 0;
       key_read_off += str8_deserial_read_struct(key, key_read_off, &section_kind);
       key_read_off += str8_deserial_read_struct(key, key_read_off, &query.size);
@@ -1122,6 +1673,64 @@ di_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *
     }
     lane_sync();
     
+    //- rjf: map all RDIs -> search indices, building missing indices wide
+    DI_SearchIndex **indexes = 0;
+    ProfScope("map all RDIs -> search indices")
+    {
+      if(lane_idx() == 0)
+      {
+        indexes = push_array(scratch.arena, DI_SearchIndex *, keys.count);
+      }
+      lane_sync_u64(&indexes, 0);
+      for EachIndex(rdi_idx, keys.count)
+      {
+        DI_SearchIndex *index = 0;
+        if(lane_idx() == 0)
+        {
+          index = di_search_index_from_key(access, keys.v[rdi_idx], section_kind);
+        }
+        lane_sync_u64(&index, 0);
+        if(index == 0 && rdis[rdi_idx] != &rdi_parsed_nil && section_kind < RDI_SectionKind_COUNT)
+        {
+          index = di_search_index_build(rdis[rdi_idx], section_kind);
+          if(lane_idx() == 0)
+          {
+            index = di_search_index_commit(keys.v[rdi_idx], index);
+          }
+          lane_sync_u64(&index, 0);
+        }
+        if(lane_idx() == 0)
+        {
+          indexes[rdi_idx] = index;
+        }
+      }
+    }
+    lane_sync();
+    
+    //- rjf: "name*" -> prefix query; only names starting with "name" (exactly,
+    // in byte order) match, and candidates come from the RDI's sorted name
+    // index, if it has one, instead of trigram postings
+    String8 match_query = query;
+    B32 query_is_prefix = (query.size > 1 && query.str[query.size-1] == '*' &&
+                           str8_find_needle(query, 0, str8_lit(" "), 0) == query.size);
+    RDI_NameMapKind prefix_name_map_kind = RDI_NameMapKind_NULL;
+    if(query_is_prefix)
+    {
+      match_query = str8_chop(query, 1);
+      switch(section_kind)
+      {
+        default:{}break;
+        case RDI_SectionKind_Procedures:      {prefix_name_map_kind = RDI_NameMapKind_Procedures;}break;
+        case RDI_SectionKind_GlobalVariables: {prefix_name_map_kind = RDI_NameMapKind_GlobalVariables;}break;
+        case RDI_SectionKind_ThreadVariables: {prefix_name_map_kind = RDI_NameMapKind_ThreadVariables;}break;
+      }
+    }
+    
+    //- rjf: split query into parts; compute query character mask
+    String8List query_parts = str8_split(scratch.arena, match_query, (U8 *)" ", 1, 0);
+    U64 query_char_mask = di_search_char_mask_from_string(match_query);
+    query_char_mask &= ~(1ull << (' ' & 63));
+    
     //- rjf: do wide search on all lanes
     Arena *arena = arena_alloc();
     Arena **arenas = 0;
@@ -1133,103 +1742,127 @@ di_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *
     lane_sync_u64(&arenas, 0);
     arenas[lane_idx()] = arena;
     DI_SearchItemChunkList *lanes_items = 0;
+    U32 **lanes_matched_idxs = 0;
+    U64 *lanes_matched_idxs_counts = 0;
     ProfScope("do wide search on all lanes")
     {
       if(lane_idx() == 0)
       {
         lanes_items = push_array(scratch.arena, DI_SearchItemChunkList, lane_count());
+        lanes_matched_idxs = push_array(scratch.arena, U32 *, lane_count());
+        lanes_matched_idxs_counts = push_array(scratch.arena, U64, lane_count());
       }
       lane_sync_u64(&lanes_items, 0);
+      lane_sync_u64(&lanes_matched_idxs, 0);
+      lane_sync_u64(&lanes_matched_idxs_counts, 0);
       {
         DI_SearchItemChunkList *lane_items = &lanes_items[lane_idx()];
         for EachIndex(rdi_idx, keys.count)
         {
           DI_Key key = keys.v[rdi_idx];
-          RDI_Parsed *rdi = rdis[rdi_idx];
-          
-          // rjf: unpack table info
-          U64 element_count = 0;
-          void *table_base = rdi_section_raw_table_from_kind(rdi, section_kind, &element_count);
-          U64 element_size = rdi_section_element_size_table[section_kind];
+          DI_SearchIndex *index = indexes[rdi_idx];
+          if(index == 0)
+          {
+            continue;
+          }
           
-          // rjf: determine name string index offset, depending on table kind
-          U64 element_name_idx_off = 0;
-          switch(section_kind)
+          //- rjf: pick narrowest candidate set: all elements, the postings of
+          // the rarest query trigram, or the matches of a previous query which
+          // this query extends
+          U32 *candidates = 0;
+          U64 candidates_count = 0;
+          if(lane_idx() == 0)
           {
-            default:{}break;
-            case RDI_SectionKind_Procedures:
-            {
-              element_name_idx_off = OffsetOf(RDI_Procedure, name_string_idx);
-            }break;
-            case RDI_SectionKind_GlobalVariables:
+            candidates_count = index->element_count;
+            for EachNode(n, String8Node, query_parts.first)
             {
-              element_name_idx_off = OffsetOf(RDI_GlobalVariable, name_string_idx);
-            }break;
-            case RDI_SectionKind_ThreadVariables:
-            {
-              element_name_idx_off = OffsetOf(RDI_ThreadVariable, name_string_idx);
-            }break;
-            case RDI_SectionKind_UDTs:
+              String8 part = n->string;
+              for(U64 off = 0; off+3 <= part.size; off += 1)
+              {
+                U64 slot_idx = di_search_trigram_slot_idx_from_chars(di_search_char_from_char(part.str[off+0]),
+                                                                     di_search_char_from_char(part.str[off+1]),
+                                                                     di_search_char_from_char(part.str[off+2]));
+                U64 slot_count = index->trigram_slot_offs[slot_idx+1] - index->trigram_slot_offs[slot_idx];
+                if(slot_count < candidates_count || candidates == 0)
+                {
+                  candidates = index->trigram_idxs + index->trigram_slot_offs[slot_idx];
+                  candidates_count = slot_count;
+                }
+              }
+            }
+            if(prefix_name_map_kind != RDI_NameMapKind_NULL)
             {
-              // NOTE(rjf): name must be determined from self_type_idx
-            }break;
-            case RDI_SectionKind_SourceFiles:
+              RDI_Parsed *rdi = rdis[rdi_idx];
+              RDI_NameMap *map = rdi_element_from_name_idx(rdi, NameMaps, prefix_name_map_kind);
+              RDI_ParsedNameMap parsed_map = {0};
+              rdi_parsed_from_name_map(rdi, map, &parsed_map);
+              if(parsed_map.sorted_nodes != 0)
+              {
+                U64 sorted_nodes_count = 0;
+                U32 *sorted_nodes = rdi_name_map_sorted_nodes_from_prefix(rdi, &parsed_map, match_query.str, match_query.size, &sorted_nodes_count);
+                U64 prefix_candidates_count = 0;
+                for EachIndex(sorted_idx, sorted_nodes_count)
+                {
+                  prefix_candidates_count += parsed_map.nodes[sorted_nodes[sorted_idx]].match_count;
+                }
+                if(prefix_candidates_count < candidates_count || candidates == 0)
+                {
+                  candidates = push_array_no_zero(scratch.arena, U32, prefix_candidates_count);
+                  candidates_count = 0;
+                  for EachIndex(sorted_idx, sorted_nodes_count)
+                  {
+                    U32 node_matches_count = 0;
+                    U32 *node_matches = rdi_matches_from_map_node(rdi, &parsed_map.nodes[sorted_nodes[sorted_idx]], &node_matches_count);
+                    for EachIndex(match_idx, node_matches_count)
+                    {
+                      if(node_matches[match_idx] < index->element_count && candidates_count < prefix_candidates_count)
+                      {
+                        candidates[candidates_count] = node_matches[match_idx];
+                        candidates_count += 1;
+                      }
+                    }
+                  }
+                }
+              }
+            }
+            MutexScope(index->memo_mutex)
             {
-              // NOTE(rjf): name must be determined from file path node chain
-            }break;
+              if(index->memo_query.size != 0 &&
+                 index->memo_idxs_count < candidates_count &&
+                 str8_match(str8_prefix(query, index->memo_query.size), index->memo_query, 0))
+              {
+                candidates_count = index->memo_idxs_count;
+                candidates = push_array_no_zero(scratch.arena, U32, candidates_count);
+                MemoryCopy(candidates, index->memo_idxs, sizeof(candidates[0])*candidates_count);
+              }
+            }
           }
+          lane_sync_u64(&candidates, 0);
+          lane_sync_u64(&candidates_count, 0);
           
-          Rng1U64 range = lane_range(element_count);
-          for EachInRange(idx, range)
+          //- rjf: fuzzy match all candidates in this lane's range
+          Rng1U64 range = lane_range(candidates_count);
+          U32 *matched_idxs = push_array_no_zero(scratch.arena, U32, dim_1u64(range));
+          U64 matched_idxs_count = 0;
+          for EachInRange(candidate_num, range)
           {
             //- rjf: every so often, check if we need to cancel, and cancel
-            if(idx%10000 == 0 && !!ins_atomic_u32_eval(cancel_signal))
+            if(candidate_num%10000 == 0 && !!ins_atomic_u32_eval(cancel_signal))
             {
               break;
             }
             
-            //- rjf: get element, map to string; if empty, continue to next element
-            void *element = (U8 *)table_base + element_size*idx;
-            String8 name = {0};
-            switch(section_kind)
-            {
-              case RDI_SectionKind_UDTs:
-              {
-                RDI_UDT *udt = (RDI_UDT *)element;
-                RDI_TypeNode *type_node = rdi_element_from_name_idx(rdi, TypeNodes, udt->self_type_idx);
-                name.str = rdi_string_from_idx(rdi, type_node->user_defined.name_string_idx, &name.size);
-                name = str8_copy(arena, name);
-              }break;
-              case RDI_SectionKind_SourceFiles:
-              {
-                Temp scratch = scratch_begin(&arena, 1);
-                RDI_SourceFile *file = (RDI_SourceFile *)element;
-                String8List path_parts = {0};
-                for(RDI_FilePathNode *fpn = rdi_element_from_name_idx(rdi, FilePathNodes, file->file_path_node_idx);
-                    fpn != rdi_element_from_name_idx(rdi, FilePathNodes, 0);
-                    fpn = rdi_element_from_name_idx(rdi, FilePathNodes, fpn->parent_path_node))
-                {
-                  String8 path_part = {0};
-                  path_part.str = rdi_string_from_idx(rdi, fpn->name_string_idx, &path_part.size);
-                  str8_list_push_front(scratch.arena, &path_parts, path_part);
-                }
-                StringJoin join = {0};
-                join.sep = str8_lit("/");
-                name = str8_list_join(arena, &path_parts, &join);
-                scratch_end(scratch);
-              }break;
-              default:
-              {
-                U32 name_idx = *(U32 *)((U8 *)element + element_name_idx_off);
-                U64 name_size = 0;
-                U8 *name_base = rdi_string_from_idx(rdi, name_idx, &name_size);
-                name = str8(name_base, name_size);
-              }break;
-            }
+            //- rjf: map candidate -> element name; reject via character mask
+            U64 idx = candidates ? candidates[candidate_num] : candidate_num;
+            String8 name = index->element_names[idx];
             if(name.size == 0) { continue; }
+            if((index->element_char_masks[idx] & query_char_mask) != query_char_mask) { continue; }
+            
+            //- rjf: prefix query -> reject names which don't start with it
+            if(query_is_prefix && !str8_match(match_query, name, StringMatchFlag_RightSideSloppy)) { continue; }
             
             //- rjf: fuzzy match against query
-            FuzzyMatchRangeList matches = fuzzy_match_find(arena, query, name);
+            FuzzyMatchRangeList matches = fuzzy_match_find(arena, match_query, name);
             
             //- rjf: collect
             if(matches.count == matches.needle_part_count)
@@ -1251,8 +1884,34 @@ di_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *
               chunk->v[chunk->count].missed_size  = (name.size > matches.total_dim) ? (name.size-matches.total_dim) : 0;
               chunk->count += 1;
               lane_items->total_count += 1;
+              matched_idxs[matched_idxs_count] = (U32)idx;
+              matched_idxs_count += 1;
+            }
+          }
+          lanes_matched_idxs[lane_idx()] = matched_idxs;
+          lanes_matched_idxs_counts[lane_idx()] = matched_idxs_count;
+          lane_sync();
+          
+          //- rjf: if this RDI's search ran to completion, remember its matches,
+          // so that later queries extending this one only need to re-check them
+          if(lane_idx() == 0 && !ins_atomic_u32_eval(cancel_signal) && query.size != 0 && !query_is_prefix) MutexScope(index->memo_mutex)
+          {
+            arena_clear(index->memo_arena);
+            index->memo_query = str8_copy(index->memo_arena, query);
+            index->memo_idxs_count = 0;
+            for EachIndex(lidx, lane_count())
+            {
+              index->memo_idxs_count += lanes_matched_idxs_counts[lidx];
+            }
+            index->memo_idxs = push_array_no_zero(index->memo_arena, U32, index->memo_idxs_count);
+            U64 off = 0;
+            for EachIndex(lidx, lane_count())
+            {
+              MemoryCopy(index->memo_idxs + off, lanes_matched_idxs[lidx], sizeof(U32)*lanes_matched_idxs_counts[lidx]);
+              off += lanes_matched_idxs_counts[lidx];
             }
           }
+          lane_sync();
         }
       }
     }
@@ -1661,3 +2320,562 @@ di_match_from_string(String8 string, U64 index, DI_Key preferred_dbgi_key, U64 e
   access_close(access);
   return result;
 }
+
+////////////////////////////////
+//~ rjf: Source Text Trigram Filters
+
+internal U64
+di_text_filter_bit_idx_from_chars(U8 c0, U8 c1, U8 c2)
+{
+  U64 result = di_search_trigram_slot_idx_from_chars(upper_from_char(c0), upper_from_char(c1), upper_from_char(c2)) % DI_TEXT_FILTER_BITS_COUNT;
+  return result;
+}
+
+internal B32
+di_text_filter_lookup(String8 path, FileProperties props, String8 query, B32 *rejected_out)
+{
+  B32 found = 0;
+  B32 rejected = 0;
+  U64 path_hash = u64_hash_from_str8(path);
+  U64 slot_idx = path_hash%di_shared->text_filter_slots_count;
+  DI_TextFilterSlot *slot = &di_shared->text_filter_slots[slot_idx];
+  Stripe *stripe = stripe_from_slot_idx(&di_shared->text_filter_stripes, slot_idx);
+  RWMutexScope(stripe->rw_mutex, 0)
+  {
+    for(DI_TextFilterNode *n = slot->first; n != 0; n = n->next)
+    {
+      if(n->path_hash == path_hash && n->modified == props.modified && n->size == props.size)
+      {
+        found = 1;
+        for(U64 off = 0; off+3 <= query.size; off += 1)
+        {
+          U64 bit_idx = di_text_filter_bit_idx_from_chars(query.str[off+0], query.str[off+1], query.str[off+2]);
+          if(!(n->bits[bit_idx/64] & (1ull << (bit_idx%64))))
+          {
+            rejected = 1;
+            break;
+          }
+        }
+        break;
+      }
+    }
+  }
+  rejected_out[0] = rejected;
+  return found;
+}
+
+internal void
+di_text_filter_submit(String8 path, FileProperties props, String8 data)
+{
+  //- rjf: build trigram bitset
+  U64 bits[DI_TEXT_FILTER_BITS_COUNT/64] = {0};
+  for(U64 off = 0; off+3 <= data.size; off += 1)
+  {
+    U64 bit_idx = di_text_filter_bit_idx_from_chars(data.str[off+0], data.str[off+1], data.str[off+2]);
+    bits[bit_idx/64] |= (1ull << (bit_idx%64));
+  }
+  
+  //- rjf: insert, or replace this path's stale filter
+  U64 path_hash = u64_hash_from_str8(path);
+  U64 slot_idx = path_hash%di_shared->text_filter_slots_count;
+  DI_TextFilterSlot *slot = &di_shared->text_filter_slots[slot_idx];
+  Stripe *stripe = stripe_from_slot_idx(&di_shared->text_filter_stripes, slot_idx);
+  RWMutexScope(stripe->rw_mutex, 1)
+  {
+    DI_TextFilterNode *node = 0;
+    for(DI_TextFilterNode *n = slot->first; n != 0; n = n->next)
+    {
+      if(n->path_hash == path_hash)
+      {
+        node = n;
+        break;
+      }
+    }
+    if(node == 0)
+    {
+      node = push_array(stripe->arena, DI_TextFilterNode, 1);
+      SLLQueuePush(slot->first, slot->last, node);
+    }
+    node->path_hash = path_hash;
+    node->modified = props.modified;
+    node->size = props.size;
+    MemoryCopyArray(node->bits, bits);
+  }
+}
+
+////////////////////////////////
+//~ rjf: Source Path Artifact Cache Hooks / Lookups
+
+internal String8
+di_mapped_from_source_path(Arena *arena, DI_PathMapArray *maps, String8 path)
+{
+  //- rjf: find longest matching source prefix, which must end on a path boundary
+  DI_PathMap *best_map = 0;
+  U64 best_src_size = 0;
+  for EachIndex(idx, maps->count)
+  {
+    DI_PathMap *map = &maps->v[idx];
+    String8 src = map->src;
+    for(;src.size > 0 && (src.str[src.size-1] == '/' || src.str[src.size-1] == '\\'); src.size -= 1);
+    if(src.size != 0 && src.size <= path.size && src.size > best_src_size &&
+       str8_match(str8_prefix(path, src.size), src, StringMatchFlag_CaseInsensitive|StringMatchFlag_SlashInsensitive) &&
+       (src.size == path.size || path.str[src.size] == '/' || path.str[src.size] == '\\'))
+    {
+      best_map = map;
+      best_src_size = src.size;
+    }
+  }
+  
+  //- rjf: swap prefix
+  String8 result = path;
+  if(best_map != 0)
+  {
+    String8 dst = best_map->dst;
+    for(;dst.size > 0 && (dst.str[dst.size-1] == '/' || dst.str[dst.size-1] == '\\'); dst.size -= 1);
+    result = push_str8f(arena, "%S%S", dst, str8_skip(path, best_src_size));
+  }
+  return result;
+}
+
+internal int
+di_source_path_qsort_compare(String8 *a, String8 *b)
+{
+  int result = 0;
+  U64 size = Min(a->size, b->size);
+  for(U64 idx = 0; idx < size && result == 0; idx += 1)
+  {
+    U8 a_c = di_search_char_from_char(a->str[idx]);
+    U8 b_c = di_search_char_from_char(b->str[idx]);
+    result = (a_c < b_c) ? -1 : (a_c > b_c) ? +1 : 0;
+  }
+  if(result == 0)
+  {
+    result = (a->size < b->size) ? -1 : (a->size > b->size) ? +1 : 0;
+  }
+  return result;
+}
+
+internal AC_Artifact
+di_source_paths_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  U64 load_gen = di_load_gen();
+  
+  //- rjf: unpack key
+  DI_PathMapArray maps = {0};
+  {
+    U64 key_read_off = 0;
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &maps.count);
+    maps.v = push_array(scratch.arena, DI_PathMap, maps.count);
+    for EachIndex(idx, maps.count)
+    {
+      key_read_off += str8_deserial_read_struct(key, key_read_off, &maps.v[idx].src.size);
+      key_read_off += str8_deserial_read_block(key, key_read_off, maps.v[idx].src.size, &maps.v[idx].src);
+      key_read_off += str8_deserial_read_struct(key, key_read_off, &maps.v[idx].dst.size);
+      key_read_off += str8_deserial_read_block(key, key_read_off, maps.v[idx].dst.size, &maps.v[idx].dst);
+    }
+  }
+  
+  //- rjf: gather mapped paths of all source files, in all loaded debug infos
+  String8List paths = {0};
+  {
+    Access *access = access_open();
+    DI_KeyArray dbgi_keys = di_push_all_loaded_keys(scratch.arena);
+    for EachIndex(dbgi_idx, dbgi_keys.count)
+    {
+      RDI_Parsed *rdi = di_rdi_from_key(access, dbgi_keys.v[dbgi_idx], 0, 0);
+      U64 files_count = 0;
+      RDI_SourceFile *files = rdi_table_from_name(rdi, SourceFiles, &files_count);
+      for(U64 file_idx = 1; file_idx < files_count; file_idx += 1)
+      {
+        Temp temp = temp_begin(scratch.arena);
+        String8List path_parts = {0};
+        for(RDI_FilePathNode *fpn = rdi_element_from_name_idx(rdi, FilePathNodes, files[file_idx].file_path_node_idx);
+            fpn != rdi_element_from_name_idx(rdi, FilePathNodes, 0);
+            fpn = rdi_element_from_name_idx(rdi, FilePathNodes, fpn->parent_path_node))
+        {
+          String8 path_part = {0};
+          path_part.str = rdi_string_from_idx(rdi, fpn->name_string_idx, &path_part.size);
+          str8_list_push_front(temp.arena, &path_parts, path_part);
+        }
+        StringJoin join = {0};
+        join.sep = str8_lit("/");
+        String8 path = str8_list_join(temp.arena, &path_parts, &join);
+        String8 path_mapped = di_mapped_from_source_path(temp.arena, &maps, path);
+        temp_end(temp);
+        if(path_mapped.size != 0)
+        {
+          str8_list_push(scratch.arena, &paths, str8_copy(scratch.arena, path_mapped));
+        }
+      }
+    }
+    access_close(access);
+  }
+  
+  //- rjf: sort & dedup - many debug infos will share headers
+  Arena *arena = arena_alloc();
+  DI_SourcePathArray *array = push_array(arena, DI_SourcePathArray, 1);
+  array->arena = arena;
+  array->id = load_gen;
+  {
+    String8Array paths_array = str8_array_from_list(scratch.arena, &paths);
+    quick_sort(paths_array.v, paths_array.count, sizeof(paths_array.v[0]), di_source_path_qsort_compare);
+    array->v = push_array(arena, String8, paths_array.count);
+    for EachIndex(idx, paths_array.count)
+    {
+      if(idx == 0 || di_source_path_qsort_compare(&paths_array.v[idx-1], &paths_array.v[idx]) != 0)
+      {
+        array->v[array->count] = str8_copy(arena, paths_array.v[idx]);
+        array->count += 1;
+      }
+    }
+  }
+  
+  AC_Artifact artifact = {0};
+  artifact.u64[0] = (U64)array;
+  scratch_end(scratch);
+  ProfEnd();
+  return artifact;
+}
+
+internal void
+di_source_paths_artifact_destroy(AC_Artifact artifact)
+{
+  DI_SourcePathArray *array = (DI_SourcePathArray *)artifact.u64[0];
+  if(array != 0)
+  {
+    arena_release(array->arena);
+  }
+}
+
+internal DI_SourcePathArray *
+di_source_path_array_from_key(Access *access, String8 key, U64 endt_us)
+{
+  AC_Artifact artifact = ac_artifact_from_key(access, key, di_source_paths_artifact_create, di_source_paths_artifact_destroy, endt_us, .gen = di_load_gen());
+  DI_SourcePathArray *array = (DI_SourcePathArray *)artifact.u64[0];
+  return array;
+}
+
+////////////////////////////////
+//~ rjf: Source Text Search Artifact Cache Hooks / Lookups
+
+internal U64
+di_text_search_hits_from_data(String8 path, String8 data, String8 query, DI_TextSearchFlags flags, DI_TextSearchHit *hits_out, U64 hits_cap)
+{
+  U64 hits_count = 0;
+  if(query.size != 0)
+  {
+    StringMatchFlags match_flags = (flags & DI_TextSearchFlag_CaseSensitive) ? 0 : StringMatchFlag_CaseInsensitive;
+    U64 line_num = 1;
+    U64 line_start_off = 0;
+    U64 line_scan_off = 0;
+    for(U64 off = str8_find_needle(data, 0, query, match_flags);
+        off < data.size && hits_count < hits_cap;
+        off = str8_find_needle(data, off + query.size, query, match_flags))
+    {
+      // rjf: advance line counter up to this match
+      for(U64 idx = line_scan_off; idx < off; idx += 1)
+      {
+        if(data.str[idx] == '\n')
+        {
+          line_num += 1;
+          line_start_off = idx+1;
+        }
+      }
+      line_scan_off = off;
+      
+      // rjf: find (bounded) line end
+      U64 line_end_off = off + query.size;
+      for(;line_end_off < data.size && line_end_off < off + query.size + DI_TEXT_SEARCH_LINE_TEXT_MAX &&
+          data.str[line_end_off] != '\n' && data.str[line_end_off] != '\r';
+          line_end_off += 1);
+      
+      // rjf: clamp displayed text to a window around the match
+      U64 text_min = line_start_off;
+      for(;text_min < off && char_is_space(data.str[text_min]); text_min += 1);
+      if(off - text_min > DI_TEXT_SEARCH_LINE_TEXT_MAX/2)
+      {
+        text_min = off - DI_TEXT_SEARCH_LINE_TEXT_MAX/2;
+      }
+      U64 text_max = Min(line_end_off, Max(text_min + DI_TEXT_SEARCH_LINE_TEXT_MAX, off + query.size));
+      
+      // rjf: push hit
+      DI_TextSearchHit *hit = &hits_out[hits_count];
+      hit->path = path;
+      hit->pt = txt_pt((S64)line_num, (S64)(off - line_start_off + 1));
+      hit->line_text = str8_substr(data, r1u64(text_min, text_max));
+      hit->line_text_match_range = r1u64(off - text_min, off - text_min + query.size);
+      hits_count += 1;
+    }
+  }
+  return hits_count;
+}
+
+internal AC_Artifact
+di_text_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  Access *access = access_open();
+  
+  //- rjf: unpack key
+  DI_TextSearchFlags flags = 0;
+  String8 query = {0};
+  U64 paths_id = 0;
+  U64 chunk_idx = 0;
+  String8 paths_key = {0};
+  {
+    U64 key_read_off = 0;
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &flags);
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &query.size);
+    key_read_off += str8_deserial_read_block(key, key_read_off, query.size, &query);
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &paths_id);
+    key_read_off += str8_deserial_read_struct(key, key_read_off, &chunk_idx);
+    paths_key = str8_skip(key, key_read_off);
+  }
+  
+  //- rjf: get source paths; if they've changed since this chunk was requested,
+  // produce nothing - a request for the new set of paths will follow
+  DI_SourcePathArray *paths = 0;
+  if(lane_idx() == 0)
+  {
+    paths = di_source_path_array_from_key(access, paths_key, 0);
+  }
+  lane_sync_u64(&paths, 0);
+  Rng1U64 chunk_range = {0};
+  if(paths != 0 && paths->id == paths_id)
+  {
+    chunk_range = r1u64(Min(chunk_idx*DI_TEXT_SEARCH_CHUNK_FILES_COUNT, paths->count),
+                        Min((chunk_idx+1)*DI_TEXT_SEARCH_CHUNK_FILES_COUNT, paths->count));
+  }
+  U64 chunk_files_count = dim_1u64(chunk_range);
+  
+  //- rjf: set up per-lane results
+  DI_TextSearchHit **lanes_hits = 0;
+  U64 *lanes_hits_counts = 0;
+  U64 *lanes_skipped_counts = 0;
+  B32 *lanes_retry = 0;
+  if(lane_idx() == 0)
+  {
+    lanes_hits = push_array(scratch.arena, DI_TextSearchHit *, lane_count());
+    lanes_hits_counts = push_array(scratch.arena, U64, lane_count());
+    lanes_skipped_counts = push_array(scratch.arena, U64, lane_count());
+    lanes_retry = push_array(scratch.arena, B32, lane_count());
+  }
+  lane_sync_u64(&lanes_hits, 0);
+  lane_sync_u64(&lanes_hits_counts, 0);
+  lane_sync_u64(&lanes_skipped_counts, 0);
+  lane_sync_u64(&lanes_retry, 0);
+  
+  //- rjf: read & scan this lane's files
+  ProfScope("search %I64u files", chunk_files_count)
+  {
+    U64 hits_cap = DI_TEXT_SEARCH_CHUNK_HITS_MAX;
+    DI_TextSearchHit *hits = push_array_no_zero(scratch.arena, DI_TextSearchHit, hits_cap);
+    U64 hits_count = 0;
+    U64 skipped_count = 0;
+    B32 retry = 0;
+    Rng1U64 range = lane_range(chunk_files_count);
+    for EachInRange(idx, range)
+    {
+      if(hits_count >= hits_cap || ins_atomic_u32_eval(cancel_signal))
+      {
+        break;
+      }
+      String8 path = paths->v[chunk_range.min + idx];
+      
+      // rjf: skip missing files, folders, & anything too big to be source
+      FileProperties props = os_properties_from_file_path(path);
+      if(props.modified == 0 || props.flags & FilePropertyFlag_IsFolder || props.size > DI_TEXT_SEARCH_FILE_SIZE_MAX)
+      {
+        skipped_count += 1;
+        continue;
+      }
+      
+      // rjf: skip files which this file's trigrams rule out
+      B32 rejected = 0;
+      B32 has_filter = di_text_filter_lookup(path, props, query, &rejected);
+      if(rejected)
+      {
+        continue;
+      }
+      
+      // rjf: get data - if not yet streamed in, come back later
+      C_Key c_key = fs_key_from_path_range(path, r1u64(0, max_U64), 0);
+      U128 hash = c_hash_from_key(c_key, 0);
+      if(u128_match(hash, u128_zero()))
+      {
+        retry = 1;
+        continue;
+      }
+      String8 data = c_data_from_hash(access, hash);
+      
+      // rjf: build filter for next time
+      if(!has_filter)
+      {
+        di_text_filter_submit(path, props, data);
+      }
+      
+      // rjf: scan
+      hits_count += di_text_search_hits_from_data(path, data, query, flags, hits + hits_count, hits_cap - hits_count);
+    }
+    lanes_hits[lane_idx()] = hits;
+    lanes_hits_counts[lane_idx()] = hits_count;
+    lanes_skipped_counts[lane_idx()] = skipped_count;
+    lanes_retry[lane_idx()] = retry;
+  }
+  lane_sync();
+  
+  //- rjf: any file not ready? -> retry whole chunk, rather than caching a
+  // partial result
+  B32 retry = 0;
+  for EachIndex(idx, lane_count())
+  {
+    retry = (retry || lanes_retry[idx]);
+  }
+  if(retry && lane_idx() == 0)
+  {
+    retry_out[0] = 1;
+  }
+  
+  //- rjf: join lanes' hits, copying out of the file data; drop everything if
+  // cancelled or retrying
+  DI_TextSearchChunk *chunk = 0;
+  if(lane_idx() == 0 && !retry && !ins_atomic_u32_eval(cancel_signal))
+  {
+    Arena *arena = arena_alloc();
+    chunk = push_array(arena, DI_TextSearchChunk, 1);
+    chunk->arena = arena;
+    chunk->files_count = chunk_files_count;
+    U64 total_count = 0;
+    for EachIndex(idx, lane_count())
+    {
+      total_count += lanes_hits_counts[idx];
+      chunk->files_skipped_count += lanes_skipped_counts[idx];
+      chunk->truncated = (chunk->truncated || lanes_hits_counts[idx] == DI_TEXT_SEARCH_CHUNK_HITS_MAX);
+    }
+    chunk->hits = push_array_no_zero(arena, DI_TextSearchHit, Min(total_count, DI_TEXT_SEARCH_CHUNK_HITS_MAX));
+    String8 last_path = {0};
+    String8 last_path_copy = {0};
+    for EachIndex(lane_idx, lane_count())
+    {
+      for(U64 idx = 0; idx < lanes_hits_counts[lane_idx] && chunk->hits_count < DI_TEXT_SEARCH_CHUNK_HITS_MAX; idx += 1)
+      {
+        DI_TextSearchHit *src = &lanes_hits[lane_idx][idx];
+        DI_TextSearchHit *dst = &chunk->hits[chunk->hits_count];
+        if(src->path.str != last_path.str)
+        {
+          last_path = src->path;
+          last_path_copy = str8_copy(arena, src->path);
+        }
+        dst->path = last_path_copy;
+        dst->pt = src->pt;
+        dst->line_text = str8_copy(arena, src->line_text);
+        dst->line_text_match_range = src->line_text_match_range;
+        chunk->hits_count += 1;
+      }
+    }
+    chunk->truncated = (chunk->truncated || chunk->hits_count < total_count);
+  }
+  lane_sync_u64(&chunk, 0);
+  
+  AC_Artifact artifact = {0};
+  artifact.u64[0] = (U64)chunk;
+  access_close(access);
+  scratch_end(scratch);
+  ProfEnd();
+  return artifact;
+}
+
+internal void
+di_text_search_artifact_destroy(AC_Artifact artifact)
+{
+  DI_TextSearchChunk *chunk = (DI_TextSearchChunk *)artifact.u64[0];
+  if(chunk != 0)
+  {
+    arena_release(chunk->arena);
+  }
+}
+
+internal DI_TextSearchResults
+di_text_search_results_from_query(Arena *arena, Access *access, DI_PathMapArray *maps, String8 query, DI_TextSearchFlags flags, U64 endt_us)
+{
+  DI_TextSearchResults results = {0};
+  if(query.size != 0)
+  {
+    Temp scratch = scratch_begin(&arena, 1);
+    
+    //- rjf: form source paths key from path maps
+    String8 paths_key = {0};
+    {
+      String8List key_parts = {0};
+      str8_list_push(scratch.arena, &key_parts, str8_struct(&maps->count));
+      for EachIndex(idx, maps->count)
+      {
+        str8_list_push(scratch.arena, &key_parts, str8_struct(&maps->v[idx].src.size));
+        str8_list_push(scratch.arena, &key_parts, maps->v[idx].src);
+        str8_list_push(scratch.arena, &key_parts, str8_struct(&maps->v[idx].dst.size));
+        str8_list_push(scratch.arena, &key_parts, maps->v[idx].dst);
+      }
+      paths_key = str8_list_join(scratch.arena, &key_parts, 0);
+    }
+    
+    //- rjf: get source paths
+    DI_SourcePathArray *paths = di_source_path_array_from_key(access, paths_key, endt_us);
+    results.is_pending = (paths == 0);
+    
+    //- rjf: get all chunks
+    U64 chunks_count = 0;
+    DI_TextSearchChunk **chunks = 0;
+    U64 total_hits_count = 0;
+    if(paths != 0)
+    {
+      results.files_count = paths->count;
+      chunks_count = (paths->count + DI_TEXT_SEARCH_CHUNK_FILES_COUNT-1) / DI_TEXT_SEARCH_CHUNK_FILES_COUNT;
+      chunks = push_array(scratch.arena, DI_TextSearchChunk *, chunks_count);
+      for EachIndex(chunk_idx, chunks_count)
+      {
+        String8List key_parts = {0};
+        str8_list_push(scratch.arena, &key_parts, str8_struct(&flags));
+        str8_list_push(scratch.arena, &key_parts, str8_struct(&query.size));
+        str8_list_push(scratch.arena, &key_parts, query);
+        str8_list_push(scratch.arena, &key_parts, str8_struct(&paths->id));
+        str8_list_push(scratch.arena, &key_parts, str8_struct(&chunk_idx));
+        str8_list_push(scratch.arena, &key_parts, paths_key);
+        String8 key = str8_list_join(scratch.arena, &key_parts, 0);
+        AC_Artifact artifact = ac_artifact_from_key(access, key, di_text_search_artifact_create, di_text_search_artifact_destroy, endt_us, .flags = AC_Flag_Wide, .gen = fs_change_gen(), .slots_count = 1024, .evict_threshold_us = 10000000);
+        DI_TextSearchChunk *chunk = (DI_TextSearchChunk *)artifact.u64[0];
+        chunks[chunk_idx] = chunk;
+        if(chunk != 0)
+        {
+          results.files_searched_count += chunk->files_count;
+          results.files_skipped_count += chunk->files_skipped_count;
+          results.truncated = (results.truncated || chunk->truncated);
+          total_hits_count += chunk->hits_count;
+        }
+        else
+        {
+          results.is_pending = 1;
+        }
+      }
+    }
+    
+    //- rjf: join chunks' hits, in path order
+    results.hits = push_array_no_zero(arena, DI_TextSearchHit, Min(total_hits_count, DI_TEXT_SEARCH_HITS_MAX));
+    for EachIndex(chunk_idx, chunks_count)
+    {
+      DI_TextSearchChunk *chunk = chunks[chunk_idx];
+      if(chunk != 0)
+      {
+        U64 copy_count = Min(chunk->hits_count, DI_TEXT_SEARCH_HITS_MAX - results.hits_count);
+        MemoryCopy(results.hits + results.hits_count, chunk->hits, sizeof(chunk->hits[0])*copy_count);
+        results.hits_count += copy_count;
+      }
+    }
+    results.truncated = (results.truncated || results.hits_count < total_hits_count);
+    
+    scratch_end(scratch);
+  }
+  return results;
+}
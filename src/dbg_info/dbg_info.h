@@ -55,6 +55,38 @@ struct DI_KeySlot
   DI_KeyPathNode *last;
 };
 
+////////////////////////////////
+//~ rjf: Per-Debug-Info Search Index Types
+
+#define DI_SEARCH_INDEX_TRIGRAM_SLOTS_COUNT 16384
+
+typedef struct DI_SearchIndex DI_SearchIndex;
+struct DI_SearchIndex
+{
+  // rjf: allocation (one arena per lane which built the index)
+  Arena **arenas;
+  U64 arenas_count;
+  
+  // rjf: per-element names & normalized character masks
+  RDI_SectionKind section_kind;
+  U64 element_count;
+  String8 *element_names;
+  U64 *element_char_masks;
+  
+  // rjf: trigram -> sorted element indices (slot i's postings are in
+  // trigram_idxs[trigram_slot_offs[i], trigram_slot_offs[i+1]))
+  U64 *trigram_slot_offs;
+  U32 *trigram_idxs;
+  
+  // rjf: matches for the last completed query, used to narrow candidates
+  // when a follow-up query extends it
+  Mutex memo_mutex;
+  Arena *memo_arena;
+  String8 memo_query;
+  U32 *memo_idxs;
+  U64 memo_idxs_count;
+};
+
 ////////////////////////////////
 //~ rjf: Debug Info Cache Types
 
@@ -76,6 +108,9 @@ struct DI_Node
   Arena *arena;
   RDI_Parsed rdi;
   
+  // rjf: lazily-built search indices, per table section
+  DI_SearchIndex *search_indexes[RDI_SectionKind_COUNT];
+  
   // rjf: metadata
   AccessPt access_pt;
   U64 refcount;
@@ -145,6 +180,7 @@ struct DI_LoadTask
   B32 rdi_is_stale;
   
   U64 thread_count;
+  U64 launch_us;
   OS_Handle process;
 };
 
@@ -155,6 +191,26 @@ struct DI_LoadCompletion
   U64 code;
 };
 
+typedef struct DI_ConversionCandidate DI_ConversionCandidate;
+struct DI_ConversionCandidate
+{
+  DI_LoadTask *task;
+  U64 priority_idx;
+  String8 og_path;
+  String8 rdi_path;
+};
+
+typedef struct DI_ConversionProgress DI_ConversionProgress;
+struct DI_ConversionProgress
+{
+  U64 active_count;
+  U64 pending_count;
+  U64 active_thread_count;
+  U64 max_thread_count;
+  U64 remaining_size;
+  U64 eta_us;
+};
+
 ////////////////////////////////
 //~ rjf: Search Types
 
@@ -204,6 +260,101 @@ struct DI_Match
   U32 idx;
 };
 
+////////////////////////////////
+//~ rjf: Source Text Search Types
+
+#define DI_TEXT_SEARCH_CHUNK_FILES_COUNT 256
+#define DI_TEXT_SEARCH_CHUNK_HITS_MAX 4096
+#define DI_TEXT_SEARCH_HITS_MAX 65536
+#define DI_TEXT_SEARCH_FILE_SIZE_MAX MB(64)
+#define DI_TEXT_SEARCH_LINE_TEXT_MAX 256
+#define DI_TEXT_FILTER_BITS_COUNT 8192
+
+typedef U32 DI_TextSearchFlags;
+enum
+{
+  DI_TextSearchFlag_CaseSensitive = (1<<0),
+};
+
+typedef struct DI_PathMap DI_PathMap;
+struct DI_PathMap
+{
+  String8 src;
+  String8 dst;
+};
+
+typedef struct DI_PathMapArray DI_PathMapArray;
+struct DI_PathMapArray
+{
+  DI_PathMap *v;
+  U64 count;
+};
+
+typedef struct DI_SourcePathArray DI_SourcePathArray;
+struct DI_SourcePathArray
+{
+  Arena *arena;
+  U64 id;
+  String8 *v;
+  U64 count;
+};
+
+typedef struct DI_TextSearchHit DI_TextSearchHit;
+struct DI_TextSearchHit
+{
+  String8 path;
+  TxtPt pt;
+  String8 line_text;
+  Rng1U64 line_text_match_range;
+};
+
+typedef struct DI_TextSearchChunk DI_TextSearchChunk;
+struct DI_TextSearchChunk
+{
+  Arena *arena;
+  DI_TextSearchHit *hits;
+  U64 hits_count;
+  U64 files_count;
+  U64 files_skipped_count;
+  B32 truncated;
+};
+
+typedef struct DI_TextSearchResults DI_TextSearchResults;
+struct DI_TextSearchResults
+{
+  DI_TextSearchHit *hits;
+  U64 hits_count;
+  U64 files_count;
+  U64 files_searched_count;
+  U64 files_skipped_count;
+  B32 truncated;
+  B32 is_pending;
+};
+
+////////////////////////////////
+//~ rjf: Source Text Trigram Filter Cache Types
+
+// NOTE(rjf): each searched file gets a bitset of its (case-folded) trigrams,
+// keyed by path & timestamp, which lets repeat searches reject most files
+// without reading them.
+
+typedef struct DI_TextFilterNode DI_TextFilterNode;
+struct DI_TextFilterNode
+{
+  DI_TextFilterNode *next;
+  U64 path_hash;
+  U64 modified;
+  U64 size;
+  U64 bits[DI_TEXT_FILTER_BITS_COUNT/64];
+};
+
+typedef struct DI_TextFilterSlot DI_TextFilterSlot;
+struct DI_TextFilterSlot
+{
+  DI_TextFilterNode *first;
+  DI_TextFilterNode *last;
+};
+
 ////////////////////////////////
 //~ rjf: Events
 
@@ -263,6 +414,11 @@ struct DI_Shared
   DI_Slot *slots;
   StripeArray stripes;
   
+  // rjf: source text trigram filter cache
+  U64 text_filter_slots_count;
+  DI_TextFilterSlot *text_filter_slots;
+  StripeArray text_filter_stripes;
+  
   // rjf: requests
   DI_RequestBatch req_batches[2]; // [0] -> high priority, [1] -> low priority
   
@@ -272,6 +428,11 @@ struct DI_Shared
   DI_LoadTask *free_load_task;
   U64 conversion_process_count;
   U64 conversion_thread_count;
+  F64 conversion_bytes_per_thread_us;
+  
+  // rjf: conversion progress (written by async tick, read by users)
+  Mutex progress_mutex;
+  DI_ConversionProgress progress;
   
   // rjf: conversion completion receiving thread
   U64 conversion_completion_code;
@@ -338,6 +499,13 @@ internal RDI_Parsed *di_rdi_from_key(Access *access, DI_Key key, B32 high_priori
 
 internal DI_EventList di_get_events(Arena *arena);
 
+////////////////////////////////
+//~ rjf: Conversion Scheduling
+
+internal U64 di_conversion_thread_count_from_size(U64 size, U64 max_thread_count);
+internal int di_conversion_candidate_qsort_compare(DI_ConversionCandidate *a, DI_ConversionCandidate *b);
+internal DI_ConversionProgress di_conversion_progress(void);
+
 ////////////////////////////////
 //~ rjf: Asynchronous Tick
 
@@ -349,6 +517,17 @@ internal void di_async_tick(void);
 internal void di_signal_completion(void);
 internal void di_conversion_completion_signal_receiver_thread_entry_point(void *p);
 
+////////////////////////////////
+//~ rjf: Search Indices
+
+internal U8 di_search_char_from_char(U8 c);
+internal U64 di_search_trigram_slot_idx_from_chars(U8 c0, U8 c1, U8 c2);
+internal U64 di_search_char_mask_from_string(String8 string);
+internal DI_SearchIndex *di_search_index_build(RDI_Parsed *rdi, RDI_SectionKind section_kind);
+internal void di_search_index_release(DI_SearchIndex *index);
+internal DI_SearchIndex *di_search_index_from_key(Access *access, DI_Key key, RDI_SectionKind section_kind);
+internal DI_SearchIndex *di_search_index_commit(DI_Key key, DI_SearchIndex *index);
+
 ////////////////////////////////
 //~ rjf: Search Artifact Cache Hooks / Lookups
 
@@ -362,4 +541,28 @@ internal DI_SearchItemArray di_search_item_array_from_target_query(Access *acces
 internal AC_Artifact di_match_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
 internal DI_Match di_match_from_string(String8 string, U64 index, DI_Key preferred_dbgi_key, U64 endt_us);
 
+////////////////////////////////
+//~ rjf: Source Text Trigram Filters
+
+internal U64 di_text_filter_bit_idx_from_chars(U8 c0, U8 c1, U8 c2);
+internal B32 di_text_filter_lookup(String8 path, FileProperties props, String8 query, B32 *rejected_out);
+internal void di_text_filter_submit(String8 path, FileProperties props, String8 data);
+
+////////////////////////////////
+//~ rjf: Source Path Artifact Cache Hooks / Lookups
+
+internal String8 di_mapped_from_source_path(Arena *arena, DI_PathMapArray *maps, String8 path);
+internal int di_source_path_qsort_compare(String8 *a, String8 *b);
+internal AC_Artifact di_source_paths_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
+internal void di_source_paths_artifact_destroy(AC_Artifact artifact);
+internal DI_SourcePathArray *di_source_path_array_from_key(Access *access, String8 key, U64 endt_us);
+
+////////////////////////////////
+//~ rjf: Source Text Search Artifact Cache Hooks / Lookups
+
+internal U64 di_text_search_hits_from_data(String8 path, String8 data, String8 query, DI_TextSearchFlags flags, DI_TextSearchHit *hits_out, U64 hits_cap);
+internal AC_Artifact di_text_search_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
+internal void di_text_search_artifact_destroy(AC_Artifact artifact);
+internal DI_TextSearchResults di_text_search_results_from_query(Arena *arena, Access *access, DI_PathMapArray *maps, String8 query, DI_TextSearchFlags flags, U64 endt_us);
+
 #endif // DBG_INFO_H
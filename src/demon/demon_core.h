@@ -159,6 +159,32 @@ struct DMN_RunCtrls
   DMN_TrapChunkList traps;
 };
 
+////////////////////////////////
+//~ rjf: Core Dump Types
+
+typedef U32 DMN_CoreFlags;
+enum
+{
+  DMN_CoreFlag_Compress = (1<<0),
+};
+
+////////////////////////////////
+//~ rjf: Memory Region Types
+
+typedef struct DMN_MemoryRegion DMN_MemoryRegion;
+struct DMN_MemoryRegion
+{
+  Rng1U64 vaddr_range;
+  OS_AccessFlags flags;
+};
+
+typedef struct DMN_MemoryRegionArray DMN_MemoryRegionArray;
+struct DMN_MemoryRegionArray
+{
+  DMN_MemoryRegion *v;
+  U64 count;
+};
+
 ////////////////////////////////
 //~ rjf: System Process Listing Types
 
@@ -225,6 +251,7 @@ internal B32 dmn_ctrl_attach(DMN_CtrlCtx *ctx, U32 pid);
 internal B32 dmn_ctrl_kill(DMN_CtrlCtx *ctx, DMN_Handle process, U32 exit_code);
 internal B32 dmn_ctrl_detach(DMN_CtrlCtx *ctx, DMN_Handle process);
 internal DMN_EventList dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls);
+internal B32 dmn_ctrl_save_core(DMN_CtrlCtx *ctx, DMN_Handle process, String8 path, DMN_CoreFlags flags);
 
 ////////////////////////////////
 //~ rjf: @dmn_os_hooks Halting (Implemented Per-OS)
@@ -247,6 +274,8 @@ internal void dmn_process_memory_release(DMN_Handle process, U64 vaddr, U64 size
 internal void dmn_process_memory_protect(DMN_Handle process, U64 vaddr, U64 size, OS_AccessFlags flags);
 internal U64 dmn_process_read(DMN_Handle process, Rng1U64 range, void *dst);
 internal B32 dmn_process_write(DMN_Handle process, Rng1U64 range, void *src);
+internal void dmn_process_read_batch(DMN_Handle process, U64 count, Rng1U64 *ranges, void **dsts, U64 *read_sizes_out);
+internal DMN_MemoryRegionArray dmn_process_memory_regions(Arena *arena, DMN_Handle process);
 #define dmn_process_read_struct(process, vaddr, ptr) dmn_process_read((process), r1u64((vaddr), (vaddr)+(sizeof(*ptr))), ptr)
 #define dmn_process_write_struct(process, vaddr, ptr) dmn_process_write((process), r1u64((vaddr), (vaddr)+(sizeof(*ptr))), ptr)
 
@@ -109,6 +109,69 @@ dmn_lnx_read_string(Arena *arena, int memory_fd, U64 vaddr)
   return dmn_lnx_read_string_capped(arena, memory_fd, vaddr, 4096);
 }
 
+internal void
+dmn_lnx_read_batch(pid_t pid, int memory_fd, U64 count, Rng1U64 *ranges, void **dsts, U64 *read_sizes_out)
+{
+  for(U64 base_idx = 0; base_idx < count; base_idx += 64)
+  {
+    // rjf: read up to 64 ranges with one syscall
+    struct iovec local[64];
+    struct iovec remote[64];
+    U64 batch_count = Min(count - base_idx, ArrayCount(local));
+    for EachIndex(idx, batch_count)
+    {
+      Rng1U64 range = ranges[base_idx + idx];
+      local[idx].iov_base  = dsts[base_idx + idx];
+      local[idx].iov_len   = dim_1u64(range);
+      remote[idx].iov_base = (void *)range.min;
+      remote[idx].iov_len  = dim_1u64(range);
+    }
+    ssize_t batch_read_size = process_vm_readv(pid, local, batch_count, remote, batch_count, 0);
+    
+    // rjf: the transfer stops at the first failing range - distribute the total
+    // in order, then retry the rest of each short range through /proc/pid/mem
+    // (which is also the only path if process_vm_readv is not permitted at all)
+    U64 bytes_left = (batch_read_size > 0 ? (U64)batch_read_size : 0);
+    for EachIndex(idx, batch_count)
+    {
+      Rng1U64 range = ranges[base_idx + idx];
+      U64 read_size = Min(bytes_left, dim_1u64(range));
+      bytes_left -= read_size;
+      if(read_size < dim_1u64(range))
+      {
+        read_size += dmn_lnx_read(memory_fd, r1u64(range.min + read_size, range.max), (U8 *)dsts[base_idx + idx] + read_size);
+      }
+      read_sizes_out[base_idx + idx] = read_size;
+    }
+  }
+}
+
+internal String8
+dmn_lnx_data_from_proc_path(Arena *arena, String8 path)
+{
+  // rjf: procfs files report a size of 0 - just read until EOF
+  String8 result = {0};
+  int fd = open((char *)path.str, O_RDONLY|O_CLOEXEC);
+  if(fd != -1)
+  {
+    Temp scratch = scratch_begin(&arena, 1);
+    String8List parts = {0};
+    for(;;)
+    {
+      U64 part_cap = KB(64);
+      U8 *part = push_array_no_zero(scratch.arena, U8, part_cap);
+      ssize_t part_size = read(fd, part, part_cap);
+      if(part_size < 0 && errno == EINTR) { continue; }
+      if(part_size <= 0) { break; }
+      str8_list_push(scratch.arena, &parts, str8(part, (U64)part_size));
+    }
+    result = str8_list_join(arena, &parts, 0);
+    close(fd);
+    scratch_end(scratch);
+  }
+  return result;
+}
+
 ////////////////////////////////
 //~ Runtime Struct Helpers
 
@@ -360,53 +423,66 @@ dmn_lnx_auxv_from_pid(pid_t pid, ELF_Class elf_class)
   String8 auxv_path = push_str8f(scratch.arena, "/proc/%d/auxv", pid);
   int     auxv_fd   = open((char*)auxv_path.str, O_RDONLY|O_CLOEXEC);
   
-  // rjf: scan aux data
+  // rjf: read & scan aux data
   if(auxv_fd >= 0)
   {
-    for(;;)
+    U64 auxv_cap  = KB(4);
+    U8 *auxv_raw  = push_array_no_zero(scratch.arena, U8, auxv_cap);
+    U64 auxv_size = dmn_lnx_read(auxv_fd, r1u64(0, auxv_cap), auxv_raw);
+    result = dmn_lnx_auxv_from_data(str8(auxv_raw, auxv_size), elf_class);
+    close(auxv_fd);
+  }
+  
+  scratch_end(scratch);
+  return result;
+}
+
+internal DMN_LNX_ProcessAuxv
+dmn_lnx_auxv_from_data(String8 data, ELF_Class elf_class)
+{
+  DMN_LNX_ProcessAuxv result = {0};
+  for(U64 off = 0;;)
+  {
+    // rjf: read next aux
+    ELF_Auxv64 auxv = {0};
+    switch(elf_class)
     {
-      // rjf: read next aux
-      ELF_Auxv64 auxv = {0};
-      switch(elf_class)
+      case ELF_Class_None:{}break;
+      case ELF_Class_32:
       {
-        case ELF_Class_None:{}break;
-        case ELF_Class_32:
+        ELF_Auxv32 auxv32 = {0};
+        if(str8_deserial_read_struct(data, off, &auxv32) != sizeof(auxv32))
         {
-          ELF_Auxv32 auxv32 = {0};
-          if(read(auxv_fd, &auxv32, sizeof(auxv32)) != sizeof(auxv32))
-          {
-            goto brkloop;
-          }
-          auxv = elf_auxv64_from_auxv32(auxv32);
-        }break;
-        case ELF_Class_64:
-        {
-          if(read(auxv_fd, &auxv, sizeof(auxv)) != sizeof(auxv))
-          {
-            goto brkloop;
-          }
-        }break;
-        default:{NotImplemented;}break;
-      }
-      
-      // rjf: fill result
-      switch(auxv.a_type)
+          goto brkloop;
+        }
+        auxv = elf_auxv64_from_auxv32(auxv32);
+        off += sizeof(auxv32);
+      }break;
+      case ELF_Class_64:
       {
-        default:{}break;
-        case ELF_AuxType_Null:         goto brkloop; break;
-        case ELF_AuxType_Base:         result.base   = auxv.a_val; break;
-        case ELF_AuxType_Phnum:        result.phnum  = auxv.a_val; break;
-        case ELF_AuxType_Phent:        result.phent  = auxv.a_val; break;
-        case ELF_AuxType_Phdr:         result.phdr   = auxv.a_val; break;
-        case ELF_AuxType_ExecFn:       result.execfn = auxv.a_val; break;
-        case ELF_AuxType_Pagesz:       result.pagesz = auxv.a_val; break;
-      }
+        if(str8_deserial_read_struct(data, off, &auxv) != sizeof(auxv))
+        {
+          goto brkloop;
+        }
+        off += sizeof(auxv);
+      }break;
+      default:{NotImplemented;}break;
+    }
+    
+    // rjf: fill result
+    switch(auxv.a_type)
+    {
+      default:{}break;
+      case ELF_AuxType_Null:         goto brkloop; break;
+      case ELF_AuxType_Base:         result.base   = auxv.a_val; break;
+      case ELF_AuxType_Phnum:        result.phnum  = auxv.a_val; break;
+      case ELF_AuxType_Phent:        result.phent  = auxv.a_val; break;
+      case ELF_AuxType_Phdr:         result.phdr   = auxv.a_val; break;
+      case ELF_AuxType_ExecFn:       result.execfn = auxv.a_val; break;
+      case ELF_AuxType_Pagesz:       result.pagesz = auxv.a_val; break;
     }
-    brkloop:;
-    close(auxv_fd);
   }
-  
-  scratch_end(scratch);
+  brkloop:;
   return result;
 }
 
@@ -817,7 +893,8 @@ dmn_lnx_thread_from_pid(pid_t pid)
   {
     for EachIndex(idx, dmn_lnx_state->entities_count)
     {
-      if(dmn_lnx_state->entities_base[idx].kind == DMN_LNX_EntityKind_Thread && (pid_t)dmn_lnx_state->entities_base[idx].id == pid)
+      if(dmn_lnx_state->entities_base[idx].kind == DMN_LNX_EntityKind_Thread && (pid_t)dmn_lnx_state->entities_base[idx].id == pid &&
+         !dmn_lnx_state->entities_base[idx].parent->is_core)
       {
         result = &dmn_lnx_state->entities_base[idx];
         break;
@@ -879,6 +956,65 @@ dmn_lnx_thread_write_sp(DMN_LNX_Entity *thread, U64 sp)
   return is_sp_written;
 }
 
+internal void
+dmn_lnx_reg_block_x64_from_regs(REGS_RegBlockX64 *dst, DMN_LNX_RegsX64 *src)
+{
+  dst->rax.u64    = src->rax;
+  dst->rcx.u64    = src->rcx;
+  dst->rdx.u64    = src->rdx;
+  dst->rbx.u64    = src->rbx;
+  dst->rsp.u64    = src->rsp;
+  dst->rbp.u64    = src->rbp;
+  dst->rsi.u64    = src->rsi;
+  dst->rdi.u64    = src->rdi;
+  dst->r8.u64     = src->r8;
+  dst->r9.u64     = src->r9;
+  dst->r10.u64    = src->r10;
+  dst->r11.u64    = src->r11;
+  dst->r12.u64    = src->r12;
+  dst->r13.u64    = src->r13;
+  dst->r14.u64    = src->r14;
+  dst->r15.u64    = src->r15;
+  dst->cs.u16     = src->cs;
+  dst->ds.u16     = src->ds;
+  dst->es.u16     = src->es;
+  dst->fs.u16     = src->fs;
+  dst->gs.u16     = src->gs;
+  dst->ss.u16     = src->ss;
+  dst->fsbase.u64 = src->fsbase;
+  dst->gsbase.u64 = src->gsbase;
+  dst->rip.u64    = src->rip;
+  dst->rflags.u64 = src->rflags;
+}
+
+internal void
+dmn_lnx_reg_block_x64_from_fxsave(REGS_RegBlockX64 *dst, X64_FXSave *src)
+{
+  // copy x87 registers
+  dst->fcw.u16        = src->fcw;
+  dst->fsw.u16        = src->fsw;
+  dst->ftw.u16        = x64_xsave_tag_word_from_real_tag_word(src->ftw);
+  dst->fop.u16        = src->fop;
+  dst->fip.u64        = src->b64.fip;
+  dst->fdp.u64        = src->b64.fdp;
+  dst->mxcsr.u32      = src->mxcsr;
+  dst->mxcsr_mask.u32 = src->mxcsr_mask;
+  for EachIndex(i, 8)
+  {
+    MemoryCopy(&dst->st0 + i, src->st_space + i, sizeof(REGS_Reg80));
+  }
+  
+  // SSE registers are always available in x64
+  {
+    U128        *xmm_d = src->xmm_space;
+    REGS_Reg512 *zmm_s = &dst->zmm0;
+    for EachIndex(i, 16)
+    {
+      MemoryCopy(&zmm_s[i], &xmm_d[i], sizeof(*xmm_d));
+    }
+  }
+}
+
 internal B32
 dmn_lnx_thread_read_reg_block(DMN_LNX_Entity *thread, void *reg_block)
 {
@@ -911,33 +1047,7 @@ dmn_lnx_thread_read_reg_block(DMN_LNX_Entity *thread, void *reg_block)
         if(ptrace_result != -1)
         {
           got_gpr = 1;
-          DMN_LNX_UserX64 *src = &ctx;
-          dst->rax.u64    = src->regs.rax;
-          dst->rcx.u64    = src->regs.rcx;
-          dst->rdx.u64    = src->regs.rdx;
-          dst->rbx.u64    = src->regs.rbx;
-          dst->rsp.u64    = src->regs.rsp;
-          dst->rbp.u64    = src->regs.rbp;
-          dst->rsi.u64    = src->regs.rsi;
-          dst->rdi.u64    = src->regs.rdi;
-          dst->r8.u64     = src->regs.r8;
-          dst->r9.u64     = src->regs.r9;
-          dst->r10.u64    = src->regs.r10;
-          dst->r11.u64    = src->regs.r11;
-          dst->r12.u64    = src->regs.r12;
-          dst->r13.u64    = src->regs.r13;
-          dst->r14.u64    = src->regs.r14;
-          dst->r15.u64    = src->regs.r15;
-          dst->cs.u16     = src->regs.cs;
-          dst->ds.u16     = src->regs.ds;
-          dst->es.u16     = src->regs.es;
-          dst->fs.u16     = src->regs.fs;
-          dst->gs.u16     = src->regs.gs;
-          dst->ss.u16     = src->regs.ss;
-          dst->fsbase.u64 = src->regs.fsbase;
-          dst->gsbase.u64 = src->regs.gsbase;
-          dst->rip.u64    = src->regs.rip;
-          dst->rflags.u64 = src->regs.rflags;
+          dmn_lnx_reg_block_x64_from_regs(dst, &ctx.regs);
         }
         else { Assert(0 && "failed to get gprs"); }
       }
@@ -979,31 +1089,7 @@ dmn_lnx_thread_read_reg_block(DMN_LNX_Entity *thread, void *reg_block)
         // copy fxsave registers
         if(fxsave)
         {
-          X64_FXSave *src = fxsave;
-          
-          // copy x87 registers
-          dst->fcw.u16        = src->fcw;
-          dst->fsw.u16        = src->fsw;
-          dst->ftw.u16        = x64_xsave_tag_word_from_real_tag_word(src->ftw);
-          dst->fop.u16        = src->fop;
-          dst->fip.u64        = src->b64.fip;
-          dst->fdp.u64        = src->b64.fdp;
-          dst->mxcsr.u32      = src->mxcsr;
-          dst->mxcsr_mask.u32 = src->mxcsr_mask;
-          for EachIndex(i, 8)
-          {
-            MemoryCopy(&dst->st0 + i, src->st_space + i, sizeof(REGS_Reg80));
-          }
-          
-          // SSE registers are always available in x64
-          {
-            U128        *xmm_d = fxsave->xmm_space;
-            REGS_Reg512 *zmm_s = &dst->zmm0;
-            for EachIndex(i, 16)
-            {
-              MemoryCopy(&zmm_s[i], &xmm_d[i], sizeof(*xmm_d));
-            }
-          }
+          dmn_lnx_reg_block_x64_from_fxsave(dst, fxsave);
         }
         
         // copy xsave registers
@@ -1416,44 +1502,833 @@ dmn_lnx_process_unloaded_modules(Arena *arena, DMN_EventList *events, DMN_LNX_En
   {
     if(dmn_lnx_read_linkmap(process->fd, map_vaddr, process->dl_class, &map))
     {
-      DMN_LNX_Entity *module = hash_table_search_u64_raw(process->loaded_modules_ht, map.addr_vaddr);
-      if(module)
-      {
-        module->is_live = 1;
-      }
-      else { Assert(0 && "unknown module is being unloaded"); }
+      DMN_LNX_Entity *module = hash_table_search_u64_raw(process->loaded_modules_ht, map.addr_vaddr);
+      if(module)
+      {
+        module->is_live = 1;
+      }
+      else { Assert(0 && "unknown module is being unloaded"); }
+    }
+    else { Assert(0 && "unable to read Link Map"); }
+  }
+  
+  // unload inactive modules
+  DMN_HandleList to_release = {0};
+  for(DMN_LNX_Entity *module = process->first; module != &dmn_lnx_nil_entity; module = module->next)
+  {
+    if(module->kind != DMN_LNX_EntityKind_Module) {continue;}
+    if(module->is_live)                           {continue;}
+    dmn_handle_list_push(scratch.arena, &to_release, dmn_lnx_handle_from_entity(module));
+  }
+  
+  // push events and clean up internal structures
+  for EachNode(n, DMN_HandleNode, to_release.first)
+  {
+    DMN_LNX_Entity *module = dmn_lnx_entity_from_handle(n->v);
+    
+    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+    e->kind    = DMN_EventKind_UnloadModule;
+    e->process = dmn_lnx_handle_from_entity(process);
+    e->module  = dmn_lnx_handle_from_entity(module);
+    e->string  = dmn_lnx_read_string(arena, process->fd, module->id);
+    
+    hash_table_purge_u64(process->loaded_modules_ht, module->base_vaddr);
+    
+    dmn_lnx_entity_release(module);
+  }
+  
+  is_unmap_complete_finished = 1;
+  exit:;
+  Assert(is_unmap_complete_finished);
+  scratch_end(scratch);
+}
+
+////////////////////////////////
+//~ rjf: Core Files
+
+internal DMN_LNX_CoreRegion *
+dmn_lnx_core_region_from_vaddr(DMN_LNX_CoreRegionArray *regions, U64 vaddr)
+{
+  DMN_LNX_CoreRegion *result = 0;
+  if(regions->count != 0 && regions->v[0].vrange.min <= vaddr)
+  {
+    U64 first = 0;
+    U64 opl   = regions->count;
+    for(;opl - first > 1;)
+    {
+      U64 mid = (first + opl) / 2;
+      if(regions->v[mid].vrange.min <= vaddr)
+      {
+        first = mid;
+      }
+      else
+      {
+        opl = mid;
+      }
+    }
+    if(vaddr < regions->v[first].vrange.max)
+    {
+      result = &regions->v[first];
+    }
+  }
+  return result;
+}
+
+internal int
+dmn_lnx_core_region_is_before(DMN_LNX_CoreRegion *a, DMN_LNX_CoreRegion *b)
+{
+  return (a->vrange.min < b->vrange.min ? -1 : a->vrange.min > b->vrange.min ? +1 : 0);
+}
+
+internal U64
+dmn_lnx_core_read(DMN_LNX_Entity *process, Rng1U64 range, void *dst)
+{
+  U64 cursor = 0, size = dim_1u64(range);
+  while(cursor < size)
+  {
+    // rjf: prefer pages the kernel wrote into the core; fall back to the
+    // on-disk module for file-backed pages which were not dumped
+    U64 vaddr = range.min + cursor;
+    String8 src = {0};
+    DMN_LNX_CoreRegion *region = 0;
+    if((region = dmn_lnx_core_region_from_vaddr(&process->core_chunk_regions, vaddr)) != 0)
+    {
+      MutexScope(process->core_chunks_mutex)
+      {
+        if(region->data.str == 0)
+        {
+          U64 raw_size = dim_1u64(region->vrange);
+          U8 *raw = push_array(process->arena, U8, raw_size);
+          if(region->compressed_data.size != 0)
+          {
+            rr_lzb_simple_decode(region->compressed_data.str, region->compressed_data.size, raw, raw_size);
+          }
+          region->data = str8(raw, raw_size);
+        }
+      }
+      src = str8_skip(region->data, vaddr - region->vrange.min);
+    }
+    else if((region = dmn_lnx_core_region_from_vaddr(&process->core_regions, vaddr)) != 0 &&
+            vaddr - region->vrange.min < region->data.size)
+    {
+      src = str8_skip(region->data, vaddr - region->vrange.min);
+    }
+    else if((region = dmn_lnx_core_region_from_vaddr(&process->core_file_regions, vaddr)) != 0)
+    {
+      src = str8_skip(region->data, vaddr - region->vrange.min);
+    }
+    if(src.size == 0) { break; }
+    
+    // rjf: copy out of the mapped view - this is where pages actually get faulted in
+    U64 copy_size = Min(src.size, size - cursor);
+    MemoryCopy((U8 *)dst + cursor, src.str, copy_size);
+    cursor += copy_size;
+  }
+  return cursor;
+}
+
+internal B32
+dmn_lnx_core_open(String8 path, U32 *pid_out)
+{
+  Temp scratch = scratch_begin(0, 0);
+  B32 is_core = 0;
+  
+  //- rjf: open & check header - only map files which are actually cores
+  OS_Handle file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_ShareRead, path);
+  ELF_Hdr64 ehdr = {0};
+  if(os_file_read_struct(file, 0, &ehdr) == sizeof(ehdr) &&
+     str8_match(str8_prefix(str8_array_fixed(ehdr.e_ident), elf_magic_string.size), elf_magic_string, 0) &&
+     ehdr.e_type == ELF_Type_Core)
+  {
+    is_core = 1;
+  }
+  if(is_core && (ehdr.e_ident[ELF_Identifier_Class] != ELF_Class_64 || ehdr.e_machine != ELF_MachineKind_X86_64))
+  {
+    log_user_errorf("%S is a core file for an unsupported architecture; only x64 core files can be debugged currently.", path);
+    goto exit;
+  }
+  if(!is_core)
+  {
+    goto exit;
+  }
+  
+  //- rjf: map the whole core - nothing is read up front, so even multi-GB cores
+  // open instantly; pages are faulted in only as reads touch them
+  FileProperties props = os_properties_from_file(file);
+  OS_Handle      map   = os_file_map_open(OS_AccessFlag_Read, file);
+  void          *base  = os_file_map_view_open(map, OS_AccessFlag_Read, r1u64(0, props.size));
+  if(base == 0)
+  {
+    os_file_map_close(map);
+    log_user_errorf("Could not map core file %S.", path);
+    goto exit;
+  }
+  String8 data = str8((U8 *)base, props.size);
+  
+  //- rjf: make process
+  Arena *process_arena = arena_alloc();
+  DMN_LNX_Entity *process = dmn_lnx_entity_alloc(dmn_lnx_state->entities_base, DMN_LNX_EntityKind_Process);
+  process->arch              = Arch_x64;
+  process->fd                = -1;
+  process->tracer_tid        = gettid();
+  process->arena             = process_arena;
+  process->loaded_modules_ht = hash_table_init(process_arena, 0x100);
+  process->xsave_size        = sizeof(X64_XSave);
+  process->is_core           = 1;
+  process->core_chunks_mutex = mutex_alloc();
+  {
+    DMN_LNX_CoreFile *core_file = push_array(process_arena, DMN_LNX_CoreFile, 1);
+    core_file->file = file;
+    core_file->map  = map;
+    core_file->data = data;
+    SLLStackPush(process->core_files, core_file);
+    file = os_handle_zero();
+  }
+  
+  //- rjf: gather phdrs (PN_XNUM -> true count is stored in section 0's sh_info)
+  U64 phnum = ehdr.e_phnum;
+  if(phnum == 0xffff)
+  {
+    ELF_Shdr64 shdr0 = {0};
+    str8_deserial_read_struct(data, ehdr.e_shoff, &shdr0);
+    phnum = shdr0.sh_info;
+  }
+  if(ehdr.e_phentsize < sizeof(ELF_Phdr64) || ehdr.e_phoff >= data.size)
+  {
+    phnum = 0;
+  }
+  else
+  {
+    phnum = Min(phnum, (data.size - ehdr.e_phoff) / ehdr.e_phentsize);
+  }
+  
+  //- rjf: PT_LOAD -> core regions; PT_NOTE -> notes
+  ELF_NoteList notes = {0};
+  process->core_regions.v = push_array(process_arena, DMN_LNX_CoreRegion, phnum);
+  for EachIndex(phdr_idx, phnum)
+  {
+    ELF_Phdr64 phdr = {0};
+    str8_deserial_read_struct(data, ehdr.e_phoff + phdr_idx*ehdr.e_phentsize, &phdr);
+    String8 phdr_data = str8_substr(data, r1u64(phdr.p_offset, phdr.p_offset + phdr.p_filesz));
+    switch(phdr.p_type)
+    {
+      default:{}break;
+      case ELF_PType_Load:
+      if(phdr.p_memsz != 0)
+      {
+        DMN_LNX_CoreRegion *region = &process->core_regions.v[process->core_regions.count];
+        region->vrange = r1u64(phdr.p_vaddr, phdr.p_vaddr + phdr.p_memsz);
+        region->data   = phdr_data;
+        process->core_regions.count += 1;
+      }break;
+      case ELF_PType_Note:
+      {
+        ELF_NoteList phdr_notes = elf_parse_note(scratch.arena, phdr_data, ELF_Class_64, ehdr.e_machine);
+        if(phdr_notes.first != 0)
+        {
+          if(notes.last) { notes.last->next = phdr_notes.first; } else { notes.first = phdr_notes.first; }
+          notes.last   = phdr_notes.last;
+          notes.count += phdr_notes.count;
+        }
+      }break;
+    }
+  }
+  quick_sort(process->core_regions.v, process->core_regions.count, sizeof(process->core_regions.v[0]), dmn_lnx_core_region_is_before);
+  
+  //- rjf: gather process-wide notes
+  String8 auxv_data   = {0};
+  String8 file_data   = {0};
+  String8 chunks_data = {0};
+  U32     pid         = 0;
+  for EachNode(n, ELF_NoteNode, notes.first)
+  {
+    if(str8_match(n->v.owner, str8_lit(DMN_LNX_CORE_NOTE_OWNER), 0) && n->v.type == DMN_LNX_CoreNoteType_LZBChunks)
+    {
+      chunks_data = n->v.desc;
+    }
+    if(!str8_match(n->v.owner, str8_lit("CORE"), 0)) { continue; }
+    switch(n->v.type)
+    {
+      default:{}break;
+      case ELF_NoteType_Auxv:{auxv_data = n->v.desc;}break;
+      case ELF_NoteType_File:{file_data = n->v.desc;}break;
+      case ELF_NoteType_PrPsInfo:
+      {
+        DMN_LNX_PrPsInfoX64 prpsinfo = {0};
+        str8_deserial_read_struct(n->v.desc, 0, &prpsinfo);
+        pid = (U32)prpsinfo.pid;
+      }break;
+    }
+  }
+  DMN_LNX_ProcessAuxv auxv = dmn_lnx_auxv_from_data(auxv_data, ELF_Class_64);
+  
+  //- rjf: compressed memory chunks -> chunk regions (decompressed lazily, on first read)
+  {
+    U64 chunks_count = 0;
+    str8_deserial_read_struct(chunks_data, 0, &chunks_count);
+    chunks_count = Min(chunks_count, (chunks_data.size - Min(sizeof(U64), chunks_data.size)) / sizeof(DMN_LNX_CoreChunk));
+    process->core_chunk_regions.v = push_array(process_arena, DMN_LNX_CoreRegion, chunks_count);
+    for EachIndex(idx, chunks_count)
+    {
+      DMN_LNX_CoreChunk chunk = {0};
+      str8_deserial_read_struct(chunks_data, sizeof(U64) + idx*sizeof(chunk), &chunk);
+      String8 compressed_data = str8_substr(data, r1u64(chunk.off, chunk.off + chunk.compressed_size));
+      if(compressed_data.size != chunk.compressed_size || chunk.compressed_size > chunk.size) { continue; }
+      DMN_LNX_CoreRegion *region = &process->core_chunk_regions.v[process->core_chunk_regions.count];
+      region->vrange          = r1u64(chunk.vaddr, chunk.vaddr + chunk.size);
+      region->compressed_data = compressed_data;
+      if(chunk.compressed_size == chunk.size)
+      {
+        region->data = compressed_data;
+      }
+      process->core_chunk_regions.count += 1;
+    }
+    quick_sort(process->core_chunk_regions.v, process->core_chunk_regions.count, sizeof(process->core_chunk_regions.v[0]), dmn_lnx_core_region_is_before);
+  }
+  
+  //- rjf: push create process event
+  process->id = pid;
+  {
+    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+    e->kind    = DMN_EventKind_CreateProcess;
+    e->process = dmn_lnx_handle_from_entity(process);
+    e->arch    = process->arch;
+    e->code    = pid;
+  }
+  
+  //- rjf: NT_PRSTATUS -> threads; each thread's NT_FPREGSET directly follows its NT_PRSTATUS
+  DMN_LNX_Entity *first_thread  = &dmn_lnx_nil_entity;
+  DMN_LNX_Entity *signal_thread = &dmn_lnx_nil_entity;
+  S32             signal_code   = 0;
+  {
+    DMN_LNX_Entity *last_thread = &dmn_lnx_nil_entity;
+    for EachNode(n, ELF_NoteNode, notes.first)
+    {
+      if(!str8_match(n->v.owner, str8_lit("CORE"), 0)) { continue; }
+      switch(n->v.type)
+      {
+        default:{}break;
+        case ELF_NoteType_PrStatus:
+        {
+          DMN_LNX_PrStatusX64 prstatus = {0};
+          if(str8_deserial_read_struct(n->v.desc, 0, &prstatus) != sizeof(prstatus)) { break; }
+          DMN_LNX_Entity *thread = dmn_lnx_entity_alloc(process, DMN_LNX_EntityKind_Thread);
+          thread->id        = (U64)prstatus.pid;
+          thread->arch      = process->arch;
+          thread->reg_block = push_array(process_arena, U8, regs_block_size_from_arch(process->arch));
+          dmn_lnx_reg_block_x64_from_regs((REGS_RegBlockX64 *)thread->reg_block, &prstatus.regs);
+          last_thread = thread;
+          if(first_thread == &dmn_lnx_nil_entity)
+          {
+            first_thread = thread;
+          }
+          if(signal_thread == &dmn_lnx_nil_entity && prstatus.cursig != 0)
+          {
+            signal_thread = thread;
+            signal_code   = prstatus.cursig;
+          }
+          DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+          e->kind    = DMN_EventKind_CreateThread;
+          e->process = dmn_lnx_handle_from_entity(process);
+          e->thread  = dmn_lnx_handle_from_entity(thread);
+          e->arch    = thread->arch;
+          e->code    = thread->id;
+        }break;
+        case ELF_NoteType_PrFpReg:
+        if(last_thread != &dmn_lnx_nil_entity && n->v.desc.size >= sizeof(X64_FXSave))
+        {
+          X64_FXSave fxsave = {0};
+          str8_deserial_read_struct(n->v.desc, 0, &fxsave);
+          dmn_lnx_reg_block_x64_from_fxsave((REGS_RegBlockX64 *)last_thread->reg_block, &fxsave);
+        }break;
+      }
+    }
+  }
+  if(process->id == 0)
+  {
+    process->id = first_thread->id;
+  }
+  
+  //- rjf: NT_FILE -> modules, and on-disk backing for file-backed pages
+  {
+    // rjf: unpack note: header, then (start, end, page offset) triples, then names
+    U64 count = 0;
+    U64 page_size = 0;
+    U64 off = 0;
+    off += str8_deserial_read_struct(file_data, off, &count);
+    off += str8_deserial_read_struct(file_data, off, &page_size);
+    count = Min(count, (file_data.size - Min(off, file_data.size)) / (sizeof(U64)*3));
+    U64 *entries = push_array(scratch.arena, U64, count*3);
+    off += str8_deserial_read_array(file_data, off, entries, count*3);
+    String8 *names = push_array(scratch.arena, String8, count);
+    for EachIndex(idx, count)
+    {
+      off += str8_deserial_read_cstr(file_data, off, &names[idx]);
+    }
+    
+    // rjf: each mapping at file offset 0, plus all directly following mappings
+    // of the same file, form one module
+    process->core_file_regions.v = push_array(process_arena, DMN_LNX_CoreRegion, count);
+    DMN_EventList module_events = {0};
+    DMN_Event *exe_module_event = 0;
+    for EachIndex(idx, count)
+    {
+      if(entries[idx*3 + 2] != 0) { continue; }
+      U64 base_vaddr = entries[idx*3 + 0];
+      U64 opl_idx    = idx + 1;
+      U64 opl_vaddr  = entries[idx*3 + 1];
+      for(;opl_idx < count && str8_match(names[opl_idx], names[idx], 0); opl_idx += 1)
+      {
+        opl_vaddr = Max(opl_vaddr, entries[opl_idx*3 + 1]);
+      }
+      
+      // rjf: map on-disk file; only keep it if it, or its dumped header, is an ELF
+      DMN_LNX_CoreFile module_file = {0};
+      module_file.file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_ShareRead, names[idx]);
+      if(!os_handle_match(module_file.file, os_handle_zero()))
+      {
+        FileProperties module_props = os_properties_from_file(module_file.file);
+        module_file.map  = os_file_map_open(OS_AccessFlag_Read, module_file.file);
+        module_file.data.str  = (U8 *)os_file_map_view_open(module_file.map, OS_AccessFlag_Read, r1u64(0, module_props.size));
+        module_file.data.size = module_file.data.str ? module_props.size : 0;
+      }
+      U8 magic[4] = {0};
+      B32 is_elf = ((dmn_lnx_core_read(process, r1u64(base_vaddr, base_vaddr + sizeof(magic)), magic) == sizeof(magic) &&
+                     MemoryMatch(magic, elf_magic_string.str, sizeof(magic))) ||
+                    str8_match(str8_prefix(module_file.data, elf_magic_string.size), elf_magic_string, 0));
+      if(!is_elf)
+      {
+        if(module_file.data.str != 0)
+        {
+          os_file_map_view_close(module_file.map, module_file.data.str, r1u64(0, module_file.data.size));
+        }
+        os_file_map_close(module_file.map);
+        os_file_close(module_file.file);
+        continue;
+      }
+      if(module_file.data.str != 0)
+      {
+        DMN_LNX_CoreFile *core_file = push_array(process_arena, DMN_LNX_CoreFile, 1);
+        MemoryCopyStruct(core_file, &module_file);
+        SLLStackPush(process->core_files, core_file);
+        for(U64 region_idx = idx; region_idx < opl_idx; region_idx += 1)
+        {
+          U64 region_off = entries[region_idx*3 + 2]*page_size;
+          Rng1U64 region_vrange = r1u64(entries[region_idx*3 + 0], entries[region_idx*3 + 1]);
+          DMN_LNX_CoreRegion *region = &process->core_file_regions.v[process->core_file_regions.count];
+          region->vrange = region_vrange;
+          region->data   = str8_substr(module_file.data, r1u64(region_off, region_off + dim_1u64(region_vrange)));
+          process->core_file_regions.count += 1;
+        }
+      }
+      
+      // rjf: gather module info
+      ELF_Hdr64 module_ehdr = {0};
+      dmn_lnx_core_read_struct(process, base_vaddr, &module_ehdr);
+      U64 module_phdr_vaddr = base_vaddr + module_ehdr.e_phoff;
+      DMN_LNX_Entity *module = dmn_lnx_entity_alloc(process, DMN_LNX_EntityKind_Module);
+      module->id         = idx;
+      module->base_vaddr = base_vaddr;
+      hash_table_push_u64_raw(process_arena, process->loaded_modules_ht, base_vaddr, module);
+      
+      // rjf: push load event
+      DMN_Event *e = dmn_event_list_push(scratch.arena, &module_events);
+      e->kind             = DMN_EventKind_LoadModule;
+      e->process          = dmn_lnx_handle_from_entity(process);
+      e->thread           = dmn_lnx_handle_from_entity(first_thread);
+      e->module           = dmn_lnx_handle_from_entity(module);
+      e->arch             = process->arch;
+      e->address          = base_vaddr;
+      e->size             = opl_vaddr - base_vaddr;
+      e->string           = names[idx];
+      e->elf_phdr_vrange  = r1u64(module_phdr_vaddr, module_phdr_vaddr + module_ehdr.e_phentsize*module_ehdr.e_phnum);
+      e->elf_phdr_entsize = module_ehdr.e_phentsize;
+      if(exe_module_event == 0 && base_vaddr <= auxv.phdr && auxv.phdr < opl_vaddr)
+      {
+        exe_module_event = e;
+      }
+    }
+    quick_sort(process->core_file_regions.v, process->core_file_regions.count, sizeof(process->core_file_regions.v[0]), dmn_lnx_core_region_is_before);
+    
+    // rjf: push load events - executable first
+    for EachIndex(pass, 2)
+    {
+      for EachNode(n, DMN_EventNode, module_events.first)
+      {
+        B32 is_exe = (&n->v == exe_module_event);
+        if(is_exe != (pass == 0)) { continue; }
+        DMN_Event *e_dst = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+        MemoryCopyStruct(e_dst, &n->v);
+        e_dst->string = push_str8_copy(dmn_lnx_state->deferred_events_arena, n->v.string);
+      }
+    }
+  }
+  
+  //- rjf: handshake event
+  {
+    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+    e->kind    = DMN_EventKind_HandshakeComplete;
+    e->process = dmn_lnx_handle_from_entity(process);
+    e->thread  = dmn_lnx_handle_from_entity(first_thread);
+    e->arch    = process->arch;
+  }
+  
+  //- rjf: stop on the signal which produced the dump - or just halt, for
+  // snapshots taken without one (e.g. gcore)
+  if(signal_thread != &dmn_lnx_nil_entity)
+  {
+    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+    e->kind                = DMN_EventKind_Exception;
+    e->process             = dmn_lnx_handle_from_entity(process);
+    e->thread              = dmn_lnx_handle_from_entity(signal_thread);
+    e->instruction_pointer = ((REGS_RegBlockX64 *)signal_thread->reg_block)->rip.u64;
+    e->signo               = signal_code;
+  }
+  else
+  {
+    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+    e->kind    = DMN_EventKind_Halt;
+    e->process = dmn_lnx_handle_from_entity(process);
+    e->thread  = dmn_lnx_handle_from_entity(first_thread);
+  }
+  if(pid_out)
+  {
+    *pid_out = (U32)process->id;
+  }
+  
+  exit:;
+  os_file_close(file);
+  scratch_end(scratch);
+  return is_core;
+}
+
+internal void
+dmn_lnx_core_close(DMN_LNX_Entity *process)
+{
+  //- rjf: generate exit-thread / unload-module / exit-process events
+  for(DMN_LNX_Entity *child = process->first; child != &dmn_lnx_nil_entity; child = child->next)
+  {
+    DMN_Event *e = 0;
+    switch(child->kind)
+    {
+      default:{}break;
+      case DMN_LNX_EntityKind_Thread:
+      {
+        e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+        e->kind   = DMN_EventKind_ExitThread;
+        e->thread = dmn_lnx_handle_from_entity(child);
+      }break;
+      case DMN_LNX_EntityKind_Module:
+      {
+        e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+        e->kind   = DMN_EventKind_UnloadModule;
+        e->module = dmn_lnx_handle_from_entity(child);
+      }break;
+    }
+    if(e != 0)
+    {
+      e->process = dmn_lnx_handle_from_entity(process);
+    }
+  }
+  {
+    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
+    e->kind    = DMN_EventKind_ExitProcess;
+    e->process = dmn_lnx_handle_from_entity(process);
+  }
+  
+  //- rjf: unmap core & module files
+  for EachNode(f, DMN_LNX_CoreFile, process->core_files)
+  {
+    os_file_map_view_close(f->map, f->data.str, r1u64(0, f->data.size));
+    os_file_map_close(f->map);
+    os_file_close(f->file);
+  }
+  
+  //- rjf: eliminate entity tree
+  Arena *process_arena = process->arena;
+  mutex_release(process->core_chunks_mutex);
+  dmn_lnx_entity_release(process);
+  arena_release(process_arena);
+}
+
+//- rjf: writing
+
+internal DMN_LNX_CoreSaveRegionArray
+dmn_lnx_core_save_regions_from_pid(Arena *arena, pid_t pid)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  String8 smaps = dmn_lnx_data_from_proc_path(scratch.arena, str8f(scratch.arena, "/proc/%d/smaps", pid));
+  String8List lines = str8_split(scratch.arena, smaps, (U8 *)"\n", 1, 0);
+  
+  //- rjf: count regions - each begins with a /proc/pid/maps-style line, followed
+  // by "Key: value" lines
+  U64 regions_cap = 0;
+  for EachNode(n, String8Node, lines.first)
+  {
+    String8 first_part = str8_prefix(n->string, str8_find_needle(n->string, 0, str8_lit(" "), 0));
+    if(first_part.size != 0 && first_part.str[first_part.size-1] != ':')
+    {
+      regions_cap += 1;
+    }
+  }
+  
+  //- rjf: parse regions
+  DMN_LNX_CoreSaveRegionArray result = {0};
+  result.v = push_array(arena, DMN_LNX_CoreSaveRegion, regions_cap);
+  String8 *names          = push_array(scratch.arena, String8, regions_cap);
+  U64     *anonymous_kbs  = push_array(scratch.arena, U64, regions_cap);
+  B8      *dont_dump      = push_array(scratch.arena, B8, regions_cap);
+  for EachNode(n, String8Node, lines.first)
+  {
+    String8 line = n->string;
+    String8 first_part = str8_prefix(line, str8_find_needle(line, 0, str8_lit(" "), 0));
+    if(first_part.size != 0 && first_part.str[first_part.size-1] != ':' && result.count < regions_cap)
+    {
+      // rjf: range perms offset dev inode [name]
+      String8List parts = str8_split(scratch.arena, line, (U8 *)" ", 1, 0);
+      if(parts.node_count < 5) { continue; }
+      String8Node *range_n  = parts.first;
+      String8Node *perms_n  = range_n->next;
+      String8Node *offset_n = perms_n->next;
+      String8Node *inode_n  = offset_n->next->next;
+      U64 range_dash_pos = str8_find_needle(range_n->string, 0, str8_lit("-"), 0);
+      DMN_LNX_CoreSaveRegion *region = &result.v[result.count];
+      region->vrange.min = u64_from_str8(str8_prefix(range_n->string, range_dash_pos), 16);
+      region->vrange.max = u64_from_str8(str8_skip(range_n->string, range_dash_pos+1), 16);
+      region->file_off   = u64_from_str8(offset_n->string, 16);
+      for EachIndex(idx, perms_n->string.size)
+      {
+        switch(perms_n->string.str[idx])
+        {
+          default:{}break;
+          case 'r':{region->flags |= ELF_PFlag_Read;}break;
+          case 'w':{region->flags |= ELF_PFlag_Write;}break;
+          case 'x':{region->flags |= ELF_PFlag_Exec;}break;
+        }
+      }
+      names[result.count] = str8_skip_chop_whitespace(str8_skip(line, (inode_n->string.str + inode_n->string.size) - line.str));
+      if(str8_match(str8_prefix(names[result.count], 1), str8_lit("/"), 0))
+      {
+        region->file_path = push_str8_copy(arena, names[result.count]);
+      }
+      result.count += 1;
+    }
+    else if(result.count != 0 && str8_match(first_part, str8_lit("Anonymous:"), 0))
+    {
+      anonymous_kbs[result.count-1] = u64_from_str8(str8_skip_chop_whitespace(str8_chop(str8_skip(line, first_part.size), 2)), 10);
+    }
+    else if(result.count != 0 && str8_match(first_part, str8_lit("VmFlags:"), 0))
+    {
+      String8List flags = str8_split(scratch.arena, str8_skip(line, first_part.size), (U8 *)" ", 1, 0);
+      for EachNode(flag_n, String8Node, flags.first)
+      {
+        if(str8_match(flag_n->string, str8_lit("dd"), 0) || str8_match(flag_n->string, str8_lit("io"), 0))
+        {
+          dont_dump[result.count-1] = 1;
+        }
+      }
+    }
+  }
+  
+  //- rjf: pick which bytes of each region to dump
+  for EachIndex(idx, result.count)
+  {
+    DMN_LNX_CoreSaveRegion *region = &result.v[idx];
+    String8 name = names[idx];
+    B32 is_file_unchanged = (region->file_path.size != 0 &&
+                             anonymous_kbs[idx] == 0 &&
+                             !str8_match(str8_postfix(name, 10), str8_lit(" (deleted)"), 0));
+    if(!(region->flags & ELF_PFlag_Read) || dont_dump[idx] ||
+       str8_match(name, str8_lit("[vvar]"), 0) ||
+       str8_match(name, str8_lit("[vvar_vclock]"), 0) ||
+       str8_match(name, str8_lit("[vsyscall]"), 0))
+    {
+      region->dump_size = 0;
+    }
+    else if(is_file_unchanged)
+    {
+      // rjf: no private copies of any page - the file on disk is the same
+      // data. keep only the first page of images, for build IDs & headers.
+      region->dump_size = (region->file_off == 0 ? Min(KB(4), dim_1u64(region->vrange)) : 0);
+    }
+    else
+    {
+      region->dump_size = dim_1u64(region->vrange);
+    }
+  }
+  
+  scratch_end(scratch);
+  return result;
+}
+
+internal void
+dmn_lnx_core_note_push(Arena *arena, String8List *list, String8 owner, U32 type, String8 desc)
+{
+  U32 owner_size = (U32)owner.size + 1;
+  U32 desc_size  = (U32)desc.size;
+  U64 desc_off   = sizeof(U32)*3 + AlignPow2(owner_size, 4);
+  U64 size       = desc_off + AlignPow2(desc_size, 4);
+  U8 *buffer     = push_array(arena, U8, size);
+  MemoryCopy(buffer + 0, &owner_size, sizeof(U32));
+  MemoryCopy(buffer + 4, &desc_size,  sizeof(U32));
+  MemoryCopy(buffer + 8, &type,       sizeof(U32));
+  MemoryCopy(buffer + 12, owner.str, owner.size);
+  MemoryCopy(buffer + desc_off, desc.str, desc.size);
+  str8_list_push(arena, list, str8(buffer, size));
+}
+
+internal B32
+dmn_lnx_data_is_zero(U8 *data, U64 size)
+{
+  B32 result = 1;
+  U64 *words = (U64 *)data;
+  U64 words_count = size / sizeof(U64);
+  for EachIndex(idx, words_count)
+  {
+    if(words[idx] != 0)
+    {
+      result = 0;
+      break;
     }
-    else { Assert(0 && "unable to read Link Map"); }
   }
+  for(U64 idx = words_count*sizeof(U64); result && idx < size; idx += 1)
+  {
+    result = (data[idx] == 0);
+  }
+  return result;
+}
+
+internal void
+dmn_lnx_core_save_lane_entry_point(void *p)
+{
+  DMN_LNX_CoreSaveLaneParams *params = (DMN_LNX_CoreSaveLaneParams *)p;
+  DMN_LNX_CoreSaveShared *shared = params->shared;
+  ThreadNameF("[dmn] core save #%I64u", params->lane_ctx.lane_idx);
+  lane_ctx(params->lane_ctx);
+  Temp scratch = scratch_begin(0, 0);
+  U64 page_size  = KB(4);
+  U64 chunk_size = DMN_LNX_CORE_CHUNK_SIZE;
   
-  // unload inactive modules
-  DMN_HandleList to_release = {0};
-  for(DMN_LNX_Entity *module = process->first; module != &dmn_lnx_nil_entity; module = module->next)
+  //- rjf: set up per-lane buffers - each lane reads (& compresses) a batch of chunks per round
+  U64      batch_cap  = 8;
+  Rng1U64 *ranges     = push_array(scratch.arena, Rng1U64, batch_cap);
+  void   **dsts       = push_array(scratch.arena, void *, batch_cap);
+  U64     *read_sizes = push_array(scratch.arena, U64, batch_cap);
+  U8      *raw        = push_array_no_zero(scratch.arena, U8, batch_cap*chunk_size);
+  U8      *compressed = 0;
+  rr_lzb_simple_context lzb = {0};
+  if(shared->compress)
   {
-    if(module->kind != DMN_LNX_EntityKind_Module) {continue;}
-    if(module->is_live)                           {continue;}
-    dmn_handle_list_push(scratch.arena, &to_release, dmn_lnx_handle_from_entity(module));
+    compressed = push_array_no_zero(scratch.arena, U8, batch_cap*chunk_size);
+    lzb.m_tableSizeBits = 14;
+    lzb.m_hashTable = push_array(scratch.arena, U16, 1<<lzb.m_tableSizeBits);
   }
   
-  // push events and clean up internal structures
-  for EachNode(n, DMN_HandleNode, to_release.first)
+  //- rjf: dump all chunks, one round at a time
+  U64 round_size = lane_count()*batch_cap;
+  for(U64 round_base = 0; round_base < shared->chunks_count; round_base += round_size)
   {
-    DMN_LNX_Entity *module = dmn_lnx_entity_from_handle(n->v);
+    Rng1U64 lane_chunks = r1u64(Min(shared->chunks_count, round_base + lane_idx()*batch_cap),
+                                Min(shared->chunks_count, round_base + (lane_idx()+1)*batch_cap));
+    U64 lane_chunks_count = dim_1u64(lane_chunks);
     
-    DMN_Event *e = dmn_event_list_push(dmn_lnx_state->deferred_events_arena, &dmn_lnx_state->deferred_events);
-    e->kind    = DMN_EventKind_UnloadModule;
-    e->process = dmn_lnx_handle_from_entity(process);
-    e->module  = dmn_lnx_handle_from_entity(module);
-    e->string  = dmn_lnx_read_string(arena, process->fd, module->id);
+    //- rjf: read this lane's chunks with one batched read; unreadable pages
+    // (e.g. past the end of a mapped file) are dumped as zeroes
+    for EachIndex(idx, lane_chunks_count)
+    {
+      DMN_LNX_CoreChunk *chunk = &shared->chunks[lane_chunks.min + idx];
+      ranges[idx] = r1u64(chunk->vaddr, chunk->vaddr + chunk->size);
+      dsts[idx]   = raw + idx*chunk_size;
+    }
+    dmn_process_read_batch(shared->process, lane_chunks_count, ranges, dsts, read_sizes);
+    for EachIndex(idx, lane_chunks_count)
+    {
+      U8 *dst = (U8 *)dsts[idx];
+      U64 size = dim_1u64(ranges[idx]);
+      for(U64 off = read_sizes[idx]; off < size;)
+      {
+        U64 page_opl = Min(size, AlignPow2(off+1, page_size));
+        U64 page_read_size = dmn_process_read(shared->process, r1u64(ranges[idx].min + off, ranges[idx].min + page_opl), dst + off);
+        MemoryZero(dst + off + page_read_size, page_opl - off - page_read_size);
+        off = page_opl;
+      }
+    }
     
-    hash_table_purge_u64(process->loaded_modules_ht, module->base_vaddr);
+    //- rjf: uncompressed -> write runs of non-zero pages at their fixed offsets;
+    // all-zero pages are left as holes in the (sparse) file
+    if(!shared->compress)
+    {
+      for EachIndex(idx, lane_chunks_count)
+      {
+        DMN_LNX_CoreChunk *chunk = &shared->chunks[lane_chunks.min + idx];
+        U8 *src = (U8 *)dsts[idx];
+        for(U64 off = 0; off < chunk->size;)
+        {
+          U64 run_min = off;
+          for(;run_min < chunk->size && dmn_lnx_data_is_zero(src + run_min, Min(page_size, chunk->size - run_min)); run_min += page_size);
+          U64 run_opl = run_min;
+          for(;run_opl < chunk->size && !dmn_lnx_data_is_zero(src + run_opl, Min(page_size, chunk->size - run_opl)); run_opl += page_size);
+          run_min = Min(run_min, chunk->size);
+          run_opl = Min(run_opl, chunk->size);
+          if(run_min < run_opl)
+          {
+            U64 write_size = os_file_write(shared->file, r1u64(chunk->off + run_min, chunk->off + run_opl), src + run_min);
+            ins_atomic_u64_add_eval(&shared->bytes_written, write_size);
+            if(write_size != run_opl - run_min)
+            {
+              shared->write_failed = 1;
+            }
+          }
+          off = run_opl;
+        }
+      }
+    }
     
-    dmn_lnx_entity_release(module);
+    //- rjf: compressed -> compress chunks, lay out this round's chunks in
+    // order, then write
+    if(shared->compress)
+    {
+      for EachIndex(idx, lane_chunks_count)
+      {
+        DMN_LNX_CoreChunk *chunk = &shared->chunks[lane_chunks.min + idx];
+        U8 *src = (U8 *)dsts[idx];
+        if(dmn_lnx_data_is_zero(src, chunk->size))
+        {
+          chunk->compressed_size = 0;
+        }
+        else
+        {
+          MemoryZero(lzb.m_hashTable, sizeof(U16)*(1<<lzb.m_tableSizeBits));
+          chunk->compressed_size = rr_lzb_simple_encode_veryfast(&lzb, src, chunk->size, compressed + idx*chunk_size);
+        }
+      }
+      lane_sync();
+      if(lane_idx() == 0)
+      {
+        Rng1U64 round_chunks = r1u64(round_base, Min(shared->chunks_count, round_base + round_size));
+        for EachInRange(chunk_idx, round_chunks)
+        {
+          shared->chunks[chunk_idx].off = shared->data_opl;
+          shared->data_opl += shared->chunks[chunk_idx].compressed_size;
+        }
+      }
+      lane_sync();
+      for EachIndex(idx, lane_chunks_count)
+      {
+        DMN_LNX_CoreChunk *chunk = &shared->chunks[lane_chunks.min + idx];
+        if(chunk->compressed_size != 0)
+        {
+          U64 write_size = os_file_write(shared->file, r1u64(chunk->off, chunk->off + chunk->compressed_size), compressed + idx*chunk_size);
+          ins_atomic_u64_add_eval(&shared->bytes_written, write_size);
+          if(write_size != chunk->compressed_size)
+          {
+            shared->write_failed = 1;
+          }
+        }
+      }
+    }
   }
   
-  is_unmap_complete_finished = 1;
-  exit:;
-  Assert(is_unmap_complete_finished);
   scratch_end(scratch);
 }
 
@@ -1506,6 +2381,15 @@ internal U32
 dmn_ctrl_launch(DMN_CtrlCtx *ctx, OS_ProcessLaunchParams *params)
 {
   Temp scratch = scratch_begin(0, 0);
+  U32 result = 0;
+  
+  //- rjf: launching an ELF core file -> open it as a frozen, read-only process
+  B32 is_core = 0;
+  if(params->cmd_line.first != 0)
+  {
+    String8 exe_path = path_absolute_dst_from_relative_dst_src(scratch.arena, params->cmd_line.first->string, params->path);
+    is_core = dmn_lnx_core_open(exe_path, &result);
+  }
   
   //- rjf: unpack command line
   char **argv = 0;
@@ -1539,7 +2423,7 @@ dmn_ctrl_launch(DMN_CtrlCtx *ctx, OS_ProcessLaunchParams *params)
   }
   
   //- rjf: create & set up new process
-  if(argv != 0 && argv[0] != 0)
+  if(!is_core && argv != 0 && argv[0] != 0)
   {
     pid_t pid                    = 0;
     int   ptrace_result          = 0;
@@ -1923,7 +2807,7 @@ dmn_ctrl_launch(DMN_CtrlCtx *ctx, OS_ProcessLaunchParams *params)
   }
   
   scratch_end(scratch);
-  return 0;
+  return result;
 }
 
 internal B32
@@ -1937,8 +2821,13 @@ dmn_ctrl_kill(DMN_CtrlCtx *ctx, DMN_Handle process, U32 exit_code)
 {
   B32 result = 0;
   DMN_LNX_Entity *process_entity = dmn_lnx_entity_from_handle(process);
-  if(process_entity != &dmn_lnx_nil_entity &&
-     kill(process_entity->id, SIGKILL) != -1)
+  if(process_entity->is_core)
+  {
+    dmn_lnx_core_close(process_entity);
+    result = 1;
+  }
+  else if(process_entity != &dmn_lnx_nil_entity &&
+          kill(process_entity->id, SIGKILL) != -1)
   {
     result = 1;
   }
@@ -1950,8 +2839,13 @@ dmn_ctrl_detach(DMN_CtrlCtx *ctx, DMN_Handle process)
 {
   B32 result = 0;
   DMN_LNX_Entity *process_entity = dmn_lnx_entity_from_handle(process);
-  if(process_entity != &dmn_lnx_nil_entity &&
-     ptrace(PTRACE_DETACH, process_entity->id, 0, 0) != -1)
+  if(process_entity->is_core)
+  {
+    dmn_lnx_core_close(process_entity);
+    result = 1;
+  }
+  else if(process_entity != &dmn_lnx_nil_entity &&
+          ptrace(PTRACE_DETACH, process_entity->id, 0, 0) != -1)
   {
     result = 1;
   }
@@ -2420,7 +3314,7 @@ dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls)
       {
         DMN_Trap *trap = n->v+n_idx;
         
-        if(trap->flags == 0)
+        if(trap->flags == 0 && !dmn_lnx_entity_from_handle(trap->process)->is_core)
         {
           DMN_ActiveTrap *is_set = hash_table_search_u64_raw(ht, trap->vaddr);
           if(is_set) { continue; }
@@ -2449,7 +3343,10 @@ dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls)
   if(!dmn_handle_match(ctrls->single_step_thread, dmn_handle_zero()))
   {
     DMN_LNX_Entity *single_step_thread = dmn_lnx_entity_from_handle(ctrls->single_step_thread);
-    dmn_lnx_set_single_step_flag(single_step_thread, 1);
+    if(!single_step_thread->parent->is_core)
+    {
+      dmn_lnx_set_single_step_flag(single_step_thread, 1);
+    }
   }
   
   ////////////////////////////
@@ -2463,6 +3360,9 @@ dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls)
     {
       if(process->kind != DMN_LNX_EntityKind_Process) { continue; }
       
+      //- rjf: core processes never run
+      if(process->is_core) { continue; }
+      
       //- rjf: determine if this process is frozen
       B32 process_is_frozen = 0;
       if(ctrls->run_entities_are_processes)
@@ -2525,6 +3425,26 @@ dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls)
     }
   }
   
+  ////////////////////////////
+  //- rjf: nothing live to run, but a core is loaded -> it is frozen forever, so
+  // report a halt instead of waiting on events which will never come
+  //
+  if(need_wait_on_events && run_threads.count == 0)
+  {
+    for(DMN_LNX_Entity *process = dmn_lnx_state->entities_base->first; process != &dmn_lnx_nil_entity; process = process->next)
+    {
+      if(process->is_core)
+      {
+        DMN_Event *e = dmn_event_list_push(arena, &evts);
+        e->kind    = DMN_EventKind_Halt;
+        e->process = dmn_lnx_handle_from_entity(process);
+        e->thread  = dmn_lnx_handle_from_entity(process->first);
+        need_wait_on_events = 0;
+        break;
+      }
+    }
+  }
+  
   ////////////////////////////
   //- rjf: resume all threads we need to run
   //
@@ -2603,6 +3523,322 @@ dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls)
   return evts;
 }
 
+internal B32
+dmn_ctrl_save_core(DMN_CtrlCtx *ctx, DMN_Handle process_handle, String8 path, DMN_CoreFlags flags)
+{
+  Temp scratch = scratch_begin(0, 0);
+  U64 start_us = os_now_microseconds();
+  B32 result = 0;
+  B32 compress = !!(flags & DMN_CoreFlag_Compress);
+  DMN_LNX_Entity *process = dmn_lnx_entity_from_handle(process_handle);
+  
+  //- rjf: only live x64 processes can be dumped
+  if(process->kind != DMN_LNX_EntityKind_Process)
+  {
+    log_user_errorf("Cannot save a core dump; no process was specified.");
+    goto exit;
+  }
+  if(process->is_core)
+  {
+    log_user_errorf("Cannot save a core dump of a process which was loaded from a core file.");
+    goto exit;
+  }
+  if(process->arch != Arch_x64)
+  {
+    log_user_errorf("Cannot save a core dump; only x64 processes are supported currently.");
+    goto exit;
+  }
+  pid_t pid = (pid_t)process->id;
+  
+  //- rjf: gather memory regions
+  DMN_LNX_CoreSaveRegionArray regions = dmn_lnx_core_save_regions_from_pid(scratch.arena, pid);
+  if(regions.count == 0)
+  {
+    log_user_errorf("Cannot save a core dump; could not read the memory map of process %i.", pid);
+    goto exit;
+  }
+  
+  //- rjf: build notes - process info, auxv, file mappings, then each thread's registers
+  String8List notes = {0};
+  {
+    String8 owner = str8_lit("CORE");
+    
+    // rjf: NT_PRPSINFO
+    {
+      DMN_LNX_PrPsInfoX64 prpsinfo = {0};
+      prpsinfo.state = 3;
+      prpsinfo.sname = 't';
+      prpsinfo.pid   = pid;
+      struct stat st = {0};
+      if(stat((char *)str8f(scratch.arena, "/proc/%d", pid).str, &st) == 0)
+      {
+        prpsinfo.uid = st.st_uid;
+        prpsinfo.gid = st.st_gid;
+      }
+      String8 comm = str8_skip_chop_whitespace(dmn_lnx_data_from_proc_path(scratch.arena, str8f(scratch.arena, "/proc/%d/comm", pid)));
+      MemoryCopy(prpsinfo.fname, comm.str, Min(comm.size, sizeof(prpsinfo.fname)-1));
+      String8 cmdline = dmn_lnx_data_from_proc_path(scratch.arena, str8f(scratch.arena, "/proc/%d/cmdline", pid));
+      for EachIndex(idx, Min(cmdline.size, sizeof(prpsinfo.psargs)-1))
+      {
+        prpsinfo.psargs[idx] = (cmdline.str[idx] == 0 ? ' ' : cmdline.str[idx]);
+      }
+      dmn_lnx_core_note_push(scratch.arena, &notes, owner, ELF_NoteType_PrPsInfo, str8_struct(&prpsinfo));
+    }
+    
+    // rjf: NT_AUXV
+    {
+      String8 auxv = dmn_lnx_data_from_proc_path(scratch.arena, str8f(scratch.arena, "/proc/%d/auxv", pid));
+      dmn_lnx_core_note_push(scratch.arena, &notes, owner, ELF_NoteType_Auxv, auxv);
+    }
+    
+    // rjf: NT_FILE - count, page size, (start, end, page offset) triples, then names
+    {
+      String8List desc = {0};
+      U64 count = 0;
+      U64 page_size = KB(4);
+      for EachIndex(idx, regions.count)
+      {
+        count += (regions.v[idx].file_path.size != 0);
+      }
+      str8_serial_begin(scratch.arena, &desc);
+      str8_serial_push_struct(scratch.arena, &desc, &count);
+      str8_serial_push_struct(scratch.arena, &desc, &page_size);
+      for EachIndex(idx, regions.count)
+      {
+        DMN_LNX_CoreSaveRegion *region = &regions.v[idx];
+        if(region->file_path.size == 0) { continue; }
+        U64 entry[3] = {region->vrange.min, region->vrange.max, region->file_off/page_size};
+        str8_serial_push_array(scratch.arena, &desc, &entry[0], ArrayCount(entry));
+      }
+      for EachIndex(idx, regions.count)
+      {
+        if(regions.v[idx].file_path.size == 0) { continue; }
+        str8_serial_push_cstr(scratch.arena, &desc, regions.v[idx].file_path);
+      }
+      dmn_lnx_core_note_push(scratch.arena, &notes, owner, ELF_NoteType_File, str8_serial_end(scratch.arena, &desc));
+    }
+    
+    // rjf: per thread: NT_PRSTATUS, NT_FPREGSET, NT_X86_XSTATE - straight from
+    // ptrace, which uses the same layouts as the kernel's own core writer
+    for(DMN_LNX_Entity *thread = process->first; thread != &dmn_lnx_nil_entity; thread = thread->next)
+    {
+      if(thread->kind != DMN_LNX_EntityKind_Thread) { continue; }
+      pid_t tid = (pid_t)thread->id;
+      DMN_LNX_PrStatusX64 prstatus = {0};
+      prstatus.pid = tid;
+      if(dmn_lnx_state->last_event_kind == DMN_EventKind_Exception && dmn_lnx_state->last_stop_pid == tid)
+      {
+        prstatus.si_signo = dmn_lnx_state->last_sig_code;
+        prstatus.cursig   = (S16)dmn_lnx_state->last_sig_code;
+      }
+      ptrace(PTRACE_GETREGSET, tid, (void *)NT_PRSTATUS, &(struct iovec){ .iov_base = &prstatus.regs, .iov_len = sizeof(prstatus.regs) });
+      X64_FXSave fxsave = {0};
+      prstatus.fpvalid = ptrace(PTRACE_GETREGSET, tid, (void *)NT_FPREGSET, &(struct iovec){ .iov_base = &fxsave, .iov_len = sizeof(fxsave) }) >= 0;
+      dmn_lnx_core_note_push(scratch.arena, &notes, owner, ELF_NoteType_PrStatus, str8_struct(&prstatus));
+      if(prstatus.fpvalid)
+      {
+        dmn_lnx_core_note_push(scratch.arena, &notes, owner, ELF_NoteType_PrFpReg, str8_struct(&fxsave));
+      }
+      if(process->xsave_size != 0)
+      {
+        U8 *xsave = push_array(scratch.arena, U8, process->xsave_size);
+        struct iovec xsave_iov = {xsave, process->xsave_size};
+        if(ptrace(PTRACE_GETREGSET, tid, (void *)NT_X86_XSTATE, &xsave_iov) >= 0)
+        {
+          dmn_lnx_core_note_push(scratch.arena, &notes, str8_lit("LINUX"), ELF_NoteType_X86XState, str8(xsave, xsave_iov.iov_len));
+        }
+      }
+    }
+  }
+  
+  //- rjf: plan file layout - headers, notes, then memory, at page-aligned offsets
+  U64 phdrs_count = 1 + !!compress + regions.count;
+  B32 is_xnum     = (phdrs_count >= 0xffff);
+  U64 phdrs_off   = sizeof(ELF_Hdr64);
+  U64 shdr_off    = phdrs_off + phdrs_count*sizeof(ELF_Phdr64);
+  U64 notes_off   = shdr_off + (is_xnum ? sizeof(ELF_Shdr64) : 0);
+  U64 data_off    = AlignPow2(notes_off + notes.total_size, KB(4));
+  U64 data_opl    = data_off;
+  U64 memory_size = 0;
+  U64 chunks_count = 0;
+  for EachIndex(idx, regions.count)
+  {
+    regions.v[idx].data_off = data_opl;
+    data_opl += (compress ? 0 : regions.v[idx].dump_size);
+    memory_size += regions.v[idx].dump_size;
+    chunks_count += CeilIntegerDiv(regions.v[idx].dump_size, DMN_LNX_CORE_CHUNK_SIZE);
+  }
+  
+  //- rjf: split dumped memory into chunks - the units of reading, compression & writing
+  DMN_LNX_CoreChunk *chunks = push_array(scratch.arena, DMN_LNX_CoreChunk, chunks_count);
+  {
+    U64 chunk_idx = 0;
+    for EachIndex(idx, regions.count)
+    {
+      DMN_LNX_CoreSaveRegion *region = &regions.v[idx];
+      for(U64 off = 0; off < region->dump_size; off += DMN_LNX_CORE_CHUNK_SIZE, chunk_idx += 1)
+      {
+        chunks[chunk_idx].vaddr           = region->vrange.min + off;
+        chunks[chunk_idx].size            = Min(DMN_LNX_CORE_CHUNK_SIZE, region->dump_size - off);
+        chunks[chunk_idx].off             = region->data_off + off;
+        chunks[chunk_idx].compressed_size = chunks[chunk_idx].size;
+      }
+    }
+  }
+  
+  //- rjf: open output (opening for writing does not truncate)
+  os_delete_file_at_path(path);
+  OS_Handle file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_Write, path);
+  if(os_handle_match(file, os_handle_zero()))
+  {
+    log_user_errorf("Cannot save a core dump; could not open %S for writing.", path);
+    goto exit;
+  }
+  
+  //- rjf: dump memory wide
+  DMN_LNX_CoreSaveShared shared = {0};
+  shared.process      = process_handle;
+  shared.file         = file;
+  shared.compress     = compress;
+  shared.chunks       = chunks;
+  shared.chunks_count = chunks_count;
+  shared.data_opl     = data_off;
+  {
+    U64 lanes_count = Clamp(1, CeilIntegerDiv(chunks_count, 8), os_get_system_info()->logical_processor_count);
+    Thread *lanes = push_array(scratch.arena, Thread, lanes_count);
+    DMN_LNX_CoreSaveLaneParams *lanes_params = push_array(scratch.arena, DMN_LNX_CoreSaveLaneParams, lanes_count);
+    Barrier barrier = barrier_alloc(lanes_count);
+    U64 broadcast_val = 0;
+    for EachIndex(idx, lanes_count)
+    {
+      lanes_params[idx].lane_ctx.lane_idx         = idx;
+      lanes_params[idx].lane_ctx.lane_count       = lanes_count;
+      lanes_params[idx].lane_ctx.barrier          = barrier;
+      lanes_params[idx].lane_ctx.broadcast_memory = &broadcast_val;
+      lanes_params[idx].shared                    = &shared;
+      lanes[idx] = thread_launch(dmn_lnx_core_save_lane_entry_point, &lanes_params[idx]);
+    }
+    for EachIndex(idx, lanes_count)
+    {
+      thread_join(lanes[idx], max_U64);
+    }
+    barrier_release(barrier);
+  }
+  
+  //- rjf: compressed -> chunk table goes after all memory
+  String8List chunks_note = {0};
+  U64 chunks_note_off = AlignPow2(shared.data_opl, 4);
+  if(compress)
+  {
+    String8List desc = {0};
+    str8_serial_begin(scratch.arena, &desc);
+    str8_serial_push_struct(scratch.arena, &desc, &chunks_count);
+    str8_serial_push_array(scratch.arena, &desc, chunks, chunks_count);
+    dmn_lnx_core_note_push(scratch.arena, &chunks_note, str8_lit(DMN_LNX_CORE_NOTE_OWNER), DMN_LNX_CoreNoteType_LZBChunks, str8_serial_end(scratch.arena, &desc));
+    data_opl = chunks_note_off + chunks_note.total_size;
+  }
+  
+  //- rjf: build headers
+  String8List headers = {0};
+  {
+    ELF_Hdr64 *ehdr = push_array(scratch.arena, ELF_Hdr64, 1);
+    MemoryCopy(ehdr->e_ident, elf_magic, sizeof(elf_magic));
+    ehdr->e_ident[ELF_Identifier_Class]   = ELF_Class_64;
+    ehdr->e_ident[ELF_Identifier_Data]    = ELF_Data_2LSB;
+    ehdr->e_ident[ELF_Identifier_Version] = ELF_Version_Current;
+    ehdr->e_type      = ELF_Type_Core;
+    ehdr->e_machine   = ELF_MachineKind_X86_64;
+    ehdr->e_version   = ELF_Version_Current;
+    ehdr->e_phoff     = phdrs_off;
+    ehdr->e_ehsize    = sizeof(ELF_Hdr64);
+    ehdr->e_phentsize = sizeof(ELF_Phdr64);
+    ehdr->e_phnum     = (U16)(is_xnum ? 0xffff : phdrs_count);
+    str8_list_push(scratch.arena, &headers, str8_struct(ehdr));
+    ELF_Phdr64 *phdrs = push_array(scratch.arena, ELF_Phdr64, phdrs_count);
+    U64 phdr_idx = 0;
+    phdrs[phdr_idx].p_type   = ELF_PType_Note;
+    phdrs[phdr_idx].p_offset = notes_off;
+    phdrs[phdr_idx].p_filesz = notes.total_size;
+    phdrs[phdr_idx].p_align  = 4;
+    phdr_idx += 1;
+    if(compress)
+    {
+      phdrs[phdr_idx].p_type   = ELF_PType_Note;
+      phdrs[phdr_idx].p_offset = chunks_note_off;
+      phdrs[phdr_idx].p_filesz = chunks_note.total_size;
+      phdrs[phdr_idx].p_align  = 4;
+      phdr_idx += 1;
+    }
+    for EachIndex(idx, regions.count)
+    {
+      // rjf: compressed cores keep the layout, but with no data in PT_LOADs -
+      // other tools still see all threads & mappings, just no memory contents
+      DMN_LNX_CoreSaveRegion *region = &regions.v[idx];
+      phdrs[phdr_idx].p_type   = ELF_PType_Load;
+      phdrs[phdr_idx].p_flags  = region->flags;
+      phdrs[phdr_idx].p_offset = region->data_off;
+      phdrs[phdr_idx].p_vaddr  = region->vrange.min;
+      phdrs[phdr_idx].p_filesz = (compress ? 0 : region->dump_size);
+      phdrs[phdr_idx].p_memsz  = dim_1u64(region->vrange);
+      phdrs[phdr_idx].p_align  = KB(4);
+      phdr_idx += 1;
+    }
+    str8_list_push(scratch.arena, &headers, str8((U8 *)phdrs, sizeof(ELF_Phdr64)*phdrs_count));
+    if(is_xnum)
+    {
+      // rjf: PN_XNUM -> true count is stored in section 0's sh_info
+      ELF_Shdr64 *shdr = push_array(scratch.arena, ELF_Shdr64, 1);
+      shdr->sh_info     = (U32)phdrs_count;
+      ehdr->e_shoff     = shdr_off;
+      ehdr->e_shentsize = sizeof(ELF_Shdr64);
+      ehdr->e_shnum     = 1;
+      str8_list_push(scratch.arena, &headers, str8_struct(shdr));
+    }
+  }
+  
+  //- rjf: write headers & notes
+  {
+    String8List parts[] = {headers, notes, chunks_note};
+    U64 parts_offs[] = {0, notes_off, chunks_note_off};
+    for EachElement(idx, parts)
+    {
+      U64 off = parts_offs[idx];
+      for EachNode(n, String8Node, parts[idx].first)
+      {
+        U64 write_size = os_file_write(file, r1u64(off, off + n->string.size), n->string.str);
+        shared.bytes_written += write_size;
+        shared.write_failed |= (write_size != n->string.size);
+        off += n->string.size;
+      }
+    }
+  }
+  
+  //- rjf: uncompressed -> trailing zero pages were never written; extend the file to its full size
+  if(!compress && data_opl > data_off && os_properties_from_file(file).size < data_opl)
+  {
+    U8 zero = 0;
+    shared.write_failed |= (os_file_write(file, r1u64(data_opl-1, data_opl), &zero) != 1);
+  }
+  os_file_close(file);
+  
+  //- rjf: report
+  if(shared.write_failed)
+  {
+    log_user_errorf("Could not write core dump to %S.", path);
+  }
+  else
+  {
+    result = 1;
+  }
+  log_infof("saved core dump of process %i to %S: %I64u regions, %I64u bytes of memory, %I64u bytes written, %I64u chunks%s, %I64u us\n",
+            pid, path, regions.count, memory_size, shared.bytes_written, chunks_count, compress ? " (compressed)" : "",
+            os_now_microseconds() - start_us);
+  
+  exit:;
+  scratch_end(scratch);
+  return result;
+}
+
 ////////////////////////////////
 //~ rjf: @dmn_os_hooks Halting (Implemented Per-OS)
 
@@ -2612,6 +3848,7 @@ dmn_halt(U64 code, U64 user_data)
   if(!dmn_lnx_state->has_halt_injection)
   {
     DMN_LNX_Entity *process = dmn_lnx_state->entities_base->first;
+    for(;process->is_core; process = process->next);
     if(process != &dmn_lnx_nil_entity)
     {
       union sigval sv = {0};
@@ -2687,7 +3924,15 @@ internal U64
 dmn_process_read(DMN_Handle process, Rng1U64 range, void *dst)
 {
   DMN_LNX_Entity *entity = dmn_lnx_entity_from_handle(process);
-  U64 result = dmn_lnx_read(entity->fd, range, dst);
+  U64 result = 0;
+  if(entity->is_core)
+  {
+    result = dmn_lnx_core_read(entity, range, dst);
+  }
+  else
+  {
+    result = dmn_lnx_read(entity->fd, range, dst);
+  }
   return result;
 }
 
@@ -2695,7 +3940,113 @@ internal B32
 dmn_process_write(DMN_Handle process, Rng1U64 range, void *src)
 {
   DMN_LNX_Entity *entity = dmn_lnx_entity_from_handle(process);
-  B32 result = dmn_lnx_write(entity->fd, range, src);
+  B32 result = 0;
+  if(!entity->is_core)
+  {
+    result = dmn_lnx_write(entity->fd, range, src);
+  }
+  return result;
+}
+
+internal void
+dmn_process_read_batch(DMN_Handle process, U64 count, Rng1U64 *ranges, void **dsts, U64 *read_sizes_out)
+{
+  DMN_LNX_Entity *entity = dmn_lnx_entity_from_handle(process);
+  if(entity->is_core)
+  {
+    for EachIndex(idx, count)
+    {
+      read_sizes_out[idx] = dmn_lnx_core_read(entity, ranges[idx], dsts[idx]);
+    }
+  }
+  else
+  {
+    dmn_lnx_read_batch((pid_t)entity->id, entity->fd, count, ranges, dsts, read_sizes_out);
+  }
+}
+
+internal DMN_MemoryRegionArray
+dmn_process_memory_regions(Arena *arena, DMN_Handle process)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  DMN_LNX_Entity *entity = dmn_lnx_entity_from_handle(process);
+  DMN_MemoryRegionArray result = {0};
+  
+  //- rjf: core -> every range we have bytes for is readable
+  if(entity->is_core)
+  {
+    DMN_LNX_CoreRegionArray *arrays[] = {&entity->core_regions, &entity->core_file_regions, &entity->core_chunk_regions};
+    U64 count = 0;
+    for EachElement(idx, arrays)
+    {
+      count += arrays[idx]->count;
+    }
+    DMN_LNX_CoreRegion *regions = push_array(scratch.arena, DMN_LNX_CoreRegion, count);
+    U64 regions_count = 0;
+    for EachElement(idx, arrays)
+    {
+      MemoryCopy(regions + regions_count, arrays[idx]->v, sizeof(regions[0])*arrays[idx]->count);
+      regions_count += arrays[idx]->count;
+    }
+    quick_sort(regions, regions_count, sizeof(regions[0]), dmn_lnx_core_region_is_before);
+    result.v = push_array(arena, DMN_MemoryRegion, regions_count);
+    for EachIndex(idx, regions_count)
+    {
+      Rng1U64 vrange = regions[idx].vrange;
+      if(result.count != 0 && vrange.min <= result.v[result.count-1].vaddr_range.max)
+      {
+        result.v[result.count-1].vaddr_range.max = Max(result.v[result.count-1].vaddr_range.max, vrange.max);
+      }
+      else
+      {
+        result.v[result.count].vaddr_range = vrange;
+        result.v[result.count].flags = OS_AccessFlag_Read;
+        result.count += 1;
+      }
+    }
+  }
+  
+  //- rjf: live process -> /proc/pid/maps
+  else
+  {
+    String8 maps = dmn_lnx_data_from_proc_path(scratch.arena, str8f(scratch.arena, "/proc/%d/maps", (pid_t)entity->id));
+    String8List lines = str8_split(scratch.arena, maps, (U8 *)"\n", 1, 0);
+    result.v = push_array(arena, DMN_MemoryRegion, lines.node_count);
+    for EachNode(n, String8Node, lines.first)
+    {
+      // rjf: range perms offset dev inode [name]
+      String8List parts = str8_split(scratch.arena, n->string, (U8 *)" ", 1, 0);
+      if(parts.node_count < 5) { continue; }
+      String8 range = parts.first->string;
+      String8 perms = parts.first->next->string;
+      String8 name = (parts.node_count > 5 ? parts.last->string : str8_zero());
+      
+      // rjf: the kernel refuses foreign reads of these, so don't report them
+      if(str8_match(name, str8_lit("[vvar]"), 0) ||
+         str8_match(name, str8_lit("[vvar_vclock]"), 0) ||
+         str8_match(name, str8_lit("[vsyscall]"), 0))
+      {
+        continue;
+      }
+      U64 range_dash_pos = str8_find_needle(range, 0, str8_lit("-"), 0);
+      DMN_MemoryRegion *region = &result.v[result.count];
+      region->vaddr_range.min = u64_from_str8(str8_prefix(range, range_dash_pos), 16);
+      region->vaddr_range.max = u64_from_str8(str8_skip(range, range_dash_pos+1), 16);
+      for EachIndex(idx, perms.size)
+      {
+        switch(perms.str[idx])
+        {
+          default:{}break;
+          case 'r':{region->flags |= OS_AccessFlag_Read;}break;
+          case 'w':{region->flags |= OS_AccessFlag_Write;}break;
+          case 'x':{region->flags |= OS_AccessFlag_Execute;}break;
+        }
+      }
+      result.count += 1;
+    }
+  }
+  
+  scratch_end(scratch);
   return result;
 }
 
@@ -2753,11 +4104,11 @@ dmn_thread_write_reg_block(DMN_Handle handle, void *reg_block)
     {
       MemoryZero(reg_block, reg_block_size);
     }
-    else
+    else if(!thread->parent->is_core)
     {
       MemoryCopy(thread->reg_block, reg_block, reg_block_size);
     }
-    result = 1;
+    result = !thread->parent->is_core;
   }
   return result;
 }
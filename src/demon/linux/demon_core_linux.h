@@ -29,39 +29,42 @@ enum
 //
 // These are defined in <sys/user.h>, but only for one architecture at a time
 
+typedef struct DMN_LNX_RegsX64 DMN_LNX_RegsX64;
+struct DMN_LNX_RegsX64
+{
+  U64 r15;
+  U64 r14;
+  U64 r13;
+  U64 r12;
+  U64 rbp;
+  U64 rbx;
+  U64 r11;
+  U64 r10;
+  U64 r9;
+  U64 r8;
+  U64 rax;
+  U64 rcx;
+  U64 rdx;
+  U64 rsi;
+  U64 rdi;
+  U64 orig_rax;
+  U64 rip;
+  U64 cs;
+  U64 rflags;
+  U64 rsp;
+  U64 ss;
+  U64 fsbase;
+  U64 gsbase;
+  U64 ds;
+  U64 es;
+  U64 fs;
+  U64 gs;
+};
+
 typedef struct DMN_LNX_UserX64 DMN_LNX_UserX64;
 struct DMN_LNX_UserX64
 {
-  struct
-  {
-    U64 r15;
-    U64 r14;
-    U64 r13;
-    U64 r12;
-    U64 rbp;
-    U64 rbx;
-    U64 r11;
-    U64 r10;
-    U64 r9;
-    U64 r8;
-    U64 rax;
-    U64 rcx;
-    U64 rdx;
-    U64 rsi;
-    U64 rdi;
-    U64 orig_rax;
-    U64 rip;
-    U64 cs;
-    U64 rflags;
-    U64 rsp;
-    U64 ss;
-    U64 fsbase;
-    U64 gsbase;
-    U64 ds;
-    U64 es;
-    U64 fs;
-    U64 gs;
-  } regs;
+  DMN_LNX_RegsX64 regs;
   S32 u_fpvalid, _pad0;
   X64_FXSave i387;
   U64 u_tsize, u_dsize, u_ssize, start_code, start_stack;
@@ -74,6 +77,52 @@ struct DMN_LNX_UserX64
 };
 StaticAssert(sizeof(DMN_LNX_UserX64) == 912, g_dmn_lnx_user_x64_size_check);
 
+// rjf: desc of x64 NT_PRSTATUS notes in core files (`struct elf_prstatus`)
+typedef struct DMN_LNX_PrStatusX64 DMN_LNX_PrStatusX64;
+struct DMN_LNX_PrStatusX64
+{
+  S32 si_signo;
+  S32 si_code;
+  S32 si_errno;
+  S16 cursig;
+  S16 _pad0;
+  U64 sigpend;
+  U64 sighold;
+  S32 pid;
+  S32 ppid;
+  S32 pgrp;
+  S32 sid;
+  U64 utime[2];
+  U64 stime[2];
+  U64 cutime[2];
+  U64 cstime[2];
+  DMN_LNX_RegsX64 regs;
+  S32 fpvalid;
+  S32 _pad1;
+};
+StaticAssert(sizeof(DMN_LNX_PrStatusX64) == 336, g_dmn_lnx_prstatus_x64_size_check);
+
+// rjf: desc of x64 NT_PRPSINFO notes in core files (`struct elf_prpsinfo`)
+typedef struct DMN_LNX_PrPsInfoX64 DMN_LNX_PrPsInfoX64;
+struct DMN_LNX_PrPsInfoX64
+{
+  U8  state;
+  U8  sname;
+  U8  zomb;
+  U8  nice;
+  U32 _pad0;
+  U64 flag;
+  U32 uid;
+  U32 gid;
+  S32 pid;
+  S32 ppid;
+  S32 pgrp;
+  S32 sid;
+  U8  fname[16];
+  U8  psargs[80];
+};
+StaticAssert(sizeof(DMN_LNX_PrPsInfoX64) == 136, g_dmn_lnx_prpsinfo_x64_size_check);
+
 ////////////////////////////////
 //~ SDT Probes
 
@@ -157,6 +206,98 @@ struct DMN_LNX_DynamicInfo
   U64 symtab_entry_size;
 };
 
+////////////////////////////////
+//~ rjf: Core File Types
+
+// rjf: a range of a core process' address space, backed by a mapped view of
+// either the core file itself (PT_LOAD), or an on-disk module (NT_FILE), for
+// file-backed pages the kernel did not write into the core. for compressed
+// cores, each region is one LZB chunk, decompressed into `data` on first read.
+typedef struct DMN_LNX_CoreRegion DMN_LNX_CoreRegion;
+struct DMN_LNX_CoreRegion
+{
+  Rng1U64 vrange;
+  String8 data;
+  String8 compressed_data;
+};
+
+typedef struct DMN_LNX_CoreRegionArray DMN_LNX_CoreRegionArray;
+struct DMN_LNX_CoreRegionArray
+{
+  DMN_LNX_CoreRegion *v;
+  U64 count;
+};
+
+typedef struct DMN_LNX_CoreFile DMN_LNX_CoreFile;
+struct DMN_LNX_CoreFile
+{
+  DMN_LNX_CoreFile *next;
+  OS_Handle file;
+  OS_Handle map;
+  String8 data;
+};
+
+// rjf: compressed cores (DMN_CoreFlag_Compress) keep standard notes & PT_LOADs,
+// but with p_filesz = 0 - memory is instead stored as independently-compressed
+// chunks, described by one extra note: U64 chunk count, then the chunk array.
+#define DMN_LNX_CORE_NOTE_OWNER "RADDBG"
+#define DMN_LNX_CORE_CHUNK_SIZE KB(256)
+enum
+{
+  DMN_LNX_CoreNoteType_LZBChunks = 0x4c5a4243,
+};
+
+typedef struct DMN_LNX_CoreChunk DMN_LNX_CoreChunk;
+struct DMN_LNX_CoreChunk
+{
+  U64 vaddr;
+  U64 size;
+  U64 off;
+  U64 compressed_size; // rjf: 0 -> chunk is all zeroes; == size -> stored raw
+};
+
+////////////////////////////////
+//~ rjf: Core File Writing Types
+
+typedef struct DMN_LNX_CoreSaveRegion DMN_LNX_CoreSaveRegion;
+struct DMN_LNX_CoreSaveRegion
+{
+  Rng1U64 vrange;
+  ELF_PFlag flags;
+  U64 file_off;
+  String8 file_path;
+  U64 dump_size;
+  U64 data_off;
+};
+
+typedef struct DMN_LNX_CoreSaveRegionArray DMN_LNX_CoreSaveRegionArray;
+struct DMN_LNX_CoreSaveRegionArray
+{
+  DMN_LNX_CoreSaveRegion *v;
+  U64 count;
+};
+
+// rjf: state shared by all lanes which read, compress & write memory
+typedef struct DMN_LNX_CoreSaveShared DMN_LNX_CoreSaveShared;
+struct DMN_LNX_CoreSaveShared
+{
+  DMN_Handle process;
+  OS_Handle file;
+  B32 compress;
+  DMN_LNX_CoreChunk *chunks;
+  U64 chunks_count;
+  U64 data_opl;
+  U64 bytes_written;
+  B32 write_failed;
+};
+
+typedef struct DMN_LNX_CoreSaveLaneParams DMN_LNX_CoreSaveLaneParams;
+struct DMN_LNX_CoreSaveLaneParams
+{
+  LaneCtx lane_ctx;
+  DMN_LNX_CoreSaveShared *shared;
+};
+
 ////////////////////////////////
 //~ rjf: Entity Types
 
@@ -196,6 +337,14 @@ struct DMN_LNX_Entity
   DMN_LNX_Probe **probes;
   U64 probe_vaddrs[DMN_LNX_ProbeType_Count];
 
+  // process core
+  B32 is_core;
+  DMN_LNX_CoreFile *core_files;
+  DMN_LNX_CoreRegionArray core_regions;
+  DMN_LNX_CoreRegionArray core_file_regions;
+  DMN_LNX_CoreRegionArray core_chunk_regions;
+  Mutex core_chunks_mutex;
+  
   // process x64
   U64 xcr0;
   U64 xsave_size;
@@ -276,6 +425,8 @@ internal B32 dmn_lnx_write(int memory_fd, Rng1U64 range, void *src);
 #define dmn_lnx_write_struct(fd, vaddr, ptr) dmn_lnx_write((fd), r1u64((vaddr), (vaddr)+sizeof(*(ptr))), (ptr))
 internal String8 dmn_lnx_read_string_capped(Arena *arena, int memory_fd, U64 base_vaddr, U64 cap_size);
 internal String8 dmn_lnx_read_string(Arena *arena, int memory_fd, U64 base_vaddr);
+internal void dmn_lnx_read_batch(pid_t pid, int memory_fd, U64 count, Rng1U64 *ranges, void **dsts, U64 *read_sizes_out);
+internal String8 dmn_lnx_data_from_proc_path(Arena *arena, String8 path);
 
 ////////////////////////////////
 //~ Runtime Struct Helpers
@@ -292,6 +443,7 @@ internal B32 dmn_lnx_read_r_debug(int memory_fd, U64 addr, Arch arch, GNU_RDebug
 internal String8             dmn_lnx_exe_path_from_pid(Arena *arena, pid_t pid);
 internal ELF_Hdr64           dmn_lnx_ehdr_from_pid(pid_t pid);
 internal DMN_LNX_ProcessAuxv dmn_lnx_auxv_from_pid(pid_t pid, ELF_Class elf_class);
+internal DMN_LNX_ProcessAuxv dmn_lnx_auxv_from_data(String8 data, ELF_Class elf_class);
 
 //- ELF/GNU info from memory
 internal DMN_LNX_PhdrInfo       dmn_lnx_phdr_info_from_memory(int memory_fd, ELF_Class elf_class, U64 rebase, U64 e_phaddr, U64 e_phentsize, U64 e_phnum);
@@ -313,6 +465,22 @@ internal B32 dmn_lnx_thread_write_ip(DMN_LNX_Entity *thread, U64 ip);
 internal B32 dmn_lnx_thread_write_sp(DMN_LNX_Entity *thread, U64 sp);
 internal B32 dmn_lnx_thread_read_reg_block(DMN_LNX_Entity *thread, void *reg_block);
 internal B32 dmn_lnx_thread_write_reg_block(DMN_LNX_Entity *thread, void *reg_block);
+internal void dmn_lnx_reg_block_x64_from_regs(REGS_RegBlockX64 *dst, DMN_LNX_RegsX64 *src);
+internal void dmn_lnx_reg_block_x64_from_fxsave(REGS_RegBlockX64 *dst, X64_FXSave *src);
+
+////////////////////////////////
+//~ rjf: Core Files
+
+internal DMN_LNX_CoreRegion *dmn_lnx_core_region_from_vaddr(DMN_LNX_CoreRegionArray *regions, U64 vaddr);
+internal U64 dmn_lnx_core_read(DMN_LNX_Entity *process, Rng1U64 range, void *dst);
+#define dmn_lnx_core_read_struct(process, vaddr, ptr) dmn_lnx_core_read((process), r1u64((vaddr), (vaddr)+sizeof(*(ptr))), (ptr))
+internal B32 dmn_lnx_core_open(String8 path, U32 *pid_out);
+internal void dmn_lnx_core_close(DMN_LNX_Entity *process);
+
+//- rjf: writing
+internal DMN_LNX_CoreSaveRegionArray dmn_lnx_core_save_regions_from_pid(Arena *arena, pid_t pid);
+internal void dmn_lnx_core_note_push(Arena *arena, String8List *list, String8 owner, U32 type, String8 desc);
+internal void dmn_lnx_core_save_lane_entry_point(void *p);
 
 ////////////////////////////////
 
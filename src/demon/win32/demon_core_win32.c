@@ -2953,6 +2953,14 @@ dmn_ctrl_run(Arena *arena, DMN_CtrlCtx *ctx, DMN_RunCtrls *ctrls)
   return events;
 }
 
+internal B32
+dmn_ctrl_save_core(DMN_CtrlCtx *ctx, DMN_Handle process, String8 path, DMN_CoreFlags flags)
+{
+  // TODO(rjf): minidump writing
+  log_user_errorf("Saving core dumps is not yet supported on Windows.");
+  return 0;
+}
+
 ////////////////////////////////
 //~ rjf: @dmn_os_hooks Halting (Implemented Per-OS)
 
@@ -3106,6 +3114,74 @@ dmn_process_write(DMN_Handle process, Rng1U64 range, void *src)
   return result;
 }
 
+internal void
+dmn_process_read_batch(DMN_Handle process, U64 count, Rng1U64 *ranges, void **dsts, U64 *read_sizes_out)
+{
+  DMN_AccessScope
+  {
+    DMN_W32_Entity *entity = dmn_w32_entity_from_handle(process);
+    for EachIndex(idx, count)
+    {
+      read_sizes_out[idx] = dmn_w32_process_read(entity->handle, ranges[idx], dsts[idx]);
+    }
+  }
+}
+
+internal DMN_MemoryRegionArray
+dmn_process_memory_regions(Arena *arena, DMN_Handle process)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  typedef struct RegionNode RegionNode;
+  struct RegionNode
+  {
+    RegionNode *next;
+    DMN_MemoryRegion v;
+  };
+  RegionNode *first = 0;
+  RegionNode *last = 0;
+  U64 count = 0;
+  DMN_AccessScope
+  {
+    DMN_W32_Entity *entity = dmn_w32_entity_from_handle(process);
+    MEMORY_BASIC_INFORMATION mbi = {0};
+    for(U64 vaddr = 0; VirtualQueryEx(entity->handle, (void *)vaddr, &mbi, sizeof(mbi)) == sizeof(mbi);)
+    {
+      U64 next_vaddr = (U64)mbi.BaseAddress + mbi.RegionSize;
+      if(next_vaddr <= vaddr)
+      {
+        break;
+      }
+      DWORD protect = mbi.Protect & 0xff;
+      if(mbi.State == MEM_COMMIT && !(mbi.Protect & PAGE_GUARD) && protect != PAGE_NOACCESS)
+      {
+        RegionNode *n = push_array(scratch.arena, RegionNode, 1);
+        n->v.vaddr_range = r1u64((U64)mbi.BaseAddress, next_vaddr);
+        n->v.flags |= OS_AccessFlag_Read;
+        if(protect == PAGE_READWRITE || protect == PAGE_WRITECOPY || protect == PAGE_EXECUTE_READWRITE || protect == PAGE_EXECUTE_WRITECOPY)
+        {
+          n->v.flags |= OS_AccessFlag_Write;
+        }
+        if(protect == PAGE_EXECUTE || protect == PAGE_EXECUTE_READ || protect == PAGE_EXECUTE_READWRITE || protect == PAGE_EXECUTE_WRITECOPY)
+        {
+          n->v.flags |= OS_AccessFlag_Execute;
+        }
+        SLLQueuePush(first, last, n);
+        count += 1;
+      }
+      vaddr = next_vaddr;
+    }
+  }
+  DMN_MemoryRegionArray result = {0};
+  result.v = push_array(arena, DMN_MemoryRegion, count);
+  for EachNode(n, RegionNode, first)
+  {
+    result.v[result.count] = n->v;
+    result.count += 1;
+  }
+  scratch_end(scratch);
+  return result;
+}
+
 //- rjf: threads
 
 internal Arch
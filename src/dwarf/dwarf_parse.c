@@ -1131,8 +1131,10 @@ dw_interp_ref(DW_Input *input, DW_CompUnit *cu, DW_FormKind form_kind, DW_Form f
   if (form_kind == DW_Form_Ref1 || form_kind == DW_Form_Ref2 ||
       form_kind == DW_Form_Ref4 || form_kind == DW_Form_Ref8 ||
       form_kind == DW_Form_RefUData) {
+    // NOTE(rjf): unit-relative forms - rebase onto .debug_info, which is how
+    // tags are keyed
     ref.cu = cu;
-    ref.info_off = form.ref;
+    ref.info_off = cu->info_range.min + form.ref;
   } else if (form_kind == DW_Form_RefAddr) {
     NotImplemented;
   } else if (form_kind == DW_Form_RefSig8) {
@@ -2214,7 +2216,7 @@ dw_tag_tree_from_cu(Arena *arena, DW_Input *input, DW_CompUnit *cu)
   String8    abbrev_data = input->sec[DW_Section_Abbrev].data;
   String8    info_data   = str8_substr(input->sec[DW_Section_Info].data, cu->info_range);
   DW_TagNode root        = {0};
-  U64        cursor      = cu->first_tag_info_off;
+  U64        cursor      = cu->first_tag_info_off - cu->info_range.min;
   U64        tag_count   = 0;
   dw_tag_tree_from_data(arena, info_data, abbrev_data, cu, &root, &cursor, &tag_count);
   
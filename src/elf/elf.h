@@ -530,6 +530,15 @@ typedef U32 ELF_NoteType;
 enum
 {
   ELF_NoteType_STapSdt = 3, // System Tap probes
+  
+  // rjf: "CORE" / "LINUX" owned notes, found in ET_CORE files
+  ELF_NoteType_PrStatus  = 1,          // per-thread status & general purpose registers
+  ELF_NoteType_PrFpReg   = 2,          // per-thread floating point registers (fxsave on x64)
+  ELF_NoteType_PrPsInfo  = 3,          // process info (name, args, state)
+  ELF_NoteType_Auxv      = 6,          // copy of the process' auxiliary vector
+  ELF_NoteType_X86XState = 0x202,      // per-thread xsave area
+  ELF_NoteType_SigInfo   = 0x53494749, // siginfo of the signal which produced the dump
+  ELF_NoteType_File      = 0x46494c45, // file-backed mappings
 };
 
 #define ELF_HdrIs64Bit(e_ident) (e_ident[ELF_Identifier_Class] == ELF_Class_64)
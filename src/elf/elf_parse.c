@@ -189,6 +189,7 @@ elf_parse_note(Arena *arena, String8 raw_note, ELF_Class elf_class, ELF_MachineK
     if (cursor + owner_size > raw_note.size) { goto exit; }
     String8 owner = str8_cstring_capped(raw_note.str + cursor, raw_note.str + cursor + owner_size);
     cursor += owner_size;
+    cursor = AlignPow2(cursor, 4);
 
     if (cursor + desc_size > raw_note.size) { goto exit; }
     String8 desc = str8_substr(raw_note, r1u64(cursor, cursor + desc_size));
@@ -772,6 +772,42 @@ e_dbg_info_from_type_key(E_TypeKey type_key)
   return result;
 }
 
+internal B32
+e_dbg_info_may_contain_name_prefix(E_DbgInfo *dbg_info, String8 prefix)
+{
+  // NOTE(rjf): this is conservative - if the debug info has no sorted name
+  // index (e.g. older RDIs), we cannot rule anything out, so we say "maybe".
+  B32 result = 0;
+  RDI_NameMapKind name_map_kinds[] =
+  {
+    RDI_NameMapKind_GlobalVariables,
+    RDI_NameMapKind_ThreadVariables,
+    RDI_NameMapKind_Constants,
+    RDI_NameMapKind_Procedures,
+    RDI_NameMapKind_Types,
+  };
+  RDI_Parsed *rdi = dbg_info->rdi;
+  for EachElement(kind_idx, name_map_kinds)
+  {
+    RDI_NameMap *map = rdi_element_from_name_idx(rdi, NameMaps, name_map_kinds[kind_idx]);
+    RDI_ParsedNameMap parsed_map = {0};
+    rdi_parsed_from_name_map(rdi, map, &parsed_map);
+    if(parsed_map.node_count != 0 && parsed_map.sorted_nodes == 0)
+    {
+      result = 1;
+      break;
+    }
+    U64 prefix_nodes_count = 0;
+    rdi_name_map_sorted_nodes_from_prefix(rdi, &parsed_map, prefix.str, prefix.size, &prefix_nodes_count);
+    if(prefix_nodes_count != 0)
+    {
+      result = 1;
+      break;
+    }
+  }
+  return result;
+}
+
 ////////////////////////////////
 //~ rjf: Cache Accessing Functions
 
@@ -1224,6 +1224,7 @@ internal void e_select_ir_ctx(E_IRCtx *ctx);
 
 internal E_DbgInfo *e_dbg_info_from_module(E_Module *module);
 internal E_DbgInfo *e_dbg_info_from_type_key(E_TypeKey type_key);
+internal B32 e_dbg_info_may_contain_name_prefix(E_DbgInfo *dbg_info, String8 prefix);
 
 ////////////////////////////////
 //~ rjf: Base Cache Accessing Functions
@@ -1915,7 +1915,10 @@ e_push_irtree_and_type_from_expr(Arena *arena, E_IRTreeAndType *root_parent, E_I
                       }
                       String8 new_namespace_prefix_possibility = str8_prefix(containing_procedure_name, past_next_scope_resolution_pos);
                       String8 namespaceified_string = push_str8f(scratch.arena, "%S%S", new_namespace_prefix_possibility, string);
-                      str8_list_push_front(scratch.arena, &namespaceified_strings, namespaceified_string);
+                      if(e_dbg_info_may_contain_name_prefix(e_base_ctx->primary_dbg_info, namespaceified_string))
+                      {
+                        str8_list_push_front(scratch.arena, &namespaceified_strings, namespaceified_string);
+                      }
                       last_past_scope_resolution_pos = past_next_scope_resolution_pos;
                     }
                   }
@@ -16,7 +16,7 @@ fs_init(void)
   fs_shared->change_gen = 1;
   fs_shared->slots_count = 1024;
   fs_shared->slots = push_array(arena, FS_Slot, fs_shared->slots_count);
-  fs_shared->stripes = stripe_array_alloc(arena);
+  fs_shared->stripes = stripe_array_alloc(arena, str8_lit("file_stream"));
 }
 
 ////////////////////////////////
@@ -184,21 +184,37 @@ fs_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out
       }
       if(node == 0)
       {
+        String8 path_buffer = {0};
         node = stripe->free;
         if(node)
         {
           stripe->free = node->next;
+          path_buffer = str8(node->path.str, node->path_cap);
         }
         else
         {
           node = push_array_no_zero(stripe->arena, FS_Node, 1);
         }
         MemoryZeroStruct(node);
-        node->path = str8_copy(stripe->arena, path);
-        SLLQueuePush(slot->first, slot->last, node);
+        if(path_buffer.size < path.size)
+        {
+          path_buffer = str8(push_array_no_zero(stripe->arena, U8, path.size), path.size);
+        }
+        MemoryCopy(path_buffer.str, path.str, path.size);
+        node->path = str8(path_buffer.str, path.size);
+        node->path_cap = path_buffer.size;
+        node->access_pt.last_time_touched_us = os_now_microseconds();
+        node->access_pt.last_update_idx_touched = update_tick_idx();
+        
+        // rjf: nodes may be evicted & recreated while artifacts computed from
+        // them are still cached - so new nodes take a fresh generation, rather
+        // than restarting at zero, to never match any such artifact
+        node->gen = ins_atomic_u64_inc_eval(&fs_shared->node_gen);
+        DLLPushBack(slot->first, slot->last, node);
       }
       node->last_modified_timestamp = pre_props.modified;
       node->size = pre_props.size;
+      gen_out[0] = node->gen;
     }
   }
   lane_sync();
@@ -248,6 +264,7 @@ fs_key_from_path_range(String8 path, Rng1U64 range, U64 endt_us)
           if(str8_match(path, n->path, 0))
           {
             gen = n->gen;
+            access_touch(access, &n->access_pt, stripe->cv);
             break;
           }
         }
@@ -289,7 +306,8 @@ fs_async_tick(void)
 {
   ProfBeginFunction();
   
-  //- rjf: detect changed timestamps for active paths
+  //- rjf: detect changed timestamps for active paths; evict paths which
+  // have not been accessed in a while, so they are not polled forever
   {
     Rng1U64 range = lane_range(fs_shared->slots_count);
     for EachInRange(slot_idx, range)
@@ -301,15 +319,27 @@ fs_async_tick(void)
         B32 found_work = 0;
         RWMutexScope(stripe->rw_mutex, write_mode)
         {
-          for(FS_Node *n = slot->first; n != 0; n = n->next)
+          for(FS_Node *n = slot->first, *next = 0; n != 0; n = next)
           {
+            next = n->next;
+            if(access_pt_is_expired(&n->access_pt, .time = 10000000))
+            {
+              found_work = 1;
+              if(write_mode)
+              {
+                DLLRemove(slot->first, slot->last, n);
+                n->next = (FS_Node *)stripe->free;
+                stripe->free = n;
+              }
+              continue;
+            }
             FileProperties props = os_properties_from_file_path(n->path);
             if(props.modified != n->last_modified_timestamp)
             {
               found_work = 1;
               if(write_mode)
               {
-                n->gen += 1;
+                n->gen = ins_atomic_u64_inc_eval(&fs_shared->node_gen);
                 ins_atomic_u64_inc_eval(&fs_shared->change_gen);
               }
             }
@@ -11,7 +11,10 @@ typedef struct FS_Node FS_Node;
 struct FS_Node
 {
   FS_Node *next;
+  FS_Node *prev;
+  AccessPt access_pt;
   String8 path;
+  U64 path_cap;
   U64 gen;
   U64 last_modified_timestamp;
   U64 size;
@@ -32,6 +35,7 @@ struct FS_Shared
 {
   Arena *arena;
   U64 change_gen;
+  U64 node_gen;
   U64 slots_count;
   FS_Slot *slots;
   StripeArray stripes;
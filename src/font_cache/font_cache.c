@@ -61,6 +61,22 @@ fnt_tag_match(FNT_Tag a, FNT_Tag b)
   return a.u64[0] == b.u64[0] && a.u64[1] == b.u64[1];
 }
 
+internal FNT_FontHashNode *
+fnt_font_node_from_tag(FNT_Tag tag)
+{
+  U64 slot_idx = tag.u64[1] % fnt_state->font_hash_table_size;
+  FNT_FontHashNode *result = 0;
+  for(FNT_FontHashNode *n = fnt_state->font_hash_table[slot_idx].first; n != 0 ; n = n->hash_next)
+  {
+    if(MemoryMatchStruct(&tag, &n->tag))
+    {
+      result = n;
+      break;
+    }
+  }
+  return result;
+}
+
 internal FP_Handle
 fnt_handle_from_tag(FNT_Tag tag)
 {
@@ -80,7 +96,7 @@ fnt_handle_from_tag(FNT_Tag tag)
   FP_Handle result = {0};
   if(existing_node != 0)
   {
-    result = existing_node->handle;
+    result = fnt_handle_from_font_node(existing_node);
   }
   ProfEnd();
   return result;
@@ -143,18 +159,20 @@ fnt_tag_from_path(String8 path)
   //- rjf: allocate & push new node if we don't have an existing one
   if(existing_node == 0)
   {
-    FP_Handle handle = fp_font_open(path);
+    FP_Handle handle = fnt_fp_open(path, 0);
     FNT_FontHashSlot *slot = &fnt_state->font_hash_table[slot_idx];
     existing_node = push_array(fnt_state->permanent_arena, FNT_FontHashNode, 1);
     existing_node->tag = result;
     existing_node->handle = handle;
     existing_node->metrics = fp_metrics_from_font(existing_node->handle);
     existing_node->path = push_str8_copy(fnt_state->permanent_arena, path);
+    existing_node->is_valid = !fp_handle_match(handle, fp_handle_zero());
+    existing_node->last_used_us = os_now_microseconds();
     SLLQueuePush_N(slot->first, slot->last, existing_node, hash_next);
   }
   
   //- rjf: tag result must be zero if this is not a valid font
-  if(fp_handle_match(existing_node->handle, fp_handle_zero()))
+  if(!existing_node->is_valid)
   {
     MemoryZeroStruct(&result);
   }
@@ -200,9 +218,12 @@ fnt_tag_from_static_data_string(String8 *data_ptr)
     FNT_FontHashSlot *slot = &fnt_state->font_hash_table[slot_idx];
     new_node = push_array(fnt_state->permanent_arena, FNT_FontHashNode, 1);
     new_node->tag = result;
-    new_node->handle = fp_font_open_from_static_data_string(data_ptr);
+    new_node->handle = fnt_fp_open(str8_zero(), data_ptr);
     new_node->metrics = fp_metrics_from_font(new_node->handle);
     new_node->path = str8_lit("");
+    new_node->static_data_ptr = data_ptr;
+    new_node->is_valid = !fp_handle_match(new_node->handle, fp_handle_zero());
+    new_node->last_used_us = os_now_microseconds();
     SLLQueuePush_N(slot->first, slot->last, new_node, hash_next);
   }
   
@@ -352,8 +373,12 @@ fnt_atlas_region_alloc(Arena *arena, FNT_Atlas *atlas, Vec2S16 needed_size)
   
   //- rjf: fill rectangular region & return
   Rng2S16 result = {0};
-  result.p0 = region_p0;
-  result.p1 = add_2s16(region_p0, region_sz);
+  if(node != 0 && node_corner != Corner_Invalid)
+  {
+    result.p0 = region_p0;
+    result.p1 = add_2s16(region_p0, region_sz);
+    atlas->allocated_area += (U64)region_sz.x*(U64)region_sz.y;
+  }
   return result;
 }
 
@@ -427,6 +452,7 @@ fnt_atlas_region_release(FNT_Atlas *atlas, Rng2S16 region)
   //- rjf: free node
   if(node != 0 && node_corner != Corner_Invalid)
   {
+    atlas->allocated_area -= (U64)calc_region_size.x*(U64)calc_region_size.y;
     node->flags &= ~FNT_AtlasRegionNodeFlag_Taken;
     if(node->parent != 0)
     {
@@ -460,6 +486,844 @@ fnt_atlas_region_release(FNT_Atlas *atlas, Rng2S16 region)
   }
 }
 
+internal FNT_Atlas *
+fnt_atlas_alloc(void)
+{
+  FNT_Atlas *atlas = fnt_state->free_atlas;
+  if(atlas != 0)
+  {
+    SLLStackPop(fnt_state->free_atlas);
+  }
+  else
+  {
+    atlas = push_array_no_zero(fnt_state->raster_arena, FNT_Atlas, 1);
+  }
+  MemoryZeroStruct(atlas);
+  DLLPushBack(fnt_state->first_atlas, fnt_state->last_atlas, atlas);
+  fnt_state->atlas_count += 1;
+  atlas->arena = arena_alloc();
+  atlas->root_dim = v2s16(FNT_ATLAS_DIM, FNT_ATLAS_DIM);
+  atlas->root = push_array(atlas->arena, FNT_AtlasRegionNode, 1);
+  atlas->root->max_free_size[Corner_00] =
+    atlas->root->max_free_size[Corner_01] =
+    atlas->root->max_free_size[Corner_10] =
+    atlas->root->max_free_size[Corner_11] = v2s16(atlas->root_dim.x/2, atlas->root_dim.y/2);
+  atlas->texture = r_tex2d_alloc(R_ResourceKind_Dynamic, v2s32((S32)atlas->root_dim.x, (S32)atlas->root_dim.y), R_Tex2DFormat_RGBA8, 0);
+  return atlas;
+}
+
+internal void
+fnt_atlas_release(FNT_Atlas *atlas)
+{
+  DLLRemove(fnt_state->first_atlas, fnt_state->last_atlas, atlas);
+  fnt_state->atlas_count -= 1;
+  r_tex2d_release(atlas->texture);
+  arena_release(atlas->arena);
+  SLLStackPush(fnt_state->free_atlas, atlas);
+}
+
+////////////////////////////////
+//~ rjf: Budget & Eviction
+
+internal U64
+fnt_atlas_count_max(void)
+{
+  U64 atlas_size = (U64)FNT_ATLAS_DIM*(U64)FNT_ATLAS_DIM*4;
+  U64 result = Max(1, fnt_state->memory_budget/atlas_size);
+  return result;
+}
+
+internal FP_Handle
+fnt_handle_from_font_node(FNT_FontHashNode *node)
+{
+  if(node->is_closed)
+  {
+    node->handle = fnt_fp_open(node->path, node->static_data_ptr);
+    node->is_closed = 0;
+  }
+  node->last_used_us = os_now_microseconds();
+  return node->handle;
+}
+
+internal int
+fnt_glyph_ref_lru_compare(FNT_GlyphRef *a, FNT_GlyphRef *b)
+{
+  int result = 0;
+  if(a->info->last_used_frame_index < b->info->last_used_frame_index)
+  {
+    result = -1;
+  }
+  else if(a->info->last_used_frame_index > b->info->last_used_frame_index)
+  {
+    result = +1;
+  }
+  return result;
+}
+
+internal FNT_GlyphRefArray
+fnt_glyph_ref_array_from_lru(Arena *arena, FNT_Atlas *atlas_filter)
+{
+  //- rjf: count glyphs
+  U64 glyph_count = 0;
+  for(U64 slot_idx = 0; slot_idx < fnt_state->hash2style_slots_count; slot_idx += 1)
+  {
+    for(FNT_Hash2StyleRasterCacheNode *style = fnt_state->hash2style_slots[slot_idx].first; style != 0; style = style->hash_next)
+    {
+      glyph_count += style->glyph_count;
+    }
+  }
+  
+  //- rjf: gather all evictable glyphs - those which occupy atlas space, and
+  // which have not been used in this frame (any pieces produced this frame may
+  // still be drawn)
+  FNT_GlyphRefArray array = {0};
+  array.v = push_array_no_zero(arena, FNT_GlyphRef, glyph_count);
+  for(U64 slot_idx = 0; slot_idx < fnt_state->hash2style_slots_count; slot_idx += 1)
+  {
+    for(FNT_Hash2StyleRasterCacheNode *style = fnt_state->hash2style_slots[slot_idx].first; style != 0; style = style->hash_next)
+    {
+      for(U64 idx = 0; idx < 256; idx += 1)
+      {
+        FNT_RasterCacheInfo *info = &style->utf8_class1_direct_map[idx];
+        if(style->utf8_class1_direct_map_mask[idx/64] & (1ull<<(idx%64)) &&
+           info->atlas != 0 && (atlas_filter == 0 || info->atlas == atlas_filter) &&
+           info->last_used_frame_index < fnt_state->frame_index)
+        {
+          FNT_GlyphRef *ref = &array.v[array.count];
+          array.count += 1;
+          ref->style = style;
+          ref->node = 0;
+          ref->direct_map_idx = (U8)idx;
+          ref->info = info;
+        }
+      }
+      for(U64 info_slot_idx = 0; info_slot_idx < style->hash2info_slots_count; info_slot_idx += 1)
+      {
+        for(FNT_Hash2InfoRasterCacheNode *n = style->hash2info_slots[info_slot_idx].first; n != 0; n = n->hash_next)
+        {
+          FNT_RasterCacheInfo *info = &n->info;
+          if(info->atlas != 0 && (atlas_filter == 0 || info->atlas == atlas_filter) &&
+             info->last_used_frame_index < fnt_state->frame_index)
+          {
+            FNT_GlyphRef *ref = &array.v[array.count];
+            array.count += 1;
+            ref->style = style;
+            ref->node = n;
+            ref->direct_map_idx = 0;
+            ref->info = info;
+          }
+        }
+      }
+    }
+  }
+  
+  //- rjf: sort, least-recently-used first
+  quick_sort(array.v, array.count, sizeof(array.v[0]), fnt_glyph_ref_lru_compare);
+  
+  return array;
+}
+
+internal void
+fnt_glyph_evict(FNT_GlyphRef *ref)
+{
+  FNT_Hash2StyleRasterCacheNode *style = ref->style;
+  FNT_RasterCacheInfo *info = ref->info;
+  
+  //- rjf: release atlas region
+  if(info->atlas != 0)
+  {
+    fnt_atlas_region_release(info->atlas, info->subrect);
+    info->atlas->glyph_count -= 1;
+    info->atlas = 0;
+  }
+  
+  //- rjf: remove from style's cache
+  if(ref->node != 0)
+  {
+    FNT_Hash2InfoRasterCacheSlot *slot = &style->hash2info_slots[ref->node->hash%style->hash2info_slots_count];
+    DLLRemove_NP(slot->first, slot->last, ref->node, hash_next, hash_prev);
+    SLLStackPush_N(style->free_hash2info_node, ref->node, hash_next);
+  }
+  else
+  {
+    style->utf8_class1_direct_map_mask[ref->direct_map_idx/64] &= ~(1ull<<(ref->direct_map_idx%64));
+  }
+  style->glyph_count -= 1;
+  fnt_state->evicted_glyph_count += 1;
+}
+
+internal U64
+fnt_evict_lru_glyphs(U64 needed_area, FNT_Atlas *atlas_filter)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  U64 freed_area = 0;
+  FNT_GlyphRefArray refs = fnt_glyph_ref_array_from_lru(scratch.arena, atlas_filter);
+  for(U64 idx = 0; idx < refs.count && freed_area < needed_area; idx += 1)
+  {
+    FNT_Atlas *atlas = refs.v[idx].info->atlas;
+    U64 allocated_area_pre = atlas->allocated_area;
+    fnt_glyph_evict(&refs.v[idx]);
+    freed_area += allocated_area_pre - atlas->allocated_area;
+  }
+  scratch_end(scratch);
+  ProfEnd();
+  return freed_area;
+}
+
+internal void
+fnt_style_release(FNT_Hash2StyleRasterCacheNode *node)
+{
+  //- rjf: release all of this style's atlas regions
+  for(U64 idx = 0; idx < 256; idx += 1)
+  {
+    FNT_RasterCacheInfo *info = &node->utf8_class1_direct_map[idx];
+    if(node->utf8_class1_direct_map_mask[idx/64] & (1ull<<(idx%64)) && info->atlas != 0)
+    {
+      fnt_atlas_region_release(info->atlas, info->subrect);
+      info->atlas->glyph_count -= 1;
+    }
+  }
+  for(U64 slot_idx = 0; slot_idx < node->hash2info_slots_count; slot_idx += 1)
+  {
+    for(FNT_Hash2InfoRasterCacheNode *n = node->hash2info_slots[slot_idx].first; n != 0; n = n->hash_next)
+    {
+      if(n->info.atlas != 0)
+      {
+        fnt_atlas_region_release(n->info.atlas, n->info.subrect);
+        n->info.atlas->glyph_count -= 1;
+      }
+    }
+  }
+  fnt_state->evicted_glyph_count += node->glyph_count;
+  
+  //- rjf: unhook & release
+  FNT_Hash2StyleRasterCacheSlot *slot = &fnt_state->hash2style_slots[node->style_hash%fnt_state->hash2style_slots_count];
+  DLLRemove_NP(slot->first, slot->last, node, hash_next, hash_prev);
+  arena_release(node->arena);
+  SLLStackPush_N(fnt_state->free_hash2style_node, node, hash_next);
+  fnt_state->style_count -= 1;
+}
+
+internal void
+fnt_compact(void)
+{
+  ProfBeginFunction();
+  U64 now_us = os_now_microseconds();
+  
+  //- rjf: release styles which haven't been used in a while (e.g. old zoom levels)
+  for(U64 slot_idx = 0; slot_idx < fnt_state->hash2style_slots_count; slot_idx += 1)
+  {
+    for(FNT_Hash2StyleRasterCacheNode *n = fnt_state->hash2style_slots[slot_idx].first, *next = 0; n != 0; n = next)
+    {
+      next = n->hash_next;
+      if(n->last_used_frame_index + FNT_STYLE_EVICT_FRAMES < fnt_state->frame_index)
+      {
+        fnt_style_release(n);
+      }
+    }
+  }
+  
+  //- rjf: release empty atlases
+  for(FNT_Atlas *a = fnt_state->first_atlas, *next = 0; a != 0; a = next)
+  {
+    next = a->next;
+    if(a->glyph_count == 0)
+    {
+      fnt_atlas_release(a);
+    }
+  }
+  
+  //- rjf: evacuate the sparsest atlas while we're over budget, or while its
+  // contents would comfortably fit into the free space of all other atlases.
+  // evacuated glyphs are re-rasterized on their next use, into denser atlases.
+  U64 atlas_area = (U64)FNT_ATLAS_DIM*(U64)FNT_ATLAS_DIM;
+  for(;;)
+  {
+    FNT_Atlas *sparsest = 0;
+    U64 total_allocated_area = 0;
+    for(FNT_Atlas *a = fnt_state->first_atlas; a != 0; a = a->next)
+    {
+      total_allocated_area += a->allocated_area;
+      if(sparsest == 0 || a->allocated_area < sparsest->allocated_area)
+      {
+        sparsest = a;
+      }
+    }
+    if(sparsest == 0)
+    {
+      break;
+    }
+    U64 other_free_area = (fnt_state->atlas_count-1)*atlas_area - (total_allocated_area - sparsest->allocated_area);
+    B32 over_budget = (fnt_state->atlas_count > fnt_atlas_count_max());
+    B32 is_sparse = (fnt_state->atlas_count > 1 && sparsest->allocated_area*2 <= other_free_area);
+    if(!over_budget && !is_sparse)
+    {
+      break;
+    }
+    fnt_evict_lru_glyphs(max_U64, sparsest);
+    if(sparsest->glyph_count != 0)
+    {
+      break;
+    }
+    fnt_atlas_release(sparsest);
+    fnt_state->evacuated_atlas_count += 1;
+  }
+  
+  //- rjf: close font handles which haven't been used in a while
+  for(U64 slot_idx = 0; slot_idx < fnt_state->font_hash_table_size; slot_idx += 1)
+  {
+    for(FNT_FontHashNode *n = fnt_state->font_hash_table[slot_idx].first; n != 0; n = n->hash_next)
+    {
+      if(n->is_valid && !n->is_closed && n->last_used_us + FNT_FONT_CLOSE_US < now_us)
+      {
+        fnt_fp_close(n->handle);
+        n->handle = fp_handle_zero();
+        n->is_closed = 1;
+      }
+    }
+  }
+  
+  ProfEnd();
+}
+
+internal void
+fnt_set_memory_budget(U64 budget)
+{
+  fnt_state->memory_budget = budget;
+}
+
+internal FNT_CacheStats
+fnt_cache_stats(void)
+{
+  FNT_CacheStats stats = {0};
+  stats.atlas_count = fnt_state->atlas_count;
+  stats.atlas_bytes = fnt_state->atlas_count*(U64)FNT_ATLAS_DIM*(U64)FNT_ATLAS_DIM*4;
+  for(FNT_Atlas *a = fnt_state->first_atlas; a != 0; a = a->next)
+  {
+    stats.allocated_area += a->allocated_area;
+  }
+  stats.style_count = fnt_state->style_count;
+  for(U64 slot_idx = 0; slot_idx < fnt_state->hash2style_slots_count; slot_idx += 1)
+  {
+    for(FNT_Hash2StyleRasterCacheNode *n = fnt_state->hash2style_slots[slot_idx].first; n != 0; n = n->hash_next)
+    {
+      stats.glyph_count += n->glyph_count;
+    }
+  }
+  for(U64 slot_idx = 0; slot_idx < fnt_state->font_hash_table_size; slot_idx += 1)
+  {
+    for(FNT_FontHashNode *n = fnt_state->font_hash_table[slot_idx].first; n != 0; n = n->hash_next)
+    {
+      stats.open_font_count += (n->is_valid && !n->is_closed);
+    }
+  }
+  stats.evicted_glyph_count = fnt_state->evicted_glyph_count;
+  stats.evacuated_atlas_count = fnt_state->evacuated_atlas_count;
+  stats.pending_raster_count = fnt_pending_raster_count();
+  return stats;
+}
+
+////////////////////////////////
+//~ rjf: Rasterization
+
+//- rjf: font provider handle open/close (serialized across threads)
+
+internal FP_Handle
+fnt_fp_open(String8 path, String8 *static_data_ptr)
+{
+  FP_Handle result = {0};
+  MutexScope(fnt_state->fp_mutex)
+  {
+    result = (static_data_ptr != 0
+              ? fp_font_open_from_static_data_string(static_data_ptr)
+              : fp_font_open(path));
+  }
+  return result;
+}
+
+internal void
+fnt_fp_close(FP_Handle handle)
+{
+  MutexScope(fnt_state->fp_mutex)
+  {
+    fp_font_close(handle);
+  }
+}
+
+//- rjf: cache info allocation & filling
+
+internal FNT_Hash2StyleRasterCacheNode *
+fnt_hash2style_from_hash(U64 style_hash)
+{
+  FNT_Hash2StyleRasterCacheNode *result = 0;
+  FNT_Hash2StyleRasterCacheSlot *slot = &fnt_state->hash2style_slots[style_hash%fnt_state->hash2style_slots_count];
+  for(FNT_Hash2StyleRasterCacheNode *n = slot->first; n != 0; n = n->hash_next)
+  {
+    if(n->style_hash == style_hash)
+    {
+      result = n;
+      break;
+    }
+  }
+  return result;
+}
+
+internal FNT_RasterCacheInfo *
+fnt_info_from_style_piece(FNT_Hash2StyleRasterCacheNode *style, String8 piece, U64 piece_hash)
+{
+  FNT_RasterCacheInfo *info = 0;
+  if(piece.size == 1)
+  {
+    if(style->utf8_class1_direct_map_mask[piece.str[0]/64] & (1ull<<(piece.str[0]%64)))
+    {
+      info = &style->utf8_class1_direct_map[piece.str[0]];
+    }
+  }
+  else
+  {
+    FNT_Hash2InfoRasterCacheSlot *slot = &style->hash2info_slots[piece_hash%style->hash2info_slots_count];
+    for(FNT_Hash2InfoRasterCacheNode *node = slot->first; node != 0; node = node->hash_next)
+    {
+      if(node->hash == piece_hash)
+      {
+        info = &node->info;
+        break;
+      }
+    }
+  }
+  return info;
+}
+
+internal FNT_RasterCacheInfo *
+fnt_info_alloc(FNT_Hash2StyleRasterCacheNode *style, String8 piece, U64 piece_hash)
+{
+  FNT_RasterCacheInfo *info = 0;
+  if(piece.size == 1)
+  {
+    info = &style->utf8_class1_direct_map[piece.str[0]];
+    style->utf8_class1_direct_map_mask[piece.str[0]/64] |= (1ull<<(piece.str[0]%64));
+  }
+  else
+  {
+    FNT_Hash2InfoRasterCacheSlot *slot = &style->hash2info_slots[piece_hash%style->hash2info_slots_count];
+    FNT_Hash2InfoRasterCacheNode *node = style->free_hash2info_node;
+    if(node != 0)
+    {
+      SLLStackPop_N(style->free_hash2info_node, hash_next);
+    }
+    else
+    {
+      node = push_array_no_zero(style->arena, FNT_Hash2InfoRasterCacheNode, 1);
+    }
+    DLLPushBack_NP(slot->first, slot->last, node, hash_next, hash_prev);
+    node->hash = piece_hash;
+    info = &node->info;
+  }
+  MemoryZeroStruct(info);
+  style->glyph_count += 1;
+  return info;
+}
+
+internal B32
+fnt_raster_dim_needs_atlas(Vec2S16 raster_dim)
+{
+  B32 result = (raster_dim.x != 0 && raster_dim.y != 0 &&
+                raster_dim.x + 2 <= FNT_ATLAS_DIM/2 && raster_dim.y + 2 <= FNT_ATLAS_DIM/2);
+  return result;
+}
+
+internal FNT_Atlas *
+fnt_atlas_from_raster_dim(Vec2S16 raster_dim, Rng2S16 *region_out)
+{
+  FNT_Atlas *chosen_atlas = 0;
+  Rng2S16 chosen_atlas_region = {0};
+  Vec2S16 needed_dimensions = v2s16(raster_dim.x + 2, raster_dim.y + 2);
+  if(fnt_raster_dim_needs_atlas(raster_dim))
+  {
+    for(U64 attempt_idx = 0; attempt_idx < 3 && chosen_atlas == 0; attempt_idx += 1)
+    {
+      // rjf: try all existing atlases
+      for(FNT_Atlas *atlas = fnt_state->first_atlas; atlas != 0; atlas = atlas->next)
+      {
+        chosen_atlas_region = fnt_atlas_region_alloc(atlas->arena, atlas, needed_dimensions);
+        if(chosen_atlas_region.x1 != chosen_atlas_region.x0)
+        {
+          chosen_atlas = atlas;
+          break;
+        }
+      }
+      
+      // rjf: no room -> create a new atlas, if the budget allows. if we've
+      // already evicted everything not in use this frame, this frame's
+      // working set exceeds the budget - go over it, rather than drawing
+      // nothing, and let compaction shrink back to the budget later.
+      U64 atlas_count_max = (attempt_idx < 2 ? fnt_atlas_count_max() : FNT_ATLAS_COUNT_HARD_MAX);
+      if(chosen_atlas == 0 && fnt_state->atlas_count < atlas_count_max)
+      {
+        FNT_Atlas *atlas = fnt_atlas_alloc();
+        chosen_atlas_region = fnt_atlas_region_alloc(atlas->arena, atlas, needed_dimensions);
+        if(chosen_atlas_region.x1 != chosen_atlas_region.x0)
+        {
+          chosen_atlas = atlas;
+        }
+      }
+      
+      // rjf: no room & no budget -> evict least-recently-used glyphs, and
+      // retry. free space in the atlases' quad-trees isn't necessarily
+      // contiguous, so first evict a generous multiple of what we need,
+      // and then everything which isn't in use this frame.
+      if(chosen_atlas == 0 && attempt_idx < 2)
+      {
+        U64 needed_area = (U64)needed_dimensions.x*(U64)needed_dimensions.y;
+        U64 evict_area = (attempt_idx == 0 ? Max(needed_area*16, (U64)FNT_ATLAS_DIM*FNT_ATLAS_DIM/8) : max_U64);
+        fnt_evict_lru_glyphs(evict_area, 0);
+      }
+    }
+  }
+  if(chosen_atlas == 0)
+  {
+    MemoryZeroStruct(&chosen_atlas_region);
+  }
+  *region_out = chosen_atlas_region;
+  return chosen_atlas;
+}
+
+internal void
+fnt_info_fill(FNT_Hash2StyleRasterCacheNode *style, FNT_RasterCacheInfo *info, FNT_Atlas *atlas, Rng2S16 region, FP_RasterResult *raster)
+{
+  //- rjf: fill info
+  info->subrect    = region;
+  info->atlas      = atlas;
+  info->raster_dim = raster->atlas_dim;
+  info->advance    = raster->advance;
+  info->is_pending = 0;
+  if(atlas != 0)
+  {
+    atlas->glyph_count += 1;
+  }
+  
+  //- rjf: refine placeholder metrics for this style, & this font
+  if(raster->atlas_dim.y != 0)
+  {
+    style->resolved_glyph_count += 1;
+    F32 style_n = (F32)Min(style->resolved_glyph_count, 64);
+    style->placeholder_advance += (raster->advance - style->placeholder_advance)/style_n;
+    style->placeholder_height = (F32)raster->atlas_dim.y;
+    FNT_FontHashNode *font_node = fnt_font_node_from_tag(style->tag);
+    if(font_node != 0 && style->size > 0)
+    {
+      font_node->resolved_glyph_count += 1;
+      F32 font_n = (F32)Min(font_node->resolved_glyph_count, 64);
+      font_node->advance_per_size += (raster->advance/style->size - font_node->advance_per_size)/font_n;
+      font_node->height_per_size  += (raster->atlas_dim.y/style->size - font_node->height_per_size)/font_n;
+    }
+  }
+}
+
+//- rjf: async rasterization
+
+internal void
+fnt_set_wakeup_hook(FNT_WakeupFunctionType *wakeup_hook)
+{
+  fnt_state->wakeup_hook = wakeup_hook;
+}
+
+internal void
+fnt_set_async_raster(B32 async_raster)
+{
+  fnt_state->async_raster = (async_raster && fnt_state->raster_workers_count != 0);
+}
+
+internal U64
+fnt_pending_raster_count(void)
+{
+  U64 result = 0;
+  MutexScope(fnt_state->raster_mutex)
+  {
+    result = fnt_state->pending_raster_count;
+  }
+  return result;
+}
+
+internal U64
+fnt_done_raster_gen(void)
+{
+  U64 result = 0;
+  MutexScope(fnt_state->raster_mutex)
+  {
+    result = fnt_state->done_raster_gen;
+  }
+  return result;
+}
+
+internal void
+fnt_raster_task_enqueue(FNT_FontHashNode *font_node, FNT_Hash2StyleRasterCacheNode *style, F32 size, FNT_RasterFlags flags, String8 piece, U64 piece_hash)
+{
+  MutexScope(fnt_state->raster_mutex)
+  {
+    FNT_RasterTask *task = fnt_state->free_raster_task;
+    if(task != 0)
+    {
+      SLLStackPop(fnt_state->free_raster_task);
+    }
+    else
+    {
+      task = push_array_no_zero(fnt_state->raster_task_arena, FNT_RasterTask, 1);
+    }
+    MemoryZeroStruct(task);
+    task->gen                  = fnt_state->raster_gen;
+    task->tag                  = font_node->tag;
+    task->font_path            = font_node->path;
+    task->font_static_data_ptr = font_node->static_data_ptr;
+    task->style_hash           = style->style_hash;
+    task->size                 = size;
+    task->flags                = flags;
+    task->piece_hash           = piece_hash;
+    task->string_size          = Min(piece.size, sizeof(task->string_buffer));
+    MemoryCopy(task->string_buffer, piece.str, task->string_size);
+    SLLQueuePush(fnt_state->first_queued_raster_task, fnt_state->last_queued_raster_task, task);
+    fnt_state->pending_raster_count += 1;
+  }
+  cond_var_signal(fnt_state->raster_cv);
+}
+
+internal FP_Handle
+fnt_raster_worker_handle_from_task(FNT_RasterWorker *worker, FNT_RasterTask *task)
+{
+  FNT_RasterWorkerFont *font = 0;
+  for(FNT_RasterWorkerFont *f = worker->first_font; f != 0; f = f->next)
+  {
+    if(fnt_tag_match(f->tag, task->tag))
+    {
+      font = f;
+      break;
+    }
+  }
+  if(font == 0)
+  {
+    font = worker->free_font;
+    if(font != 0)
+    {
+      SLLStackPop(worker->free_font);
+    }
+    else
+    {
+      font = push_array_no_zero(worker->font_arena, FNT_RasterWorkerFont, 1);
+    }
+    MemoryZeroStruct(font);
+    font->tag    = task->tag;
+    font->handle = fnt_fp_open(task->font_path, task->font_static_data_ptr);
+    SLLStackPush(worker->first_font, font);
+  }
+  font->last_used_us = os_now_microseconds();
+  return font->handle;
+}
+
+internal void
+fnt_raster_worker__entry_point(void *p)
+{
+  FNT_RasterWorker *worker = (FNT_RasterWorker *)p;
+  ThreadNameF("fnt_raster_worker_%I64u", worker->idx);
+  for(;;)
+  {
+    //- rjf: take next task, or time out
+    FNT_RasterTask *task = 0;
+    MutexScope(fnt_state->raster_mutex)
+    {
+      if(fnt_state->first_queued_raster_task == 0)
+      {
+        cond_var_wait(fnt_state->raster_cv, fnt_state->raster_mutex, os_now_microseconds() + FNT_COMPACTION_INTERVAL_US);
+      }
+      if(fnt_state->first_queued_raster_task != 0)
+      {
+        task = fnt_state->first_queued_raster_task;
+        SLLQueuePop(fnt_state->first_queued_raster_task, fnt_state->last_queued_raster_task);
+        task->next = 0;
+      }
+    }
+    
+    //- rjf: no task -> close this worker's font handles which haven't been
+    // used in a while
+    if(task == 0)
+    {
+      U64 now_us = os_now_microseconds();
+      for(FNT_RasterWorkerFont **ptr = &worker->first_font; *ptr != 0;)
+      {
+        FNT_RasterWorkerFont *font = *ptr;
+        if(font->last_used_us + FNT_FONT_CLOSE_US < now_us)
+        {
+          fnt_fp_close(font->handle);
+          *ptr = font->next;
+          SLLStackPush(worker->free_font, font);
+        }
+        else
+        {
+          ptr = &font->next;
+        }
+      }
+      continue;
+    }
+    
+    //- rjf: all of this worker's prior results have been consumed -> reset
+    if(ins_atomic_u64_eval(&worker->outstanding_result_count) == 0)
+    {
+      arena_clear(worker->result_arena);
+    }
+    
+    //- rjf: rasterize
+    ProfScope("rasterize")
+    {
+      FP_Handle handle = fnt_raster_worker_handle_from_task(worker, task);
+      FP_RasterFlags fp_flags = 0;
+      if(task->flags & FNT_RasterFlag_Smooth) { fp_flags |= FP_RasterFlag_Smooth; }
+      if(task->flags & FNT_RasterFlag_Hinted) { fp_flags |= FP_RasterFlag_Hinted; }
+      task->raster = fp_raster(worker->result_arena, handle, floor_f32(task->size), fp_flags, str8(task->string_buffer, task->string_size));
+      task->worker = worker;
+    }
+    
+    //- rjf: push result; wake up the UI thread on the first new result, so
+    // that it's collected at the next frame
+    B32 need_wakeup = 0;
+    ins_atomic_u64_inc_eval(&worker->outstanding_result_count);
+    MutexScope(fnt_state->raster_mutex)
+    {
+      need_wakeup = (fnt_state->first_done_raster_task == 0);
+      SLLQueuePush(fnt_state->first_done_raster_task, fnt_state->last_done_raster_task, task);
+      fnt_state->done_raster_gen += 1;
+    }
+    if(need_wakeup && fnt_state->wakeup_hook != 0)
+    {
+      fnt_state->wakeup_hook();
+    }
+  }
+}
+
+internal void
+fnt_raster_results_flush(void)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  
+  //- rjf: take all finished tasks
+  FNT_RasterTask *first_task = 0;
+  U64 task_count = 0;
+  MutexScope(fnt_state->raster_mutex)
+  {
+    first_task = fnt_state->first_done_raster_task;
+    fnt_state->first_done_raster_task = fnt_state->last_done_raster_task = 0;
+  }
+  for(FNT_RasterTask *t = first_task; t != 0; t = t->next)
+  {
+    task_count += 1;
+  }
+  
+  //- rjf: pack each rasterization into an atlas, & fill its pending info
+  typedef struct FNT_AtlasFill FNT_AtlasFill;
+  struct FNT_AtlasFill
+  {
+    FNT_Atlas *atlas;
+    R_Tex2DRegionFill fill;
+  };
+  FNT_AtlasFill *fills = push_array(scratch.arena, FNT_AtlasFill, task_count);
+  U64 fills_count = 0;
+  for(FNT_RasterTask *task = first_task; task != 0; task = task->next)
+  {
+    // rjf: map to pending info - may be gone, if the cache was reset, or if
+    // the style was evicted, since this task was queued
+    String8 piece = str8(task->string_buffer, task->string_size);
+    FNT_Hash2StyleRasterCacheNode *style = 0;
+    FNT_RasterCacheInfo *info = 0;
+    if(task->gen == fnt_state->raster_gen)
+    {
+      style = fnt_hash2style_from_hash(task->style_hash);
+    }
+    if(style != 0)
+    {
+      info = fnt_info_from_style_piece(style, piece, task->piece_hash);
+    }
+    if(info == 0 || !info->is_pending)
+    {
+      continue;
+    }
+    
+    // rjf: allocate atlas region
+    Rng2S16 region = {0};
+    FNT_Atlas *atlas = fnt_atlas_from_raster_dim(task->raster.atlas_dim, &region);
+    
+    // rjf: no room -> drop the pending info, so it's re-queued on next use
+    if(atlas == 0 && fnt_raster_dim_needs_atlas(task->raster.atlas_dim))
+    {
+      FNT_GlyphRef ref = {style, 0, 0, info};
+      if(piece.size == 1)
+      {
+        ref.direct_map_idx = piece.str[0];
+      }
+      else
+      {
+        ref.node = CastFromMember(FNT_Hash2InfoRasterCacheNode, info, info);
+      }
+      fnt_glyph_evict(&ref);
+      continue;
+    }
+    
+    // rjf: fill info; touch it, so that packing later results in this batch
+    // can't evict it
+    fnt_info_fill(style, info, atlas, region, &task->raster);
+    info->last_used_frame_index = fnt_state->frame_index;
+    
+    // rjf: push upload
+    if(atlas != 0)
+    {
+      FNT_AtlasFill *f = &fills[fills_count];
+      fills_count += 1;
+      f->atlas = atlas;
+      f->fill.subrect = r2s32p(region.x0, region.y0, region.x0 + task->raster.atlas_dim.x, region.y0 + task->raster.atlas_dim.y);
+      f->fill.data = task->raster.atlas;
+    }
+  }
+  
+  //- rjf: upload, one batch per atlas
+  for(FNT_Atlas *atlas = fnt_state->first_atlas; atlas != 0 && fills_count != 0; atlas = atlas->next)
+  {
+    R_Tex2DRegionFillArray array = {0};
+    array.v = push_array(scratch.arena, R_Tex2DRegionFill, fills_count);
+    for EachIndex(idx, fills_count)
+    {
+      if(fills[idx].atlas == atlas)
+      {
+        array.v[array.count] = fills[idx].fill;
+        array.count += 1;
+      }
+    }
+    if(array.count != 0)
+    {
+      r_fill_tex2d_regions(atlas->texture, &array);
+    }
+  }
+  
+  //- rjf: release tasks, & their workers' results
+  if(first_task != 0)
+  {
+    for(FNT_RasterTask *task = first_task; task != 0; task = task->next)
+    {
+      ins_atomic_u64_dec_eval(&task->worker->outstanding_result_count);
+    }
+    MutexScope(fnt_state->raster_mutex)
+    {
+      for(FNT_RasterTask *task = first_task, *next = 0; task != 0; task = next)
+      {
+        next = task->next;
+        SLLStackPush(fnt_state->free_raster_task, task);
+      }
+      fnt_state->pending_raster_count -= task_count;
+    }
+  }
+  
+  scratch_end(scratch);
+  ProfEnd();
+}
+
 ////////////////////////////////
 //~ rjf: Piece Type Functions
 
@@ -551,15 +1415,43 @@ fnt_hash2style_from_tag_size_flags(FNT_Tag tag, F32 size, FNT_RasterFlags flags)
     if(Unlikely(hash2style_node == 0))
     {
       FNT_Metrics metrics = fnt_metrics_from_tag_size(tag, size);
-      hash2style_node = push_array(fnt_state->raster_arena, FNT_Hash2StyleRasterCacheNode, 1);
+      hash2style_node = fnt_state->free_hash2style_node;
+      if(hash2style_node != 0)
+      {
+        SLLStackPop_N(fnt_state->free_hash2style_node, hash_next);
+      }
+      else
+      {
+        hash2style_node = push_array_no_zero(fnt_state->raster_arena, FNT_Hash2StyleRasterCacheNode, 1);
+      }
+      MemoryZeroStruct(hash2style_node);
       DLLPushBack_NP(slot->first, slot->last, hash2style_node, hash_next, hash_prev);
+      fnt_state->style_count += 1;
+      hash2style_node->arena = arena_alloc();
       hash2style_node->style_hash = style_hash;
+      hash2style_node->tag      = tag;
+      hash2style_node->size     = size;
       hash2style_node->ascent   = metrics.ascent;
       hash2style_node->descent  = metrics.descent;
-      hash2style_node->utf8_class1_direct_map = push_array_no_zero(fnt_state->raster_arena, FNT_RasterCacheInfo, 256);
+      
+      // rjf: estimate placeholder metrics for pending glyphs - from glyphs of
+      // this font already rasterized at other sizes, or from its vertical metrics
+      FNT_FontHashNode *font_node = fnt_font_node_from_tag(tag);
+      if(font_node != 0 && font_node->resolved_glyph_count != 0)
+      {
+        hash2style_node->placeholder_advance = font_node->advance_per_size*size;
+        hash2style_node->placeholder_height  = font_node->height_per_size*size;
+      }
+      else
+      {
+        hash2style_node->placeholder_advance = (metrics.ascent + metrics.descent)/2;
+        hash2style_node->placeholder_height  = (metrics.ascent + metrics.descent);
+      }
+      hash2style_node->utf8_class1_direct_map = push_array_no_zero(hash2style_node->arena, FNT_RasterCacheInfo, 256);
       hash2style_node->hash2info_slots_count = 1024;
-      hash2style_node->hash2info_slots = push_array(fnt_state->raster_arena, FNT_Hash2InfoRasterCacheSlot, hash2style_node->hash2info_slots_count);
+      hash2style_node->hash2info_slots = push_array(hash2style_node->arena, FNT_Hash2InfoRasterCacheSlot, hash2style_node->hash2info_slots_count);
     }
+    hash2style_node->last_used_frame_index = fnt_state->frame_index;
   }
   
   return hash2style_node;
@@ -609,8 +1501,8 @@ fnt_run_from_string(FNT_Tag tag, F32 size, F32 base_align_px, F32 tab_size_px, F
     //- rjf: decode string & produce run pieces
     FNT_PieceChunkList piece_chunks = {0};
     Vec2F32 dim = {0};
-    B32 font_handle_mapped_on_miss = 0;
-    FP_Handle font_handle = {0};
+    B32 font_node_mapped_on_miss = 0;
+    FNT_FontHashNode *font_node = 0;
     U64 piece_substring_start_idx = 0;
     U64 piece_substring_end_idx = 0;
     for(U64 idx = 0; idx <= string.size;)
@@ -660,6 +1552,7 @@ fnt_run_from_string(FNT_Tag tag, F32 size, F32 base_align_px, F32 tab_size_px, F
       
       //- rjf: piece substring -> raster cache info
       FNT_RasterCacheInfo *info = 0;
+      FNT_RasterCacheInfo uncached_info = {0};
       U64 piece_hash = 0;
       {
         // rjf: fast path for utf8 class 1 -> direct map
@@ -690,122 +1583,81 @@ fnt_run_from_string(FNT_Tag tag, F32 size, F32 base_align_px, F32 tab_size_px, F
       {
         Temp scratch = scratch_begin(0, 0);
         
-        // rjf: grab font handle for this tag if we don't have one already
-        if(font_handle_mapped_on_miss == 0)
+        // rjf: grab font node for this tag if we don't have one already
+        if(font_node_mapped_on_miss == 0)
         {
-          font_handle_mapped_on_miss = 1;
+          font_node_mapped_on_miss = 1;
           
           // rjf: tag -> font slot index
           U64 font_slot_idx = tag.u64[1] % fnt_state->font_hash_table_size;
           
           // rjf: tag * slot -> existing node
-          FNT_FontHashNode *existing_node = 0;
-          {
-            for(FNT_FontHashNode *n = fnt_state->font_hash_table[font_slot_idx].first; n != 0 ; n = n->hash_next)
-            {
-              if(MemoryMatchStruct(&n->tag, &tag))
-              {
-                existing_node = n;
-                break;
-              }
-            }
-          }
-          
-          // rjf: existing node -> font handle
-          if(existing_node != 0)
-          {
-            font_handle = existing_node->handle;
-          }
-        }
-        
-        // rjf: call into font provider to rasterize this substring
-        FP_RasterResult raster = {0};
-        if(size > 0)
-        {
-          FP_RasterFlags fp_flags = 0;
-          if(flags & FNT_RasterFlag_Smooth) { fp_flags |= FP_RasterFlag_Smooth; }
-          if(flags & FNT_RasterFlag_Hinted) { fp_flags |= FP_RasterFlag_Hinted; }
-          raster = fp_raster(scratch.arena, font_handle, floor_f32(size), flags, piece_substring);
-        }
-        
-        // rjf: allocate portion of an atlas to upload the rasterization
-        S16 chosen_atlas_num = 0;
-        FNT_Atlas *chosen_atlas = 0;
-        Rng2S16 chosen_atlas_region = {0};
-        if(raster.atlas_dim.x != 0 && raster.atlas_dim.y != 0)
-        {
-          U64 num_atlases = 0;
-          for(FNT_Atlas *atlas = fnt_state->first_atlas;; atlas = atlas->next, num_atlases += 1)
+          for(FNT_FontHashNode *n = fnt_state->font_hash_table[font_slot_idx].first; n != 0 ; n = n->hash_next)
           {
-            // rjf: create atlas if needed
-            if(atlas == 0 && num_atlases < 64)
-            {
-              atlas = push_array(fnt_state->raster_arena, FNT_Atlas, 1);
-              DLLPushBack(fnt_state->first_atlas, fnt_state->last_atlas, atlas);
-              atlas->root_dim = v2s16(1024, 1024);
-              atlas->root = push_array(fnt_state->raster_arena, FNT_AtlasRegionNode, 1);
-              atlas->root->max_free_size[Corner_00] =
-                atlas->root->max_free_size[Corner_01] =
-                atlas->root->max_free_size[Corner_10] =
-                atlas->root->max_free_size[Corner_11] = v2s16(atlas->root_dim.x/2, atlas->root_dim.y/2);
-              atlas->texture = r_tex2d_alloc(R_ResourceKind_Dynamic, v2s32((S32)atlas->root_dim.x, (S32)atlas->root_dim.y), R_Tex2DFormat_RGBA8, 0);
-            }
-            
-            // rjf: allocate from atlas
-            if(atlas != 0)
-            {
-              Vec2S16 needed_dimensions = v2s16(raster.atlas_dim.x + 2, raster.atlas_dim.y + 2);
-              chosen_atlas_region = fnt_atlas_region_alloc(fnt_state->raster_arena, atlas, needed_dimensions);
-              if(chosen_atlas_region.x1 != chosen_atlas_region.x0)
-              {
-                chosen_atlas = atlas;
-                chosen_atlas_num = (S32)num_atlases;
-                break;
-              }
-            }
-            else
+            if(MemoryMatchStruct(&n->tag, &tag))
             {
+              font_node = n;
               break;
             }
           }
         }
         
-        // rjf: upload rasterization to allocated region of atlas texture memory
-        if(chosen_atlas != 0)
+        // rjf: async rasterization -> insert pending info w/ placeholder
+        // metrics, & queue rasterization to the workers
+        if(fnt_state->async_raster && size > 0 && font_node != 0 && font_node->is_valid &&
+           piece_substring.size <= FNT_RASTER_STRING_MAX)
         {
-          Rng2S32 subregion =
-          {
-            chosen_atlas_region.x0,
-            chosen_atlas_region.y0,
-            chosen_atlas_region.x0 + raster.atlas_dim.x,
-            chosen_atlas_region.y0 + raster.atlas_dim.y
-          };
-          r_fill_tex2d_region(chosen_atlas->texture, subregion, raster.atlas);
+          info = fnt_info_alloc(hash2style_node, piece_substring, piece_hash);
+          info->is_pending = 1;
+          info->advance    = hash2style_node->placeholder_advance;
+          fnt_raster_task_enqueue(font_node, hash2style_node, size, flags, piece_substring, piece_hash);
         }
         
-        // rjf: allocate & fill & push node
+        // rjf: synchronous rasterization -> call into font provider to
+        // rasterize this substring, pack & upload it immediately
+        else
         {
-          if(piece_substring.size == 1)
+          FP_RasterResult raster = {0};
+          if(size > 0 && font_node != 0)
           {
-            info = &hash2style_node->utf8_class1_direct_map[piece_substring.str[0]];
-            hash2style_node->utf8_class1_direct_map_mask[piece_substring.str[0]/64] |= (1ull<<(piece_substring.str[0]%64));
+            FP_RasterFlags fp_flags = 0;
+            if(flags & FNT_RasterFlag_Smooth) { fp_flags |= FP_RasterFlag_Smooth; }
+            if(flags & FNT_RasterFlag_Hinted) { fp_flags |= FP_RasterFlag_Hinted; }
+            raster = fp_raster(scratch.arena, fnt_handle_from_font_node(font_node), floor_f32(size), fp_flags, piece_substring);
           }
-          else
+          
+          // rjf: allocate portion of an atlas to upload the rasterization
+          Rng2S16 region = {0};
+          FNT_Atlas *atlas = fnt_atlas_from_raster_dim(raster.atlas_dim, &region);
+          
+          // rjf: upload rasterization to allocated region of atlas texture memory
+          if(atlas != 0)
           {
-            U64 slot_idx = piece_hash%hash2style_node->hash2info_slots_count;
-            FNT_Hash2InfoRasterCacheSlot *slot = &hash2style_node->hash2info_slots[slot_idx];
-            FNT_Hash2InfoRasterCacheNode *node = push_array_no_zero(fnt_state->raster_arena, FNT_Hash2InfoRasterCacheNode, 1);
-            DLLPushBack_NP(slot->first, slot->last, node, hash_next, hash_prev);
-            node->hash = piece_hash;
-            info = &node->info;
+            Rng2S32 subregion =
+            {
+              region.x0,
+              region.y0,
+              region.x0 + raster.atlas_dim.x,
+              region.y0 + raster.atlas_dim.y
+            };
+            r_fill_tex2d_region(atlas->texture, subregion, raster.atlas);
           }
-          if(info != 0)
+          
+          // rjf: allocate & fill node - if there was no room for this
+          // rasterization (everything resident is in use this frame), then don't
+          // cache it, so it's retried next frame rather than cached as empty
+          if(atlas == 0 && fnt_raster_dim_needs_atlas(raster.atlas_dim))
           {
-            info->subrect    = chosen_atlas_region;
-            info->atlas_num  = chosen_atlas_num;
+            info = &uncached_info;
+            run_is_cacheable = 0;
             info->raster_dim = raster.atlas_dim;
             info->advance    = raster.advance;
           }
+          else
+          {
+            info = fnt_info_alloc(hash2style_node, piece_substring, piece_hash);
+            fnt_info_fill(hash2style_node, info, atlas, region, &raster);
+          }
         }
         
         scratch_end(scratch);
@@ -814,22 +1666,10 @@ fnt_run_from_string(FNT_Tag tag, F32 size, F32 base_align_px, F32 tab_size_px, F
       //- rjf: push piece for this raster portion
       if(info != 0)
       {
-        // rjf: find atlas
-        FNT_Atlas *atlas = 0;
-        {
-          if(info->subrect.x1 != 0 && info->subrect.y1 != 0)
-          {
-            S32 num = 0;
-            for(FNT_Atlas *a = fnt_state->first_atlas; a != 0; a = a->next, num += 1)
-            {
-              if(info->atlas_num == num)
-              {
-                atlas = a;
-                break;
-              }
-            }
-          }
-        }
+        // rjf: touch glyph, so it's not evicted while this frame's pieces may
+        // still be drawn
+        FNT_Atlas *atlas = info->atlas;
+        info->last_used_frame_index = fnt_state->frame_index;
         
         // rjf: on tabs -> expand advance
         F32 advance = info->advance;
@@ -853,7 +1693,7 @@ fnt_run_from_string(FNT_Tag tag, F32 size, F32 base_align_px, F32 tab_size_px, F
           }
           base_align_px += advance;
           dim.x += piece->advance;
-          dim.y = Max(dim.y, info->raster_dim.y);
+          dim.y = Max(dim.y, info->is_pending ? hash2style_node->placeholder_height : info->raster_dim.y);
         }
       }
     }
@@ -1095,6 +1935,23 @@ fnt_init(void)
   fnt_state->frame_arena = arena_alloc();
   fnt_state->font_hash_table_size = 64;
   fnt_state->font_hash_table = push_array(fnt_state->permanent_arena, FNT_FontHashSlot, fnt_state->font_hash_table_size);
+  fnt_state->memory_budget = FNT_DEFAULT_MEMORY_BUDGET;
+  fnt_state->last_compaction_us = os_now_microseconds();
+  fnt_state->fp_mutex = mutex_alloc();
+  fnt_state->raster_mutex = mutex_alloc();
+  fnt_state->raster_cv = cond_var_alloc();
+  fnt_state->raster_task_arena = arena_alloc();
+  fnt_state->raster_workers_count = Clamp(1, os_get_system_info()->logical_processor_count/2, FNT_RASTER_WORKER_COUNT_MAX);
+  fnt_state->raster_workers = push_array(fnt_state->permanent_arena, FNT_RasterWorker, fnt_state->raster_workers_count);
+  for EachIndex(idx, fnt_state->raster_workers_count)
+  {
+    FNT_RasterWorker *worker = &fnt_state->raster_workers[idx];
+    worker->idx = idx;
+    worker->font_arena = arena_alloc();
+    worker->result_arena = arena_alloc();
+    worker->thread = thread_launch(fnt_raster_worker__entry_point, worker);
+  }
+  fnt_state->async_raster = 1;
   fnt_reset();
 }
 
@@ -1104,8 +1961,20 @@ fnt_reset(void)
   for(FNT_Atlas *a = fnt_state->first_atlas; a != 0; a = a->next)
   {
     r_tex2d_release(a->texture);
+    arena_release(a->arena);
   }
-  fnt_state->first_atlas = fnt_state->last_atlas = 0;
+  for(U64 slot_idx = 0; slot_idx < fnt_state->hash2style_slots_count; slot_idx += 1)
+  {
+    for(FNT_Hash2StyleRasterCacheNode *n = fnt_state->hash2style_slots[slot_idx].first; n != 0; n = n->hash_next)
+    {
+      arena_release(n->arena);
+    }
+  }
+  fnt_state->first_atlas = fnt_state->last_atlas = fnt_state->free_atlas = 0;
+  fnt_state->atlas_count = 0;
+  fnt_state->free_hash2style_node = 0;
+  fnt_state->style_count = 0;
+  fnt_state->raster_gen += 1;
   arena_clear(fnt_state->raster_arena);
   fnt_state->hash2style_slots_count = 1024;
   fnt_state->hash2style_slots = push_array(fnt_state->raster_arena, FNT_Hash2StyleRasterCacheSlot, fnt_state->hash2style_slots_count);
@@ -1116,4 +1985,16 @@ fnt_frame(void)
 {
   fnt_state->frame_index += 1;
   arena_clear(fnt_state->frame_arena);
+  
+  //- rjf: collect finished rasterizations, pack & upload them
+  fnt_raster_results_flush();
+  
+  //- rjf: periodically compact the cache - at frame boundaries, no pieces
+  // from prior frames are still in use, so all glyphs & atlases are movable
+  U64 now_us = os_now_microseconds();
+  if(fnt_state->last_compaction_us + FNT_COMPACTION_INTERVAL_US <= now_us)
+  {
+    fnt_state->last_compaction_us = now_us;
+    fnt_compact();
+  }
 }
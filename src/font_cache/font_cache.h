@@ -4,6 +4,41 @@
 #ifndef FONT_CACHE_H
 #define FONT_CACHE_H
 
+////////////////////////////////
+//~ rjf: Font Cache Overview
+//
+// Glyph rasterizations are cached per style (font * size * flags), and packed
+// into a list of atlas textures. The cache lives within a memory budget,
+// which bounds the number of atlases. When a rasterization doesn't fit, the
+// least-recently-used glyphs (never those used in the current frame) are
+// evicted, and their atlas regions are released. Periodically, at frame
+// boundaries, the cache is compacted - empty atlases are released, sparse
+// atlases are evacuated (their glyphs are evicted & re-rasterized on their
+// next use, into denser atlases), empty styles are released, and font
+// provider handles which haven't been used recently are closed. Closed
+// handles are reopened lazily, so font tags remain valid indefinitely.
+//
+// Rasterization is asynchronous. A piece which misses the cache is inserted
+// as "pending", with placeholder metrics (estimated from glyphs already
+// rasterized in that style), and queued to a small pool of rasterization
+// workers. Font provider handles can't be used from multiple threads at once,
+// so each worker opens its own handle for each font. Finished rasterizations
+// are collected at the next frame boundary, packed into atlases, and uploaded
+// in one batch per atlas - so the UI thread never waits on the font provider,
+// and layout settles a frame or two after a new glyph first appears.
+
+////////////////////////////////
+//~ rjf: Cache Parameters
+
+#define FNT_ATLAS_DIM                1024
+#define FNT_ATLAS_COUNT_HARD_MAX     64
+#define FNT_DEFAULT_MEMORY_BUDGET    MB(64)
+#define FNT_COMPACTION_INTERVAL_US   1000000
+#define FNT_STYLE_EVICT_FRAMES       600
+#define FNT_FONT_CLOSE_US            30000000
+#define FNT_RASTER_WORKER_COUNT_MAX  4
+#define FNT_RASTER_STRING_MAX        16
+
 ////////////////////////////////
 //~ rjf: Rasterization Flags
 
@@ -81,6 +116,13 @@ struct FNT_FontHashNode
   FP_Handle handle;
   FP_Metrics metrics;
   String8 path;
+  String8 *static_data_ptr;
+  B32 is_valid;
+  B32 is_closed;
+  U64 last_used_us;
+  U64 resolved_glyph_count;
+  F32 advance_per_size;
+  F32 height_per_size;
 };
 
 typedef struct FNT_FontHashSlot FNT_FontHashSlot;
@@ -95,13 +137,17 @@ struct FNT_FontHashSlot
 
 //- rjf: base glyph rasterization / dimensions cache 
 
+typedef struct FNT_Atlas FNT_Atlas;
+
 typedef struct FNT_RasterCacheInfo FNT_RasterCacheInfo;
 struct FNT_RasterCacheInfo
 {
   Rng2S16 subrect;
   Vec2S16 raster_dim;
-  S16 atlas_num;
+  FNT_Atlas *atlas;
   F32 advance;
+  U64 last_used_frame_index;
+  B32 is_pending;
 };
 
 typedef struct FNT_Hash2InfoRasterCacheNode FNT_Hash2InfoRasterCacheNode;
@@ -144,10 +190,19 @@ struct FNT_Hash2StyleRasterCacheNode
 {
   FNT_Hash2StyleRasterCacheNode *hash_next;
   FNT_Hash2StyleRasterCacheNode *hash_prev;
+  Arena *arena;
   U64 style_hash;
+  FNT_Tag tag;
+  F32 size;
+  U64 last_used_frame_index;
+  U64 glyph_count;
+  FNT_Hash2InfoRasterCacheNode *free_hash2info_node;
   F32 ascent;
   F32 descent;
   F32 column_width;
+  F32 placeholder_advance;
+  F32 placeholder_height;
+  U64 resolved_glyph_count;
   FNT_RasterCacheInfo *utf8_class1_direct_map;
   U64 utf8_class1_direct_map_mask[4];
   U64 hash2info_slots_count;
@@ -183,14 +238,97 @@ struct FNT_AtlasRegionNode
   U64 num_allocated_descendants;
 };
 
-typedef struct FNT_Atlas FNT_Atlas;
 struct FNT_Atlas
 {
   FNT_Atlas *next;
   FNT_Atlas *prev;
+  Arena *arena;
   R_Handle texture;
   Vec2S16 root_dim;
   FNT_AtlasRegionNode *root;
+  U64 allocated_area;
+  U64 glyph_count;
+};
+
+////////////////////////////////
+//~ rjf: Eviction Types
+
+typedef struct FNT_GlyphRef FNT_GlyphRef;
+struct FNT_GlyphRef
+{
+  FNT_Hash2StyleRasterCacheNode *style;
+  FNT_Hash2InfoRasterCacheNode *node;
+  U8 direct_map_idx;
+  FNT_RasterCacheInfo *info;
+};
+
+typedef struct FNT_GlyphRefArray FNT_GlyphRefArray;
+struct FNT_GlyphRefArray
+{
+  FNT_GlyphRef *v;
+  U64 count;
+};
+
+////////////////////////////////
+//~ rjf: Async Rasterization Types
+
+#define FNT_WAKEUP_FUNCTION_DEF(name) void name(void)
+typedef FNT_WAKEUP_FUNCTION_DEF(FNT_WakeupFunctionType);
+
+typedef struct FNT_RasterWorkerFont FNT_RasterWorkerFont;
+struct FNT_RasterWorkerFont
+{
+  FNT_RasterWorkerFont *next;
+  FNT_Tag tag;
+  FP_Handle handle;
+  U64 last_used_us;
+};
+
+typedef struct FNT_RasterWorker FNT_RasterWorker;
+struct FNT_RasterWorker
+{
+  U64 idx;
+  Thread thread;
+  Arena *font_arena;
+  FNT_RasterWorkerFont *first_font;
+  FNT_RasterWorkerFont *free_font;
+  Arena *result_arena;
+  U64 outstanding_result_count;
+};
+
+typedef struct FNT_RasterTask FNT_RasterTask;
+struct FNT_RasterTask
+{
+  FNT_RasterTask *next;
+  U64 gen;
+  FNT_Tag tag;
+  String8 font_path;
+  String8 *font_static_data_ptr;
+  U64 style_hash;
+  F32 size;
+  FNT_RasterFlags flags;
+  U64 piece_hash;
+  U64 string_size;
+  U8 string_buffer[FNT_RASTER_STRING_MAX];
+  FNT_RasterWorker *worker;
+  FP_RasterResult raster;
+};
+
+////////////////////////////////
+//~ rjf: Cache Stats
+
+typedef struct FNT_CacheStats FNT_CacheStats;
+struct FNT_CacheStats
+{
+  U64 atlas_count;
+  U64 atlas_bytes;
+  U64 allocated_area;
+  U64 style_count;
+  U64 glyph_count;
+  U64 open_font_count;
+  U64 evicted_glyph_count;
+  U64 evacuated_atlas_count;
+  U64 pending_raster_count;
 };
 
 ////////////////////////////////
@@ -216,6 +354,10 @@ struct FNT_State
   Arena *frame_arena;
   U64 frame_index;
   
+  // rjf: budget
+  U64 memory_budget;
+  U64 last_compaction_us;
+  
   // rjf: font table
   U64 font_hash_table_size;
   FNT_FontHashSlot *font_hash_table;
@@ -223,10 +365,36 @@ struct FNT_State
   // rjf: hash -> raster cache table
   U64 hash2style_slots_count;
   FNT_Hash2StyleRasterCacheSlot *hash2style_slots;
+  FNT_Hash2StyleRasterCacheNode *free_hash2style_node;
+  U64 style_count;
   
   // rjf: atlas list
   FNT_Atlas *first_atlas;
   FNT_Atlas *last_atlas;
+  FNT_Atlas *free_atlas;
+  U64 atlas_count;
+  
+  // rjf: eviction counters
+  U64 evicted_glyph_count;
+  U64 evacuated_atlas_count;
+  
+  // rjf: async rasterization
+  B32 async_raster;
+  U64 raster_gen;
+  FNT_WakeupFunctionType *wakeup_hook;
+  Mutex fp_mutex;
+  Mutex raster_mutex;
+  CondVar raster_cv;
+  Arena *raster_task_arena;
+  FNT_RasterTask *free_raster_task;
+  FNT_RasterTask *first_queued_raster_task;
+  FNT_RasterTask *last_queued_raster_task;
+  FNT_RasterTask *first_done_raster_task;
+  FNT_RasterTask *last_done_raster_task;
+  U64 pending_raster_count;
+  U64 done_raster_gen;
+  U64 raster_workers_count;
+  FNT_RasterWorker *raster_workers;
 };
 
 ////////////////////////////////
@@ -246,6 +414,7 @@ internal Vec2S32 fnt_vertex_from_corner(Corner corner);
 
 internal FNT_Tag fnt_tag_zero(void);
 internal B32 fnt_tag_match(FNT_Tag a, FNT_Tag b);
+internal FNT_FontHashNode *fnt_font_node_from_tag(FNT_Tag tag);
 internal FP_Handle fnt_handle_from_tag(FNT_Tag tag);
 internal FP_Metrics fnt_fp_metrics_from_tag(FNT_Tag tag);
 internal FNT_Tag fnt_tag_from_path(String8 path);
@@ -257,6 +426,46 @@ internal String8 fnt_path_from_tag(FNT_Tag tag);
 
 internal Rng2S16 fnt_atlas_region_alloc(Arena *arena, FNT_Atlas *atlas, Vec2S16 needed_size);
 internal void fnt_atlas_region_release(FNT_Atlas *atlas, Rng2S16 region);
+internal FNT_Atlas *fnt_atlas_alloc(void);
+internal void fnt_atlas_release(FNT_Atlas *atlas);
+
+////////////////////////////////
+//~ rjf: Budget & Eviction
+
+internal U64 fnt_atlas_count_max(void);
+internal FP_Handle fnt_handle_from_font_node(FNT_FontHashNode *node);
+internal FNT_GlyphRefArray fnt_glyph_ref_array_from_lru(Arena *arena, FNT_Atlas *atlas_filter);
+internal void fnt_glyph_evict(FNT_GlyphRef *ref);
+internal U64 fnt_evict_lru_glyphs(U64 needed_area, FNT_Atlas *atlas_filter);
+internal void fnt_style_release(FNT_Hash2StyleRasterCacheNode *node);
+internal void fnt_compact(void);
+internal void fnt_set_memory_budget(U64 budget);
+internal FNT_CacheStats fnt_cache_stats(void);
+
+////////////////////////////////
+//~ rjf: Rasterization
+
+//- rjf: font provider handle open/close (serialized across threads)
+internal FP_Handle fnt_fp_open(String8 path, String8 *static_data_ptr);
+internal void fnt_fp_close(FP_Handle handle);
+
+//- rjf: cache info allocation & filling
+internal FNT_Hash2StyleRasterCacheNode *fnt_hash2style_from_hash(U64 style_hash);
+internal FNT_RasterCacheInfo *fnt_info_from_style_piece(FNT_Hash2StyleRasterCacheNode *style, String8 piece, U64 piece_hash);
+internal FNT_RasterCacheInfo *fnt_info_alloc(FNT_Hash2StyleRasterCacheNode *style, String8 piece, U64 piece_hash);
+internal B32 fnt_raster_dim_needs_atlas(Vec2S16 raster_dim);
+internal FNT_Atlas *fnt_atlas_from_raster_dim(Vec2S16 raster_dim, Rng2S16 *region_out);
+internal void fnt_info_fill(FNT_Hash2StyleRasterCacheNode *style, FNT_RasterCacheInfo *info, FNT_Atlas *atlas, Rng2S16 region, FP_RasterResult *raster);
+
+//- rjf: async rasterization
+internal void fnt_set_wakeup_hook(FNT_WakeupFunctionType *wakeup_hook);
+internal void fnt_set_async_raster(B32 async_raster);
+internal U64 fnt_pending_raster_count(void);
+internal U64 fnt_done_raster_gen(void);
+internal void fnt_raster_task_enqueue(FNT_FontHashNode *font_node, FNT_Hash2StyleRasterCacheNode *style, F32 size, FNT_RasterFlags flags, String8 piece, U64 piece_hash);
+internal FP_Handle fnt_raster_worker_handle_from_task(FNT_RasterWorker *worker, FNT_RasterTask *task);
+internal void fnt_raster_worker__entry_point(void *p);
+internal void fnt_raster_results_flush(void);
 
 ////////////////////////////////
 //~ rjf: Piece Type Functions
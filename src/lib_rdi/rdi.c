@@ -10,7 +10,7 @@
 #ifndef RDI_C
 #define RDI_C
 
-RDI_U16 rdi_section_element_size_table[44] =
+RDI_U16 rdi_section_element_size_table[46] =
 {
 sizeof(RDI_U8),
 sizeof(RDI_TopLevelInfo),
@@ -55,6 +55,8 @@ sizeof(RDI_U64),
 sizeof(RDI_NameMap),
 sizeof(RDI_NameMapBucket),
 sizeof(RDI_NameMapNode),
+sizeof(RDI_U32),
+sizeof(RDI_U64),
 sizeof(RDI_U8),
 };
 
@@ -67,7 +67,7 @@ union RDI_GUID {RDI_U8 u8[16]; RDI_U64 u64[2];};
 
 // "raddbg\0\0"
 #define RDI_MAGIC_CONSTANT   0x0000676264646172
-#define RDI_ENCODING_VERSION 17
+#define RDI_ENCODING_VERSION 20
 
 ////////////////////////////////////////////////////////////////
 //~ Format Types & Functions
@@ -118,7 +118,9 @@ RDI_SectionKind_Timestamps           = 0x0027,
 RDI_SectionKind_NameMaps             = 0x0028,
 RDI_SectionKind_NameMapBuckets       = 0x0029,
 RDI_SectionKind_NameMapNodes         = 0x002A,
-RDI_SectionKind_COUNT                = 0x002B,
+RDI_SectionKind_NameMapSortedNodes   = 0x002B,
+RDI_SectionKind_LineTableInputHashes = 0x002C,
+RDI_SectionKind_COUNT                = 0x002D,
 } RDI_SectionKindEnum;
 
 typedef RDI_U32 RDI_SectionEncoding;
@@ -126,6 +128,7 @@ typedef enum RDI_SectionEncodingEnum
 {
 RDI_SectionEncoding_Unpacked   = 0,
 RDI_SectionEncoding_LZB        = 1,
+RDI_SectionEncoding_LZBBlocks  = 2,
 } RDI_SectionEncodingEnum;
 
 typedef RDI_U32 RDI_Arch;
@@ -620,10 +623,13 @@ X(Timestamps, timestamps, RDI_U64)\
 X(NameMaps, name_maps, RDI_NameMap)\
 X(NameMapBuckets, name_map_buckets, RDI_NameMapBucket)\
 X(NameMapNodes, name_map_nodes, RDI_NameMapNode)\
+X(NameMapSortedNodes, name_map_sorted_nodes, RDI_U32)\
+X(LineTableInputHashes, line_table_input_hashes, RDI_U64)\
 
 #define RDI_SectionEncoding_XList \
 X(Unpacked)\
 X(LZB)\
+X(LZBBlocks)\
 
 #define RDI_Section_XList \
 X(RDI_SectionEncoding, encoding)\
@@ -632,6 +638,10 @@ X(RDI_U64, off)\
 X(RDI_U64, encoded_size)\
 X(RDI_U64, unpacked_size)\
 
+#define RDI_SectionBlockHeader_XList \
+X(RDI_U64, block_size)\
+X(RDI_U64, block_count)\
+
 #define RDI_VMapEntry_XList \
 X(RDI_U64, voff)\
 X(RDI_U64, idx)\
@@ -1175,6 +1185,7 @@ X(RDI_U32, node_count)\
 X(RDI_U32, string_idx)\
 X(RDI_U32, match_count)\
 X(RDI_U32, match_idx_or_idx_run_first)\
+X(RDI_U32, string_hash)\
 
 #if !RDI_DISABLE_TABLE_INDEX_TYPECHECKING
 typedef struct RDI_U32_StringTable                 { RDI_U32 v; } RDI_U32_StringTable;
@@ -1214,6 +1225,8 @@ typedef struct RDI_U32_Timestamps                  { RDI_U32 v; } RDI_U32_Timest
 typedef struct RDI_U32_NameMaps                    { RDI_U32 v; } RDI_U32_NameMaps;
 typedef struct RDI_U32_NameMapBuckets              { RDI_U32 v; } RDI_U32_NameMapBuckets;
 typedef struct RDI_U32_NameMapNodes                { RDI_U32 v; } RDI_U32_NameMapNodes;
+typedef struct RDI_U32_NameMapSortedNodes          { RDI_U32 v; } RDI_U32_NameMapSortedNodes;
+typedef struct RDI_U32_LineTableInputHashes        { RDI_U32 v; } RDI_U32_LineTableInputHashes;
 #else
 typedef struct RDI_U32_Table { RDI_U32 v; } RDI_U32_Table;
 typedef struct RDI_U64_Table { RDI_U64 v; } RDI_U64_Table;
@@ -1254,6 +1267,8 @@ typedef RDI_U32_Table RDI_U32_Timestamps;
 typedef RDI_U32_Table RDI_U32_NameMaps;
 typedef RDI_U32_Table RDI_U32_NameMapBuckets;
 typedef RDI_U32_Table RDI_U32_NameMapNodes;
+typedef RDI_U32_Table RDI_U32_NameMapSortedNodes;
+typedef RDI_U32_Table RDI_U32_LineTableInputHashes;
 #endif
 
 #define RDI_EVAL_CTRLBITS(decodeN,popN,pushN) (((decodeN) << 8) | ((popN) << 4) | ((pushN) << 0))
@@ -1281,6 +1296,13 @@ RDI_U64 encoded_size;
 RDI_U64 unpacked_size;
 };
 
+typedef struct RDI_SectionBlockHeader RDI_SectionBlockHeader;
+struct RDI_SectionBlockHeader
+{
+RDI_U64 block_size;
+RDI_U64 block_count;
+};
+
 typedef struct RDI_VMapEntry RDI_VMapEntry;
 struct RDI_VMapEntry
 {
@@ -1584,6 +1606,7 @@ struct RDI_NameMapNode
 RDI_U32 string_idx;
 RDI_U32 match_count;
 RDI_U32 match_idx_or_idx_run_first;
+RDI_U32 string_hash;
 };
 
 typedef RDI_TopLevelInfo                 RDI_SectionElementType_TopLevelInfo;
@@ -1628,6 +1651,8 @@ typedef RDI_U64                          RDI_SectionElementType_Timestamps;
 typedef RDI_NameMap                      RDI_SectionElementType_NameMaps;
 typedef RDI_NameMapBucket                RDI_SectionElementType_NameMapBuckets;
 typedef RDI_NameMapNode                  RDI_SectionElementType_NameMapNodes;
+typedef RDI_U32                          RDI_SectionElementType_NameMapSortedNodes;
+typedef RDI_U64                          RDI_SectionElementType_LineTableInputHashes;
 
 RDI_PROC RDI_U64 rdi_hash(RDI_U8 *ptr, RDI_U64 size);
 RDI_PROC RDI_U8 *rdi_string_from_type_kind(RDI_TypeKind kind, RDI_U64 *size_out);
@@ -1637,7 +1662,7 @@ RDI_PROC RDI_EvalConversionKind rdi_eval_conversion_kind_from_typegroups(RDI_Eva
 RDI_PROC RDI_S32 rdi_eval_op_typegroup_are_compatible(RDI_EvalOp op, RDI_EvalTypeGroup group);
 RDI_PROC RDI_U8 *rdi_explanation_string_from_eval_conversion_kind(RDI_EvalConversionKind kind, RDI_U64 *size_out);
 
-extern RDI_U16 rdi_section_element_size_table[44];
+extern RDI_U16 rdi_section_element_size_table[46];
 extern RDI_U16 rdi_eval_op_ctrlbits_table[53];
 
 #endif // RDI_H
@@ -277,9 +277,18 @@ RDI_PROC RDI_U64
 rdi_decompressed_size_from_parsed(RDI_Parsed *rdi)
 {
   RDI_U64 decompressed_size = rdi->raw_data_size;
+  RDI_U64 packed_count = 0;
   for(RDI_U64 section_idx = 0; section_idx < rdi->sections_count; section_idx += 1)
   {
     decompressed_size += (rdi->sections[section_idx].unpacked_size - rdi->sections[section_idx].encoded_size);
+    packed_count += (rdi->sections[section_idx].encoding != RDI_SectionEncoding_Unpacked);
+  }
+  
+  // NOTE(rjf): decompressed sections are re-aligned to 8 bytes, which may
+  // require more padding than the packed sections did.
+  if(packed_count != 0)
+  {
+    decompressed_size += 8*rdi->sections_count;
   }
   return decompressed_size;
 }
@@ -287,7 +296,7 @@ rdi_decompressed_size_from_parsed(RDI_Parsed *rdi)
 //- decompression
 
 internal void
-rdi_decompress_parsed(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi)
+rdi_decompress_parsed_layout(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi)
 {
   // rjf: copy header
   RDI_Header *src_header = (RDI_Header *)og_rdi->raw_data;
@@ -314,22 +323,225 @@ rdi_decompress_parsed(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *
       off -= off%8;
     }
   }
+}
+
+internal RDI_SectionBlockHeader *
+rdi_section_block_header_from_section(RDI_Parsed *og_rdi, RDI_Section *section, RDI_U64 **offs_out)
+{
+  RDI_SectionBlockHeader *result = 0;
+  if(section->encoding == RDI_SectionEncoding_LZBBlocks &&
+     section->encoded_size >= sizeof(RDI_SectionBlockHeader) &&
+     section->off + section->encoded_size <= og_rdi->raw_data_size)
+  {
+    RDI_SectionBlockHeader *hdr = (RDI_SectionBlockHeader *)(og_rdi->raw_data + section->off);
+    U64 offs_size = (hdr->block_count + 1) * sizeof(RDI_U64);
+    if(hdr->block_size != 0 &&
+       hdr->block_count == (section->unpacked_size + hdr->block_size - 1) / hdr->block_size &&
+       sizeof(RDI_SectionBlockHeader) + offs_size <= section->encoded_size)
+    {
+      result = hdr;
+      if(offs_out != 0)
+      {
+        *offs_out = (RDI_U64 *)(hdr + 1);
+      }
+    }
+  }
+  return result;
+}
+
+internal U64
+rdi_decompress_unit_count_from_section(RDI_Parsed *og_rdi, RDI_Section *section)
+{
+  U64 count = 1;
+  RDI_SectionBlockHeader *hdr = rdi_section_block_header_from_section(og_rdi, section, 0);
+  if(hdr != 0)
+  {
+    count = hdr->block_count;
+  }
+  return count;
+}
+
+internal U64
+rdi_decompress_unit_count_from_parsed(RDI_Parsed *og_rdi)
+{
+  U64 count = 0;
+  for(U64 idx = 0; idx < og_rdi->sections_count; idx += 1)
+  {
+    count += rdi_decompress_unit_count_from_section(og_rdi, &og_rdi->sections[idx]);
+  }
+  return count;
+}
+
+internal void
+rdi_decompress_parsed_unit(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi, U64 unit_idx)
+{
+  RDI_Header *dst_header = (RDI_Header *)decompressed_data;
+  RDI_Section *dst_first = (RDI_Section *)(decompressed_data + dst_header->data_section_off);
+  
+  // rjf: map unit index -> section & block
+  U64 section_idx = og_rdi->sections_count;
+  U64 block_idx = 0;
+  {
+    U64 unit_base = 0;
+    for(U64 idx = 0; idx < og_rdi->sections_count; idx += 1)
+    {
+      U64 unit_count = rdi_decompress_unit_count_from_section(og_rdi, &og_rdi->sections[idx]);
+      if(unit_base <= unit_idx && unit_idx < unit_base + unit_count)
+      {
+        section_idx = idx;
+        block_idx = unit_idx - unit_base;
+        break;
+      }
+      unit_base += unit_count;
+    }
+  }
   
-  // rjf: decompress sections into new decompressed file buffer
-  if(og_rdi->sections_count != 0)
+  // rjf: decode unit
+  if(section_idx < og_rdi->sections_count)
+  {
+    RDI_Section *src = &og_rdi->sections[section_idx];
+    RDI_Section *dst = &dst_first[section_idx];
+    if(dst->off + dst->unpacked_size <= decompressed_size)
+    {
+      RDI_U64 *offs = 0;
+      RDI_SectionBlockHeader *hdr = rdi_section_block_header_from_section(og_rdi, src, &offs);
+      if(hdr != 0)
+      {
+        U64 raw_off = block_idx*hdr->block_size;
+        U64 raw_size = Min(hdr->block_size, dst->unpacked_size - raw_off);
+        U64 comp_off = offs[block_idx];
+        U64 comp_opl = offs[block_idx+1];
+        if(comp_off <= comp_opl && comp_opl <= src->encoded_size)
+        {
+          rr_lzb_simple_decode((U8*)og_rdi->raw_data + src->off + comp_off, comp_opl - comp_off,
+                               decompressed_data     + dst->off + raw_off, raw_size);
+        }
+      }
+      else if(src->encoding != RDI_SectionEncoding_LZBBlocks &&
+              src->off + src->encoded_size <= og_rdi->raw_data_size)
+      {
+        rr_lzb_simple_decode((U8*)og_rdi->raw_data + src->off, src->encoded_size,
+                             decompressed_data     + dst->off, dst->unpacked_size);
+      }
+    }
+  }
+}
+
+internal void
+rdi_decompress_parsed(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi)
+{
+  rdi_decompress_parsed_layout(decompressed_data, decompressed_size, og_rdi);
+  U64 unit_count = rdi_decompress_unit_count_from_parsed(og_rdi);
+  for(U64 unit_idx = 0; unit_idx < unit_count; unit_idx += 1)
+  {
+    rdi_decompress_parsed_unit(decompressed_data, decompressed_size, og_rdi, unit_idx);
+  }
+}
+
+RDI_PROC RDI_U64
+rdi_decompress_section_range_scratch_size(RDI_Parsed *og_rdi, RDI_SectionKind kind)
+{
+  RDI_U64 result = 0;
+  if(kind < og_rdi->sections_count)
   {
-    RDI_Section *src_first = og_rdi->sections;
-    RDI_Section *dst_first = (RDI_Section *)(decompressed_data + dst_header->data_section_off);
-    RDI_Section *src_opl = src_first + og_rdi->sections_count;
-    RDI_Section *dst_opl = dst_first + og_rdi->sections_count;
-    for(RDI_Section *src = src_first, *dst = dst_first;
-        src < src_opl && dst < dst_opl;
-        src += 1, dst += 1)
+    RDI_Section *section = &og_rdi->sections[kind];
+    switch(section->encoding)
     {
-      rr_lzb_simple_decode((U8*)og_rdi->raw_data + src->off, src->encoded_size,
-                           decompressed_data     + dst->off, dst->unpacked_size);
+      default:{}break;
+      case RDI_SectionEncoding_LZB:
+      {
+        result = section->unpacked_size;
+      }break;
+      case RDI_SectionEncoding_LZBBlocks:
+      {
+        RDI_SectionBlockHeader *hdr = rdi_section_block_header_from_section(og_rdi, section, 0);
+        if(hdr != 0)
+        {
+          result = Min(hdr->block_size, section->unpacked_size);
+        }
+      }break;
     }
   }
+  return result;
+}
+
+RDI_PROC RDI_S32
+rdi_decompress_section_range(RDI_Parsed *og_rdi, RDI_SectionKind kind, RDI_U64 off, RDI_U64 size, RDI_U8 *dst, RDI_U8 *scratch, RDI_U64 scratch_size)
+{
+  RDI_S32 good = 0;
+  if(kind < og_rdi->sections_count)
+  {
+    RDI_Section *section = &og_rdi->sections[kind];
+    if(off <= section->unpacked_size && size <= section->unpacked_size - off &&
+       section->off + section->encoded_size <= og_rdi->raw_data_size)
+    {
+      RDI_U8 *section_data = og_rdi->raw_data + section->off;
+      RDI_U64 *offs = 0;
+      RDI_SectionBlockHeader *hdr = rdi_section_block_header_from_section(og_rdi, section, &offs);
+      switch(section->encoding)
+      {
+        default:{}break;
+        
+        //- rjf: unpacked -> direct copy
+        case RDI_SectionEncoding_Unpacked:
+        {
+          MemoryCopy(dst, section_data + off, size);
+          good = 1;
+        }break;
+        
+        //- rjf: whole-section LZB -> no random access; decode everything, into
+        // the destination if it covers the whole section, otherwise into scratch
+        case RDI_SectionEncoding_LZB:
+        if(off == 0 && size == section->unpacked_size)
+        {
+          rr_lzb_simple_decode(section_data, section->encoded_size, dst, size);
+          good = 1;
+        }
+        else if(section->unpacked_size <= scratch_size)
+        {
+          rr_lzb_simple_decode(section_data, section->encoded_size, scratch, section->unpacked_size);
+          MemoryCopy(dst, scratch + off, size);
+          good = 1;
+        }break;
+        
+        //- rjf: blocks -> decode only the touched blocks; whole blocks decode
+        // directly into the destination, partial ones go through scratch
+        case RDI_SectionEncoding_LZBBlocks:
+        if(hdr != 0)
+        {
+          good = 1;
+          RDI_U64 opl = off + size;
+          RDI_U64 first_block_idx = off / hdr->block_size;
+          RDI_U64 opl_block_idx = (opl + hdr->block_size - 1) / hdr->block_size;
+          for(RDI_U64 block_idx = first_block_idx; block_idx < opl_block_idx && good; block_idx += 1)
+          {
+            RDI_U64 raw_off = block_idx*hdr->block_size;
+            RDI_U64 raw_size = Min(hdr->block_size, section->unpacked_size - raw_off);
+            RDI_U64 comp_off = offs[block_idx];
+            RDI_U64 comp_opl = offs[block_idx+1];
+            RDI_U64 clamped_off = Max(off, raw_off);
+            RDI_U64 clamped_opl = Min(opl, raw_off + raw_size);
+            RDI_S32 block_is_covered = (clamped_off == raw_off && clamped_opl == raw_off + raw_size);
+            if(comp_off > comp_opl || comp_opl > section->encoded_size ||
+               (!block_is_covered && raw_size > scratch_size))
+            {
+              good = 0;
+            }
+            else if(block_is_covered)
+            {
+              rr_lzb_simple_decode(section_data + comp_off, comp_opl - comp_off, dst + (raw_off - off), raw_size);
+            }
+            else
+            {
+              rr_lzb_simple_decode(section_data + comp_off, comp_opl - comp_off, scratch, raw_size);
+              MemoryCopy(dst + (clamped_off - off), scratch + (clamped_off - raw_off), clamped_opl - clamped_off);
+            }
+          }
+        }break;
+      }
+    }
+  }
+  return good;
 }
 
 //- strings
@@ -637,6 +849,7 @@ RDI_PROC void
 rdi_parsed_from_name_map(RDI_Parsed *rdi, RDI_NameMap *mapptr, RDI_ParsedNameMap *out)
 {
   out->buckets = 0;
+  out->sorted_nodes = 0;
   out->bucket_count = 0;
   if(mapptr != 0)
   {
@@ -644,10 +857,16 @@ rdi_parsed_from_name_map(RDI_Parsed *rdi, RDI_NameMap *mapptr, RDI_ParsedNameMap
     RDI_NameMapBucket *all_buckets = rdi_table_from_name(rdi, NameMapBuckets, &all_buckets_count);
     RDI_U64 all_nodes_count = 0;
     RDI_NameMapNode *all_nodes = rdi_table_from_name(rdi, NameMapNodes, &all_nodes_count);
+    RDI_U64 all_sorted_nodes_count = 0;
+    RDI_U32 *all_sorted_nodes = rdi_table_from_name(rdi, NameMapSortedNodes, &all_sorted_nodes_count);
     out->buckets = all_buckets+mapptr->bucket_base_idx;
     out->nodes = all_nodes+mapptr->node_base_idx;
     out->bucket_count = mapptr->bucket_count;
     out->node_count = mapptr->node_count;
+    if((RDI_U64)mapptr->node_base_idx + mapptr->node_count <= all_sorted_nodes_count)
+    {
+      out->sorted_nodes = all_sorted_nodes+mapptr->node_base_idx;
+    }
     if(mapptr->bucket_base_idx > all_buckets_count)
     {
       out->buckets = 0;
@@ -674,8 +893,15 @@ rdi_name_map_lookup(RDI_Parsed *p, RDI_ParsedNameMap *map, RDI_U8 *str, RDI_U64
     RDI_NameMapBucket *bucket = map->buckets + bucket_index;
     RDI_NameMapNode *node = map->nodes + bucket->first_node;
     RDI_NameMapNode *node_opl = node + bucket->node_count;
+    RDI_U32 hash_lo = (RDI_U32)hash;
     for(;node < node_opl; node += 1)
     {
+      // reject nodes with mismatching hashes, without touching string data
+      if(node->string_hash != hash_lo)
+      {
+        continue;
+      }
+      
       // extract a string from this node
       RDI_U64 nlen = 0;
       RDI_U8 *nstr = rdi_string_from_idx(p, node->string_idx, &nlen);
@@ -703,6 +929,76 @@ rdi_name_map_lookup(RDI_Parsed *p, RDI_ParsedNameMap *map, RDI_U8 *str, RDI_U64
   return result;
 }
 
+RDI_PROC RDI_S32
+rdi_name_map__prefix_compare(RDI_U8 *str, RDI_U64 len, RDI_U8 *prefix, RDI_U64 prefix_len)
+{
+  // NOTE: returns <0 if `str` sorts before all strings with `prefix`, 0 if
+  // `str` begins with `prefix`, and >0 if `str` sorts after all of them.
+  RDI_S32 result = 0;
+  RDI_U64 common_len = rdi_parse__min(len, prefix_len);
+  for(RDI_U64 idx = 0; idx < common_len; idx += 1)
+  {
+    if(str[idx] != prefix[idx])
+    {
+      result = (str[idx] < prefix[idx]) ? -1 : +1;
+      break;
+    }
+  }
+  if(result == 0 && len < prefix_len)
+  {
+    result = -1;
+  }
+  return result;
+}
+
+RDI_PROC RDI_U32 *
+rdi_name_map_sorted_nodes_from_prefix(RDI_Parsed *p, RDI_ParsedNameMap *map, RDI_U8 *prefix, RDI_U64 prefix_len, RDI_U64 *n_out)
+{
+  RDI_U32 *result = 0;
+  RDI_U64 count = 0;
+  if(map->sorted_nodes != 0 && map->node_count != 0)
+  {
+    // find first sorted node with prefix (or after all nodes with prefix)
+    RDI_U64 first = 0;
+    {
+      RDI_U64 lo = 0;
+      RDI_U64 hi = map->node_count;
+      for(;lo < hi;)
+      {
+        RDI_U64 mid = lo + (hi-lo)/2;
+        RDI_U32 node_idx = map->sorted_nodes[mid];
+        RDI_U64 nlen = 0;
+        RDI_U8 *nstr = (node_idx < map->node_count) ? rdi_string_from_idx(p, map->nodes[node_idx].string_idx, &nlen) : 0;
+        if(rdi_name_map__prefix_compare(nstr, nlen, prefix, prefix_len) < 0) { lo = mid+1; }
+        else { hi = mid; }
+      }
+      first = lo;
+    }
+    
+    // find first sorted node after all nodes with prefix
+    RDI_U64 opl = first;
+    {
+      RDI_U64 lo = first;
+      RDI_U64 hi = map->node_count;
+      for(;lo < hi;)
+      {
+        RDI_U64 mid = lo + (hi-lo)/2;
+        RDI_U32 node_idx = map->sorted_nodes[mid];
+        RDI_U64 nlen = 0;
+        RDI_U8 *nstr = (node_idx < map->node_count) ? rdi_string_from_idx(p, map->nodes[node_idx].string_idx, &nlen) : 0;
+        if(rdi_name_map__prefix_compare(nstr, nlen, prefix, prefix_len) <= 0) { lo = mid+1; }
+        else { hi = mid; }
+      }
+      opl = lo;
+    }
+    
+    result = map->sorted_nodes + first;
+    count = opl - first;
+  }
+  *n_out = count;
+  return result;
+}
+
 RDI_PROC RDI_U32*
 rdi_matches_from_map_node(RDI_Parsed *p, RDI_NameMapNode *node, RDI_U32 *n_out)
 {
@@ -99,6 +99,7 @@ struct RDI_ParsedNameMap
 {
   RDI_NameMapBucket *buckets;
   RDI_NameMapNode *nodes;
+  RDI_U32 *sorted_nodes; // [node_count] indices into nodes, sorted by name; 0 if not present
   RDI_U64 bucket_count;
   RDI_U64 node_count;
 };
@@ -152,7 +153,14 @@ RDI_PROC void *rdi_section_raw_element_from_kind_idx(RDI_Parsed *rdi, RDI_Sectio
 RDI_PROC RDI_U64 rdi_decompressed_size_from_parsed(RDI_Parsed *rdi);
 
 //- decompression
+internal void rdi_decompress_parsed_layout(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi);
+internal RDI_SectionBlockHeader *rdi_section_block_header_from_section(RDI_Parsed *og_rdi, RDI_Section *section, RDI_U64 **offs_out);
+internal U64 rdi_decompress_unit_count_from_section(RDI_Parsed *og_rdi, RDI_Section *section);
+internal U64 rdi_decompress_unit_count_from_parsed(RDI_Parsed *og_rdi);
+internal void rdi_decompress_parsed_unit(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi, U64 unit_idx);
 internal void rdi_decompress_parsed(U8 *decompressed_data, U64 decompressed_size, RDI_Parsed *og_rdi);
+RDI_PROC RDI_U64 rdi_decompress_section_range_scratch_size(RDI_Parsed *og_rdi, RDI_SectionKind kind);
+RDI_PROC RDI_S32 rdi_decompress_section_range(RDI_Parsed *og_rdi, RDI_SectionKind kind, RDI_U64 off, RDI_U64 size, RDI_U8 *dst, RDI_U8 *scratch, RDI_U64 scratch_size);
 
 //- strings
 RDI_PROC RDI_U8 *rdi_string_from_idx(RDI_Parsed *rdi, RDI_U32 idx, RDI_U64 *len_out);
@@ -175,6 +183,7 @@ RDI_PROC RDI_NameMap *rdi_name_map_from_kind(RDI_Parsed *p, RDI_NameMapKind kind
 RDI_PROC void rdi_name_map_parse(RDI_Parsed* p, RDI_NameMap *mapptr, RDI_ParsedNameMap *out);
 RDI_PROC RDI_NameMapNode *rdi_name_map_lookup(RDI_Parsed *p, RDI_ParsedNameMap *map, RDI_U8 *str, RDI_U64 len);
 RDI_PROC RDI_U32 *rdi_matches_from_map_node(RDI_Parsed *p, RDI_NameMapNode *node, RDI_U32 *n_out);
+RDI_PROC RDI_U32 *rdi_name_map_sorted_nodes_from_prefix(RDI_Parsed *p, RDI_ParsedNameMap *map, RDI_U8 *prefix, RDI_U64 prefix_len, RDI_U64 *n_out);
 
 ////////////////////////////////
 //~ High-Level Composite Lookup Functions
@@ -1400,6 +1400,15 @@ rdim_bake_string_map_loose_insert(RDIM_Arena *arena, RDIM_BakeStringMapTopology
   if(string.RDIM_String8_SizeMember != 0)
   {
     RDI_U64 hash = rdi_hash(string.RDIM_String8_BaseMember, string.RDIM_String8_SizeMember);
+    rdim_bake_string_map_loose_insert_hashed(arena, map_topology, map, chunk_cap, string, hash);
+  }
+}
+
+RDI_PROC void
+rdim_bake_string_map_loose_insert_hashed(RDIM_Arena *arena, RDIM_BakeStringMapTopology *map_topology, RDIM_BakeStringMapLoose *map, RDI_U64 chunk_cap, RDIM_String8 string, RDI_U64 hash)
+{
+  if(string.RDIM_String8_SizeMember != 0)
+  {
     RDI_U64 slot_idx = hash%map_topology->slots_count;
     RDIM_BakeStringChunkList *slot = map->slots[slot_idx];
     if(slot == 0)
@@ -1411,7 +1420,7 @@ rdim_bake_string_map_loose_insert(RDIM_Arena *arena, RDIM_BakeStringMapTopology
     {
       for(RDI_U64 idx = 0; idx < n->count; idx += 1)
       {
-        if(rdim_str8_match(n->v[idx].string, string, 0))
+        if(n->v[idx].hash == hash && rdim_str8_match(n->v[idx].string, string, 0))
         {
           is_duplicate = 1;
           goto break_all;
@@ -1863,6 +1872,15 @@ rdim_bake_name_map_insert(RDIM_Arena *arena, RDIM_BakeNameMapTopology *map_topol
   if(string.RDIM_String8_SizeMember != 0)
   {
     RDI_U64 hash = rdi_hash(string.RDIM_String8_BaseMember, string.RDIM_String8_SizeMember);
+    rdim_bake_name_map_insert_hashed(arena, map_topology, map, chunk_cap, string, hash, idx);
+  }
+}
+
+RDI_PROC void
+rdim_bake_name_map_insert_hashed(RDIM_Arena *arena, RDIM_BakeNameMapTopology *map_topology, RDIM_BakeNameMap *map, RDI_U64 chunk_cap, RDIM_String8 string, RDI_U64 hash, RDI_U64 idx)
+{
+  if(string.RDIM_String8_SizeMember != 0)
+  {
     RDI_U64 slot_idx = hash%map_topology->slots_count;
     RDIM_BakeNameChunkList *slot = map->slots[slot_idx];
     if(slot == 0)
@@ -1872,10 +1890,11 @@ rdim_bake_name_map_insert(RDIM_Arena *arena, RDIM_BakeNameMapTopology *map_topol
     RDI_S32 is_duplicate = 0;
     for(RDIM_BakeNameChunkNode *n = slot->first; n != 0; n = n->next)
     {
-      for(RDI_U64 idx = 0; idx < n->count; idx += 1)
+      for(RDI_U64 n_idx = 0; n_idx < n->count; n_idx += 1)
       {
-        if(rdim_str8_match(n->v[idx].string, string, 0) &&
-           n->v[idx].idx == idx)
+        if(n->v[n_idx].idx == idx &&
+           n->v[n_idx].hash == hash &&
+           rdim_str8_match(n->v[n_idx].string, string, 0))
         {
           is_duplicate = 1;
           goto break_all;
@@ -2172,6 +2191,8 @@ rdim_serialized_section_bundle_from_bake_results(RDIM_BakeResults *results)
   bundle.sections[RDI_SectionKind_NameMaps]             = rdim_serialized_section_make_unpacked_array(results->top_level_name_maps.name_maps, results->top_level_name_maps.name_maps_count);
   bundle.sections[RDI_SectionKind_NameMapBuckets]       = rdim_serialized_section_make_unpacked_array(results->name_maps.buckets, results->name_maps.buckets_count);
   bundle.sections[RDI_SectionKind_NameMapNodes]         = rdim_serialized_section_make_unpacked_array(results->name_maps.nodes, results->name_maps.nodes_count);
+  bundle.sections[RDI_SectionKind_NameMapSortedNodes]   = rdim_serialized_section_make_unpacked_array(results->name_maps.sorted_nodes, results->name_maps.sorted_nodes ? results->name_maps.nodes_count : 0);
+  bundle.sections[RDI_SectionKind_LineTableInputHashes] = rdim_serialized_section_make_unpacked_array(results->line_tables.line_table_input_hashes, results->line_tables.line_table_input_hashes ? results->line_tables.line_tables_count : 0);
   return bundle;
 }
 
@@ -1347,6 +1347,7 @@ struct RDIM_LineTableBakeResult
   RDI_U64 line_table_lines_count;
   RDI_Column *line_table_columns;
   RDI_U64 line_table_columns_count;
+  RDI_U64 *line_table_input_hashes; // [line_tables_count]
 };
 
 typedef struct RDIM_TypeNodeBakeResult RDIM_TypeNodeBakeResult;
@@ -1457,6 +1458,7 @@ struct RDIM_NameMapBakeResult
   RDI_U64 buckets_count;
   RDI_NameMapNode *nodes;
   RDI_U64 nodes_count;
+  RDI_U32 *sorted_nodes; // [nodes_count]
 };
 
 typedef struct RDIM_FilePathBakeResult RDIM_FilePathBakeResult;
@@ -1698,6 +1700,7 @@ RDI_PROC RDIM_BakeStringChunkList rdim_bake_string_chunk_list_sorted_from_unsort
 //- rjf: loose map
 RDI_PROC RDIM_BakeStringMapLoose *rdim_bake_string_map_loose_make(RDIM_Arena *arena, RDIM_BakeStringMapTopology *top);
 RDI_PROC void rdim_bake_string_map_loose_insert(RDIM_Arena *arena, RDIM_BakeStringMapTopology *map_topology, RDIM_BakeStringMapLoose *map, RDI_U64 chunk_cap, RDIM_String8 string);
+RDI_PROC void rdim_bake_string_map_loose_insert_hashed(RDIM_Arena *arena, RDIM_BakeStringMapTopology *map_topology, RDIM_BakeStringMapLoose *map, RDI_U64 chunk_cap, RDIM_String8 string, RDI_U64 hash);
 RDI_PROC RDIM_BakeStringMapBaseIndices rdim_bake_string_map_base_indices_from_map_loose(RDIM_Arena *arena, RDIM_BakeStringMapTopology *map_topology, RDIM_BakeStringMapLoose *map);
 
 //- rjf: finalized / tight map
@@ -1732,6 +1735,7 @@ RDI_PROC RDIM_BakeNameChunkList rdim_bake_name_chunk_list_sorted_from_unsorted(R
 //- rjf: bake name chunk list maps
 RDI_PROC RDIM_BakeNameMap *rdim_bake_name_map_make(RDIM_Arena *arena, RDIM_BakeNameMapTopology *top);
 RDI_PROC void rdim_bake_name_map_insert(RDIM_Arena *arena, RDIM_BakeNameMapTopology *map_topology, RDIM_BakeNameMap *map, RDI_U64 chunk_cap, RDIM_String8 string, RDI_U64 idx);
+RDI_PROC void rdim_bake_name_map_insert_hashed(RDIM_Arena *arena, RDIM_BakeNameMapTopology *map_topology, RDIM_BakeNameMap *map, RDI_U64 chunk_cap, RDIM_String8 string, RDI_U64 hash, RDI_U64 idx);
 
 ////////////////////////////////
 //~ rjf: [Baking Helpers] Deduplicated Path Baking Tree
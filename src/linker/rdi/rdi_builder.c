@@ -4396,6 +4396,7 @@ THREAD_POOL_TASK_FUNC(rdib_build_name_map_task)
 
       RDI_NameMapNode *dst_node = &out_nodes[node_cursor];
       dst_node->string_idx      = rdib_idx_from_string_map(task->string_map, src_name->string);
+      dst_node->string_hash     = (U32)rdi_hash(src_name->string.str, src_name->string.size);
       dst_node->match_count     = src_name->count;
       if (src_name->count > 1) {
         dst_node->match_idx_or_idx_run_first = task->idx_run_map->buckets[src_name->idx_run_bucket_idx]->index_in_output_array;
@@ -273,6 +273,49 @@ msf_data_from_stream_number(Arena *arena, String8 msf_data, MSF_RawStreamTable *
   return result;
 }
 
+internal B32
+msf_stream_number_is_contiguous(String8 msf_data, MSF_RawStreamTable *st, MSF_StreamNumber sn)
+{
+  B32 result = 0;
+  if(sn < st->stream_count)
+  {
+    MSF_RawStream stream = st->streams[sn];
+    result = 1;
+    U64 first_page_idx = 0;
+    for(U64 i = 0; i < stream.page_count; i += 1)
+    {
+      U64 page_idx = (st->index_size == 4 ? stream.u.page_indices_u32[i] : stream.u.page_indices_u16[i]);
+      if(i == 0)
+      {
+        first_page_idx = page_idx;
+      }
+      else if(page_idx != first_page_idx + i)
+      {
+        result = 0;
+        break;
+      }
+    }
+    if(result && stream.page_count != 0 && first_page_idx*st->page_size + stream.size > msf_data.size)
+    {
+      result = 0;
+    }
+  }
+  return result;
+}
+
+internal String8
+msf_view_from_stream_number(String8 msf_data, MSF_RawStreamTable *st, MSF_StreamNumber sn)
+{
+  String8 result = {0};
+  if(msf_stream_number_is_contiguous(msf_data, st, sn) && st->streams[sn].page_count != 0)
+  {
+    MSF_RawStream stream = st->streams[sn];
+    U64 first_page_idx = (st->index_size == 4 ? stream.u.page_indices_u32[0] : stream.u.page_indices_u16[0]);
+    result = str8(msf_data.str + first_page_idx*st->page_size, stream.size);
+  }
+  return result;
+}
+
 internal MSF_Parsed *
 msf_parsed_from_data(Arena *arena, String8 msf_data)
 {
@@ -298,12 +341,102 @@ msf_parsed_from_data(Arena *arena, String8 msf_data)
   return result;
 }
 
+internal MSF_Parsed *
+msf_parsed_lazy_from_data(Arena *arena, String8 msf_data)
+{
+  ProfBeginFunction();
+  MSF_Parsed *result = 0;
+  MSF_RawStreamTable *st = msf_raw_stream_table_from_data(arena, msf_data);
+  if(st)
+  {
+    result = push_array(arena, MSF_Parsed, 1);
+    result->streams           = push_array(arena, String8, st->stream_count);
+    result->stream_count      = st->stream_count;
+    result->page_size         = st->page_size;
+    result->page_count        = st->total_page_count;
+    result->msf_data          = msf_data;
+    result->raw_stream_table  = st;
+    result->stream_states     = push_array(arena, U64, st->stream_count);
+    result->lane_arenas_count = Max(1, lane_count());
+    result->lane_arenas       = push_array(arena, Arena *, result->lane_arenas_count);
+    result->mutex             = mutex_alloc();
+    result->cv                = cond_var_alloc();
+    
+    // rjf: contiguous streams need no materialization - just point into the
+    // msf data directly
+    for(MSF_StreamNumber sn = 0; sn < st->stream_count; sn += 1)
+    {
+      if(msf_stream_number_is_contiguous(msf_data, st, sn))
+      {
+        result->streams[sn] = msf_view_from_stream_number(msf_data, st, sn);
+        result->stream_states[sn] = MSF_StreamState_Ready;
+      }
+    }
+  }
+  ProfEnd();
+  return result;
+}
+
+internal void
+msf_parsed_lazy_equip_lane_arena(MSF_Parsed *msf, Arena *arena)
+{
+  if(msf != 0 && msf->lane_arenas != 0 && lane_idx() < msf->lane_arenas_count)
+  {
+    msf->lane_arenas[lane_idx()] = arena;
+  }
+}
+
+internal void
+msf_parsed_lazy_release(MSF_Parsed *msf)
+{
+  if(msf != 0 && msf->stream_states != 0)
+  {
+    mutex_release(msf->mutex);
+    cond_var_release(msf->cv);
+  }
+}
+
 internal String8
 msf_data_from_stream(MSF_Parsed *msf, MSF_StreamNumber sn)
 {
   String8 result = {0};
   if(sn < msf->stream_count)
   {
+    //- rjf: lazily-parsed MSF, stream not yet ready -> materialize it on this
+    // lane, or wait for whichever lane got to it first
+    if(msf->stream_states != 0 && ins_atomic_u64_eval(&msf->stream_states[sn]) != MSF_StreamState_Ready)
+    {
+      Arena *arena = (lane_idx() < msf->lane_arenas_count ? msf->lane_arenas[lane_idx()] : 0);
+      B32 is_owner = 0;
+      MutexScope(msf->mutex)
+      {
+        for(;;)
+        {
+          U64 state = msf->stream_states[sn];
+          if(state == MSF_StreamState_Unmaterialized && arena != 0)
+          {
+            msf->stream_states[sn] = MSF_StreamState_Materializing;
+            is_owner = 1;
+            break;
+          }
+          if(state != MSF_StreamState_Materializing)
+          {
+            break;
+          }
+          cond_var_wait(msf->cv, msf->mutex, max_U64);
+        }
+      }
+      if(is_owner)
+      {
+        String8 data = msf_data_from_stream_number(arena, msf->msf_data, msf->raw_stream_table, sn);
+        MutexScope(msf->mutex)
+        {
+          msf->streams[sn] = data;
+          ins_atomic_u64_eval_assign(&msf->stream_states[sn], MSF_StreamState_Ready);
+        }
+        cond_var_broadcast(msf->cv);
+      }
+    }
     result = msf->streams[sn];
   }
   return(result);
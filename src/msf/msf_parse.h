@@ -28,6 +28,14 @@ struct MSF_RawStreamTable
   MSF_RawStream *streams;
 };
 
+typedef enum MSF_StreamState
+{
+  MSF_StreamState_Unmaterialized,
+  MSF_StreamState_Materializing,
+  MSF_StreamState_Ready,
+}
+MSF_StreamState;
+
 typedef struct MSF_Parsed MSF_Parsed;
 struct MSF_Parsed
 {
@@ -35,6 +43,18 @@ struct MSF_Parsed
   U64      stream_count;
   U64      page_size;
   U64      page_count;
+  
+  // rjf: lazy materialization state - only used for `MSF_Parsed`s produced
+  // by `msf_parsed_lazy_from_data`. contiguous streams are zero-copy views
+  // into `msf_data`, and are ready immediately; fragmented streams are
+  // materialized into the requesting lane's arena on first access.
+  String8             msf_data;
+  MSF_RawStreamTable *raw_stream_table;
+  U64                *stream_states;
+  Arena             **lane_arenas;
+  U64                 lane_arenas_count;
+  Mutex               mutex;
+  CondVar             cv;
 };
 
 ////////////////////////////////
@@ -42,7 +62,12 @@ struct MSF_Parsed
 
 internal MSF_RawStreamTable* msf_raw_stream_table_from_data(Arena *arena, String8 msf_data);
 internal String8             msf_data_from_stream_number(Arena *arena, String8 msf_data, MSF_RawStreamTable *st, MSF_StreamNumber sn);
+internal B32                 msf_stream_number_is_contiguous(String8 msf_data, MSF_RawStreamTable *st, MSF_StreamNumber sn);
+internal String8             msf_view_from_stream_number(String8 msf_data, MSF_RawStreamTable *st, MSF_StreamNumber sn);
 internal MSF_Parsed*         msf_parsed_from_data(Arena *arena, String8 msf_data);
+internal MSF_Parsed*         msf_parsed_lazy_from_data(Arena *arena, String8 msf_data);
+internal void                msf_parsed_lazy_equip_lane_arena(MSF_Parsed *msf, Arena *arena);
+internal void                msf_parsed_lazy_release(MSF_Parsed *msf);
 internal String8             msf_data_from_stream(MSF_Parsed *msf, MSF_StreamNumber sn);
 
 #endif // MSF_PARSE_H
@@ -168,6 +168,18 @@ os_get_process_start_time_unix(void)
   return (U32)start_time;
 }
 
+internal U64
+os_get_process_peak_memory_usage(void)
+{
+  U64 result = 0;
+  struct rusage usage = {0};
+  if(getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+    result = (U64)usage.ru_maxrss * KB(1);
+  }
+  return result;
+}
+
 ////////////////////////////////
 //~ rjf: @os_hooks Memory Allocation (Implemented Per-OS)
 
@@ -1039,6 +1051,23 @@ os_rw_mutex_take(RWMutex rw_mutex, B32 write_mode)
   }
 }
 
+internal B32
+os_rw_mutex_try_take(RWMutex rw_mutex, B32 write_mode)
+{
+  if(MemoryIsZeroStruct(&rw_mutex)) { return 1; }
+  OS_LNX_Entity *entity = (OS_LNX_Entity *)rw_mutex.u64[0];
+  int result = 0;
+  if(write_mode)
+  {
+    result = pthread_rwlock_trywrlock(&entity->rwmutex_handle);
+  }
+  else
+  {
+    result = pthread_rwlock_tryrdlock(&entity->rwmutex_handle);
+  }
+  return (result == 0);
+}
+
 internal void
 os_rw_mutex_drop(RWMutex rw_mutex, B32 write_mode)
 {
@@ -161,6 +161,7 @@ internal OS_SystemInfo  *os_get_system_info(void);
 internal OS_ProcessInfo *os_get_process_info(void);
 internal String8         os_get_current_path(Arena *arena);
 internal U32             os_get_process_start_time_unix(void);
+internal U64             os_get_process_peak_memory_usage(void);
 
 ////////////////////////////////
 //~ rjf: @os_hooks Memory Allocation (Implemented Per-OS)
@@ -268,6 +269,7 @@ internal void  os_mutex_drop(Mutex mutex);
 internal RWMutex os_rw_mutex_alloc(void);
 internal void    os_rw_mutex_release(RWMutex mutex);
 internal void    os_rw_mutex_take(RWMutex mutex, B32 write_mode);
+internal B32     os_rw_mutex_try_take(RWMutex mutex, B32 write_mode);
 internal void    os_rw_mutex_drop(RWMutex mutex, B32 write_mode);
 
 //- rjf: condition variables
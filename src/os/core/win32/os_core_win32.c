@@ -192,6 +192,19 @@ os_get_process_start_time_unix(void)
   return 0;
 }
 
+internal U64
+os_get_process_peak_memory_usage(void)
+{
+  U64 result = 0;
+  PROCESS_MEMORY_COUNTERS counters = {0};
+  counters.cb = sizeof(counters);
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    result = counters.PeakWorkingSetSize;
+  }
+  return result;
+}
+
 ////////////////////////////////
 //~ rjf: @os_hooks Memory Allocation (Implemented Per-OS)
 
@@ -1206,6 +1219,22 @@ os_rw_mutex_take(RWMutex rw_mutex, B32 write_mode)
   }
 }
 
+internal B32
+os_rw_mutex_try_take(RWMutex rw_mutex, B32 write_mode)
+{
+  OS_W32_Entity *entity = (OS_W32_Entity*)PtrFromInt(rw_mutex.u64[0]);
+  B32 result = 0;
+  if(write_mode)
+  {
+    result = !!TryAcquireSRWLockExclusive(&entity->rw_mutex);
+  }
+  else
+  {
+    result = !!TryAcquireSRWLockShared(&entity->rw_mutex);
+  }
+  return result;
+}
+
 internal void
 os_rw_mutex_drop(RWMutex rw_mutex, B32 write_mode)
 {
@@ -15,6 +15,7 @@
 #include <tlhelp32.h>
 #include <Shlobj.h>
 #include <processthreadsapi.h>
+#include <psapi.h>
 #pragma comment(lib, "user32")
 #pragma comment(lib, "winmm")
 #pragma comment(lib, "shell32")
@@ -23,6 +24,7 @@
 #pragma comment(lib, "shlwapi")
 #pragma comment(lib, "comctl32")
 #pragma comment(lib, "ws2_32")
+#pragma comment(lib, "psapi")
 #pragma comment(linker,"\"/manifestdependency:type='win32' name='Microsoft.Windows.Common-Controls' version='6.0.0.0' processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"") // this is required for loading correct comctl32 dll file
 
 ////////////////////////////////
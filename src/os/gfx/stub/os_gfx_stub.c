@@ -4,6 +4,40 @@
 internal void
 os_gfx_init(void)
 {
+  Arena *arena = arena_alloc();
+  os_stub_gfx_state = push_array(arena, OS_StubGfxState, 1);
+  os_stub_gfx_state->arena = arena;
+  os_stub_gfx_state->events_arena = arena_alloc();
+  os_stub_gfx_state->client_rect = r2f32p(0, 0, 500, 500);
+}
+
+////////////////////////////////
+//~ rjf: Stub Driving API
+
+internal void
+os_stub_push_event(OS_Event *event)
+{
+  OS_Event *dst = push_array(os_stub_gfx_state->events_arena, OS_Event, 1);
+  MemoryCopyStruct(dst, event);
+  dst->strings = str8_list_copy(os_stub_gfx_state->events_arena, &event->strings);
+  if(dst->timestamp_us == 0)
+  {
+    dst->timestamp_us = os_now_microseconds();
+  }
+  DLLPushBack(os_stub_gfx_state->events.first, os_stub_gfx_state->events.last, dst);
+  os_stub_gfx_state->events.count += 1;
+}
+
+internal void
+os_stub_set_client_rect(Rng2F32 rect)
+{
+  os_stub_gfx_state->client_rect = rect;
+}
+
+internal void
+os_stub_set_windows_focused(B32 focused)
+{
+  os_stub_gfx_state->windows_focused = focused;
 }
 
 ////////////////////////////////
@@ -13,6 +47,9 @@ internal OS_GfxInfo *
 os_get_gfx_info(void)
 {
   local_persist OS_GfxInfo g = {0};
+  g.double_click_time    = 0.5f;
+  g.caret_blink_time     = 0.5f;
+  g.default_refresh_rate = 60.f;
   return &g;
 }
 
@@ -63,7 +100,7 @@ os_window_focus(OS_Handle window)
 internal B32
 os_window_is_focused(OS_Handle window)
 {
-  return 0;
+  return os_stub_gfx_state->windows_focused;
 }
 
 internal B32
@@ -132,14 +169,14 @@ os_window_push_custom_title_bar_client_area(OS_Handle handle, Rng2F32 rect)
 internal Rng2F32
 os_rect_from_window(OS_Handle window)
 {
-  Rng2F32 rect = r2f32(v2f32(0, 0), v2f32(500, 500));
+  Rng2F32 rect = os_stub_gfx_state->client_rect;
   return rect;
 }
 
 internal Rng2F32
 os_client_rect_from_window(OS_Handle window)
 {
-  Rng2F32 rect = r2f32(v2f32(0, 0), v2f32(500, 500));
+  Rng2F32 rect = os_stub_gfx_state->client_rect;
   return rect;
 }
 
@@ -220,7 +257,16 @@ os_send_wakeup_event(void)
 internal OS_EventList
 os_get_events(Arena *arena, B32 wait)
 {
-  OS_EventList evts = {0};
+  OS_EventList evts = os_event_list_copy(arena, &os_stub_gfx_state->events);
+  for(OS_Event *e = evts.first; e != 0; e = e->next)
+  {
+    if(e->kind == OS_EventKind_MouseMove)
+    {
+      os_stub_gfx_state->mouse = e->pos;
+    }
+  }
+  MemoryZeroStruct(&os_stub_gfx_state->events);
+  arena_clear(os_stub_gfx_state->events_arena);
   return evts;
 }
 
@@ -240,7 +286,7 @@ os_key_is_down(OS_Key key)
 internal Vec2F32
 os_mouse_from_window(OS_Handle window)
 {
-  return v2f32(0, 0);
+  return os_stub_gfx_state->mouse;
 }
 
 ////////////////////////////////
@@ -4,4 +4,36 @@
 #ifndef OS_GFX_STUB_H
 #define OS_GFX_STUB_H
 
+////////////////////////////////
+//~ rjf: Stub State
+//
+// There is no windowing system behind the stub backend, but it can still be
+// driven by a headless harness (e.g. the UI benchmark). Events are queued with
+// `os_stub_push_event`, and are handed out by the next `os_get_events`. All
+// windows share one client rectangle, one focus state, and one mouse position,
+// which follows queued mouse events.
+
+typedef struct OS_StubGfxState OS_StubGfxState;
+struct OS_StubGfxState
+{
+  Arena *arena;
+  Arena *events_arena;
+  OS_EventList events;
+  Rng2F32 client_rect;
+  Vec2F32 mouse;
+  B32 windows_focused;
+};
+
+////////////////////////////////
+//~ rjf: Globals
+
+global OS_StubGfxState *os_stub_gfx_state = 0;
+
+////////////////////////////////
+//~ rjf: Stub Driving API
+
+internal void os_stub_push_event(OS_Event *event);
+internal void os_stub_set_client_rect(Rng2F32 rect);
+internal void os_stub_set_windows_focused(B32 focused);
+
 #endif // OS_GFX_STUB_H
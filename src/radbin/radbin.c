@@ -6,6 +6,79 @@
 
 #include "radbin/generated/radbin.meta.c"
 
+////////////////////////////////
+//~ rjf: Perf Stats
+
+internal String8List
+rb_perf_stats_json_from_run(Arena *arena, U64 threads_count, U64 wall_us)
+{
+  String8List strings = {0};
+  str8_list_pushf(arena, &strings, "{\"threads\": %I64u, \"wall_us\": %I64u, \"peak_memory\": %I64u, \"zones\": [", threads_count, wall_us, os_get_process_peak_memory_usage());
+#if PROFILE_STATS
+  {
+    Temp scratch = scratch_begin(&arena, 1);
+    
+    //- rjf: merge all threads' zones, by name pointer; also track the largest
+    // per-thread total for each zone, which approximates its wall time when
+    // the zone runs on all lanes
+    typedef struct RB_PerfZone RB_PerfZone;
+    struct RB_PerfZone
+    {
+      char *name;
+      U64 hit_count;
+      U64 total_us;
+      U64 max_us;
+      U64 max_thread_total_us;
+    };
+    U64 zones_cap = PROF_STATS_ZONES_CAP*2;
+    RB_PerfZone *zones = push_array(scratch.arena, RB_PerfZone, zones_cap);
+    for(ProfStatsThread *t = prof_stats_first_thread; t != 0; t = t->next)
+    {
+      for EachElement(idx, t->zones)
+      {
+        ProfStatsZone *src = &t->zones[idx];
+        if(src->name == 0 || src->hit_count == 0)
+        {
+          continue;
+        }
+        U64 hash = ((U64)src->name >> 3) * 0x9e3779b97f4a7c15ull;
+        for EachIndex(probe_idx, zones_cap)
+        {
+          RB_PerfZone *dst = &zones[(hash + probe_idx) % zones_cap];
+          if(dst->name == src->name || dst->name == 0)
+          {
+            dst->name = src->name;
+            dst->hit_count += src->hit_count;
+            dst->total_us += src->total_us;
+            dst->max_us = Max(dst->max_us, src->max_us);
+            dst->max_thread_total_us = Max(dst->max_thread_total_us, src->total_us);
+            break;
+          }
+        }
+      }
+    }
+    
+    //- rjf: emit
+    B32 first = 1;
+    for EachIndex(idx, zones_cap)
+    {
+      RB_PerfZone *zone = &zones[idx];
+      if(zone->name != 0)
+      {
+        String8 name_escaped = escaped_from_raw_str8(scratch.arena, str8_cstring(zone->name));
+        str8_list_pushf(arena, &strings, "%s\n  {\"name\": \"%S\", \"hits\": %I64u, \"total_us\": %I64u, \"max_us\": %I64u, \"max_thread_total_us\": %I64u}",
+                        first ? "" : ",",
+                        name_escaped, zone->hit_count, zone->total_us, zone->max_us, zone->max_thread_total_us);
+        first = 0;
+      }
+    }
+    scratch_end(scratch);
+  }
+#endif
+  str8_list_pushf(arena, &strings, "]}\n");
+  return strings;
+}
+
 ////////////////////////////////
 //~ rjf: Top-Level Entry Points
 
@@ -13,6 +86,7 @@ internal void
 rb_entry_point(CmdLine *cmdline)
 {
   Temp scratch = scratch_begin(0, 0);
+  U64 start_us = os_now_microseconds();
   U64 threads_count = os_get_system_info()->logical_processor_count;
   String8 threads_count_from_cmdline_string = cmd_line_string(cmdline, str8_lit("thread_count"));
   if(threads_count_from_cmdline_string.size != 0)
@@ -40,6 +114,15 @@ rb_entry_point(CmdLine *cmdline)
   {
     thread_join(threads[idx], max_U64);
   }
+  
+  //- rjf: write perf stats, if requested
+  String8 perf_stats_path = cmd_line_string(cmdline, str8_lit("perf_stats"));
+  if(perf_stats_path.size != 0)
+  {
+    U64 end_us = os_now_microseconds();
+    String8List perf_stats = rb_perf_stats_json_from_run(scratch.arena, threads_count, end_us - start_us);
+    os_write_data_list_to_file_path(perf_stats_path, perf_stats);
+  }
   scratch_end(scratch);
 }
 
@@ -477,6 +560,7 @@ rb_thread_entry_point(void *p)
   //- rjf: perform operation based on output kind
   //
   String8List output_blobs = {0};
+  B32 output_streamed = 0;
   switch(output_kind)
   {
     ////////////////////////////
@@ -530,6 +614,10 @@ rb_thread_entry_point(void *p)
       
       fprintf(stderr, "--verbose        Outputs all log information collected during execution.\n\n");
       
+      fprintf(stderr, "--perf_stats:<path>\n");
+      fprintf(stderr, "                 Writes wall time, peak memory usage, and (in builds with\n");
+      fprintf(stderr, "                 PROFILE_STATS) per-profile-zone timings, as JSON.\n\n");
+      
       fprintf(stderr, "There are also operation-specific arguments. To see them, run this binary with\n");
       fprintf(stderr, "the operation selected, with no additional inputs (e.g. `radbin --rdi`).\n\n");
     }break;
@@ -550,6 +638,14 @@ rb_thread_entry_point(void *p)
           
           fprintf(stderr, "--compress                       Compresses the RDI file's contents.\n");
           fprintf(stderr, "\n");
+          fprintf(stderr, "--stream                         Writes each part of the RDI file as soon as it\n");
+          fprintf(stderr, "                                 is baked, rather than building the whole file\n");
+          fprintf(stderr, "                                 in memory first. Lowers peak memory usage.\n");
+          fprintf(stderr, "\n");
+          fprintf(stderr, "--incremental[:<path>]           Reuses line info for unchanged units from a\n");
+          fprintf(stderr, "                                 previously-generated RDI - by default, the\n");
+          fprintf(stderr, "                                 file already at the output path.\n");
+          fprintf(stderr, "\n");
           fprintf(stderr, "--only:<comma delimited names>   Specifies that only the named subsets of debug\n");
           fprintf(stderr, "                                 information should be generated. See below for\n");
           fprintf(stderr, "                                 a list of valid debug info subset names.\n");
@@ -779,11 +875,105 @@ rb_thread_entry_point(void *p)
         log_user_errorf("Could not load debug info from the specified inputs. You must provide either a valid PDB file or an executable image (PE, ELF) file with DWARF debug info.");
       }
       
+      //- rjf: incremental? -> map & parse the previous RDI, so that unchanged parts
+      // can be reused by the baker
+      typedef struct RB_PrevRDI RB_PrevRDI;
+      struct RB_PrevRDI
+      {
+        OS_Handle file;
+        OS_Handle map;
+        void *base;
+        Rng1U64 range;
+        RDI_Parsed rdi;
+        B32 good;
+      };
+      RB_PrevRDI *prev = 0;
+      if(lane_idx() == 0)
+      {
+        prev = push_array(arena, RB_PrevRDI, 1);
+        String8 prev_path = cmd_line_string(cmdline, str8_lit("incremental"));
+        if(prev_path.size == 0 && cmd_line_has_flag(cmdline, str8_lit("incremental")))
+        {
+          prev_path = output_path;
+        }
+        if(prev_path.size != 0 && output_kind == OutputKind_RDI) ProfScope("map & parse previous RDI")
+        {
+          prev->file = os_file_open(OS_AccessFlag_Read|OS_AccessFlag_ShareRead, prev_path);
+          FileProperties props = os_properties_from_file(prev->file);
+          if(props.size != 0)
+          {
+            prev->map = os_file_map_open(OS_AccessFlag_Read, prev->file);
+            prev->range = r1u64(0, props.size);
+            prev->base = os_file_map_view_open(prev->map, OS_AccessFlag_Read, prev->range);
+          }
+          if(prev->base != 0 && rdi_parse((U8 *)prev->base, props.size, &prev->rdi) == RDI_ParseStatus_Good)
+          {
+            U64 decompressed_size = rdi_decompressed_size_from_parsed(&prev->rdi);
+            prev->good = 1;
+            if(decompressed_size > props.size)
+            {
+              U8 *decompressed_data = push_array_no_zero(arena, U8, decompressed_size);
+              rdi_decompress_parsed(decompressed_data, decompressed_size, &prev->rdi);
+              prev->good = (rdi_parse(decompressed_data, decompressed_size, &prev->rdi) == RDI_ParseStatus_Good);
+            }
+          }
+          if(prev->good)
+          {
+            log_infof("Incremental; reusing unchanged line info from %S\n", prev_path);
+          }
+          else
+          {
+            log_infof("Incremental; could not use %S as a previous RDI, doing a full build\n", prev_path);
+          }
+        }
+      }
+      lane_sync_u64(&prev, 0);
+      
+      //- rjf: streaming? -> open the output for section-by-section writing,
+      // so that each bake stage's sections are written & released as soon as
+      // they're done, rather than holding the whole file in memory. this goes
+      // to a temporary path, since the previous RDI may still be mapped.
+      RDIM_SectionStream *stream = 0;
+      String8 stream_path = {0};
+      if(convert_done && output_kind == OutputKind_RDI && output_path.size != 0 && cmd_line_has_flag(cmdline, str8_lit("stream")))
+      {
+        stream_path = push_str8f(arena, "%S.stream_tmp", output_path);
+        if(lane_idx() == 0)
+        {
+          stream = rdim_section_stream_begin(arena, stream_path, cmd_line_has_flag(cmdline, str8_lit("compress")));
+          if(stream == 0)
+          {
+            log_user_errorf("ERROR: failed to open %S for streaming; writing in one piece instead\n", stream_path);
+          }
+        }
+        lane_sync_u64(&stream, 0);
+      }
+      
       //- rjf: bake
       RDIM_BakeResults bake_results = {0};
       ProfScope("bake")
       {
-        bake_results = rdim_bake(arena, bake_params);
+        bake_results = rdim_bake(arena, bake_params, prev->good ? &prev->rdi : 0, stream);
+      }
+      
+      //- rjf: release previous RDI - we may be about to write over it
+      lane_sync();
+      if(lane_idx() == 0)
+      {
+        if(prev->good)
+        {
+          log_infof("Incremental; reused %I64u/%I64u line tables\n", rdim_shared->reused_line_tables_count, rdim_shared->line_tables_count);
+        }
+        if(prev->base != 0)
+        {
+          os_file_map_view_close(prev->map, prev->base, prev->range);
+          os_file_map_close(prev->map);
+        }
+        if(!os_handle_match(prev->file, os_handle_zero()))
+        {
+          os_file_close(prev->file);
+        }
+        MemoryZeroStruct(&prev->rdi);
       }
       
       //- rjf: convert done => generate output
@@ -793,6 +983,31 @@ rb_thread_entry_point(void *p)
         
         //- rjf: generate RDI blobs
         case OutputKind_RDI:
+        if(stream != 0)
+        {
+          // rjf: streamed -> all sections are already written; finish the file
+          // & move it into place
+          if(lane_idx() == 0) ProfScope("finish stream")
+          {
+            B32 is_written = rdim_section_stream_end(stream);
+            if(is_written)
+            {
+              os_delete_file_at_path(output_path);
+              is_written = os_move_file_path(output_path, stream_path);
+            }
+            if(is_written)
+            {
+              log_infof("Results streamed to %S", output_path);
+            }
+            else
+            {
+              os_delete_file_at_path(stream_path);
+              log_user_errorf("ERROR: failed to write file %S\n", output_path);
+            }
+          }
+          output_streamed = 1;
+        }
+        else
         {
           // rjf: serialize
           RDIM_SerializedSectionBundle *serialized_section_bundle = 0;
@@ -1258,7 +1473,7 @@ rb_thread_entry_point(void *p)
   //////////////////////////////
   //- rjf: write outputs
   //
-  if(lane_idx() == 0)
+  if(lane_idx() == 0 && !output_streamed)
   {
     if(output_path.size != 0) ProfScope("write outputs [file]")
     {
@@ -70,6 +70,11 @@ struct RB_Shared
 
 global RB_Shared *rb_shared = 0;
 
+////////////////////////////////
+//~ rjf: Perf Stats
+
+internal String8List rb_perf_stats_json_from_run(Arena *arena, U64 threads_count, U64 wall_us);
+
 ////////////////////////////////
 //~ rjf: Top-Level Entry Points
 
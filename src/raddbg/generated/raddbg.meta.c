@@ -4,7 +4,7 @@
 //- GENERATED CODE
 
 C_LINKAGE_BEGIN
-String8 rd_tab_fast_path_view_name_table[25] =
+String8 rd_tab_fast_path_view_name_table[26] =
 {
 str8_lit_comp("watch"),
 str8_lit_comp("watch"),
@@ -31,9 +31,10 @@ str8_lit_comp("memory"),
 str8_lit_comp("bitmap"),
 str8_lit_comp("color"),
 str8_lit_comp("geo3d"),
+str8_lit_comp("file_search"),
 };
 
-String8 rd_tab_fast_path_query_name_table[25] =
+String8 rd_tab_fast_path_query_name_table[26] =
 {
 str8_lit_comp(""),
 str8_lit_comp("query:locals"),
@@ -60,9 +61,10 @@ str8_lit_comp(""),
 str8_lit_comp(""),
 str8_lit_comp(""),
 str8_lit_comp(""),
+str8_lit_comp(""),
 };
 
-RD_VocabInfo rd_vocab_info_table[358] =
+RD_VocabInfo rd_vocab_info_table[374] =
 {
 {str8_lit_comp("type_view"), str8_lit_comp("type_views"), str8_lit_comp("Type View"), str8_lit_comp("Type Views"), RD_IconKind_Binoculars},
 {str8_lit_comp("file_path_map"), str8_lit_comp("file_path_maps"), str8_lit_comp("File Path Map"), str8_lit_comp("File Path Maps"), RD_IconKind_FileOutline},
@@ -162,6 +164,12 @@ RD_VocabInfo rd_vocab_info_table[358] =
 {str8_lit_comp("bytes_per_cell"), str8_lit_comp(""), str8_lit_comp("Bytes Per Cell"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("bitmap"), str8_lit_comp("bitmaps"), str8_lit_comp("Bitmap"), str8_lit_comp("Bitmaps"), RD_IconKind_Bitmap},
 {str8_lit_comp("geo3d"), str8_lit_comp(""), str8_lit_comp("Geometry (3D)"), str8_lit_comp(""), RD_IconKind_Cube},
+{str8_lit_comp("sum"), str8_lit_comp("sums"), str8_lit_comp("Sum"), str8_lit_comp("Sums"), RD_IconKind_Null},
+{str8_lit_comp("min"), str8_lit_comp(""), str8_lit_comp("Minimum"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("max"), str8_lit_comp(""), str8_lit_comp("Maximum"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("mean"), str8_lit_comp(""), str8_lit_comp("Mean"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("histogram"), str8_lit_comp("histograms"), str8_lit_comp("Histogram"), str8_lit_comp("Histograms"), RD_IconKind_Null},
+{str8_lit_comp("bins"), str8_lit_comp(""), str8_lit_comp("Bins"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("address_range_size"), str8_lit_comp("address_range_sizes"), str8_lit_comp("Address Range Size"), str8_lit_comp("Address Range Sizes"), RD_IconKind_Null},
 {str8_lit_comp("break_on_read"), str8_lit_comp(""), str8_lit_comp("Break On Read"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("break_on_write"), str8_lit_comp(""), str8_lit_comp("Break On Write"), str8_lit_comp(""), RD_IconKind_Null},
@@ -180,7 +188,11 @@ RD_VocabInfo rd_vocab_info_table[358] =
 {str8_lit_comp("kill"), str8_lit_comp(""), str8_lit_comp("Kill"), str8_lit_comp(""), RD_IconKind_X},
 {str8_lit_comp("kill_all"), str8_lit_comp(""), str8_lit_comp("Kill All"), str8_lit_comp(""), RD_IconKind_Stop},
 {str8_lit_comp("detach"), str8_lit_comp(""), str8_lit_comp("Detach"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("save_core_dump"), str8_lit_comp(""), str8_lit_comp("Save Core Dump"), str8_lit_comp(""), RD_IconKind_Save},
+{str8_lit_comp("save_compressed_core_dump"), str8_lit_comp(""), str8_lit_comp("Save Compressed Core Dump"), str8_lit_comp(""), RD_IconKind_Save},
 {str8_lit_comp("continue"), str8_lit_comp(""), str8_lit_comp("Continue"), str8_lit_comp(""), RD_IconKind_Play},
+{str8_lit_comp("run_with_sampling"), str8_lit_comp(""), str8_lit_comp("Run With Sampling Profiler"), str8_lit_comp(""), RD_IconKind_Play},
+{str8_lit_comp("clear_sample_profile"), str8_lit_comp(""), str8_lit_comp("Clear Sample Profile"), str8_lit_comp(""), RD_IconKind_X},
 {str8_lit_comp("step_into_inst"), str8_lit_comp(""), str8_lit_comp("Step Into (Assembly)"), str8_lit_comp(""), RD_IconKind_StepInto},
 {str8_lit_comp("step_over_inst"), str8_lit_comp(""), str8_lit_comp("Step Over (Assembly)"), str8_lit_comp(""), RD_IconKind_StepOver},
 {str8_lit_comp("step_into_line"), str8_lit_comp(""), str8_lit_comp("Step Into (Line)"), str8_lit_comp(""), RD_IconKind_StepInto},
@@ -364,6 +376,7 @@ RD_VocabInfo rd_vocab_info_table[358] =
 {str8_lit_comp("clear_breakpoints"), str8_lit_comp(""), str8_lit_comp("Clear Breakpoints"), str8_lit_comp(""), RD_IconKind_Trash},
 {str8_lit_comp("list_breakpoints"), str8_lit_comp(""), str8_lit_comp("List Breakpoints"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("clear_output"), str8_lit_comp(""), str8_lit_comp("Clear Output"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("copy_sample_profile"), str8_lit_comp(""), str8_lit_comp("Copy Sample Profile"), str8_lit_comp(""), RD_IconKind_Clipboard},
 {str8_lit_comp("add_watch_pin"), str8_lit_comp(""), str8_lit_comp("Add Watch Pin"), str8_lit_comp(""), RD_IconKind_Pin},
 {str8_lit_comp("toggle_watch_pin"), str8_lit_comp(""), str8_lit_comp("Toggle Watch Pin"), str8_lit_comp(""), RD_IconKind_Pin},
 {str8_lit_comp("load_debug_info"), str8_lit_comp(""), str8_lit_comp("Load Debug Info"), str8_lit_comp(""), RD_IconKind_Module},
@@ -397,6 +410,10 @@ RD_VocabInfo rd_vocab_info_table[358] =
 {str8_lit_comp("close_event_buffer"), str8_lit_comp(""), str8_lit_comp("Close Event Buffer"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("toggle_dev_menu"), str8_lit_comp(""), str8_lit_comp("Toggle Developer Menu"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("log_marker"), str8_lit_comp(""), str8_lit_comp("Log Marker"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("toggle_profiler_capture"), str8_lit_comp(""), str8_lit_comp("Toggle Profiler Capture"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("dump_profiler_trace"), str8_lit_comp(""), str8_lit_comp("Dump Profiler Trace"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("toggle_lock_stats"), str8_lit_comp(""), str8_lit_comp("Toggle Lock Contention Statistics"), str8_lit_comp(""), RD_IconKind_Null},
+{str8_lit_comp("dump_lock_stats"), str8_lit_comp(""), str8_lit_comp("Dump Lock Contention Statistics"), str8_lit_comp(""), RD_IconKind_Null},
 {str8_lit_comp("watches"), str8_lit_comp(""), str8_lit_comp("Watch"), str8_lit_comp(""), RD_IconKind_Binoculars},
 {str8_lit_comp("locals"), str8_lit_comp(""), str8_lit_comp("Locals"), str8_lit_comp(""), RD_IconKind_Binoculars},
 {str8_lit_comp("registers"), str8_lit_comp(""), str8_lit_comp("Registers"), str8_lit_comp(""), RD_IconKind_Binoculars},
@@ -422,12 +439,13 @@ RD_VocabInfo rd_vocab_info_table[358] =
 {str8_lit_comp("bitmap"), str8_lit_comp(""), str8_lit_comp("Bitmap"), str8_lit_comp(""), RD_IconKind_Bitmap},
 {str8_lit_comp("color"), str8_lit_comp(""), str8_lit_comp("Color"), str8_lit_comp(""), RD_IconKind_Palette},
 {str8_lit_comp("geo3d"), str8_lit_comp(""), str8_lit_comp("Geometry (3D)"), str8_lit_comp(""), RD_IconKind_Cube},
+{str8_lit_comp("file_search"), str8_lit_comp(""), str8_lit_comp("Find In Files"), str8_lit_comp(""), RD_IconKind_Find},
 };
 
-RD_NameSchemaInfo rd_name_schema_info_table[26] =
+RD_NameSchemaInfo rd_name_schema_info_table[32] =
 {
-{str8_lit_comp("user"), str8_lit_comp("@expand_commands(edit_user_theme) x:\n{\n  //- rjf: animations\n  @display_name('Animations') @description(\"Enables animations.\")\n  @default(1) 'animations': bool,\n  @display_name('Scrolling Animations') @description(\"Enables scrolling animations.\")\n  @expand_if(\"$.animations\") @default(1) 'scrolling_animations': bool,\n  @display_name('Tooltip Animations') @description(\"Enables tooltip animations.\")\n  @expand_if(\"$.animations\") @default(1) 'tooltip_animations': bool,\n  @display_name('Menu Animations') @description(\"Enables menu animations.\")\n  @expand_if(\"$.animations\") @default(1) 'menu_animations': bool,\n\n  //- rjf: fonts\n  @display_name('UI Font') @description(\"The name of, or path to, the font used when displaying non-code UI elements.\")\n  @default('') 'main_font': string,\n  @display_name('Code Font') @description(\"The name of, or path to, the font used when displaying code.\")\n  @default('') 'code_font': string,\n\n  //- rjf: theme\n  @default(\"Default (Dark)\") @display_name('User Theme')\n  @description(\"The user's theme, which describes all colors used throughout the UI.\")\n  'theme': string,\n  @no_expand @display_name('User Theme')\n  'theme_colors': query,\n\n  //- rjf: autocompletion\n  @display_name('Autocompletion Lister') @description(\"Enables the autocompletion lister while typing expressions.\") @default(1)\n  'autocompletion_lister': bool,\n  @display_name('View Call Argument Helper') @description(\"Enables the view call argument helper, which shows view arguments and documentation, while typing expressions.\") @default(1)\n  'view_call_argument_helper': bool,\n\n  //- rjf: scope decorations\n  @default(1) @display_name('Cursor Scope Lines') @description(\"Controls whether or not scopes containing the cursor in text views are drawn.\")\n  'cursor_scope_lines': bool,\n\n  //- rjf: cursor decorations\n  @default(1) @display_name('Cursor Trail') @description(\"Controls whether or not a movement trail of the cursor is drawn.\")\n  'cursor_trail': bool,\n\n  //- rjf: thread & breakpoint decorations\n  @default(1) @display_name('Thread Lines') @description(\"Controls whether or not a long horizontal line is drawn before the next line or instruction that the selected thread will execute in source and disassembly views.\")\n  'thread_lines': bool,\n  @default(1) @display_name('Thread Glow') @description(\"Controls whether or not a glowing effect is drawn on the selected thread in source and disassembly views.\")\n  'thread_glow': bool,\n  @default(1) @display_name('Breakpoint Lines') @description(\"Controls whether or not a long horizontal line is drawn before the line or instruction at which a breakpoint is placed, in source and disassembly views.\")\n  'breakpoint_lines': bool,\n  @default(1) @display_name('Breakpoint Glow') @description(\"Controls whether or not a glowing effect is drawn on breakpoints in source and disassembly views.\")\n  'breakpoint_glow': bool,\n\n  //- rjf: occluding background settings\n  @default(0) @display_name('Opaque Backgrounds') @description(\"Controls whether or not all floating background colors are forced to be fully opaque.\")\n  'opaque_backgrounds': bool,\n  @default(1) @display_name('Background Blur') @description(\"Controls whether or not occluded regions behind floating elements are blurred.\")\n  'background_blur': bool,\n\n  //- rjf: appearance settings\n  @default(1) @display_name('Drop Shadows') @description(\"Controls whether or not drop shadows are drawn.\")\n  'drop_shadows': bool,\n  @default(1.f) @display_name('Rounded Corner Amount') @description(\"Controls the degree to which UI corners are rounded.\")\n  'rounded_corner_amount': @range[0, 1] f32,\n\n  //- rjf: code formatting settings\n  @default(2) @display_name('User Tab Width') 'tab_width': @range[1, 32] u64,\n\n  //- rjf: windows style menu bar\n  @default(1) @display_name('Focus Menu Bar With Alt') @description(\"Mimics standard Windows behavior of focusing the menu bar using the Alt key.\")\n  'focus_menu_bar_with_alt': bool,\n\n  //- rjf: native filesystem dialogues\n  @default(0) @display_name('Use Native File System Dialog') @description(\"Uses the operating system's file system dialog box, rather than the debugger's built-in UI.\")\n  'use_native_file_system_dialog': bool,\n}\n")},
-{str8_lit_comp("project"), str8_lit_comp("@expand_commands(edit_project_theme) x:\n{\n  @default(2) @display_name('Project Tab Width') 'tab_width': @range[1, 32] u64,\n\n  //- rjf: visualizers\n  @display_name('Use Default C++ STL Type Visualizers') @description(\"Enables the built-in type views for C++ STL types.\")\n  @default(1) use_default_stl_type_views: bool,\n  @display_name('Use Default Unreal Engine Type Visualizers') @description(\"Enables the built-in type views for Unreal Engine types.\")\n  @default(1) use_default_ue_type_views: bool,\n\n  //- rjf: theme\n  @default(\"None\") @display_name('Project Theme') @description(\"The project's theme, which describes all colors used throughout the UI, and can override the user's theme.\")\n  'theme': string,\n  @no_expand @display_name('Project Theme') @description(\"The project's theme, which describes all colors used throughout the UI, and can override the user's theme.\")\n  'theme_colors': query,\n\n  //- rjf: exception settings\n  @default(1) @display_name(\"Break On Win32 Control-C Exceptions\") @description(\"Code: 0x40010005\")\n  win32_ctrl_c: bool;\n  @default(1) @display_name(\"Break On Win32 Control-Break Exceptions\") @description(\"Code: 0x40010008\")\n  win32_ctrl_break: bool;\n  @default(0) @display_name(\"Break On Win32 WinRT Originate Error Exceptions\") @description(\"Code: 0x40080201\")\n  win32_win_rt_originate_error: bool;\n  @default(0) @display_name(\"Break On Win32 WinRT Transform Error Exceptions\") @description(\"Code: 0x40080202\")\n  win32_win_rt_transform_error: bool;\n  @default(0) @display_name(\"Break On Win32 RPC Call Cancelled Exceptions\") @description(\"Code: 0x0000071a\")\n  win32_rpc_call_cancelled: bool;\n  @default(0) @display_name(\"Break On Win32 Data Type Misalignment Exceptions\") @description(\"Code: 0x80000002\")\n  win32_datatype_misalignment: bool;\n  @default(1) @display_name(\"Break On Win32 Access Violation Exceptions\") @description(\"Code: 0xc0000005\")\n  win32_access_violation: bool;\n  @default(0) @display_name(\"Break On Win32 In Page Error Exceptions\") @description(\"Code: 0xc0000006\")\n  win32_in_page_error: bool;\n  @default(1) @display_name(\"Break On Win32 Invalid Handle Specified Exceptions\") @description(\"Code: 0xc0000008\")\n  win32_invalid_handle: bool;\n  @default(0) @display_name(\"Break On Win32 Not Enough Quota Exceptions\") @description(\"Code: 0xc0000017\")\n  win32_not_enough_quota: bool;\n  @default(0) @display_name(\"Break On Win32 Illegal Instruction Exceptions\") @description(\"Code: 0xc000001d\")\n  win32_illegal_instruction: bool;\n  @default(0) @display_name(\"Break On Win32 Cannot Continue From Exception Exceptions\") @description(\"Code: 0xc0000025\")\n  win32_cannot_continue_exception: bool;\n  @default(0) @display_name(\"Break On Win32 Invalid Exception Disposition Returned By Handler Exceptions\") @description(\"Code: 0xc0000026\")\n  win32_invalid_exception_disposition: bool;\n  @default(0) @display_name(\"Break On Win32 Array Bounds Exceeded Exceptions\") @description(\"Code: 0xc000008c\")\n  win32_array_bounds_exceeded: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Denormal Operand Exceptions\") @description(\"Code: 0xc000008d\")\n  win32_floating_point_denormal_operand: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Division By Zero Exceptions\") @description(\"Code: 0xc000008e\")\n  win32_floating_point_division_by_zero: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Inexact Result Exceptions\") @description(\"Code: 0xc000008f\")\n  win32_floating_point_inexact_result: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Invalid Operation Exceptions\") @description(\"Code: 0xc0000090\")\n  win32_floating_point_invalid_operation: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Overflow Exceptions\") @description(\"Code: 0xc0000091\")\n  win32_floating_point_overflow: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Stack Check Exceptions\") @description(\"Code: 0xc0000092\")\n  win32_floating_point_stack_check: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Underflow Exceptions\") @description(\"Code: 0xc0000093\")\n  win32_floating_point_underflow: bool;\n  @default(0) @display_name(\"Break On Win32 Integer Division By Zero Exceptions\") @description(\"Code: 0xc0000094\")\n  win32_integer_division_by_zero: bool;\n  @default(0) @display_name(\"Break On Win32 Integer Overflow Exceptions\") @description(\"Code: 0xc0000095\")\n  win32_integer_overflow: bool;\n  @default(0) @display_name(\"Break On Win32 Privileged Instruction Exceptions\") @description(\"Code: 0xc0000096\")\n  win32_privileged_instruction: bool;\n  @default(0) @display_name(\"Break On Win32 Stack Overflow Exceptions\") @description(\"Code: 0xc00000fd\")\n  win32_stack_overflow: bool;\n  @default(0) @display_name(\"Break On Win32 Unable To Locate DLL Exceptions\") @description(\"Code: 0xc0000135\")\n  win32_unable_to_locate_dll: bool;\n  @default(0) @display_name(\"Break On Win32 Ordinal Not Found Exceptions\") @description(\"Code: 0xc0000138\")\n  win32_ordinal_not_found: bool;\n  @default(0) @display_name(\"Break On Win32 Entry Point Not Found Exceptions\") @description(\"Code: 0xc0000139\")\n  win32_entry_point_not_found: bool;\n  @default(0) @display_name(\"Break On Win32 DLL Initialization Failed Exceptions\") @description(\"Code: 0xc0000142\")\n  win32_dll_initialization_failed: bool;\n  @default(0) @display_name(\"Break On Win32 Floating Point SSE Multiple Faults Exceptions\") @description(\"Code: 0xc00002b4\")\n  win32_floating_point_sse_multiple_faults: bool;\n  @default(0) @display_name(\"Break On Win32 Floating Point SSE Multiple Traps Exceptions\") @description(\"Code: 0xc00002b5\")\n  win32_floating_point_sse_multiple_traps: bool;\n  @default(1) @display_name(\"Break On Win32 Assertion Failed Exceptions\") @description(\"Code: 0xc0000420\")\n  win32_assertion_failed: bool;\n  @default(0) @display_name(\"Break On Win32 Module Not Found Exceptions\") @description(\"Code: 0xc06d007e\")\n  win32_module_not_found: bool;\n  @default(0) @display_name(\"Break On Win32 Procedure Not Found Exceptions\") @description(\"Code: 0xc06d007f\")\n  win32_procedure_not_found: bool;\n  @default(1) @display_name(\"Break On Win32 Sanitizer Error Detected Exceptions\") @description(\"Code: 0xe073616e\")\n  win32_sanitizer_error_detected: bool;\n  @default(0) @display_name(\"Break On Win32 Sanitizer Raw Access Violation Exceptions\") @description(\"Code: 0xe0736171\")\n  win32_sanitizer_raw_access_violation: bool;\n  @default(1) @display_name(\"Break On Win32 DirectX Debug Layer Exceptions\") @description(\"Code: 0x0000087a\")\n  win32_directx_debug_layer: bool;\n}\n")},
+{str8_lit_comp("user"), str8_lit_comp("@expand_commands(edit_user_theme) x:\n{\n  //- rjf: animations\n  @display_name('Animations') @description(\"Enables animations.\")\n  @default(1) 'animations': bool,\n  @display_name('Scrolling Animations') @description(\"Enables scrolling animations.\")\n  @expand_if(\"$.animations\") @default(1) 'scrolling_animations': bool,\n  @display_name('Tooltip Animations') @description(\"Enables tooltip animations.\")\n  @expand_if(\"$.animations\") @default(1) 'tooltip_animations': bool,\n  @display_name('Menu Animations') @description(\"Enables menu animations.\")\n  @expand_if(\"$.animations\") @default(1) 'menu_animations': bool,\n\n  //- rjf: fonts\n  @display_name('UI Font') @description(\"The name of, or path to, the font used when displaying non-code UI elements.\")\n  @default('') 'main_font': string,\n  @display_name('Code Font') @description(\"The name of, or path to, the font used when displaying code.\")\n  @default('') 'code_font': string,\n  @display_name('Font Cache Budget (MB)') @description(\"The amount of texture memory, in megabytes, which may be used for cached glyph rasterizations. When exceeded, the least-recently-used glyphs are evicted.\")\n  @default(64) 'font_cache_budget_mb': @range[4, 1024] u64,\n\n  //- rjf: theme\n  @default(\"Default (Dark)\") @display_name('User Theme')\n  @description(\"The user's theme, which describes all colors used throughout the UI.\")\n  'theme': string,\n  @no_expand @display_name('User Theme')\n  'theme_colors': query,\n\n  //- rjf: autocompletion\n  @display_name('Autocompletion Lister') @description(\"Enables the autocompletion lister while typing expressions.\") @default(1)\n  'autocompletion_lister': bool,\n  @display_name('View Call Argument Helper') @description(\"Enables the view call argument helper, which shows view arguments and documentation, while typing expressions.\") @default(1)\n  'view_call_argument_helper': bool,\n\n  //- rjf: scope decorations\n  @default(1) @display_name('Cursor Scope Lines') @description(\"Controls whether or not scopes containing the cursor in text views are drawn.\")\n  'cursor_scope_lines': bool,\n\n  //- rjf: cursor decorations\n  @default(1) @display_name('Cursor Trail') @description(\"Controls whether or not a movement trail of the cursor is drawn.\")\n  'cursor_trail': bool,\n\n  //- rjf: thread & breakpoint decorations\n  @default(1) @display_name('Thread Lines') @description(\"Controls whether or not a long horizontal line is drawn before the next line or instruction that the selected thread will execute in source and disassembly views.\")\n  'thread_lines': bool,\n  @default(1) @display_name('Thread Glow') @description(\"Controls whether or not a glowing effect is drawn on the selected thread in source and disassembly views.\")\n  'thread_glow': bool,\n  @default(1) @display_name('Breakpoint Lines') @description(\"Controls whether or not a long horizontal line is drawn before the line or instruction at which a breakpoint is placed, in source and disassembly views.\")\n  'breakpoint_lines': bool,\n  @default(1) @display_name('Breakpoint Glow') @description(\"Controls whether or not a glowing effect is drawn on breakpoints in source and disassembly views.\")\n  'breakpoint_glow': bool,\n\n  //- rjf: occluding background settings\n  @default(0) @display_name('Opaque Backgrounds') @description(\"Controls whether or not all floating background colors are forced to be fully opaque.\")\n  'opaque_backgrounds': bool,\n  @default(1) @display_name('Background Blur') @description(\"Controls whether or not occluded regions behind floating elements are blurred.\")\n  'background_blur': bool,\n\n  //- rjf: appearance settings\n  @default(1) @display_name('Drop Shadows') @description(\"Controls whether or not drop shadows are drawn.\")\n  'drop_shadows': bool,\n  @default(1.f) @display_name('Rounded Corner Amount') @description(\"Controls the degree to which UI corners are rounded.\")\n  'rounded_corner_amount': @range[0, 1] f32,\n\n  //- rjf: code formatting settings\n  @default(2) @display_name('User Tab Width') 'tab_width': @range[1, 32] u64,\n\n  //- rjf: windows style menu bar\n  @default(1) @display_name('Focus Menu Bar With Alt') @description(\"Mimics standard Windows behavior of focusing the menu bar using the Alt key.\")\n  'focus_menu_bar_with_alt': bool,\n\n  //- rjf: native filesystem dialogues\n  @default(0) @display_name('Use Native File System Dialog') @description(\"Uses the operating system's file system dialog box, rather than the debugger's built-in UI.\")\n  'use_native_file_system_dialog': bool,\n\n  //- rjf: symbol stores\n  @display_name('Symbol Stores') @description(\"A semicolon-separated list of directories and symbol server or debuginfod URLs, which are searched for the debug info of modules whose debug info can't be found locally. Accepts _NT_SYMBOL_PATH syntax. The _NT_SYMBOL_PATH and DEBUGINFOD_URLS environment variables are also used.\")\n  @default('') 'symbol_stores': string,\n  @display_name('Symbol Cache Directory') @description(\"The directory into which debug info fetched from symbol servers is downloaded. If empty, a per-user directory is used.\")\n  @default('') 'symbol_cache_dir': string,\n}\n")},
+{str8_lit_comp("project"), str8_lit_comp("@expand_commands(edit_project_theme) x:\n{\n  @default(2) @display_name('Project Tab Width') 'tab_width': @range[1, 32] u64,\n\n  //- rjf: visualizers\n  @display_name('Use Default C++ STL Type Visualizers') @description(\"Enables the built-in type views for C++ STL types.\")\n  @default(1) use_default_stl_type_views: bool,\n  @display_name('Use Default Unreal Engine Type Visualizers') @description(\"Enables the built-in type views for Unreal Engine types.\")\n  @default(1) use_default_ue_type_views: bool,\n\n  //- rjf: sampling profiler\n  @default(1000) @display_name('Sampling Profiler Interval (us)') @description(\"The minimum time, in microseconds, between call stack samples taken when running with the sampling profiler.\")\n  'sample_interval_us': @range[100, 1000000] u64,\n  @default(5) @display_name('Sampling Profiler Overhead (%)') @description(\"The maximum percentage of the target's run time which may be spent taking call stack samples. Sampling is slowed down to stay below this budget.\")\n  'sample_overhead_pct': @range[1, 100] u64,\n\n  //- rjf: theme\n  @default(\"None\") @display_name('Project Theme') @description(\"The project's theme, which describes all colors used throughout the UI, and can override the user's theme.\")\n  'theme': string,\n  @no_expand @display_name('Project Theme') @description(\"The project's theme, which describes all colors used throughout the UI, and can override the user's theme.\")\n  'theme_colors': query,\n\n  //- rjf: exception settings\n  @default(1) @display_name(\"Break On Win32 Control-C Exceptions\") @description(\"Code: 0x40010005\")\n  win32_ctrl_c: bool;\n  @default(1) @display_name(\"Break On Win32 Control-Break Exceptions\") @description(\"Code: 0x40010008\")\n  win32_ctrl_break: bool;\n  @default(0) @display_name(\"Break On Win32 WinRT Originate Error Exceptions\") @description(\"Code: 0x40080201\")\n  win32_win_rt_originate_error: bool;\n  @default(0) @display_name(\"Break On Win32 WinRT Transform Error Exceptions\") @description(\"Code: 0x40080202\")\n  win32_win_rt_transform_error: bool;\n  @default(0) @display_name(\"Break On Win32 RPC Call Cancelled Exceptions\") @description(\"Code: 0x0000071a\")\n  win32_rpc_call_cancelled: bool;\n  @default(0) @display_name(\"Break On Win32 Data Type Misalignment Exceptions\") @description(\"Code: 0x80000002\")\n  win32_datatype_misalignment: bool;\n  @default(1) @display_name(\"Break On Win32 Access Violation Exceptions\") @description(\"Code: 0xc0000005\")\n  win32_access_violation: bool;\n  @default(0) @display_name(\"Break On Win32 In Page Error Exceptions\") @description(\"Code: 0xc0000006\")\n  win32_in_page_error: bool;\n  @default(1) @display_name(\"Break On Win32 Invalid Handle Specified Exceptions\") @description(\"Code: 0xc0000008\")\n  win32_invalid_handle: bool;\n  @default(0) @display_name(\"Break On Win32 Not Enough Quota Exceptions\") @description(\"Code: 0xc0000017\")\n  win32_not_enough_quota: bool;\n  @default(0) @display_name(\"Break On Win32 Illegal Instruction Exceptions\") @description(\"Code: 0xc000001d\")\n  win32_illegal_instruction: bool;\n  @default(0) @display_name(\"Break On Win32 Cannot Continue From Exception Exceptions\") @description(\"Code: 0xc0000025\")\n  win32_cannot_continue_exception: bool;\n  @default(0) @display_name(\"Break On Win32 Invalid Exception Disposition Returned By Handler Exceptions\") @description(\"Code: 0xc0000026\")\n  win32_invalid_exception_disposition: bool;\n  @default(0) @display_name(\"Break On Win32 Array Bounds Exceeded Exceptions\") @description(\"Code: 0xc000008c\")\n  win32_array_bounds_exceeded: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Denormal Operand Exceptions\") @description(\"Code: 0xc000008d\")\n  win32_floating_point_denormal_operand: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Division By Zero Exceptions\") @description(\"Code: 0xc000008e\")\n  win32_floating_point_division_by_zero: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Inexact Result Exceptions\") @description(\"Code: 0xc000008f\")\n  win32_floating_point_inexact_result: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Invalid Operation Exceptions\") @description(\"Code: 0xc0000090\")\n  win32_floating_point_invalid_operation: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Overflow Exceptions\") @description(\"Code: 0xc0000091\")\n  win32_floating_point_overflow: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Stack Check Exceptions\") @description(\"Code: 0xc0000092\")\n  win32_floating_point_stack_check: bool;\n  @default(0) @display_name(\"Break On Win32 Floating-Point Underflow Exceptions\") @description(\"Code: 0xc0000093\")\n  win32_floating_point_underflow: bool;\n  @default(0) @display_name(\"Break On Win32 Integer Division By Zero Exceptions\") @description(\"Code: 0xc0000094\")\n  win32_integer_division_by_zero: bool;\n  @default(0) @display_name(\"Break On Win32 Integer Overflow Exceptions\") @description(\"Code: 0xc0000095\")\n  win32_integer_overflow: bool;\n  @default(0) @display_name(\"Break On Win32 Privileged Instruction Exceptions\") @description(\"Code: 0xc0000096\")\n  win32_privileged_instruction: bool;\n  @default(0) @display_name(\"Break On Win32 Stack Overflow Exceptions\") @description(\"Code: 0xc00000fd\")\n  win32_stack_overflow: bool;\n  @default(0) @display_name(\"Break On Win32 Unable To Locate DLL Exceptions\") @description(\"Code: 0xc0000135\")\n  win32_unable_to_locate_dll: bool;\n  @default(0) @display_name(\"Break On Win32 Ordinal Not Found Exceptions\") @description(\"Code: 0xc0000138\")\n  win32_ordinal_not_found: bool;\n  @default(0) @display_name(\"Break On Win32 Entry Point Not Found Exceptions\") @description(\"Code: 0xc0000139\")\n  win32_entry_point_not_found: bool;\n  @default(0) @display_name(\"Break On Win32 DLL Initialization Failed Exceptions\") @description(\"Code: 0xc0000142\")\n  win32_dll_initialization_failed: bool;\n  @default(0) @display_name(\"Break On Win32 Floating Point SSE Multiple Faults Exceptions\") @description(\"Code: 0xc00002b4\")\n  win32_floating_point_sse_multiple_faults: bool;\n  @default(0) @display_name(\"Break On Win32 Floating Point SSE Multiple Traps Exceptions\") @description(\"Code: 0xc00002b5\")\n  win32_floating_point_sse_multiple_traps: bool;\n  @default(1) @display_name(\"Break On Win32 Assertion Failed Exceptions\") @description(\"Code: 0xc0000420\")\n  win32_assertion_failed: bool;\n  @default(0) @display_name(\"Break On Win32 Module Not Found Exceptions\") @description(\"Code: 0xc06d007e\")\n  win32_module_not_found: bool;\n  @default(0) @display_name(\"Break On Win32 Procedure Not Found Exceptions\") @description(\"Code: 0xc06d007f\")\n  win32_procedure_not_found: bool;\n  @default(1) @display_name(\"Break On Win32 Sanitizer Error Detected Exceptions\") @description(\"Code: 0xe073616e\")\n  win32_sanitizer_error_detected: bool;\n  @default(0) @display_name(\"Break On Win32 Sanitizer Raw Access Violation Exceptions\") @description(\"Code: 0xe0736171\")\n  win32_sanitizer_raw_access_violation: bool;\n  @default(1) @display_name(\"Break On Win32 DirectX Debug Layer Exceptions\") @description(\"Code: 0x0000087a\")\n  win32_directx_debug_layer: bool;\n}\n")},
 {str8_lit_comp("theme_color"), str8_lit_comp("@collection_commands(add_theme_color, fork_theme, save_theme, save_and_set_theme)\n@row_commands(duplicate_cfg, remove_cfg)\nx:\n{\n  @display_name('Tags') tags: string,\n  @display_name('Value') value: @color @hex u32,\n}\n")},
 {str8_lit_comp("window"), str8_lit_comp("x:\n{\n  //- rjf: text rasterization settings\n  @default(1) @display_name('Smooth UI Text') @description(\"Controls whether or not UI text is fully anti-aliased, for a smoother appearance.\")\n  'smooth_ui_text': bool,\n  @default(1) @display_name('Hint UI Text') @description(\"Controls whether or not UI text is hinted, for better text readability at small sizes.\")\n  'hint_ui_text': bool,\n  @default(0) @display_name('Smooth Code Text') @description(\"Controls whether or not code text is fully anti-aliased, for a smoother appearance.\")\n  'smooth_code_text': bool,\n  @default(1) @display_name('Hint Code Text') @description(\"Controls whether or not code text is hinted, for better text readability at small sizes.\")\n  'hint_code_text': bool,\n  @default(11) @display_name('Window Font Size') @description(\"Controls the window's default font size. Does not apply to tabs with their own font size set.\")\n  'font_size': @range[6, 72] u64,\n\n  //- rjf: size settings\n  @default(3.f) @display_name('Window Row Height') @description(\"Controls the window's default row height, in multiples of the font size. Does not apply to tabs with their own row height set.\")\n  'row_height': @range[1.75f, 5.f] f32,\n  @default(3.f) @description(\"Controls the height of tabs, in multiples of the font size.\")\n  'tab_height': @range[1.75f, 5.f] f32,\n\n  //- rjf: theme settings\n  @default(1) @display_name('Use Project Theme') @description(\"Prefer using the project theme for this window, if any. If off, only the user's theme settings will be used.\")\n  'use_project_theme': bool,\n}\n")},
 {str8_lit_comp("tab"), str8_lit_comp("@row_commands(@file copy_tab_full_path, @file show_file_in_explorer, duplicate_tab, close_tab)\nx:\n{\n  @override @display_name('Tab Font Size') @description(\"Controls the tab's font size.\") @no_callee_helper\n  'font_size': @range[6, 72] u64,\n}\n")},
@@ -439,6 +457,12 @@ RD_NameSchemaInfo rd_name_schema_info_table[26] =
 {str8_lit_comp("bitmap"), str8_lit_comp("@inherit(tab) x:\n{\n  @description(\"An expression which refers to the base address of data which should be viewed as a bitmap.\")\n  'expression': expr_string,\n  @description(\"An expression describing the width of the bitmap, in pixels.\") @order(0) 'w': u64,\n  @description(\"An expression describing the height of the bitmap, in pixels.\") @order(1) 'h': u64,\n  @display_name(\"Bitmap Format\") @description(\"The pixel format that the bitmap data should be interpreted as being within.\")\n  'fmt': code_string,\n}\n")},
 {str8_lit_comp("color"), str8_lit_comp("@inherit(tab) x:\n{\n  @display_name(\"Value\") @description(\"An expression to describe the value or location of the color.\")\n  'expression': expr_string,\n}\n")},
 {str8_lit_comp("geo3d"), str8_lit_comp("@inherit(tab) x:\n{\n  @display_name(\"Expression\") @description(\"An expression to describe the base address of the index buffer.\")\n  'expression': expr_string,\n  'count': expr_string,\n  'vtx': expr_string,\n  'vtx_size': expr_string,\n  'yaw': @range[0, 1] f32,\n  'pitch': @range[-0.5, 0] f32,\n  'zoom': @range[0, 100] f32,\n}\n")},
+{str8_lit_comp("sum"), str8_lit_comp("@inherit(tab) x:\n{\n  @description(\"An expression which refers to the array, or the base address of the elements, which should be reduced.\")\n  'expression': expr_string,\n  @description(\"The number of elements to reduce, if not implied by the expression's type.\") @order(0) 'count': u64,\n}\n")},
+{str8_lit_comp("min"), str8_lit_comp("@inherit(tab) x:\n{\n  @description(\"An expression which refers to the array, or the base address of the elements, which should be reduced.\")\n  'expression': expr_string,\n  @description(\"The number of elements to reduce, if not implied by the expression's type.\") @order(0) 'count': u64,\n}\n")},
+{str8_lit_comp("max"), str8_lit_comp("@inherit(tab) x:\n{\n  @description(\"An expression which refers to the array, or the base address of the elements, which should be reduced.\")\n  'expression': expr_string,\n  @description(\"The number of elements to reduce, if not implied by the expression's type.\") @order(0) 'count': u64,\n}\n")},
+{str8_lit_comp("mean"), str8_lit_comp("@inherit(tab) x:\n{\n  @description(\"An expression which refers to the array, or the base address of the elements, which should be reduced.\")\n  'expression': expr_string,\n  @description(\"The number of elements to reduce, if not implied by the expression's type.\") @order(0) 'count': u64,\n}\n")},
+{str8_lit_comp("histogram"), str8_lit_comp("@inherit(tab) x:\n{\n  @description(\"An expression which refers to the array, or the base address of the elements, which should be reduced.\")\n  'expression': expr_string,\n  @description(\"The number of elements to reduce, if not implied by the expression's type.\") @order(0) 'count': u64,\n  @default(32) @description(\"The number of equally-sized bins, spanning the minimum and maximum values, into which elements are counted.\") @order(1) 'bins': @range[1, 1024] u64,\n}\n")},
+{str8_lit_comp("file_search"), str8_lit_comp("@inherit(tab) x:\n{\n}\n")},
 {str8_lit_comp("getting_started"), str8_lit_comp("@inherit(tab) x:\n{\n}\n")},
 {str8_lit_comp("target"), str8_lit_comp("@row_commands(@cmd_line save_cfg_to_project, enable_cfg, launch_and_run, launch_and_step_into, duplicate_cfg, remove_cfg)\n@collection_commands(add_target)\nx:\n{\n  'label':              code_string,\n  'executable':         path,\n  'arguments':          string,\n  'working_directory':  path,\n  'entry_point':        expr_string,\n  'stdout_path':        @no_relativize path,\n  'stderr_path':        @no_relativize path,\n  'stdin_path':         @no_relativize path,\n  'environment':        query,\n  'debug_subprocesses': bool,\n  @no_revert @no_expand @default(0) 'enabled': bool,\n}\n")},
 {str8_lit_comp("breakpoint"), str8_lit_comp("@row_commands(enable_cfg, duplicate_cfg, remove_cfg)\n@collection_commands(toggle_breakpoint, add_breakpoint, add_address_breakpoint, add_function_breakpoint, clear_breakpoints)\nx:\n{\n  'label':            code_string,\n  'condition':        expr_string,\n  'source_location':  path_pt,\n  'address_location': expr_string,\n  'hit_count':        u64,\n  'address_range_size': @or(0, 1, 2, 4, 8) u64,\n  'break_on_write':   bool,\n  'break_on_read':    bool,\n  'break_on_execute': bool,\n  @no_revert @no_expand @default(1) 'enabled': bool,\n}\n")},
@@ -558,7 +582,7 @@ Rng1U64 rd_reg_slot_range_table[48] =
 {OffsetOf(RD_Regs, os_event), OffsetOf(RD_Regs, os_event) + sizeof(OS_Event *)},
 };
 
-RD_CmdKindInfo rd_cmd_kind_info_table[248] =
+RD_CmdKindInfo rd_cmd_kind_info_table[258] =
 {
 {0},
 { str8_lit_comp("launch_and_run"), str8_lit_comp("Starts debugging a new instance of a target, then runs."), str8_lit_comp("launch,start,run,target"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_Cfg, str8_lit_comp("query:targets"), str8_lit_comp(""), CTRL_EntityKind_Null}},
@@ -566,7 +590,11 @@ RD_CmdKindInfo rd_cmd_kind_info_table[248] =
 { str8_lit_comp("kill"), str8_lit_comp("Kills the specified existing attached process(es)."), str8_lit_comp("stop,kill"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_Process, str8_lit_comp("query:processes"), str8_lit_comp(""), CTRL_EntityKind_Process}},
 { str8_lit_comp("kill_all"), str8_lit_comp("Kills all attached processes."), str8_lit_comp("stop,kill,all"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("detach"), str8_lit_comp("Detaches the specified attached process(es)."), str8_lit_comp("detach"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_Process, str8_lit_comp("query:processes"), str8_lit_comp(""), CTRL_EntityKind_Process}},
+{ str8_lit_comp("save_core_dump"), str8_lit_comp("Saves a core dump of the selected process to the specified file path."), str8_lit_comp("core,dump,minidump"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*1)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_FilePath, str8_lit_comp("folder:\"$input\""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("save_compressed_core_dump"), str8_lit_comp("Saves a compressed core dump of the selected process to the specified file path."), str8_lit_comp("core,dump,minidump"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*1)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_FilePath, str8_lit_comp("folder:\"$input\""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("continue"), str8_lit_comp("Continues executing all attached processes."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("run_with_sampling"), str8_lit_comp("Continues executing all attached processes, periodically sampling all threads' call stacks."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("clear_sample_profile"), str8_lit_comp("Clears all call stack samples collected by the sampling profiler."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("step_into_inst"), str8_lit_comp("Performs a step that goes into calls, at the instruction level."), str8_lit_comp("single,step,thread"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("step_over_inst"), str8_lit_comp("Performs a step that skips calls, at the instruction level."), str8_lit_comp("single,step,thread"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("step_into_line"), str8_lit_comp("Performs a step that goes into calls, at the source code line level."), str8_lit_comp("step,thread"), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
@@ -750,6 +778,7 @@ RD_CmdKindInfo rd_cmd_kind_info_table[248] =
 { str8_lit_comp("clear_breakpoints"), str8_lit_comp("Removes all breakpoints."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("list_breakpoints"), str8_lit_comp("Lists all breakpoints."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*0)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("clear_output"), str8_lit_comp("Clears all output."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("copy_sample_profile"), str8_lit_comp("Copies all call stacks collected by the sampling profiler to the clipboard, in the folded stacks format used by flame graph tools."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("add_watch_pin"), str8_lit_comp("Places a watch pin at a given location (file path and line number or address)."), str8_lit_comp(""), str8_lit_comp("$watch_pins,"), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*1)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_Expr, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("toggle_watch_pin"), str8_lit_comp("Places or removes a watch pin at a given location (file path and line number or address)."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*0)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*1)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_Expr, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("load_debug_info"), str8_lit_comp("Loads a debug info file."), str8_lit_comp(""), str8_lit_comp("$debug_infos,"), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*1)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*1)|(RD_QueryFlag_Required*1), RD_RegSlot_FilePath, str8_lit_comp("folder:\"$input\""), str8_lit_comp(""), CTRL_EntityKind_Null}},
@@ -783,6 +812,10 @@ RD_CmdKindInfo rd_cmd_kind_info_table[248] =
 { str8_lit_comp("close_event_buffer"), str8_lit_comp("Closes an existing event buffer."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*0)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Cfg, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("toggle_dev_menu"), str8_lit_comp("Opens and closes the developer menu."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("log_marker"), str8_lit_comp("Logs a marker in the application log, to denote specific points in time within the log."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("toggle_profiler_capture"), str8_lit_comp("Begins or ends recording of the built-in trace profiler."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("dump_profiler_trace"), str8_lit_comp("Writes the built-in trace profiler's recent events to a Chrome trace JSON file."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("toggle_lock_stats"), str8_lit_comp("Begins or ends counting acquisitions, contention, & wait time for striped tables' locks."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
+{ str8_lit_comp("dump_lock_stats"), str8_lit_comp("Writes striped tables, ranked by lock contention, to the application log."), str8_lit_comp(""), str8_lit_comp(""), (RD_CmdKindFlag_ListInUI*1)|(RD_CmdKindFlag_ListInIPCDocs*1)|(RD_CmdKindFlag_ListInTextPt*0)|(RD_CmdKindFlag_ListInTextRng*0), {(RD_QueryFlag_AllowFiles*0)|(RD_QueryFlag_AllowFolders*0)|(RD_QueryFlag_CodeInput*0)|(RD_QueryFlag_KeepOldInput*0)|(RD_QueryFlag_SelectOldInput*0)|(RD_QueryFlag_Floating*0)|(RD_QueryFlag_Required*0), RD_RegSlot_Null, str8_lit_comp(""), str8_lit_comp(""), CTRL_EntityKind_Null}},
 { str8_lit_comp("watches"), str8_lit_comp("Opens a Watch tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
 { str8_lit_comp("locals"), str8_lit_comp("Opens a Locals tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
 { str8_lit_comp("registers"), str8_lit_comp("Opens a Registers tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
@@ -808,6 +841,7 @@ RD_CmdKindInfo rd_cmd_kind_info_table[248] =
 { str8_lit_comp("bitmap"), str8_lit_comp("Opens a Bitmap tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
 { str8_lit_comp("color"), str8_lit_comp("Opens a Color tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
 { str8_lit_comp("geo3d"), str8_lit_comp("Opens a Geometry (3D) tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
+{ str8_lit_comp("file_search"), str8_lit_comp("Opens a Find In Files tab."), {0}, {0}, RD_CmdKindFlag_ListInUI|RD_CmdKindFlag_ListInIPCDocs|RD_CmdKindFlag_ListInTab},
 };
 
 struct {String8 string; CFG_Binding binding;} rd_default_binding_table[116] =
@@ -0,0 +1,775 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Script Parsing
+
+internal OS_Key
+rd_bench_key_from_string(String8 string)
+{
+  OS_Key result = OS_Key_Null;
+  for EachEnumVal(OS_Key, k)
+  {
+    if(str8_match(os_g_key_cfg_string_table[k], string, StringMatchFlag_CaseInsensitive))
+    {
+      result = k;
+      break;
+    }
+  }
+  return result;
+}
+
+internal RD_BenchStep *
+rd_bench_script_push(Arena *arena, RD_BenchScript *script, RD_BenchStepKind kind)
+{
+  RD_BenchStep *step = push_array(arena, RD_BenchStep, 1);
+  SLLQueuePush(script->first, script->last, step);
+  script->count += 1;
+  step->kind = kind;
+  return step;
+}
+
+internal void
+rd_bench_script_push_event(Arena *arena, RD_BenchScript *script, OS_EventKind kind, OS_Key key, OS_Modifiers modifiers, Vec2F32 pos)
+{
+  RD_BenchStep *step = rd_bench_script_push(arena, script, RD_BenchStepKind_Event);
+  step->event.kind      = kind;
+  step->event.key       = key;
+  step->event.modifiers = modifiers;
+  step->event.pos       = pos;
+}
+
+internal RD_BenchScript
+rd_bench_script_from_string(Arena *arena, String8 string, String8 *error_out)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  RD_BenchScript script = {0};
+  typedef struct RepeatTask RepeatTask;
+  struct RepeatTask
+  {
+    RepeatTask *next;
+    RD_BenchStep *last_before_body;
+    U64 count_before_body;
+    U64 repeat_count;
+  };
+  RepeatTask *top_repeat = 0;
+  String8List lines = str8_split(scratch.arena, string, (U8 *)"\n", 1, 0);
+  U64 line_num = 0;
+  for EachNode(line_n, String8Node, lines.first)
+  {
+    line_num += 1;
+    String8 line = str8_skip_chop_whitespace(line_n->string);
+    if(line.size == 0 || line.str[0] == '#' || str8_match(str8_prefix(line, 2), str8_lit("//"), 0))
+    {
+      continue;
+    }
+    String8List parts = str8_split(scratch.arena, line, (U8 *)" \t", 2, 0);
+    String8 op = parts.first->string;
+    String8 rest = str8_skip_chop_whitespace(str8_skip(line, op.size));
+    String8 args[3] = {0};
+    {
+      U64 arg_idx = 0;
+      for(String8Node *n = parts.first->next; n != 0 && arg_idx < ArrayCount(args); n = n->next, arg_idx += 1)
+      {
+        args[arg_idx] = n->string;
+      }
+    }
+    Vec2F32 pos = v2f32((F32)f64_from_str8(args[0]), (F32)f64_from_str8(args[1]));
+
+    //- rjf: section / cmd / text
+    if(str8_match(op, str8_lit("section"), 0))
+    {
+      rd_bench_script_push(arena, &script, RD_BenchStepKind_Section)->string = push_str8_copy(arena, rest);
+    }
+    else if(str8_match(op, str8_lit("cmd"), 0))
+    {
+      rd_bench_script_push(arena, &script, RD_BenchStepKind_Cmd)->string = push_str8_copy(arena, rest);
+    }
+    else if(str8_match(op, str8_lit("text"), 0))
+    {
+      for(U64 off = 0; off < rest.size;)
+      {
+        UnicodeDecode decode = utf8_decode(rest.str+off, rest.size-off);
+        RD_BenchStep *step = rd_bench_script_push(arena, &script, RD_BenchStepKind_Event);
+        step->event.kind = OS_EventKind_Text;
+        step->event.character = decode.codepoint;
+        off += Max(1, decode.inc);
+      }
+    }
+
+    //- rjf: keys
+    else if(str8_match(op, str8_lit("key"), 0))
+    {
+      OS_Key key = rd_bench_key_from_string(args[0]);
+      OS_Modifiers modifiers = 0;
+      for(String8Node *n = parts.first->next ? parts.first->next->next : 0; n != 0; n = n->next)
+      {
+        if(str8_match(n->string, str8_lit("ctrl"), StringMatchFlag_CaseInsensitive))  {modifiers |= OS_Modifier_Ctrl;}
+        if(str8_match(n->string, str8_lit("shift"), StringMatchFlag_CaseInsensitive)) {modifiers |= OS_Modifier_Shift;}
+        if(str8_match(n->string, str8_lit("alt"), StringMatchFlag_CaseInsensitive))   {modifiers |= OS_Modifier_Alt;}
+      }
+      if(key == OS_Key_Null)
+      {
+        *error_out = push_str8f(arena, "line %I64u: unknown key \"%S\"", line_num, args[0]);
+        break;
+      }
+      rd_bench_script_push_event(arena, &script, OS_EventKind_Press, key, modifiers, v2f32(0, 0));
+      rd_bench_script_push_event(arena, &script, OS_EventKind_Release, key, modifiers, v2f32(0, 0));
+    }
+
+    //- rjf: mouse
+    else if(str8_match(op, str8_lit("move"), 0))
+    {
+      rd_bench_script_push_event(arena, &script, OS_EventKind_MouseMove, OS_Key_Null, 0, pos);
+    }
+    else if(str8_match(op, str8_lit("click"), 0))
+    {
+      rd_bench_script_push_event(arena, &script, OS_EventKind_MouseMove, OS_Key_Null, 0, pos);
+      rd_bench_script_push_event(arena, &script, OS_EventKind_Press, OS_Key_LeftMouseButton, 0, pos);
+      rd_bench_script_push_event(arena, &script, OS_EventKind_Release, OS_Key_LeftMouseButton, 0, pos);
+    }
+    else if(str8_match(op, str8_lit("scroll"), 0))
+    {
+      rd_bench_script_push_event(arena, &script, OS_EventKind_MouseMove, OS_Key_Null, 0, pos);
+      rd_bench_script_push_event(arena, &script, OS_EventKind_Scroll, OS_Key_Null, 0, pos);
+      script.last->event.delta = v2f32(0, (F32)f64_from_str8(args[2]));
+    }
+
+    //- rjf: frame steps
+    else if(str8_match(op, str8_lit("frames"), 0) ||
+            str8_match(op, str8_lit("settle"), 0) ||
+            str8_match(op, str8_lit("wait_stop"), 0))
+    {
+      RD_BenchStepKind kind = (op.str[0] == 'f' ? RD_BenchStepKind_Frames :
+                               op.str[0] == 's' ? RD_BenchStepKind_Settle :
+                               RD_BenchStepKind_WaitStop);
+      U64 count = 0;
+      if(args[0].size != 0 && !try_u64_from_str8_c_rules(args[0], &count))
+      {
+        *error_out = push_str8f(arena, "line %I64u: bad count \"%S\"", line_num, args[0]);
+        break;
+      }
+      rd_bench_script_push(arena, &script, kind)->count = count;
+    }
+
+    //- rjf: repeats
+    else if(str8_match(op, str8_lit("repeat"), 0))
+    {
+      RepeatTask *t = push_array(scratch.arena, RepeatTask, 1);
+      t->last_before_body = script.last;
+      t->count_before_body = script.count;
+      if(!try_u64_from_str8_c_rules(args[0], &t->repeat_count))
+      {
+        *error_out = push_str8f(arena, "line %I64u: bad repeat count \"%S\"", line_num, args[0]);
+        break;
+      }
+      SLLStackPush(top_repeat, t);
+    }
+    else if(str8_match(op, str8_lit("end"), 0))
+    {
+      RepeatTask *t = top_repeat;
+      if(t == 0)
+      {
+        *error_out = push_str8f(arena, "line %I64u: `end` without `repeat`", line_num);
+        break;
+      }
+      SLLStackPop(top_repeat);
+      RD_BenchStep *body_first = t->last_before_body ? t->last_before_body->next : script.first;
+      RD_BenchStep *body_last = script.last;
+      if(t->repeat_count == 0)
+      {
+        script.last = t->last_before_body;
+        script.count = t->count_before_body;
+        if(script.last) {script.last->next = 0;} else {script.first = 0;}
+      }
+      else if(body_first != 0)
+      {
+        for(U64 idx = 1; idx < t->repeat_count; idx += 1)
+        {
+          for(RD_BenchStep *src = body_first;; src = src->next)
+          {
+            RD_BenchStep *dst = rd_bench_script_push(arena, &script, src->kind);
+            dst->string = src->string;
+            dst->event  = src->event;
+            dst->count  = src->count;
+            if(src == body_last)
+            {
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    //- rjf: unknown
+    else
+    {
+      *error_out = push_str8f(arena, "line %I64u: unknown step \"%S\"", line_num, op);
+      break;
+    }
+  }
+  if(error_out->size == 0 && top_repeat != 0)
+  {
+    *error_out = str8_lit("`repeat` without `end`");
+  }
+  scratch_end(scratch);
+  return script;
+}
+
+////////////////////////////////
+//~ rjf: Scenarios
+
+internal CFG_Node *
+rd_bench_window(void)
+{
+  Temp scratch = scratch_begin(0, 0);
+  CFG_NodePtrList windows = cfg_node_top_level_list_from_string(scratch.arena, str8_lit("window"));
+  CFG_Node *window = windows.first ? windows.first->v : &cfg_nil_node;
+  scratch_end(scratch);
+  return window;
+}
+
+internal CFG_Node *
+rd_bench_layout_single_tab(String8 view_name, String8 expr)
+{
+  CFG_Node *window = rd_bench_window();
+  CFG_Node *tab = &cfg_nil_node;
+  if(window != &cfg_nil_node)
+  {
+    CFG_Node *old_panels = cfg_node_child_from_string(window, str8_lit("panels"));
+    if(old_panels != &cfg_nil_node)
+    {
+      cfg_node_release(rd_state->cfg, old_panels);
+    }
+    CFG_Node *panels = cfg_node_new(rd_state->cfg, window, str8_lit("panels"));
+    cfg_node_new(rd_state->cfg, panels, str8_lit("selected"));
+    tab = cfg_node_new(rd_state->cfg, panels, view_name);
+    cfg_node_new(rd_state->cfg, tab, str8_lit("selected"));
+    if(expr.size != 0)
+    {
+      CFG_Node *expr_cfg = cfg_node_new(rd_state->cfg, tab, str8_lit("expression"));
+      cfg_node_new(rd_state->cfg, expr_cfg, expr);
+    }
+  }
+  return tab;
+}
+
+internal String8
+rd_bench_setup_scenario(Arena *arena, RD_BenchScenarioKind kind, RD_BenchParams *params)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  String8 script = {0};
+  switch(kind)
+  {
+    default:{}break;
+
+    //- rjf: big watch window: many rows of target-independent expressions
+    case RD_BenchScenarioKind_Watch:
+    {
+      CFG_Node *tab = rd_bench_layout_single_tab(str8_lit("watch"), str8_zero());
+      for EachIndex(idx, params->watch_count)
+      {
+        String8 expr = {0};
+        switch(idx%5)
+        {
+          case 0:{expr = push_str8f(scratch.arena, "%I64u", idx);}break;
+          case 1:{expr = push_str8f(scratch.arena, "%I64u*3+1", idx);}break;
+          case 2:{expr = push_str8f(scratch.arena, "0x%I64x<<4", idx);}break;
+          case 3:{expr = push_str8f(scratch.arena, "%I64u.0/7", idx);}break;
+          case 4:{expr = push_str8f(scratch.arena, "\"watch row %I64u\"", idx);}break;
+        }
+        CFG_Node *watch = cfg_node_new(rd_state->cfg, tab, str8_lit("watch"));
+        cfg_node_new(rd_state->cfg, watch, expr);
+      }
+      script = str8_lit("settle\n"
+                        "section idle\n"
+                        "frames 60\n"
+                        "section cursor_down\n"
+                        "repeat 200\n key down\n frames 1\nend\n"
+                        "section page_down\n"
+                        "repeat 50\n key page_down\n frames 1\nend\n"
+                        "section wheel\n"
+                        "repeat 100\n scroll 400 400 3\n frames 1\nend\n"
+                        "section jump_ends\n"
+                        "repeat 10\n key end ctrl\n frames 2\n key home ctrl\n frames 2\nend\n");
+    }break;
+
+    //- rjf: huge source file
+    case RD_BenchScenarioKind_Source:
+    {
+      String8 path = push_str8f(scratch.arena, "%S/ui_bench_source.c", params->work_dir);
+      String8List lines = {0};
+      for EachIndex(idx, params->source_line_count)
+      {
+        switch(idx%8)
+        {
+          case 0:{str8_list_pushf(scratch.arena, &lines, "// function %I64u: synthesized for the UI benchmark\n", idx/8);}break;
+          case 1:{str8_list_pushf(scratch.arena, &lines, "static int func_%I64u(int a, int b, const char *name)\n", idx/8);}break;
+          case 2:{str8_list_pushf(scratch.arena, &lines, "{\n");}break;
+          case 3:{str8_list_pushf(scratch.arena, &lines, "  int result = a*%I64u + b - 0x%I64x;\n", idx%97, idx);}break;
+          case 4:{str8_list_pushf(scratch.arena, &lines, "  if(name != 0 && name[0] == '%c') { result += func_%I64u(b, a, name+1); }\n", 'a' + (char)(idx%26), idx/16);}break;
+          case 5:{str8_list_pushf(scratch.arena, &lines, "  for(int i = 0; i < %I64u; i += 1) { result ^= (result << 3) + i; }\n", idx%1000);}break;
+          case 6:{str8_list_pushf(scratch.arena, &lines, "  return result; /* \"%I64u\" */\n", idx);}break;
+          case 7:{str8_list_pushf(scratch.arena, &lines, "}\n");}break;
+        }
+      }
+      os_write_data_list_to_file_path(path, lines);
+      rd_bench_layout_single_tab(str8_lit("text"), rd_eval_string_from_file_path(scratch.arena, path));
+      script = str8_lit("settle\n"
+                        "section idle\n"
+                        "frames 60\n"
+                        "section cursor_down\n"
+                        "repeat 200\n key down\n frames 1\nend\n"
+                        "section page_down\n"
+                        "repeat 100\n key page_down\n frames 1\nend\n"
+                        "section wheel\n"
+                        "repeat 100\n scroll 600 400 3\n frames 1\nend\n"
+                        "section jump_ends\n"
+                        "repeat 10\n key end ctrl\n frames 2\n key home ctrl\n frames 2\nend\n"
+                        "section select_down\n"
+                        "repeat 100\n key down shift\n frames 1\nend\n");
+    }break;
+
+    //- rjf: deep call stack: stop a user-provided target (e.g. a core file, or
+    // a program which recurses deeply & then crashes), show its call stack
+    case RD_BenchScenarioKind_CallStack:
+    if(params->target_path.size != 0)
+    {
+      String8 path = path_absolute_dst_from_relative_dst_src(scratch.arena, params->target_path, os_get_current_path(scratch.arena));
+      rd_bench_layout_single_tab(str8_lit("watch"), str8_lit("query:call_stack"));
+      rd_cmd(RD_CmdKind_AddTarget, .file_path = path, .non_graphical = 1);
+      rd_cmd(RD_CmdKind_Run);
+      script = str8_lit("wait_stop 30000\n"
+                        "settle\n"
+                        "section idle\n"
+                        "frames 60\n"
+                        "section cursor_down\n"
+                        "repeat 200\n key down\n frames 1\nend\n"
+                        "section page_down\n"
+                        "repeat 50\n key page_down\n frames 1\nend\n"
+                        "section wheel\n"
+                        "repeat 100\n scroll 400 400 3\n frames 1\nend\n");
+    }break;
+  }
+  
+  // rjf: the layout was edited directly, rather than by commands or input,
+  // so nothing else would tell the frontend that it must rebuild its UI
+  rd_request_frame();
+  
+  scratch_end(scratch);
+  return script;
+}
+
+////////////////////////////////
+//~ rjf: Running
+
+internal void
+rd_bench_frame(void)
+{
+  update();
+}
+
+internal void
+rd_bench_run_script(Arena *arena, RD_BenchScript *script, RD_BenchParams *params, String8 scenario_name, RD_BenchSectionList *sections_out)
+{
+  RD_BenchSection *section = 0;
+  for(RD_BenchStep *step = script->first; step != 0; step = step->next)
+  {
+    //- rjf: begin new section on section steps, or on measured frames outside of any section
+    if(step->kind == RD_BenchStepKind_Section ||
+       (step->kind == RD_BenchStepKind_Frames && section == 0))
+    {
+      section = push_array(arena, RD_BenchSection, 1);
+      SLLQueuePush(sections_out->first, sections_out->last, section);
+      sections_out->count += 1;
+      section->name = (step->kind == RD_BenchStepKind_Section
+                       ? push_str8f(arena, "%S:%S", scenario_name, step->string)
+                       : scenario_name);
+      for(RD_BenchStep *s = (step->kind == RD_BenchStepKind_Section ? step->next : step);
+          s != 0 && s->kind != RD_BenchStepKind_Section;
+          s = s->next)
+      {
+        if(s->kind == RD_BenchStepKind_Frames)
+        {
+          section->frames_cap += s->count;
+        }
+      }
+      section->frames = push_array(arena, RD_FrameStats, section->frames_cap);
+    }
+
+    //- rjf: do step
+    switch(step->kind)
+    {
+      default:{}break;
+      case RD_BenchStepKind_Cmd:
+      {
+        CFG_Node *window = rd_bench_window();
+        Temp scratch = scratch_begin(&arena, 1);
+        CFG_PanelTree panel_tree = cfg_panel_tree_from_cfg(scratch.arena, window);
+        RD_RegsScope(.window = window->id,
+                     .panel  = panel_tree.focused->cfg->id,
+                     .tab    = panel_tree.focused->selected_tab->id,
+                     .view   = panel_tree.focused->selected_tab->id)
+        {
+          rd_cmd(RD_CmdKind_RunExternalDriverTextCommand, .string = step->string);
+        }
+        scratch_end(scratch);
+      }break;
+      case RD_BenchStepKind_Event:
+      {
+        OS_Event event = step->event;
+        event.window = rd_window_state_from_cfg(rd_bench_window())->os;
+        os_stub_push_event(&event);
+      }break;
+      case RD_BenchStepKind_Frames:
+      {
+        for EachIndex(idx, step->count)
+        {
+          rd_bench_frame();
+          if(section->frames_count < section->frames_cap)
+          {
+            section->frames[section->frames_count] = rd_state->last_frame_stats;
+            section->frames_count += 1;
+          }
+        }
+      }break;
+      case RD_BenchStepKind_Settle:
+      {
+        U64 max_frames = step->count ? step->count : params->settle_frames_max;
+        U64 quiet_frames = 0;
+        for(U64 idx = 0; idx < max_frames && quiet_frames < 8; idx += 1)
+        {
+          rd_bench_frame();
+          B32 quiet = (rd_state->num_frames_requested == 0 && fnt_pending_raster_count() == 0);
+          quiet_frames = quiet ? quiet_frames+1 : 0;
+          os_sleep_milliseconds(1);
+        }
+      }break;
+      case RD_BenchStepKind_WaitStop:
+      {
+        U64 timeout_us = (step->count ? step->count : 30000)*1000;
+        U64 endt_us = os_now_microseconds() + timeout_us;
+        U64 quiet_frames = 0;
+        for(;os_now_microseconds() < endt_us && quiet_frames < 32;)
+        {
+          Temp scratch = scratch_begin(&arena, 1);
+          rd_bench_frame();
+          CTRL_EntityArray processes = ctrl_entity_array_from_kind(&d_state->ctrl_entity_store->ctx, CTRL_EntityKind_Process);
+          CTRL_EntityArray threads = ctrl_entity_array_from_kind(&d_state->ctrl_entity_store->ctx, CTRL_EntityKind_Thread);
+          B32 stopped = (processes.count != 0 && threads.count != 0 && !d_ctrl_targets_running());
+          
+          // rjf: attached without a stop event (e.g. a core file)? -> select
+          // the first thread, so views of the selected thread have contents
+          if(stopped)
+          {
+            CTRL_Entity *selected_thread = ctrl_entity_from_handle(&d_state->ctrl_entity_store->ctx, rd_base_regs()->thread);
+            if(selected_thread == &ctrl_entity_nil)
+            {
+              rd_cmd(RD_CmdKind_SelectThread, .thread = ctrl_entity_array_first(&threads)->handle);
+            }
+          }
+          
+          // rjf: stopped -> also wait for the stopped modules' debug info to
+          // finish converting/loading, so unwinding & symbolication is stable
+          CFG_NodePtrList conversion_tasks = cfg_node_top_level_list_from_string(scratch.arena, str8_lit("conversion_task"));
+          quiet_frames = (stopped && conversion_tasks.count == 0) ? quiet_frames+1 : 0;
+          scratch_end(scratch);
+          os_sleep_milliseconds(1);
+        }
+      }break;
+    }
+  }
+}
+
+////////////////////////////////
+//~ rjf: Reporting
+
+typedef enum RD_BenchColumn
+{
+  RD_BenchColumn_Total,
+  RD_BenchColumn_UIBeginBuild,
+  RD_BenchColumn_UIBuild,
+  RD_BenchColumn_UIPrune,
+  RD_BenchColumn_UICalcSizes,
+  RD_BenchColumn_UILayout,
+  RD_BenchColumn_UIEndBuild,
+  RD_BenchColumn_Draw,
+  RD_BenchColumn_Submit,
+  RD_BenchColumn_Other,
+  RD_BenchColumn_Boxes,
+  RD_BenchColumn_COUNT
+}
+RD_BenchColumn;
+
+read_only global String8 rd_bench_column_name_table[RD_BenchColumn_COUNT] =
+{
+  str8_lit_comp("total"),
+  str8_lit_comp("ui_begin_build"),
+  str8_lit_comp("ui_build"),
+  str8_lit_comp("ui_prune"),
+  str8_lit_comp("ui_calc_sizes"),
+  str8_lit_comp("ui_layout"),
+  str8_lit_comp("ui_end_build"),
+  str8_lit_comp("draw"),
+  str8_lit_comp("submit"),
+  str8_lit_comp("other"),
+  str8_lit_comp("boxes"),
+};
+
+internal U64
+rd_bench_value_from_frame_column(RD_FrameStats *f, RD_BenchColumn column)
+{
+  U64 result = 0;
+  switch(column)
+  {
+    default:{}break;
+    case RD_BenchColumn_Total:        {result = f->total_us;}break;
+    case RD_BenchColumn_UIBeginBuild: {result = f->ui_begin_build_us;}break;
+    case RD_BenchColumn_UIBuild:      {result = f->ui_build_us;}break;
+    case RD_BenchColumn_UIPrune:      {result = f->ui_prune_us;}break;
+    case RD_BenchColumn_UICalcSizes:  {result = f->ui_calc_sizes_us;}break;
+    case RD_BenchColumn_UILayout:     {result = f->ui_layout_us;}break;
+    case RD_BenchColumn_UIEndBuild:   {result = f->ui_end_build_us;}break;
+    case RD_BenchColumn_Draw:         {result = f->draw_us;}break;
+    case RD_BenchColumn_Submit:       {result = f->submit_us;}break;
+    case RD_BenchColumn_Boxes:        {result = f->box_count;}break;
+    case RD_BenchColumn_Other:
+    {
+      U64 accounted = f->ui_begin_build_us + f->ui_build_us + f->ui_end_build_us + f->draw_us + f->submit_us;
+      result = f->total_us > accounted ? f->total_us - accounted : 0;
+    }break;
+  }
+  return result;
+}
+
+internal int
+rd_bench_u64_compare(U64 *a, U64 *b)
+{
+  return *a < *b ? -1 : *a > *b ? +1 : 0;
+}
+
+internal String8List
+rd_bench_report_from_sections(Arena *arena, RD_BenchSectionList *sections)
+{
+  String8List report = {0};
+  Temp scratch = scratch_begin(&arena, 1);
+  for EachNode(section, RD_BenchSection, sections->first)
+  {
+    str8_list_pushf(arena, &report, "%S (%I64u frames)\n", section->name, section->frames_count);
+    if(section->frames_count == 0)
+    {
+      continue;
+    }
+    str8_list_pushf(arena, &report, "  %-16s %10s %10s %10s %10s\n", "(ms)", "mean", "p50", "p95", "max");
+    U64 *values = push_array_no_zero(scratch.arena, U64, section->frames_count);
+    for EachEnumVal(RD_BenchColumn, column)
+    {
+      U64 sum = 0;
+      for EachIndex(idx, section->frames_count)
+      {
+        values[idx] = rd_bench_value_from_frame_column(&section->frames[idx], column);
+        sum += values[idx];
+      }
+      quick_sort(values, section->frames_count, sizeof(values[0]), rd_bench_u64_compare);
+      U64 p50 = values[(section->frames_count-1)*50/100];
+      U64 p95 = values[(section->frames_count-1)*95/100];
+      U64 max = values[section->frames_count-1];
+      F64 mean = (F64)sum / (F64)section->frames_count;
+      if(column == RD_BenchColumn_Boxes)
+      {
+        str8_list_pushf(arena, &report, "  %-16S %10.0f %10I64u %10I64u %10I64u\n", rd_bench_column_name_table[column], mean, p50, p95, max);
+      }
+      else
+      {
+        str8_list_pushf(arena, &report, "  %-16S %10.3f %10.3f %10.3f %10.3f\n", rd_bench_column_name_table[column], mean/1000.0, p50/1000.0, p95/1000.0, max/1000.0);
+      }
+    }
+  }
+  scratch_end(scratch);
+  return report;
+}
+
+internal String8List
+rd_bench_csv_from_sections(Arena *arena, RD_BenchSectionList *sections)
+{
+  String8List csv = {0};
+  str8_list_pushf(arena, &csv, "section,frame");
+  for EachEnumVal(RD_BenchColumn, column)
+  {
+    str8_list_pushf(arena, &csv, ",%S%s", rd_bench_column_name_table[column], column == RD_BenchColumn_Boxes ? "" : "_us");
+  }
+  str8_list_pushf(arena, &csv, "\n");
+  for EachNode(section, RD_BenchSection, sections->first)
+  {
+    for EachIndex(idx, section->frames_count)
+    {
+      str8_list_pushf(arena, &csv, "%S,%I64u", section->name, idx);
+      for EachEnumVal(RD_BenchColumn, column)
+      {
+        str8_list_pushf(arena, &csv, ",%I64u", rd_bench_value_from_frame_column(&section->frames[idx], column));
+      }
+      str8_list_pushf(arena, &csv, "\n");
+    }
+  }
+  return csv;
+}
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void
+rd_bench_entry_point(CmdLine *cmd_line)
+{
+  Arena *arena = arena_alloc();
+
+  //- rjf: unpack command line
+  RD_BenchParams params = {0};
+  String8List scenario_names = cmd_line_strings(cmd_line, str8_lit("ui_bench"));
+  String8 csv_path = cmd_line_string(cmd_line, str8_lit("csv"));
+  B32 async_raster = cmd_line_has_flag(cmd_line, str8_lit("async_raster"));
+  U64 width = 1920;
+  U64 height = 1080;
+  {
+    params.work_dir          = cmd_line_string(cmd_line, str8_lit("work_dir"));
+    params.target_path       = cmd_line_string(cmd_line, str8_lit("target"));
+    params.script_path       = cmd_line_string(cmd_line, str8_lit("script"));
+    params.watch_count       = 2000;
+    params.source_line_count = 200000;
+    params.settle_frames_max = 600;
+    try_u64_from_str8_c_rules(cmd_line_string(cmd_line, str8_lit("watch_count")), &params.watch_count);
+    try_u64_from_str8_c_rules(cmd_line_string(cmd_line, str8_lit("source_lines")), &params.source_line_count);
+    try_u64_from_str8_c_rules(cmd_line_string(cmd_line, str8_lit("settle_frames")), &params.settle_frames_max);
+    try_u64_from_str8_c_rules(cmd_line_string(cmd_line, str8_lit("width")), &width);
+    try_u64_from_str8_c_rules(cmd_line_string(cmd_line, str8_lit("height")), &height);
+    if(params.work_dir.size == 0)
+    {
+      params.work_dir = push_str8f(arena, "%S/raddbg_ui_bench", os_get_current_path(arena));
+    }
+    params.work_dir = path_absolute_dst_from_relative_dst_src(arena, params.work_dir, os_get_current_path(arena));
+  }
+
+  //- rjf: pick scenarios - all canned scenarios by default, or none if a
+  // script is provided, in which case it runs against the loaded config
+  B32 scenario_selected[RD_BenchScenarioKind_COUNT] = {0};
+  B32 run_script_alone = (scenario_names.node_count == 0 && params.script_path.size != 0);
+  if(scenario_names.node_count == 0 && !run_script_alone)
+  {
+    for EachEnumVal(RD_BenchScenarioKind, k)
+    {
+      scenario_selected[k] = (k != RD_BenchScenarioKind_CallStack || params.target_path.size != 0);
+    }
+  }
+  for EachNode(n, String8Node, scenario_names.first)
+  {
+    B32 found = 0;
+    for EachEnumVal(RD_BenchScenarioKind, k)
+    {
+      if(str8_match(n->string, rd_bench_scenario_name_table[k], StringMatchFlag_CaseInsensitive))
+      {
+        scenario_selected[k] = 1;
+        found = 1;
+      }
+    }
+    if(!found)
+    {
+      fprintf(stderr, "error: unknown scenario \"%.*s\" (expected watch, source, or callstack)\n", str8_varg(n->string));
+      return;
+    }
+  }
+  if(scenario_selected[RD_BenchScenarioKind_CallStack] && params.target_path.size == 0)
+  {
+    fprintf(stderr, "error: the callstack scenario needs a stopped target; pass --target:<executable or core file>\n");
+    return;
+  }
+  String8 custom_script = {0};
+  if(params.script_path.size != 0)
+  {
+    custom_script = os_data_from_file_path(arena, params.script_path);
+    if(custom_script.size == 0)
+    {
+      fprintf(stderr, "error: could not read script \"%.*s\"\n", str8_varg(params.script_path));
+      return;
+    }
+  }
+
+  //- rjf: use fresh user & project files in the work directory, unless specified
+  os_make_directory(params.work_dir);
+  {
+    String8 names[] = {str8_lit_comp("user"), str8_lit_comp("project")};
+    for EachElement(idx, names)
+    {
+      if(cmd_line_string(cmd_line, names[idx]).size == 0)
+      {
+        String8 path = push_str8f(arena, "%S/ui_bench.raddbg_%S", params.work_dir, names[idx]);
+        os_delete_file_at_path(path);
+        String8List values = {0};
+        str8_list_push(arena, &values, path);
+        cmd_line_insert_opt(arena, cmd_line, names[idx], values);
+      }
+    }
+  }
+
+  //- rjf: initialize layers, with a fixed-size, always-focused stub window
+  {
+    dmn_init();
+    ctrl_init();
+    os_gfx_init();
+    fp_init();
+    r_init(cmd_line);
+    fnt_init();
+    d_init();
+    rd_init(cmd_line);
+    os_stub_set_client_rect(r2f32p(0, 0, (F32)width, (F32)height));
+    os_stub_set_windows_focused(1);
+    fnt_set_async_raster(async_raster);
+  }
+
+  //- rjf: let startup config loading finish
+  {
+    RD_BenchScript startup = {0};
+    rd_bench_script_push(arena, &startup, RD_BenchStepKind_Settle);
+    RD_BenchSectionList ignored = {0};
+    rd_bench_run_script(arena, &startup, &params, str8_lit("startup"), &ignored);
+  }
+
+  //- rjf: run scenarios
+  RD_BenchSectionList sections = {0};
+  for EachEnumVal(RD_BenchScenarioKind, k)
+  {
+    if(!scenario_selected[k] && !(run_script_alone && k == 0))
+    {
+      continue;
+    }
+    String8 scenario_name = run_script_alone ? str8_skip_last_slash(params.script_path) : rd_bench_scenario_name_table[k];
+    String8 script_string = run_script_alone ? custom_script : rd_bench_setup_scenario(arena, k, &params);
+    if(custom_script.size != 0 && !run_script_alone)
+    {
+      script_string = push_str8f(arena, "%ssettle\n%S", k == RD_BenchScenarioKind_CallStack ? "wait_stop\n" : "", custom_script);
+    }
+    String8 error = {0};
+    RD_BenchScript script = rd_bench_script_from_string(arena, script_string, &error);
+    if(error.size != 0)
+    {
+      fprintf(stderr, "error: %.*s: %.*s\n", str8_varg(scenario_name), str8_varg(error));
+      continue;
+    }
+    fprintf(stderr, "running %.*s...\n", str8_varg(scenario_name));
+    rd_bench_run_script(arena, &script, &params, scenario_name, &sections);
+  }
+
+  //- rjf: report
+  String8List report = rd_bench_report_from_sections(arena, &sections);
+  for EachNode(n, String8Node, report.first)
+  {
+    fwrite(n->string.str, 1, n->string.size, stdout);
+  }
+  fflush(stdout);
+  if(csv_path.size != 0)
+  {
+    String8List csv = rd_bench_csv_from_sections(arena, &sections);
+    if(!os_write_data_list_to_file_path(csv_path, csv))
+    {
+      fprintf(stderr, "error: could not write %.*s\n", str8_varg(csv_path));
+    }
+  }
+}
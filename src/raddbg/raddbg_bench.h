@@ -0,0 +1,159 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#ifndef RADDBG_BENCH_H
+#define RADDBG_BENCH_H
+
+////////////////////////////////
+//~ rjf: UI Benchmark Overview
+//
+// `raddbg --ui_bench` runs the frontend headlessly, for regression-testing UI
+// performance on machines without a GPU or display. It is only available in
+// builds which use the stub OS graphics & render backends (`build raddbg_uibench`).
+//
+// Each scenario replaces the first window's panels with a canned layout (a
+// big watch window, a huge source file, or a deep call stack), lets it load,
+// and then replays a script of input events against it. Scripts are plain
+// text, one step per line:
+//
+//   section <name>          begin a new section of the report
+//   cmd <command> [args]    run a command, in the same syntax as `--ipc`
+//   key <key> [ctrl|shift|alt...]   press & release a key
+//   text <string>           type a string
+//   move <x> <y>            move the mouse
+//   click <x> <y>           move the mouse, press & release the left button
+//   scroll <x> <y> <dy>     move the mouse, then scroll by dy notches
+//   frames <n>              run & measure n frames
+//   settle [max frames]     run unmeasured frames until nothing is pending
+//   wait_stop [timeout ms]  run unmeasured frames until targets are stopped,
+//                           and their debug info is loaded
+//   repeat <n> ... end      repeat the enclosed steps n times
+//
+// Events are delivered on the next frame which runs. Every measured frame
+// records an `RD_FrameStats` - a breakdown of time spent in UI building,
+// sizing, layout, draw-list generation, and submission - and the report
+// summarizes each section's frames, optionally writing all frames to a CSV.
+// Frames which had nothing to rebuild skip the UI entirely (see
+// `RD_FrameSignature`), and are recorded with zero boxes & windows.
+
+////////////////////////////////
+//~ rjf: Script Types
+
+typedef enum RD_BenchStepKind
+{
+  RD_BenchStepKind_Null,
+  RD_BenchStepKind_Section,
+  RD_BenchStepKind_Cmd,
+  RD_BenchStepKind_Event,
+  RD_BenchStepKind_Frames,
+  RD_BenchStepKind_Settle,
+  RD_BenchStepKind_WaitStop,
+  RD_BenchStepKind_COUNT
+}
+RD_BenchStepKind;
+
+typedef struct RD_BenchStep RD_BenchStep;
+struct RD_BenchStep
+{
+  RD_BenchStep *next;
+  RD_BenchStepKind kind;
+  String8 string;
+  OS_Event event;
+  U64 count;
+};
+
+typedef struct RD_BenchScript RD_BenchScript;
+struct RD_BenchScript
+{
+  RD_BenchStep *first;
+  RD_BenchStep *last;
+  U64 count;
+};
+
+////////////////////////////////
+//~ rjf: Scenario Types
+
+typedef enum RD_BenchScenarioKind
+{
+  RD_BenchScenarioKind_Watch,
+  RD_BenchScenarioKind_Source,
+  RD_BenchScenarioKind_CallStack,
+  RD_BenchScenarioKind_COUNT
+}
+RD_BenchScenarioKind;
+
+typedef struct RD_BenchParams RD_BenchParams;
+struct RD_BenchParams
+{
+  String8 work_dir;
+  String8 target_path;
+  String8 script_path;
+  U64 watch_count;
+  U64 source_line_count;
+  U64 settle_frames_max;
+};
+
+////////////////////////////////
+//~ rjf: Result Types
+
+typedef struct RD_BenchSection RD_BenchSection;
+struct RD_BenchSection
+{
+  RD_BenchSection *next;
+  String8 name;
+  U64 frames_count;
+  U64 frames_cap;
+  RD_FrameStats *frames;
+};
+
+typedef struct RD_BenchSectionList RD_BenchSectionList;
+struct RD_BenchSectionList
+{
+  RD_BenchSection *first;
+  RD_BenchSection *last;
+  U64 count;
+};
+
+////////////////////////////////
+//~ rjf: Globals
+
+read_only global String8 rd_bench_scenario_name_table[RD_BenchScenarioKind_COUNT] =
+{
+  str8_lit_comp("watch"),
+  str8_lit_comp("source"),
+  str8_lit_comp("callstack"),
+};
+
+////////////////////////////////
+//~ rjf: Script Parsing
+
+internal OS_Key rd_bench_key_from_string(String8 string);
+internal RD_BenchStep *rd_bench_script_push(Arena *arena, RD_BenchScript *script, RD_BenchStepKind kind);
+internal void rd_bench_script_push_event(Arena *arena, RD_BenchScript *script, OS_EventKind kind, OS_Key key, OS_Modifiers modifiers, Vec2F32 pos);
+internal RD_BenchScript rd_bench_script_from_string(Arena *arena, String8 string, String8 *error_out);
+
+////////////////////////////////
+//~ rjf: Scenarios
+
+internal CFG_Node *rd_bench_window(void);
+internal CFG_Node *rd_bench_layout_single_tab(String8 view_name, String8 expr);
+internal String8 rd_bench_setup_scenario(Arena *arena, RD_BenchScenarioKind kind, RD_BenchParams *params);
+
+////////////////////////////////
+//~ rjf: Running
+
+internal void rd_bench_frame(void);
+internal void rd_bench_run_script(Arena *arena, RD_BenchScript *script, RD_BenchParams *params, String8 scenario_name, RD_BenchSectionList *sections_out);
+
+////////////////////////////////
+//~ rjf: Reporting
+
+internal String8List rd_bench_report_from_sections(Arena *arena, RD_BenchSectionList *sections);
+internal String8List rd_bench_csv_from_sections(Arena *arena, RD_BenchSectionList *sections);
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void rd_bench_entry_point(CmdLine *cmd_line);
+
+#endif // RADDBG_BENCH_H
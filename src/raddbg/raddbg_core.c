@@ -5644,6 +5644,37 @@ rd_window_frame(void)
         {
           ProfEndCapture();
         }
+        if(ui_clicked(ui_buttonf("Dump Profiler Trace")))
+        {
+          rd_cmd(RD_CmdKind_DumpProfilerTrace);
+        }
+        
+        //- rjf: lock contention statistics
+        if(ui_clicked(rd_icon_button(lock_stats_enabled ? RD_IconKind_CheckFilled : RD_IconKind_CheckHollow, 0, str8_lit("lock_stats"))))
+        {
+          rd_cmd(RD_CmdKind_ToggleLockStats);
+        }
+        if(lock_stats_enabled)
+        {
+          Temp scratch = scratch_begin(0, 0);
+          LockStatsGroupSummaryArray summaries = lock_stats_group_summaries(scratch.arena);
+          for EachIndex(idx, summaries.count)
+          {
+            LockStatsGroupSummary *s = &summaries.v[idx];
+            F64 rate = s->total.take_count ? (F64)s->total.contended_count / (F64)s->total.take_count : 0;
+            ui_labelf("%S: %I64u / %I64u contended (%.2f%%), %.3f ms waiting, hottest stripe %I64u",
+                      s->name, s->total.contended_count, s->total.take_count, rate*100.0, s->total.wait_us/1000.0, s->hottest_idx);
+          }
+          if(ui_clicked(ui_buttonf("Dump Lock Contention Statistics")))
+          {
+            rd_cmd(RD_CmdKind_DumpLockStats);
+          }
+          if(ui_clicked(ui_buttonf("Reset Lock Contention Statistics")))
+          {
+            lock_stats_reset();
+          }
+          scratch_end(scratch);
+        }
         
         //- rjf: toggles
         for(U64 idx = 0; idx < ArrayCount(DEV_toggle_table); idx += 1)
@@ -7250,7 +7281,13 @@ rd_window_frame(void)
           dr_fstrs_push_new(scratch.arena, &status_fstrs, &params, str8_lit("  Running..."));
           if(long_running_tasks.count != 0)
           {
+            DI_ConversionProgress progress = di_conversion_progress();
+            U64 eta_seconds = (progress.eta_us + 999999)/1000000;
             String8 string = push_str8f(scratch.arena, "  Loading %I64u debug information file%s...", long_running_tasks.count, long_running_tasks.count == 1 ? "" : "s");
+            if(eta_seconds > 1)
+            {
+              string = push_str8f(scratch.arena, "  Loading %I64u debug information file%s (about %I64us remaining)...", long_running_tasks.count, long_running_tasks.count == 1 ? "" : "s", eta_seconds);
+            }
             dr_fstrs_push_new(scratch.arena, &status_fstrs, &params, string);
           }
         }
@@ -8469,6 +8506,21 @@ rd_window_frame(void)
     ui_end_build();
   }
   
+  //////////////////////////////
+  //- rjf: @window_frame_part accumulate ui build stats
+  //
+  {
+    UI_BuildStats ui_stats = ui_build_stats_from_state(ws->ui);
+    rd_state->frame_stats.ui_begin_build_us += ui_stats.begin_build_us;
+    rd_state->frame_stats.ui_build_us       += ui_stats.build_us;
+    rd_state->frame_stats.ui_prune_us       += ui_stats.prune_us;
+    rd_state->frame_stats.ui_calc_sizes_us  += ui_stats.calc_sizes_us;
+    rd_state->frame_stats.ui_layout_us      += ui_stats.layout_us;
+    rd_state->frame_stats.ui_end_build_us   += ui_stats.end_build_us;
+    rd_state->frame_stats.box_count         += ui_stats.box_count;
+    rd_state->frame_stats.window_count      += 1;
+  }
+  
   //////////////////////////////
   //- rjf: @window_frame_part hover eval cancelling
   //
@@ -8491,6 +8543,7 @@ rd_window_frame(void)
   //////////////////////////////
   //- rjf: @window_frame_part draw UI
   //
+  U64 draw_begin_us = os_now_microseconds();
   ws->draw_bucket = dr_bucket_make();
   DR_BucketScope(ws->draw_bucket)
     ProfScope("draw UI")
@@ -9016,6 +9069,7 @@ rd_window_frame(void)
     
     scratch_end(scratch);
   }
+  rd_state->frame_stats.draw_us += os_now_microseconds() - draw_begin_us;
   
   //////////////////////////////
   //- rjf: @window_frame_part update per-window frame counters/info
@@ -9690,6 +9744,24 @@ rd_request_frame(void)
   rd_state->num_frames_requested = 4;
 }
 
+internal RD_FrameSignature
+rd_frame_signature(void)
+{
+  RD_FrameSignature signature = {0};
+  signature.ctrl_events_gen          = d_ctrl_events_gen();
+  signature.ctrl_run_gen             = ctrl_run_gen();
+  signature.ctrl_mem_gen             = ctrl_mem_gen();
+  signature.ctrl_reg_gen             = ctrl_reg_gen();
+  signature.ctrl_sample_gen          = ctrl_sample_gen();
+  signature.di_load_gen              = di_load_gen();
+  signature.fs_change_gen            = fs_change_gen();
+  signature.ss_gen                   = ss_gen();
+  signature.ac_completion_gen        = ac_completion_gen();
+  signature.c_submit_gen             = c_submit_gen();
+  signature.fnt_done_raster_gen      = fnt_done_raster_gen();
+  return signature;
+}
+
 ////////////////////////////////
 //~ rjf: Main State Accessors
 
@@ -10374,6 +10446,8 @@ rd_frame(void)
   arena_clear(rd_frame_arena());
   rd_state->top_regs = &rd_state->base_regs;
   rd_regs_copy_contents(rd_frame_arena(), &rd_state->top_regs->v, &rd_state->top_regs->v);
+  RD_Regs *next_hover_regs_restore = rd_state->next_hover_regs;
+  RD_RegSlot next_hover_regs_slot_restore = rd_state->next_hover_regs_slot;
   if(rd_state->next_hover_regs != 0)
   {
     rd_state->hover_regs = rd_regs_copy(rd_frame_arena(), rd_state->next_hover_regs);
@@ -10493,7 +10567,10 @@ rd_frame(void)
   //////////////////////////////
   //- rjf: garbage collect untouched immediate cfg trees
   //
-  if(rd_state->frame_depth == 1)
+  // NOTE(rjf): if the last frame skipped building the UI, then nothing has
+  // had a chance to re-mark its immediate trees as hot, so wait a frame.
+  //
+  if(rd_state->frame_depth == 1 && !rd_state->last_frame_skipped_ui)
   {
     CFG_Node *transient = cfg_node_child_from_string(cfg_node_root(), str8_lit("transient"));
     for(CFG_Node *tln = transient->first, *next = &cfg_nil_node; tln != &cfg_nil_node; tln = next)
@@ -10554,6 +10631,10 @@ rd_frame(void)
   ProfScope("sync with di parsers")
   {
     DI_EventList events = di_get_events(scratch.arena);
+    if(events.count != 0)
+    {
+      rd_request_frame();
+    }
     for(DI_EventNode *n = events.first; n != 0; n = n->next)
     {
       DI_Event *event = &n->v;
@@ -10645,6 +10726,7 @@ rd_frame(void)
   {
     events = os_get_events(scratch.arena, rd_state->num_frames_requested == 0 && !DEV_always_refresh);
   }
+  U64 os_events_count = events.count;
   
   //////////////////////////////
   //- rjf: push frame scopes
@@ -10724,6 +10806,10 @@ rd_frame(void)
   //- rjf: begin measuring actual per-frame work
   //
   U64 begin_time_us = os_now_microseconds();
+  if(rd_state->frame_depth == 1)
+  {
+    MemoryZeroStruct(&rd_state->frame_stats);
+  }
   
   //////////////////////////////
   //- rjf: bind change
@@ -10804,6 +10890,9 @@ rd_frame(void)
       rd_state->font_slot_table[RD_FontSlot_Code] = fnt_tag_from_static_data_string(&rd_default_code_font_bytes);
     }
     rd_state->font_slot_table[RD_FontSlot_Icons] = fnt_tag_from_static_data_string(&rd_icon_font_bytes);
+    U64 font_cache_budget_mb = 64;
+    try_u64_from_str8_c_rules(rd_setting_from_name(str8_lit("font_cache_budget_mb")), &font_cache_budget_mb);
+    fnt_set_memory_budget(MB(Clamp(4, font_cache_budget_mb, 1024)));
   }
   
   //////////////////////////////
@@ -11735,6 +11824,12 @@ rd_frame(void)
         {str8_lit("bitmap"),      0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(bitmap),            EV_EXPAND_RULE_INFO_FUNCTION_NAME(bitmap)},
         {str8_lit("color"),       0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(color),             EV_EXPAND_RULE_INFO_FUNCTION_NAME(color)},
         {str8_lit("geo3d"),       0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(geo3d),             EV_EXPAND_RULE_INFO_FUNCTION_NAME(geo3d)},
+        {str8_lit("sum"),         0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(sum),               EV_EXPAND_RULE_INFO_FUNCTION_NAME(sum)},
+        {str8_lit("min"),         0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(min),               EV_EXPAND_RULE_INFO_FUNCTION_NAME(sum)},
+        {str8_lit("max"),         0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(max),               EV_EXPAND_RULE_INFO_FUNCTION_NAME(sum)},
+        {str8_lit("mean"),        0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(mean),              EV_EXPAND_RULE_INFO_FUNCTION_NAME(sum)},
+        {str8_lit("histogram"),   0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(histogram),         EV_EXPAND_RULE_INFO_FUNCTION_NAME(histogram)},
+        {str8_lit("file_search"), 0, 0, 0,        0, 0, {0}, RD_VIEW_UI_FUNCTION_NAME(file_search),       EV_EXPAND_RULE_INFO_FUNCTION_NAME(file_search)},
       };
       
       //- rjf: fill lenses in ev expand rule map, rd view ui rule map
@@ -15082,6 +15177,23 @@ rd_frame(void)
             mtx_push_op(d_state->output_log_key, op);
           }break;
           
+          //- rjf: sampling profiler
+          case RD_CmdKind_CopySampleProfile:
+          {
+            Access *access = access_open();
+            CTRL_SampleTree tree = ctrl_sample_tree(access, os_now_microseconds()+1000000);
+            String8 folded_stacks = ctrl_folded_stacks_string_from_sample_tree(scratch.arena, &tree);
+            if(tree.sample_count == 0)
+            {
+              log_user_error(str8_lit("No call stack samples have been collected. Use \"Run With Sampling Profiler\" to collect samples."));
+            }
+            else
+            {
+              os_set_clipboard_text(folded_stacks);
+            }
+            access_close(access);
+          }break;
+          
           //- rjf: watch pins
           case RD_CmdKind_AddWatchPin:
           case RD_CmdKind_ToggleWatchPin:
@@ -15425,6 +15537,33 @@ rd_frame(void)
           {
             log_infof("\"#MARKER\"");
           }break;
+          case RD_CmdKind_ToggleProfilerCapture:
+          {
+            if(ProfIsCapturing())
+            {
+              ProfEndCapture();
+            }
+            else
+            {
+              ProfBeginCapture("raddbg");
+            }
+          }break;
+          case RD_CmdKind_DumpProfilerTrace:
+          {
+            if(!ProfDumpCapture(0))
+            {
+              log_user_error(str8_lit("Could not write the profiler trace."));
+            }
+          }break;
+          case RD_CmdKind_ToggleLockStats:
+          {
+            lock_stats_enabled ^= 1;
+          }break;
+          case RD_CmdKind_DumpLockStats:
+          {
+            String8List report = lock_stats_report(scratch.arena);
+            log_infof("lock contention statistics:\n%S", str8_list_join(scratch.arena, &report, 0));
+          }break;
           
           //- rjf: os event passthrough
           case RD_CmdKind_OSEvent:
@@ -16203,11 +16342,33 @@ rd_frame(void)
       }
     }
     
+    ////////////////////////////
+    //- rjf: gather sampling profiler parameters
+    //
+    U64 sample_interval_us = rd_setting_u64_from_name(str8_lit("sample_interval_us"));
+    U64 sample_overhead_pct = rd_setting_u64_from_name(str8_lit("sample_overhead_pct"));
+    
+    ////////////////////////////
+    //- rjf: sync symbol store sources
+    //
+    {
+      String8List sources = {0};
+      ss_source_list_push_from_string(scratch.arena, &sources, rd_setting_from_name(str8_lit("symbol_stores")));
+      String8List env_sources = ss_source_list_from_environment(scratch.arena);
+      str8_list_concat_in_place(&sources, &env_sources);
+      ss_set_sources(rd_setting_from_name(str8_lit("symbol_cache_dir")), sources);
+      String8List ss_user_errors = ss_take_user_errors(scratch.arena);
+      for EachNode(n, String8Node, ss_user_errors.first)
+      {
+        log_user_error(n->string);
+      }
+    }
+    
     ////////////////////////////
     //- rjf: tick debug engine
     //
     U64 cmd_count_pre_tick = rd_state->cmds[0].count;
-    D_EventList engine_events = d_tick(scratch.arena, &targets, &breakpoints, &path_maps, exception_code_filters);
+    D_EventList engine_events = d_tick(scratch.arena, &targets, &breakpoints, &path_maps, exception_code_filters, sample_interval_us, sample_overhead_pct);
     
     ////////////////////////////
     //- rjf: process debug engine events
@@ -16363,6 +16524,52 @@ rd_frame(void)
     rd_cmd(RD_CmdKind_FindThread, .thread = find_thread_retry);
   }
   
+  //////////////////////////////
+  //- rjf: determine if windows need to be rebuilt
+  //
+  // if this frame was only woken up by asynchronous work (no OS events, no
+  // commands, no requested frames), and none of that work has changed any
+  // state which the UI reads since the last frame which built the UI, then
+  // rebuilding would produce the same UI, so building & rendering all
+  // windows can be skipped. the engine has still been ticked above.
+  //
+  B32 skip_ui = 0;
+  if(rd_state->frame_depth == 1)
+  {
+    RD_FrameSignature signature = rd_frame_signature();
+    skip_ui = (rd_state->frame_index != 0 &&
+               !DEV_always_refresh &&
+               !rd_state->quit &&
+               os_events_count == 0 &&
+               rd_state->cmds[0].count == 0 &&
+               rd_state->num_frames_requested == 0 &&
+               rd_state->drag_drop_state == RD_DragDropState_Null &&
+               MemoryMatchStruct(&signature, &rd_state->last_built_frame_signature));
+    if(skip_ui)
+    {
+      // rjf: carry state, which would've been refreshed by the UI build,
+      // over to the next frame which builds
+      rd_state->next_hover_regs = next_hover_regs_restore;
+      rd_state->next_hover_regs_slot = next_hover_regs_slot_restore;
+      rd_state->text_edit_mode = !allow_text_hotkeys;
+      rd_state->skipped_frame_count += 1;
+    }
+    else
+    {
+      rd_state->last_built_frame_signature = signature;
+    }
+    rd_state->last_frame_skipped_ui = skip_ui;
+  }
+  
+  //////////////////////////////
+  //- rjf: building -> advance the update tick (also begins the font cache's
+  // frame); skipped frames must not age anything which the UI touches
+  //
+  if(!skip_ui)
+  {
+    update_tick_advance();
+  }
+  
   ////////////////////////////
   //- rjf: rotate command slots, bump command gen counter
   //
@@ -16500,6 +16707,7 @@ rd_frame(void)
   //////////////////////////////
   //- rjf: update/render all windows
   //
+  if(!skip_ui)
   {
     dr_begin_frame(rd_font_from_slot(RD_FontSlot_Icons));
     CFG_NodePtrList windows = cfg_node_top_level_list_from_string(scratch.arena, str8_lit("window"));
@@ -16527,6 +16735,7 @@ rd_frame(void)
   //////////////////////////////
   //- rjf: garbage collect untouched window states
   //
+  if(!skip_ui)
   {
     for EachIndex(slot_idx, rd_state->window_state_slots_count)
     {
@@ -16589,8 +16798,9 @@ rd_frame(void)
   //////////////////////////////
   //- rjf: submit rendering to all windows
   //
-  ProfScope("submit rendering to all windows")
+  if(!skip_ui) ProfScope("submit rendering to all windows")
   {
+    U64 submit_begin_us = os_now_microseconds();
     r_begin_frame();
     for(RD_WindowState *w = rd_state->first_window_state; w != &rd_nil_window_state; w = w->order_next)
     {
@@ -16599,6 +16809,7 @@ rd_frame(void)
       r_window_end_frame(w->os, w->r);
     }
     r_end_frame();
+    rd_state->frame_stats.submit_us += os_now_microseconds() - submit_begin_us;
   }
   
   //////////////////////////////
@@ -16627,7 +16838,15 @@ rd_frame(void)
   //
   U64 end_time_us = os_now_microseconds();
   U64 frame_time_us = end_time_us-begin_time_us;
-  rd_state->frame_time_us_history[rd_state->frame_index%ArrayCount(rd_state->frame_time_us_history)] = frame_time_us;
+  if(!skip_ui)
+  {
+    rd_state->frame_time_us_history[rd_state->frame_index%ArrayCount(rd_state->frame_time_us_history)] = frame_time_us;
+  }
+  if(rd_state->frame_depth == 1)
+  {
+    rd_state->frame_stats.total_us = frame_time_us;
+    rd_state->last_frame_stats = rd_state->frame_stats;
+  }
   
   //////////////////////////////
   //- rjf: [windows] clear pages from working set shortly after startup, many of which will not be needed
@@ -16645,7 +16864,14 @@ rd_frame(void)
   //////////////////////////////
   //- rjf: bump frame time counters
   //
-  rd_state->frame_index += 1;
+  // NOTE(rjf): frames which skipped the UI do not count as frames, for the
+  // purposes of per-frame state (frame arenas, touch-based garbage
+  // collection), so that state from the last built frame stays alive.
+  //
+  if(!skip_ui)
+  {
+    rd_state->frame_index += 1;
+  }
   rd_state->time_in_seconds += rd_state->frame_dt;
   rd_state->time_in_us += frame_time_us;
   
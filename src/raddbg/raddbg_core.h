@@ -351,6 +351,53 @@ struct RD_WindowStateSlot
   RD_WindowState *last;
 };
 
+////////////////////////////////
+//~ rjf: Per-Frame Timing Stats
+//
+// Breakdown of the last frame's work, summed across all windows. `total_us`
+// covers everything in `rd_frame` after events are gathered; the UI parts
+// come from each window's `UI_BuildStats`.
+
+typedef struct RD_FrameStats RD_FrameStats;
+struct RD_FrameStats
+{
+  U64 total_us;
+  U64 ui_begin_build_us;
+  U64 ui_build_us;
+  U64 ui_prune_us;
+  U64 ui_calc_sizes_us;
+  U64 ui_layout_us;
+  U64 ui_end_build_us;
+  U64 draw_us;
+  U64 submit_us;
+  U64 box_count;
+  U64 window_count;
+};
+
+////////////////////////////////
+//~ rjf: Frame Change Signature
+//
+// Generations of all asynchronously-changing state which the UI reads. When a
+// frame is woken up without any OS events, commands, or requested frames, and
+// this signature matches that of the last frame which built the UI, the frame
+// still ticks the engine, but skips building & rendering all windows.
+
+typedef struct RD_FrameSignature RD_FrameSignature;
+struct RD_FrameSignature
+{
+  U64 ctrl_events_gen;
+  U64 ctrl_run_gen;
+  U64 ctrl_mem_gen;
+  U64 ctrl_reg_gen;
+  U64 ctrl_sample_gen;
+  U64 di_load_gen;
+  U64 fs_change_gen;
+  U64 ss_gen;
+  U64 ac_completion_gen;
+  U64 c_submit_gen;
+  U64 fnt_done_raster_gen;
+};
+
 ////////////////////////////////
 //~ rjf: Main Per-Process Graphical State
 
@@ -433,7 +480,12 @@ struct RD_State
   U64 frame_index;
   Arena *frame_arenas[2];
   U64 frame_time_us_history[64];
+  RD_FrameStats frame_stats;
+  RD_FrameStats last_frame_stats;
   U64 num_frames_requested;
+  RD_FrameSignature last_built_frame_signature;
+  B32 last_frame_skipped_ui;
+  U64 skipped_frame_count;
   F64 time_in_seconds;
   U64 time_in_us;
   
@@ -780,6 +832,7 @@ internal RD_VocabInfo *rd_vocab_info_from_code_name_plural(String8 code_name_plu
 //~ rjf: Continuous Frame Requests
 
 internal void rd_request_frame(void);
+internal RD_FrameSignature rd_frame_signature(void);
 
 ////////////////////////////////
 //~ rjf: Main State Accessors
@@ -6,3 +6,6 @@
 #include "raddbg_widgets.c"
 #include "raddbg_views.c"
 #include "raddbg_legacy_config.c"
+#if OS_GFX_STUB
+# include "raddbg_bench.c"
+#endif
@@ -9,5 +9,8 @@
 #include "raddbg_widgets.h"
 #include "raddbg_views.h"
 #include "raddbg_legacy_config.h"
+#if OS_GFX_STUB
+# include "raddbg_bench.h"
+#endif
 
 #endif // RADDBG_INC_H
@@ -120,11 +120,7 @@
 // [ ] EVAL LOOKUP RULES -> currently going 0 -> rdis_count, but we need
 //  to prioritize the primary rdi
 // [ ] wide transforms
-//  [ ] sum
 //  [ ] plot
-//  [ ] max view rule
-//  [ ] min view rule
-//  [ ] histogram view rule
 //  [ ] diffs?
 //  [ ] ** One very nice feature of RemedyBG that I use all the time is the
 //      ability to put "$err, hr" into the watch window, which will just show
@@ -137,7 +133,6 @@
 //
 //- control improvements
 // [ ] debug info overrides (both path-based AND module-based)
-// [ ] symbol server
 // [ ] can it ignore stepping into _RTC_CheckStackVars generated functions?
 // [ ] jump table thunks, on code w/o /INCREMENTAL:NO
 // [ ] investigate /DEBUG:FASTLINK - can we somehow alert that we do not
@@ -149,18 +144,18 @@
 // [ ] live++ investigations - ctrl+alt+f11 in UE?
 //
 //- short-to-medium term future features
-// [ ] search-in-all-files
-//  [ ] automatically snap to search matches when searching source files
+// [ ] automatically snap to search matches when searching source files
 // [ ] memory view
 //  [ ] memory view mutation controls
 //  [ ] memory view user-made annotations
-//  [ ] memory view searching
 // [ ] disasm view
 //  [ ] visualize jump destinations in disasm
 //
 //- longer-term future features
 // [ ] long-term future notes from martins
-// [ ] core dump saving/loading
+// [ ] core dump saving on windows (minidumps) - linux ELF cores can be both
+//     saved (optionally LZB-compressed) and loaded as frozen, read-only
+//     processes
 // [ ] parallel call stacks view
 // [ ] parallel watch view
 // [ ] mixed native/interpreted/jit debugging
@@ -171,8 +166,6 @@
 //- code cleanup
 // [ ] eliminate explicit font parameters in the various ui paths (e.g.
 //     code slice params)
-// [ ] font cache eviction (both for font tags, closing fp handles, and
-//     rasterizations)
 
 ////////////////////////////////
 //~ rjf: Build Options
@@ -229,6 +222,7 @@
 #include "regs/regs.h"
 #include "regs/rdi/regs_rdi.h"
 #include "dbg_info/dbg_info.h"
+#include "symbol_store/symbol_store_inc.h"
 #include "disasm/disasm.h"
 #include "stap/stap_parse.h"
 #include "demon/demon_inc.h"
@@ -280,6 +274,7 @@
 #include "regs/regs.c"
 #include "regs/rdi/regs_rdi.c"
 #include "dbg_info/dbg_info.c"
+#include "symbol_store/symbol_store_inc.c"
 #include "disasm/disasm.c"
 #include "stap/stap_parse.c"
 #include "demon/demon_inc.c"
@@ -302,6 +297,7 @@ typedef enum ExecMode
   ExecMode_Normal,
   ExecMode_IPCSender,
   ExecMode_BinaryUtility,
+  ExecMode_UIBench,
   ExecMode_Help,
 }
 ExecMode;
@@ -375,6 +371,22 @@ internal CTRL_WAKEUP_FUNCTION_DEF(wakeup_hook_ctrl)
   os_send_wakeup_event();
 }
 
+////////////////////////////////
+//~ rjf: Symbol Store -> Main Thread Wakeup Hook
+
+internal SS_WAKEUP_FUNCTION_DEF(wakeup_hook_ss)
+{
+  os_send_wakeup_event();
+}
+
+////////////////////////////////
+//~ rjf: Font Cache -> Main Thread Wakeup Hook
+
+internal FNT_WAKEUP_FUNCTION_DEF(wakeup_hook_fnt)
+{
+  os_send_wakeup_event();
+}
+
 ////////////////////////////////
 //~ rjf: Per-Frame Entry Point
 
@@ -410,6 +422,10 @@ entry_point(CmdLine *cmd_line)
     {
       exec_mode = ExecMode_BinaryUtility;
     }
+    else if(cmd_line_has_flag(cmd_line, str8_lit("ui_bench")))
+    {
+      exec_mode = ExecMode_UIBench;
+    }
     else if(cmd_line_has_flag(cmd_line, str8_lit("?")) ||
             cmd_line_has_flag(cmd_line, str8_lit("help")))
     {
@@ -480,6 +496,8 @@ entry_point(CmdLine *cmd_line)
         d_init();
         rd_init(cmd_line);
         ctrl_set_wakeup_hook(wakeup_hook_ctrl);
+        ss_set_wakeup_hook(wakeup_hook_ss);
+        fnt_set_wakeup_hook(wakeup_hook_fnt);
       }
       
       //- rjf: set up shared resources for ipc to this instance; launch IPC signaler thread
@@ -737,6 +755,16 @@ entry_point(CmdLine *cmd_line)
       di_signal_completion();
     }break;
     
+    //- rjf: headless ui benchmark (stub graphics & render backends only)
+    case ExecMode_UIBench:
+    {
+#if OS_GFX_STUB && R_BACKEND == R_BACKEND_STUB
+      rd_bench_entry_point(cmd_line);
+#else
+      fprintf(stderr, "--ui_bench is only available in builds with the stub graphics & render backends (`build raddbg_uibench`).\n");
+#endif
+    }break;
+    
     //- rjf: help message box
     case ExecMode_Help:
     {
@@ -2637,8 +2637,139 @@ struct RD_MemoryViewState
   B32 center_cursor;
   B32 contain_cursor;
   B32 snap_scroll;
+  S32 find_dir;
+  U64 find_start_vaddr;
 };
 
+//- rjf: memory search queries
+//
+// "text"         -> the bytes of `text`
+// u32:expression -> the bytes of `expression`, cast to u32 & only matched at
+//                   aligned addresses (also u8-u64, s8-s64, f32, f64)
+// DE AD ?? E?    -> hex bytes; `?` matches any nibble
+// anything else  -> the bytes of the query as typed
+//
+internal CTRL_MemorySearchParams
+rd_memory_search_params_from_query(Arena *arena, String8 query)
+{
+  CTRL_MemorySearchParams params = {0};
+  B32 parsed = 0;
+  query = str8_skip_chop_whitespace(query);
+  
+  //- rjf: "quoted" -> text
+  if(!parsed && query.size >= 2 && query.str[0] == '"' && query.str[query.size-1] == '"')
+  {
+    parsed = 1;
+    params.pattern = push_str8_copy(arena, str8_substr(query, r1u64(1, query.size-1)));
+  }
+  
+  //- rjf: type:expression -> typed value
+  if(!parsed)
+  {
+    local_persist struct {String8 name; E_TypeKind kind;} type_table[] =
+    {
+      {str8_lit_comp("u8"),  E_TypeKind_U8},
+      {str8_lit_comp("u16"), E_TypeKind_U16},
+      {str8_lit_comp("u32"), E_TypeKind_U32},
+      {str8_lit_comp("u64"), E_TypeKind_U64},
+      {str8_lit_comp("s8"),  E_TypeKind_S8},
+      {str8_lit_comp("s16"), E_TypeKind_S16},
+      {str8_lit_comp("s32"), E_TypeKind_S32},
+      {str8_lit_comp("s64"), E_TypeKind_S64},
+      {str8_lit_comp("f32"), E_TypeKind_F32},
+      {str8_lit_comp("f64"), E_TypeKind_F64},
+    };
+    U64 colon_pos = str8_find_needle(query, 0, str8_lit(":"), 0);
+    String8 type_name = str8_skip_chop_whitespace(str8_prefix(query, colon_pos));
+    String8 expr = str8_skip_chop_whitespace(str8_skip(query, colon_pos+1));
+    for EachElement(idx, type_table)
+    {
+      if(colon_pos < query.size && str8_match(type_name, type_table[idx].name, StringMatchFlag_CaseInsensitive))
+      {
+        Temp scratch = scratch_begin(&arena, 1);
+        parsed = 1;
+        E_TypeKey type_key = e_type_key_basic(type_table[idx].kind);
+        E_Eval eval = e_value_eval_from_eval(e_eval_from_stringf("(%S)(%S)", e_type_string_from_key(scratch.arena, type_key), expr));
+        if(expr.size != 0 && eval.msgs.max_kind == E_MsgKind_Null)
+        {
+          U64 size = e_type_byte_size_from_key(type_key);
+          params.pattern = push_str8_copy(arena, str8((U8 *)&eval.value, size));
+          params.align = size;
+        }
+        scratch_end(scratch);
+        break;
+      }
+    }
+  }
+  
+  //- rjf: hex bytes, with wildcard nibbles
+  if(!parsed && query.size != 0)
+  {
+    U8 *pattern = push_array(arena, U8, query.size/2 + 1);
+    U8 *mask = push_array(arena, U8, query.size/2 + 1);
+    U64 nibbles_count = 0;
+    B32 good = 1;
+    for EachIndex(idx, query.size)
+    {
+      U8 c = query.str[idx];
+      U8 nibble = 0;
+      U8 nibble_mask = 0;
+      if(char_is_space(c) && nibbles_count%2 == 0)
+      {
+        continue;
+      }
+      else if(char_is_digit(c, 16))
+      {
+        nibble = (U8)u64_from_str8(str8(&c, 1), 16);
+        nibble_mask = 0xf;
+      }
+      else if(c != '?')
+      {
+        good = 0;
+        break;
+      }
+      U64 shift = (nibbles_count%2 == 0) ? 4 : 0;
+      pattern[nibbles_count/2] |= (nibble<<shift);
+      mask[nibbles_count/2]    |= (nibble_mask<<shift);
+      nibbles_count += 1;
+    }
+    if(good && nibbles_count != 0 && nibbles_count%2 == 0)
+    {
+      parsed = 1;
+      params.pattern = str8(pattern, nibbles_count/2);
+      params.mask    = str8(mask, nibbles_count/2);
+    }
+  }
+  
+  //- rjf: anything else -> text as typed
+  if(!parsed)
+  {
+    params.pattern = push_str8_copy(arena, query);
+  }
+  
+  return params;
+}
+
+internal U64
+rd_memory_search_idx_from_vaddr(CTRL_MemorySearchResults *results, U64 vaddr)
+{
+  U64 min = 0;
+  U64 opl = results->count;
+  for(;min < opl;)
+  {
+    U64 mid = min + (opl-min)/2;
+    if(results->vaddrs[mid] < vaddr)
+    {
+      min = mid+1;
+    }
+    else
+    {
+      opl = mid;
+    }
+  }
+  return min;
+}
+
 EV_EXPAND_RULE_INFO_FUNCTION_DEF(memory)
 {
   EV_ExpandInfo info = {0};
@@ -2733,6 +2864,87 @@ RD_VIEW_UI_FUNCTION_DEF(memory)
         cursor_base_vaddr = mark_base_vaddr = cmd->regs->vaddr;
         mv->center_cursor = 1;
       }break;
+      case RD_CmdKind_Search:
+      case RD_CmdKind_FindNext:
+      {
+        mv->find_dir = +1;
+        mv->find_start_vaddr = cursor_base_vaddr;
+      }break;
+      case RD_CmdKind_SearchBackwards:
+      case RD_CmdKind_FindPrev:
+      {
+        mv->find_dir = -1;
+        mv->find_start_vaddr = cursor_base_vaddr;
+      }break;
+    }
+  }
+  
+  //////////////////////////////
+  //- rjf: search the whole address space for the query - results stream in
+  // as chunks of the address space finish
+  //
+  String8 search_query = rd_view_query_input();
+  CTRL_MemorySearchParams search_params = {0};
+  CTRL_MemorySearchResults search_results = {0};
+  B32 search_is_active = 0;
+  if(search_query.size != 0 && eval.space.kind == CTRL_EvalSpaceKind_Entity && !d_ctrl_targets_running())
+  {
+    CTRL_Entity *process = rd_ctrl_entity_from_eval_space(eval.space);
+    if(process->kind == CTRL_EntityKind_Process)
+    {
+      Access *access = access_open();
+      search_is_active = 1;
+      search_params = rd_memory_search_params_from_query(scratch.arena, search_query);
+      search_results = ctrl_memory_search_results_from_process(scratch.arena, access, process->handle, &search_params, 0);
+      access_close(access);
+    }
+  }
+  
+  //////////////////////////////
+  //- rjf: find next/previous match - only take a match once every chunk
+  // between it & the starting point has been searched
+  //
+  if(!search_is_active)
+  {
+    mv->find_dir = 0;
+  }
+  if(mv->find_dir != 0 && search_params.pattern.size != 0)
+  {
+    U64 match_idx = rd_memory_search_idx_from_vaddr(&search_results, mv->find_start_vaddr + (mv->find_dir > 0));
+    B32 match_found = 0;
+    U64 match_vaddr = 0;
+    if(mv->find_dir > 0 && match_idx < search_results.count)
+    {
+      match_found = 1;
+      match_vaddr = search_results.vaddrs[match_idx];
+    }
+    else if(mv->find_dir < 0 && match_idx > 0)
+    {
+      match_found = 1;
+      match_vaddr = search_results.vaddrs[match_idx-1];
+    }
+    Rng1U64 gap = (match_found ? r1u64(mv->find_start_vaddr, match_vaddr) : r1u64(mv->find_start_vaddr, mv->find_dir > 0 ? max_U64 : 0));
+    B32 gap_is_searched = (search_results.total_size != 0);
+    for EachIndex(idx, search_results.pending_ranges.count)
+    {
+      Rng1U64 pending_range = search_results.pending_ranges.v[idx];
+      if(pending_range.min <= gap.max && gap.min < pending_range.max)
+      {
+        gap_is_searched = 0;
+        break;
+      }
+    }
+    if(gap_is_searched && match_found)
+    {
+      cursor_base_vaddr = match_vaddr;
+      mark_base_vaddr = match_vaddr + search_params.pattern.size - 1;
+      mv->center_cursor = 1;
+      mv->find_dir = 0;
+    }
+    else if(gap_is_searched)
+    {
+      log_user_errorf("Could not find `%S`", search_query);
+      mv->find_dir = 0;
     }
   }
   
@@ -3046,6 +3258,26 @@ RD_VIEW_UI_FUNCTION_DEF(memory)
     }
   }
   
+  //////////////////////////////
+  //- rjf: mark search matches in windowed memory
+  //
+  U64 *visible_memory_match_flags = push_array(scratch.arena, U64, (visible_memory_size+63)/64);
+  if(search_params.pattern.size != 0)
+  {
+    U64 first_vaddr = viz_range_bytes.min - Min(viz_range_bytes.min, search_params.pattern.size-1);
+    for(U64 idx = rd_memory_search_idx_from_vaddr(&search_results, first_vaddr);
+        idx < search_results.count && search_results.vaddrs[idx] < viz_range_bytes.max;
+        idx += 1)
+    {
+      Rng1U64 match_range = intersect_1u64(viz_range_bytes, r1u64(search_results.vaddrs[idx], search_results.vaddrs[idx] + search_params.pattern.size));
+      for(U64 vaddr = match_range.min; vaddr < match_range.max; vaddr += 1)
+      {
+        U64 visible_byte_idx = vaddr - viz_range_bytes.min;
+        visible_memory_match_flags[visible_byte_idx/64] |= (1ull<<(visible_byte_idx%64));
+      }
+    }
+  }
+  
   //////////////////////////////
   //- rjf: grab annotations for windowed range of memory
   //
@@ -3449,6 +3681,21 @@ RD_VIEW_UI_FUNCTION_DEF(memory)
           ui_labelf("%016I64X (%I64u)", as_u64, as_u64);
         }
       }
+      if(search_is_active)
+      {
+        UI_PrefWidth(ui_em(7.5f, 1.f)) UI_HeightFill UI_Column UI_TagF("weak")
+          UI_PrefHeight(ui_em(2.f, 0.f))
+        {
+          ui_labelf("Matches:");
+          ui_labelf("Searched:");
+        }
+        UI_PrefWidth(ui_em(30.f, 1.f)) UI_HeightFill UI_Column
+          UI_PrefHeight(ui_em(2.f, 0.f))
+        {
+          ui_labelf("%I64u%s", search_results.count, search_results.truncated ? "+" : "");
+          ui_labelf("%I64u / %I64u MB", search_results.searched_size/MB(1), search_results.total_size/MB(1));
+        }
+      }
     }
   }
   
@@ -3623,6 +3870,7 @@ RD_VIEW_UI_FUNCTION_DEF(memory)
               U8 byte_value = visible_memory[visible_byte_idx];
               B32 byte_is_bad = !!(visible_memory_bad_flags[visible_byte_idx/64] & (1ull<<(visible_byte_idx%64)));
               B32 byte_is_changed = !!(visible_memory_change_flags[visible_byte_idx/64] & (1ull<<(visible_byte_idx%64)));
+              B32 byte_is_match = !!(visible_memory_match_flags[visible_byte_idx/64] & (1ull<<(visible_byte_idx%64)));
               AnnotationNode *annotation_node = visible_memory_annotations[visible_byte_idx].first;
               
               // rjf: unpack visual cell info
@@ -3656,6 +3904,11 @@ RD_VIEW_UI_FUNCTION_DEF(memory)
               {
                 cell_flags |= UI_BoxFlag_DrawSideBottom;
               }
+              if(byte_is_match) UI_TagF("good_pop")
+              {
+                cell_flags |= UI_BoxFlag_DrawBackground;
+                cell_bg_rgba = ui_color_from_name(str8_lit("background"));
+              }
               if(contains_1u64(rich_hover_range, global_byte_idx)) UI_TagF("pop")
               {
                 cell_flags |= UI_BoxFlag_DrawBackground;
@@ -4720,3 +4973,1038 @@ RD_VIEW_UI_FUNCTION_DEF(geo3d)
   access_close(access);
   scratch_end(scratch);
 }
+
+////////////////////////////////
+//~ rjf: wide reductions (sum/min/max/mean/histogram) @view_hook_impl
+
+typedef enum RD_ReduceKind
+{
+  RD_ReduceKind_Sum,
+  RD_ReduceKind_Min,
+  RD_ReduceKind_Max,
+  RD_ReduceKind_Mean,
+  RD_ReduceKind_Histogram,
+  RD_ReduceKind_COUNT
+}
+RD_ReduceKind;
+
+typedef struct RD_ReduceStats RD_ReduceStats;
+struct RD_ReduceStats
+{
+  U64 count;
+  U64 nan_count;
+  
+  // rjf: all element kinds (integers converted - display, means, & histogram
+  // bin ranges only; integer results are read from the exact values below)
+  F64 sum;
+  F64 min;
+  F64 max;
+  
+  // rjf: integer element kinds - exact; signed elements are sign-extended to
+  // 64 bits, and the sum is a 128-bit two's complement integer
+  B32 is_signed;
+  U64 int_min;
+  U64 int_max;
+  U64 int_sum_lo;
+  U64 int_sum_hi;
+};
+
+#pragma pack(push, 1)
+typedef struct RD_ReduceParams RD_ReduceParams;
+struct RD_ReduceParams
+{
+  U128 hash;
+  U64 data_off;
+  U64 data_size;
+  U32 element_kind;
+  U32 bins_count;
+  F64 bins_min;
+  F64 bins_max;
+};
+#pragma pack(pop)
+
+typedef struct RD_ReduceResult RD_ReduceResult;
+struct RD_ReduceResult
+{
+  Arena *arena;
+  RD_ReduceStats stats;
+  U64 bins_count;
+  U64 *bins;
+};
+
+typedef struct RD_ReduceInfo RD_ReduceInfo;
+struct RD_ReduceInfo
+{
+  E_TypeKind element_kind;
+  U64 element_count;
+  U64 chunks_count;
+  U64 chunks_done_count;
+  U64 bins_chunks_done_count;
+  RD_ReduceStats stats;
+  U64 bins_count;
+  U64 *bins;
+};
+
+// rjf: target memory is streamed in chunks of this size - each chunk is its
+// own content key, and its own reduction artifact, so results can be shown
+// as chunks finish, and only changed chunks are reduced again after a step.
+#define RD_REDUCE_CHUNK_SIZE MB(16)
+#define RD_REDUCE_CHUNKS_COUNT_MAX 4096
+
+// rjf: within a chunk, each lane reduces blocks of this many elements at a
+// time, checking for cancellation in between
+#define RD_REDUCE_BLOCK_ELEMENT_COUNT 65536
+
+//- rjf: element kinds
+
+internal E_TypeKind
+rd_reduce_element_kind_from_type_kind(E_TypeKind kind)
+{
+  E_TypeKind result = E_TypeKind_Null;
+  switch(kind)
+  {
+    default:{}break;
+    case E_TypeKind_Char8:   {result = E_TypeKind_S8;}break;
+    case E_TypeKind_Char16:  {result = E_TypeKind_S16;}break;
+    case E_TypeKind_Char32:  {result = E_TypeKind_S32;}break;
+    case E_TypeKind_UChar8:
+    case E_TypeKind_Bool:    {result = E_TypeKind_U8;}break;
+    case E_TypeKind_UChar16: {result = E_TypeKind_U16;}break;
+    case E_TypeKind_UChar32: {result = E_TypeKind_U32;}break;
+    case E_TypeKind_U8:
+    case E_TypeKind_U16:
+    case E_TypeKind_U32:
+    case E_TypeKind_U64:
+    case E_TypeKind_S8:
+    case E_TypeKind_S16:
+    case E_TypeKind_S32:
+    case E_TypeKind_S64:
+    case E_TypeKind_F32:
+    case E_TypeKind_F64:     {result = kind;}break;
+  }
+  return result;
+}
+
+internal String8
+rd_string_from_reduce_value(Arena *arena, E_TypeKind element_kind, F64 value)
+{
+  String8 result = {0};
+  if(element_kind == E_TypeKind_F32)
+  {
+    result = push_str8f(arena, "%.9g", value);
+  }
+  else
+  {
+    result = push_str8f(arena, "%.15g", value);
+  }
+  return result;
+}
+
+internal String8
+rd_string_from_reduce_int(Arena *arena, B32 is_signed, U64 lo, U64 hi)
+{
+  //- rjf: 128-bit two's complement -> sign & magnitude
+  B32 is_negative = (is_signed && (hi >> 63));
+  if(is_negative)
+  {
+    lo = ~lo + 1;
+    hi = ~hi + (lo == 0);
+  }
+  
+  //- rjf: magnitude -> decimal digits (least significant first), by long
+  // division of 32-bit limbs
+  U8 digits[40];
+  U64 digits_count = 0;
+  U32 limbs[4] = {(U32)(hi >> 32), (U32)hi, (U32)(lo >> 32), (U32)lo};
+  do
+  {
+    U64 rem = 0;
+    for EachElement(limb_idx, limbs)
+    {
+      U64 cur = (rem << 32) | limbs[limb_idx];
+      limbs[limb_idx] = (U32)(cur / 10);
+      rem = cur % 10;
+    }
+    digits[digits_count] = (U8)('0' + rem);
+    digits_count += 1;
+  }while((limbs[0] | limbs[1] | limbs[2] | limbs[3]) != 0);
+  
+  //- rjf: build string
+  String8 result = {0};
+  result.size = digits_count + !!is_negative;
+  result.str = push_array_no_zero(arena, U8, result.size+1);
+  U64 write_off = 0;
+  if(is_negative)
+  {
+    result.str[write_off] = '-';
+    write_off += 1;
+  }
+  for EachIndex(idx, digits_count)
+  {
+    result.str[write_off + idx] = digits[digits_count-1-idx];
+  }
+  result.str[result.size] = 0;
+  return result;
+}
+
+internal U64
+rd_reduce_int_hi_from_lo(B32 is_signed, U64 lo)
+{
+  U64 hi = (is_signed && (lo >> 63)) ? max_U64 : 0;
+  return hi;
+}
+
+internal F64
+rd_reduce_f64_from_int(B32 is_signed, U64 lo, U64 hi)
+{
+  F64 hi_f64 = is_signed ? (F64)(S64)hi : (F64)hi;
+  F64 result = hi_f64*18446744073709551616.0 + (F64)lo;
+  return result;
+}
+
+internal String8
+rd_string_from_reduce_stats(Arena *arena, E_TypeKind element_kind, RD_ReduceStats *stats, RD_ReduceKind kind)
+{
+  String8 result = {0};
+  B32 is_integer = e_type_kind_is_integer(element_kind);
+  B32 is_signed = stats->is_signed;
+  switch(kind)
+  {
+    default:{}break;
+    case RD_ReduceKind_Sum:
+    {
+      result = (is_integer
+                ? rd_string_from_reduce_int(arena, is_signed, stats->int_sum_lo, stats->int_sum_hi)
+                : rd_string_from_reduce_value(arena, element_kind, stats->sum));
+    }break;
+    case RD_ReduceKind_Min:
+    {
+      result = (is_integer
+                ? rd_string_from_reduce_int(arena, is_signed, stats->int_min, rd_reduce_int_hi_from_lo(is_signed, stats->int_min))
+                : rd_string_from_reduce_value(arena, element_kind, stats->min));
+    }break;
+    case RD_ReduceKind_Max:
+    {
+      result = (is_integer
+                ? rd_string_from_reduce_int(arena, is_signed, stats->int_max, rd_reduce_int_hi_from_lo(is_signed, stats->int_max))
+                : rd_string_from_reduce_value(arena, element_kind, stats->max));
+    }break;
+    case RD_ReduceKind_Mean:
+    {
+      U64 valid_count = stats->count - stats->nan_count;
+      F64 sum = is_integer ? rd_reduce_f64_from_int(is_signed, stats->int_sum_lo, stats->int_sum_hi) : stats->sum;
+      result = rd_string_from_reduce_value(arena, E_TypeKind_F64, valid_count ? sum / (F64)valid_count : 0);
+    }break;
+  }
+  return result;
+}
+
+//- rjf: kernels
+
+internal RD_ReduceStats
+rd_reduce_stats_zero(E_TypeKind element_kind)
+{
+  RD_ReduceStats stats = {0};
+  stats.min = (F64)inf32();
+  stats.max = (F64)neg_inf32();
+  stats.is_signed = e_type_kind_is_signed(element_kind);
+  stats.int_min = stats.is_signed ? (U64)max_S64 : max_U64;
+  stats.int_max = stats.is_signed ? (U64)min_S64 : 0;
+  return stats;
+}
+
+internal RD_ReduceStats
+rd_reduce_stats_combine(RD_ReduceStats a, RD_ReduceStats b)
+{
+  RD_ReduceStats result = {0};
+  result.count      = a.count + b.count;
+  result.nan_count  = a.nan_count + b.nan_count;
+  result.sum        = a.sum + b.sum;
+  result.min        = Min(a.min, b.min);
+  result.max        = Max(a.max, b.max);
+  result.is_signed  = a.is_signed;
+  if(a.is_signed)
+  {
+    result.int_min = (U64)Min((S64)a.int_min, (S64)b.int_min);
+    result.int_max = (U64)Max((S64)a.int_max, (S64)b.int_max);
+  }
+  else
+  {
+    result.int_min = Min(a.int_min, b.int_min);
+    result.int_max = Max(a.int_max, b.int_max);
+  }
+  result.int_sum_lo = a.int_sum_lo + b.int_sum_lo;
+  result.int_sum_hi = a.int_sum_hi + b.int_sum_hi + (result.int_sum_lo < a.int_sum_lo);
+  return result;
+}
+
+internal void
+rd_reduce_stats_set_int(RD_ReduceStats *stats, U64 min, U64 max, U64 sum_lo, U64 sum_hi)
+{
+  B32 is_signed = stats->is_signed;
+  stats->int_min    = min;
+  stats->int_max    = max;
+  stats->int_sum_lo = sum_lo;
+  stats->int_sum_hi = sum_hi;
+  stats->min        = rd_reduce_f64_from_int(is_signed, min, rd_reduce_int_hi_from_lo(is_signed, min));
+  stats->max        = rd_reduce_f64_from_int(is_signed, max, rd_reduce_int_hi_from_lo(is_signed, max));
+  stats->sum        = rd_reduce_f64_from_int(is_signed, sum_lo, sum_hi);
+}
+
+internal RD_ReduceStats
+rd_reduce_stats_from_elements(E_TypeKind element_kind, void *base, U64 count)
+{
+  RD_ReduceStats stats = rd_reduce_stats_zero(element_kind);
+  stats.count = count;
+  switch(element_kind)
+  {
+    default:{}break;
+    
+    //- rjf: 8/16/32-bit integers -> exact, with four independent accumulators
+    // per pass, which the compiler is free to vectorize. sums are 64-bit,
+    // which cannot overflow for fewer than 2^32 elements; integers have no NaNs
+#define RD_ReduceIntegerCase(kind, T, A) \
+    case kind: if(count != 0)\
+    {\
+      Assert(count <= max_U32);\
+      T *v = (T *)base;\
+      A sums[4] = {0};\
+      T mins[4] = {v[0], v[0], v[0], v[0]};\
+      T maxs[4] = {v[0], v[0], v[0], v[0]};\
+      U64 idx = 0;\
+      for(; idx+4 <= count; idx += 4)\
+      {\
+        for EachIndex(k, 4)\
+        {\
+          T x = v[idx+k];\
+          sums[k] += (A)x;\
+          mins[k] = Min(mins[k], x);\
+          maxs[k] = Max(maxs[k], x);\
+        }\
+      }\
+      for(; idx < count; idx += 1)\
+      {\
+        T x = v[idx];\
+        sums[0] += (A)x;\
+        mins[0] = Min(mins[0], x);\
+        maxs[0] = Max(maxs[0], x);\
+      }\
+      A sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);\
+      T min = Min(Min(mins[0], mins[1]), Min(mins[2], mins[3]));\
+      T max = Max(Max(maxs[0], maxs[1]), Max(maxs[2], maxs[3]));\
+      rd_reduce_stats_set_int(&stats, (U64)(A)min, (U64)(A)max, (U64)sum, rd_reduce_int_hi_from_lo(stats.is_signed, (U64)sum));\
+    }break
+    RD_ReduceIntegerCase(E_TypeKind_U8,  U8,  U64);
+    RD_ReduceIntegerCase(E_TypeKind_U16, U16, U64);
+    RD_ReduceIntegerCase(E_TypeKind_U32, U32, U64);
+    RD_ReduceIntegerCase(E_TypeKind_S8,  S8,  S64);
+    RD_ReduceIntegerCase(E_TypeKind_S16, S16, S64);
+    RD_ReduceIntegerCase(E_TypeKind_S32, S32, S64);
+#undef RD_ReduceIntegerCase
+    
+    //- rjf: 64-bit integers -> exact, with 128-bit sums; each element's
+    // high half is its carry (unsigned) or its sign extension plus carry
+    // (signed)
+#define RD_ReduceIntegerCase(kind, T) \
+    case kind: if(count != 0)\
+    {\
+      T *v = (T *)base;\
+      U64 sum_lo = 0;\
+      U64 sum_hi = 0;\
+      T min = v[0];\
+      T max = v[0];\
+      for EachIndex(idx, count)\
+      {\
+        T x = v[idx];\
+        U64 x_lo = (U64)x;\
+        sum_lo += x_lo;\
+        sum_hi += rd_reduce_int_hi_from_lo(stats.is_signed, x_lo) + (sum_lo < x_lo);\
+        min = Min(min, x);\
+        max = Max(max, x);\
+      }\
+      rd_reduce_stats_set_int(&stats, (U64)min, (U64)max, sum_lo, sum_hi);\
+    }break
+    RD_ReduceIntegerCase(E_TypeKind_U64, U64);
+    RD_ReduceIntegerCase(E_TypeKind_S64, S64);
+#undef RD_ReduceIntegerCase
+    
+    //- rjf: floats -> NaNs are counted, but excluded from sums, minimums, and
+    // maximums; f32 sums are accumulated at f64 precision
+    case E_TypeKind_F32:
+    {
+      F32 *v = (F32 *)base;
+      U64 idx = 0;
+#if ARCH_X64
+      {
+        __m128 min_v = _mm_set1_ps(inf32());
+        __m128 max_v = _mm_set1_ps(neg_inf32());
+        __m128d sum_lo_v = _mm_setzero_pd();
+        __m128d sum_hi_v = _mm_setzero_pd();
+        for(; idx+4 <= count; idx += 4)
+        {
+          __m128 x = _mm_loadu_ps(v+idx);
+          __m128 is_ordered = _mm_cmpord_ps(x, x);
+          __m128 x_or_zero = _mm_and_ps(x, is_ordered);
+          stats.nan_count += 4 - count_bits_set32((U32)_mm_movemask_ps(is_ordered));
+          min_v = _mm_min_ps(x, min_v); // NOTE(rjf): minps/maxps return the 2nd operand if either is NaN
+          max_v = _mm_max_ps(x, max_v);
+          sum_lo_v = _mm_add_pd(sum_lo_v, _mm_cvtps_pd(x_or_zero));
+          sum_hi_v = _mm_add_pd(sum_hi_v, _mm_cvtps_pd(_mm_movehl_ps(x_or_zero, x_or_zero)));
+        }
+        F32 mins[4], maxs[4];
+        F64 sums_lo[2], sums_hi[2];
+        _mm_storeu_ps(mins, min_v);
+        _mm_storeu_ps(maxs, max_v);
+        _mm_storeu_pd(sums_lo, sum_lo_v);
+        _mm_storeu_pd(sums_hi, sum_hi_v);
+        for EachIndex(k, 4)
+        {
+          stats.min = Min(stats.min, (F64)mins[k]);
+          stats.max = Max(stats.max, (F64)maxs[k]);
+        }
+        stats.sum += (sums_lo[0] + sums_lo[1]) + (sums_hi[0] + sums_hi[1]);
+      }
+#endif
+      for(; idx < count; idx += 1)
+      {
+        F64 x = (F64)v[idx];
+        if(x != x) { stats.nan_count += 1; continue; }
+        stats.sum += x;
+        stats.min = Min(stats.min, x);
+        stats.max = Max(stats.max, x);
+      }
+    }break;
+    case E_TypeKind_F64:
+    {
+      F64 *v = (F64 *)base;
+      U64 idx = 0;
+#if ARCH_X64
+      {
+        __m128d min_v = _mm_set1_pd(stats.min);
+        __m128d max_v = _mm_set1_pd(stats.max);
+        __m128d sum_v = _mm_setzero_pd();
+        for(; idx+2 <= count; idx += 2)
+        {
+          __m128d x = _mm_loadu_pd(v+idx);
+          __m128d is_ordered = _mm_cmpord_pd(x, x);
+          stats.nan_count += 2 - count_bits_set32((U32)_mm_movemask_pd(is_ordered));
+          min_v = _mm_min_pd(x, min_v);
+          max_v = _mm_max_pd(x, max_v);
+          sum_v = _mm_add_pd(sum_v, _mm_and_pd(x, is_ordered));
+        }
+        F64 mins[2], maxs[2], sums[2];
+        _mm_storeu_pd(mins, min_v);
+        _mm_storeu_pd(maxs, max_v);
+        _mm_storeu_pd(sums, sum_v);
+        stats.min = Min(mins[0], mins[1]);
+        stats.max = Max(maxs[0], maxs[1]);
+        stats.sum = sums[0] + sums[1];
+      }
+#endif
+      for(; idx < count; idx += 1)
+      {
+        F64 x = v[idx];
+        if(x != x) { stats.nan_count += 1; continue; }
+        stats.sum += x;
+        stats.min = Min(stats.min, x);
+        stats.max = Max(stats.max, x);
+      }
+    }break;
+  }
+  return stats;
+}
+
+internal void
+rd_reduce_histogram_from_elements(E_TypeKind element_kind, void *base, U64 count, F64 bins_min, F64 bins_max, U64 bins_count, U64 *bins)
+{
+  if(bins_count == 0) { return; }
+  F64 scale = (bins_max > bins_min) ? (F64)bins_count / (bins_max - bins_min) : 0;
+  F64 last_bin = (F64)(bins_count-1);
+  switch(element_kind)
+  {
+    default:{}break;
+    
+    //- rjf: integers
+#define RD_ReduceIntegerCase(kind, T) \
+    case kind:\
+    {\
+      T *v = (T *)base;\
+      for EachIndex(idx, count)\
+      {\
+        F64 t = ((F64)v[idx] - bins_min)*scale;\
+        bins[(U64)Clamp(0, t, last_bin)] += 1;\
+      }\
+    }break
+    RD_ReduceIntegerCase(E_TypeKind_U8,  U8);
+    RD_ReduceIntegerCase(E_TypeKind_U16, U16);
+    RD_ReduceIntegerCase(E_TypeKind_U32, U32);
+    RD_ReduceIntegerCase(E_TypeKind_U64, U64);
+    RD_ReduceIntegerCase(E_TypeKind_S8,  S8);
+    RD_ReduceIntegerCase(E_TypeKind_S16, S16);
+    RD_ReduceIntegerCase(E_TypeKind_S32, S32);
+    RD_ReduceIntegerCase(E_TypeKind_S64, S64);
+#undef RD_ReduceIntegerCase
+    
+    //- rjf: f32 -> bin indices computed 4-wide, then scattered
+    case E_TypeKind_F32:
+    {
+      F32 *v = (F32 *)base;
+      U64 idx = 0;
+#if ARCH_X64
+      {
+        __m128 min_v = _mm_set1_ps((F32)bins_min);
+        __m128 scale_v = _mm_set1_ps((F32)scale);
+        __m128 zero_v = _mm_setzero_ps();
+        __m128 last_bin_v = _mm_set1_ps((F32)last_bin);
+        for(; idx+4 <= count; idx += 4)
+        {
+          __m128 x = _mm_loadu_ps(v+idx);
+          U32 ordered_mask = (U32)_mm_movemask_ps(_mm_cmpord_ps(x, x));
+          __m128 t = _mm_mul_ps(_mm_sub_ps(x, min_v), scale_v);
+          t = _mm_min_ps(_mm_max_ps(t, zero_v), last_bin_v);
+          S32 bin_idxs[4];
+          _mm_storeu_si128((__m128i *)bin_idxs, _mm_cvttps_epi32(t));
+          for EachIndex(k, 4)
+          {
+            if(ordered_mask & (1<<k))
+            {
+              bins[bin_idxs[k]] += 1;
+            }
+          }
+        }
+      }
+#endif
+      for(; idx < count; idx += 1)
+      {
+        F64 x = (F64)v[idx];
+        if(x != x) { continue; }
+        F64 t = (x - bins_min)*scale;
+        bins[(U64)Clamp(0, t, last_bin)] += 1;
+      }
+    }break;
+    
+    //- rjf: f64
+    case E_TypeKind_F64:
+    {
+      F64 *v = (F64 *)base;
+      for EachIndex(idx, count)
+      {
+        F64 x = v[idx];
+        if(x != x) { continue; }
+        F64 t = (x - bins_min)*scale;
+        bins[(U64)Clamp(0, t, last_bin)] += 1;
+      }
+    }break;
+  }
+}
+
+//- rjf: artifact cache hooks
+
+internal AC_Artifact
+rd_reduce_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  ProfBeginFunction();
+  Access *access = access_open();
+  
+  //- rjf: unpack key
+  RD_ReduceParams params = {0};
+  str8_deserial_read_struct(key, 0, &params);
+  String8 data = str8_substr(c_data_from_hash(access, params.hash), r1u64(params.data_off, params.data_off + params.data_size));
+  E_TypeKind element_kind = (E_TypeKind)params.element_kind;
+  U64 element_size = e_type_byte_size_from_key(e_type_key_basic(element_kind));
+  U64 element_count = (element_size != 0) ? data.size/element_size : 0;
+  
+  //- rjf: set up result & per-lane partial results
+  RD_ReduceResult *result = 0;
+  RD_ReduceStats *lane_stats = 0;
+  U64 *lane_bins = 0;
+  if(lane_idx() == 0)
+  {
+    Arena *arena = arena_alloc();
+    result = push_array(arena, RD_ReduceResult, 1);
+    result->arena      = arena;
+    result->bins_count = params.bins_count;
+    result->bins       = push_array(arena, U64, params.bins_count);
+    lane_stats = push_array(arena, RD_ReduceStats, lane_count());
+    lane_bins  = push_array(arena, U64, lane_count()*params.bins_count);
+  }
+  lane_sync_u64(&result, 0);
+  lane_sync_u64(&lane_stats, 0);
+  lane_sync_u64(&lane_bins, 0);
+  
+  //- rjf: reduce this lane's range of elements
+  ProfScope("reduce %I64u elements", element_count)
+  {
+    Rng1U64 range = lane_range(element_count);
+    RD_ReduceStats stats = rd_reduce_stats_zero(element_kind);
+    U64 *bins = lane_bins + lane_idx()*params.bins_count;
+    for(U64 block_base = range.min; block_base < range.max; block_base += RD_REDUCE_BLOCK_ELEMENT_COUNT)
+    {
+      if(ins_atomic_u32_eval(cancel_signal))
+      {
+        break;
+      }
+      U64 block_count = Min(range.max - block_base, RD_REDUCE_BLOCK_ELEMENT_COUNT);
+      void *block = data.str + block_base*element_size;
+      if(params.bins_count == 0)
+      {
+        stats = rd_reduce_stats_combine(stats, rd_reduce_stats_from_elements(element_kind, block, block_count));
+      }
+      else
+      {
+        rd_reduce_histogram_from_elements(element_kind, block, block_count, params.bins_min, params.bins_max, params.bins_count, bins);
+      }
+    }
+    lane_stats[lane_idx()] = stats;
+  }
+  lane_sync();
+  
+  //- rjf: join partial results; drop everything if cancelled
+  if(lane_idx() == 0)
+  {
+    if(ins_atomic_u32_eval(cancel_signal))
+    {
+      arena_release(result->arena);
+      result = 0;
+    }
+    else
+    {
+      result->stats = rd_reduce_stats_zero(element_kind);
+      for EachIndex(idx, lane_count())
+      {
+        result->stats = rd_reduce_stats_combine(result->stats, lane_stats[idx]);
+        for EachIndex(bin_idx, params.bins_count)
+        {
+          result->bins[bin_idx] += lane_bins[idx*params.bins_count + bin_idx];
+        }
+      }
+    }
+  }
+  lane_sync_u64(&result, 0);
+  
+  AC_Artifact artifact = {0};
+  artifact.u64[0] = (U64)result;
+  access_close(access);
+  ProfEnd();
+  return artifact;
+}
+
+internal void
+rd_reduce_artifact_destroy(AC_Artifact artifact)
+{
+  RD_ReduceResult *result = (RD_ReduceResult *)artifact.u64[0];
+  if(result != 0)
+  {
+    arena_release(result->arena);
+  }
+}
+
+//- rjf: eval -> progressive reduction info
+
+internal RD_ReduceInfo
+rd_reduce_info_from_eval(Arena *arena, Access *access, E_Eval eval, U64 bins_count)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  RD_ReduceInfo info = {0};
+  
+  //- rjf: if parameterized by a register-space evaluation, interpret as an
+  // address in the primary module.
+  if(e_space_match(eval.space, e_base_ctx->thread_reg_space))
+  {
+    eval = e_value_eval_from_eval(eval);
+    eval.space = e_base_ctx->primary_module->space;
+  }
+  
+  //- rjf: unpack element type & count - arrays imply their count, pointers
+  // need it to be explicitly passed
+  E_TypeKey type_key = e_type_key_unwrap(eval.irtree.type_key, E_TypeUnwrapFlag_AllDecorative);
+  E_Type *type = e_type_from_key(type_key);
+  E_TypeKey element_type_key = type_key;
+  U64 element_count = 1;
+  if(type->kind == E_TypeKind_Array)
+  {
+    element_type_key = type->direct_type_key;
+    element_count = type->count;
+  }
+  else if(e_type_kind_is_pointer_or_ref(type->kind))
+  {
+    element_type_key = type->direct_type_key;
+  }
+  U64 count_setting = rd_view_setting_u64_from_name(str8_lit("count"));
+  if(count_setting != 0)
+  {
+    element_count = count_setting;
+  }
+  element_type_key = e_type_key_unwrap(element_type_key, E_TypeUnwrapFlag_AllDecorative);
+  info.element_kind = rd_reduce_element_kind_from_type_kind(e_type_kind_from_key(element_type_key));
+  U64 element_size = e_type_byte_size_from_key(e_type_key_basic(info.element_kind));
+  
+  //- rjf: split into chunks; chunk boundaries always fall on element boundaries
+  U64 base_offset = e_range_from_eval(eval).min;
+  U64 chunk_size = 0;
+  if(info.element_kind != E_TypeKind_Null && element_size != 0 && eval.msgs.max_kind == E_MsgKind_Null)
+  {
+    chunk_size = (RD_REDUCE_CHUNK_SIZE/element_size)*element_size;
+    info.element_count = Min(element_count, (chunk_size/element_size)*RD_REDUCE_CHUNKS_COUNT_MAX);
+    info.chunks_count = (info.element_count*element_size + chunk_size-1)/chunk_size;
+  }
+  
+  //- rjf: gather all finished chunks' stats - when a chunk's newest contents
+  // have not yet been streamed in or reduced, fall back to older contents, so
+  // that results remain stable while stepping
+  U128 *chunk_hashes = push_array(scratch.arena, U128, info.chunks_count);
+  Rng1U64 *chunk_data_ranges = push_array(scratch.arena, Rng1U64, info.chunks_count);
+  info.stats = rd_reduce_stats_zero(info.element_kind);
+  for EachIndex(chunk_idx, info.chunks_count)
+  {
+    U64 chunk_off = chunk_idx*chunk_size;
+    Rng1U64 chunk_range = r1u64(base_offset + chunk_off, base_offset + Min(chunk_off + chunk_size, info.element_count*element_size));
+    C_Key chunk_key = rd_key_from_eval_space_range(eval.space, chunk_range, 0);
+    chunk_data_ranges[chunk_idx] = (eval.space.kind == E_SpaceKind_HashStoreKey ? chunk_range : r1u64(0, dim_1u64(chunk_range)));
+    for EachIndex(rewind_idx, C_KEY_HASH_HISTORY_COUNT)
+    {
+      U128 hash = c_hash_from_key(chunk_key, rewind_idx);
+      if(u128_match(hash, u128_zero()))
+      {
+        continue;
+      }
+      RD_ReduceParams params = {0};
+      params.hash         = hash;
+      params.data_off     = chunk_data_ranges[chunk_idx].min;
+      params.data_size    = dim_1u64(chunk_data_ranges[chunk_idx]);
+      params.element_kind = (U32)info.element_kind;
+      AC_Artifact artifact = ac_artifact_from_key(access, str8_struct(&params), rd_reduce_artifact_create, rd_reduce_artifact_destroy, 0, .flags = AC_Flag_Wide);
+      RD_ReduceResult *result = (RD_ReduceResult *)artifact.u64[0];
+      if(result != 0)
+      {
+        chunk_hashes[chunk_idx] = hash;
+        info.stats = rd_reduce_stats_combine(info.stats, result->stats);
+        info.chunks_done_count += 1;
+        break;
+      }
+    }
+  }
+  
+  //- rjf: once all stats are in, the value range is known -> gather per-chunk
+  // histograms over that range, for the same contents that produced the stats
+  if(bins_count != 0 && info.chunks_count != 0 && info.chunks_done_count == info.chunks_count)
+  {
+    info.bins_count = bins_count;
+    info.bins = push_array(arena, U64, info.bins_count);
+    for EachIndex(chunk_idx, info.chunks_count)
+    {
+      RD_ReduceParams params = {0};
+      params.hash         = chunk_hashes[chunk_idx];
+      params.data_off     = chunk_data_ranges[chunk_idx].min;
+      params.data_size    = dim_1u64(chunk_data_ranges[chunk_idx]);
+      params.element_kind = (U32)info.element_kind;
+      params.bins_count   = (U32)bins_count;
+      params.bins_min     = info.stats.min;
+      params.bins_max     = info.stats.max;
+      AC_Artifact artifact = ac_artifact_from_key(access, str8_struct(&params), rd_reduce_artifact_create, rd_reduce_artifact_destroy, 0, .flags = AC_Flag_Wide);
+      RD_ReduceResult *result = (RD_ReduceResult *)artifact.u64[0];
+      if(result != 0 && result->bins_count == info.bins_count)
+      {
+        for EachIndex(bin_idx, info.bins_count)
+        {
+          info.bins[bin_idx] += result->bins[bin_idx];
+        }
+        info.bins_chunks_done_count += 1;
+      }
+    }
+  }
+  
+  scratch_end(scratch);
+  return info;
+}
+
+//- rjf: ui
+
+internal void
+rd_reduce_view_ui(E_Eval eval, Rng2F32 rect, RD_ReduceKind kind)
+{
+  Temp scratch = scratch_begin(0, 0);
+  Access *access = access_open();
+  
+  //////////////////////////////
+  //- rjf: gather progressive results
+  //
+  U64 bins_count = 0;
+  if(kind == RD_ReduceKind_Histogram)
+  {
+    bins_count = Clamp(1, rd_view_setting_u64_from_name(str8_lit("bins")), 1024);
+  }
+  RD_ReduceInfo info = rd_reduce_info_from_eval(scratch.arena, access, eval, bins_count);
+  U64 valid_count = info.stats.count - info.stats.nan_count;
+  
+  //////////////////////////////
+  //- rjf: equip loading info
+  //
+  U64 progress = info.chunks_done_count + info.bins_chunks_done_count;
+  U64 progress_target = info.chunks_count * (kind == RD_ReduceKind_Histogram ? 2 : 1);
+  if(eval.string.size != 0 && progress < progress_target)
+  {
+    rd_store_view_loading_info(1, progress, progress_target);
+  }
+  
+  //////////////////////////////
+  //- rjf: build description
+  //
+  String8 desc = {0};
+  if(info.element_kind == E_TypeKind_Null)
+  {
+    desc = str8_lit("Only arrays of, or pointers to, integers or floating point numbers can be reduced.");
+  }
+  else
+  {
+    String8List strings = {0};
+    str8_list_pushf(scratch.arena, &strings, "%I64u x %S", info.element_count, e_type_kind_basic_string_table[info.element_kind]);
+    if(info.chunks_done_count < info.chunks_count)
+    {
+      str8_list_pushf(scratch.arena, &strings, "(%I64u / %I64u elements reduced)", info.stats.count, info.element_count);
+    }
+    if(info.stats.nan_count != 0)
+    {
+      str8_list_pushf(scratch.arena, &strings, "(%I64u NaNs skipped)", info.stats.nan_count);
+    }
+    desc = str8_list_join(scratch.arena, &strings, &(StringJoin){.sep = str8_lit(" ")});
+  }
+  
+  //////////////////////////////
+  //- rjf: build UI
+  //
+  UI_WidthFill UI_HeightFill UI_Column UI_Padding(ui_em(0.5f, 1.f)) RD_Font(RD_FontSlot_Code)
+  {
+    //- rjf: single values
+    if(kind != RD_ReduceKind_Histogram) UI_PrefHeight(ui_em(2.f, 1.f))
+    {
+      String8 value_string = str8_lit("...");
+      if(valid_count != 0)
+      {
+        value_string = rd_string_from_reduce_stats(scratch.arena, info.element_kind, &info.stats, kind);
+      }
+      ui_label(value_string);
+      UI_TagF("weak") ui_label(desc);
+    }
+    
+    //- rjf: histogram
+    if(kind == RD_ReduceKind_Histogram)
+    {
+      U64 max_bin_count = 0;
+      for EachIndex(bin_idx, info.bins_count)
+      {
+        max_bin_count = Max(max_bin_count, info.bins[bin_idx]);
+      }
+      F64 bin_size = (info.stats.max - info.stats.min) / (F64)Max(1, info.bins_count);
+      UI_PrefHeight(ui_pct(1.f, 0.f)) UI_Row
+      {
+        for EachIndex(bin_idx, info.bins_count)
+        {
+          F32 pct = max_bin_count ? (F32)info.bins[bin_idx] / (F32)max_bin_count : 0.f;
+          UI_PrefWidth(ui_pct(1.f / info.bins_count, 0.f)) UI_Column
+          {
+            ui_spacer(ui_pct(1.f - pct, 0.f));
+            UI_Box *bar = &ui_nil_box;
+            UI_PrefHeight(ui_pct(pct, 0.f)) UI_TagF("pop")
+            {
+              bar = ui_build_box_from_stringf(UI_BoxFlag_DrawBackground|UI_BoxFlag_DrawBorder, "bin_%I64u", bin_idx);
+            }
+            UI_Signal sig = ui_signal_from_box(bar);
+            if(ui_hovering(sig)) UI_Tooltip
+            {
+              F64 bin_min = info.stats.min + bin_idx*bin_size;
+              ui_labelf("[%S, %S): %I64u",
+                        rd_string_from_reduce_value(scratch.arena, E_TypeKind_F64, bin_min),
+                        rd_string_from_reduce_value(scratch.arena, E_TypeKind_F64, bin_min + bin_size),
+                        info.bins[bin_idx]);
+            }
+          }
+        }
+      }
+      UI_PrefHeight(ui_em(2.f, 1.f)) UI_Row
+      {
+        if(valid_count != 0)
+        {
+          UI_PrefWidth(ui_text_dim(10, 1)) ui_label(rd_string_from_reduce_stats(scratch.arena, info.element_kind, &info.stats, RD_ReduceKind_Min));
+          ui_spacer(ui_pct(1.f, 0.f));
+          UI_PrefWidth(ui_text_dim(10, 1)) ui_label(rd_string_from_reduce_stats(scratch.arena, info.element_kind, &info.stats, RD_ReduceKind_Max));
+        }
+      }
+      UI_PrefHeight(ui_em(2.f, 1.f)) UI_TagF("weak") ui_label(desc);
+    }
+  }
+  
+  access_close(access);
+  scratch_end(scratch);
+}
+
+EV_EXPAND_RULE_INFO_FUNCTION_DEF(sum)
+{
+  EV_ExpandInfo info = {0};
+  info.row_count = 2;
+  info.single_item = 1;
+  return info;
+}
+
+EV_EXPAND_RULE_INFO_FUNCTION_DEF(histogram)
+{
+  EV_ExpandInfo info = {0};
+  info.row_count = 8;
+  info.single_item = 1;
+  return info;
+}
+
+RD_VIEW_UI_FUNCTION_DEF(sum)       { rd_reduce_view_ui(eval, rect, RD_ReduceKind_Sum); }
+RD_VIEW_UI_FUNCTION_DEF(min)       { rd_reduce_view_ui(eval, rect, RD_ReduceKind_Min); }
+RD_VIEW_UI_FUNCTION_DEF(max)       { rd_reduce_view_ui(eval, rect, RD_ReduceKind_Max); }
+RD_VIEW_UI_FUNCTION_DEF(mean)      { rd_reduce_view_ui(eval, rect, RD_ReduceKind_Mean); }
+RD_VIEW_UI_FUNCTION_DEF(histogram) { rd_reduce_view_ui(eval, rect, RD_ReduceKind_Histogram); }
+
+////////////////////////////////
+//~ rjf: file_search @view_hook_impl
+
+EV_EXPAND_RULE_INFO_FUNCTION_DEF(file_search)
+{
+  EV_ExpandInfo info = {0};
+  info.row_count = 8;
+  info.single_item = 1;
+  return info;
+}
+
+RD_VIEW_UI_FUNCTION_DEF(file_search)
+{
+  Temp scratch = scratch_begin(0, 0);
+  Access *access = access_open();
+  
+  //////////////////////////////
+  //- rjf: the query is this view's only input - keep it open
+  //
+  {
+    CFG_Node *view = cfg_node_from_id(rd_regs()->view);
+    RD_ViewState *vs = rd_view_state_from_cfg(view);
+    vs->query_is_open = 1;
+  }
+  
+  //////////////////////////////
+  //- rjf: gather path maps, so we search the local copies of source files
+  //
+  DI_PathMapArray maps = {0};
+  {
+    CFG_NodePtrList map_cfgs = cfg_node_top_level_list_from_string(scratch.arena, str8_lit("file_path_map"));
+    maps.v = push_array(scratch.arena, DI_PathMap, map_cfgs.count);
+    for(CFG_NodePtrNode *n = map_cfgs.first; n != 0; n = n->next)
+    {
+      DI_PathMap *map = &maps.v[maps.count];
+      map->src = cfg_node_child_from_string(n->v, str8_lit("source"))->first->string;
+      map->dst = cfg_node_child_from_string(n->v, str8_lit("dest"))->first->string;
+      if(map->src.size != 0 && map->dst.size != 0)
+      {
+        maps.count += 1;
+      }
+    }
+  }
+  
+  //////////////////////////////
+  //- rjf: search all source files - smart case: any uppercase character in
+  // the query makes the search case-sensitive. results stream in as chunks
+  // of files are searched.
+  //
+  String8 query = rd_view_query_input();
+  DI_TextSearchFlags search_flags = 0;
+  for EachIndex(idx, query.size)
+  {
+    if(char_is_upper(query.str[idx]))
+    {
+      search_flags |= DI_TextSearchFlag_CaseSensitive;
+      break;
+    }
+  }
+  DI_TextSearchResults results = di_text_search_results_from_query(scratch.arena, access, &maps, query, search_flags, 0);
+  if(results.is_pending)
+  {
+    rd_request_frame();
+  }
+  
+  //////////////////////////////
+  //- rjf: unpack visual params
+  //
+  F32 row_height_px = floor_f32(ui_top_font_size()*2.5f);
+  Vec2F32 rect_dim = dim_2f32(rect);
+  
+  //////////////////////////////
+  //- rjf: build UI
+  //
+  UI_WidthFill UI_HeightFill UI_Column
+  {
+    //- rjf: status
+    UI_PrefHeight(ui_px(row_height_px, 1.f)) UI_Row UI_Padding(ui_em(0.5f, 1.f)) UI_TagF("weak")
+    {
+      if(query.size == 0)
+      {
+        ui_labelf("Searches the text of all source files referenced by loaded debug info.");
+      }
+      else
+      {
+        String8List strings = {0};
+        str8_list_pushf(scratch.arena, &strings, "%I64u%s match%s", results.hits_count, results.truncated ? "+" : "", results.hits_count == 1 ? "" : "es");
+        str8_list_pushf(scratch.arena, &strings, "(%I64u / %I64u files searched)", results.files_searched_count, results.files_count);
+        if(results.files_skipped_count != 0)
+        {
+          str8_list_pushf(scratch.arena, &strings, "(%I64u missing or skipped)", results.files_skipped_count);
+        }
+        ui_label(str8_list_join(scratch.arena, &strings, &(StringJoin){.sep = str8_lit(" ")}));
+      }
+    }
+    
+    //- rjf: matches
+    UI_ScrollPt2 scroll_pos = rd_view_scroll_pos();
+    Rng1S64 visible_row_rng = {0};
+    UI_ScrollListParams scroll_list_params = {0};
+    {
+      scroll_list_params.flags         = UI_ScrollListFlag_All;
+      scroll_list_params.row_height_px = row_height_px;
+      scroll_list_params.dim_px        = v2f32(rect_dim.x, Max(rect_dim.y - row_height_px, 0));
+      scroll_list_params.cursor_range  = r2s64(v2s64(0, 0), v2s64(0, 0));
+      scroll_list_params.item_range    = r1s64(0, (S64)results.hits_count);
+      scroll_list_params.cursor_min_is_empty_selection[Axis2_Y] = 1;
+    }
+    UI_ScrollListSignal scroll_list_sig = {0};
+    UI_ScrollList(&scroll_list_params, &scroll_pos.y, 0, 0, &visible_row_rng, &scroll_list_sig)
+    {
+      for(S64 row_idx = Max(0, visible_row_rng.min); row_idx <= visible_row_rng.max && row_idx < (S64)results.hits_count; row_idx += 1)
+      {
+        DI_TextSearchHit *hit = &results.hits[row_idx];
+        ui_set_next_child_layout_axis(Axis2_X);
+        ui_set_next_hover_cursor(OS_Cursor_HandPoint);
+        UI_Box *row_box = ui_build_box_from_stringf(UI_BoxFlag_Clickable|UI_BoxFlag_DrawHotEffects|UI_BoxFlag_DrawActiveEffects|UI_BoxFlag_DrawSideBottom, "###hit_%I64d", row_idx);
+        UI_Parent(row_box) UI_HeightFill UI_Padding(ui_em(0.5f, 1.f))
+        {
+          UI_PrefWidth(ui_text_dim(10, 1)) UI_TagF("weak")
+            ui_labelf("%S:%I64d:%I64d", str8_skip_last_slash(hit->path), hit->pt.line, hit->pt.column);
+          ui_spacer(ui_em(1.f, 1.f));
+          UI_Box *text_box = &ui_nil_box;
+          RD_Font(RD_FontSlot_Code) UI_WidthFill
+          {
+            text_box = ui_label(hit->line_text).box;
+          }
+          FuzzyMatchRangeNode match_node = {0, hit->line_text_match_range};
+          FuzzyMatchRangeList matches = {&match_node, &match_node, 1, 1, dim_1u64(hit->line_text_match_range)};
+          ui_box_equip_fuzzy_match_ranges(text_box, &matches);
+        }
+        UI_Signal sig = ui_signal_from_box(row_box);
+        if(ui_hovering(sig)) UI_Tooltip
+        {
+          ui_label(hit->path);
+        }
+        if(ui_clicked(sig))
+        {
+          rd_cmd(RD_CmdKind_FindCodeLocation, .file_path = hit->path, .cursor = hit->pt, .vaddr = 0);
+        }
+      }
+    }
+    rd_store_view_scroll_pos(scroll_pos);
+  }
+  
+  access_close(access);
+  scratch_end(scratch);
+}
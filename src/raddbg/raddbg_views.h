@@ -224,6 +224,12 @@ internal RD_WatchRowCellInfo rd_info_from_watch_row_cell(Arena *arena, EV_Row *r
 //- rjf: table coordinates -> text edit state
 internal RD_WatchViewTextEditState *rd_watch_view_text_edit_state_from_pt(RD_WatchViewState *wv, RD_WatchPt pt);
 
+////////////////////////////////
+//~ rjf: Memory View Functions
+
+internal CTRL_MemorySearchParams rd_memory_search_params_from_query(Arena *arena, String8 query);
+internal U64 rd_memory_search_idx_from_vaddr(CTRL_MemorySearchResults *results, U64 vaddr);
+
 ////////////////////////////////
 //~ rjf: View Hooks
 
@@ -237,6 +243,9 @@ EV_EXPAND_RULE_INFO_FUNCTION_DEF(memory);
 EV_EXPAND_RULE_INFO_FUNCTION_DEF(bitmap);
 EV_EXPAND_RULE_INFO_FUNCTION_DEF(color);
 EV_EXPAND_RULE_INFO_FUNCTION_DEF(geo3d);
+EV_EXPAND_RULE_INFO_FUNCTION_DEF(sum);
+EV_EXPAND_RULE_INFO_FUNCTION_DEF(histogram);
+EV_EXPAND_RULE_INFO_FUNCTION_DEF(file_search);
 
 RD_VIEW_UI_FUNCTION_DEF(text);
 RD_VIEW_UI_FUNCTION_DEF(disasm);
@@ -244,5 +253,11 @@ RD_VIEW_UI_FUNCTION_DEF(memory);
 RD_VIEW_UI_FUNCTION_DEF(bitmap);
 RD_VIEW_UI_FUNCTION_DEF(color);
 RD_VIEW_UI_FUNCTION_DEF(geo3d);
+RD_VIEW_UI_FUNCTION_DEF(sum);
+RD_VIEW_UI_FUNCTION_DEF(min);
+RD_VIEW_UI_FUNCTION_DEF(max);
+RD_VIEW_UI_FUNCTION_DEF(mean);
+RD_VIEW_UI_FUNCTION_DEF(histogram);
+RD_VIEW_UI_FUNCTION_DEF(file_search);
 
 #endif // RADDBG_VIEWS_H
@@ -1182,7 +1182,7 @@ d2r_bytecode_from_expression(Arena       *arena,
           out = D2R_ValueType_Generic;
         } else {
           // find ref tag
-          DW_TagNode *tag_node = dw_tag_node_from_info_off(cu, inst->operands[0].u64);
+          DW_TagNode *tag_node = dw_tag_node_from_info_off(cu, cu->info_range.min + inst->operands[0].u64);
           DW_Tag      tag      = tag_node->tag;
           if (tag.kind == DW_TagKind_BaseType) {
             // extract encoding attribute
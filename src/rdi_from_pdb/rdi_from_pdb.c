@@ -411,42 +411,20 @@ p2r_convert(Arena *arena, P2R_ConvertParams *params)
   //////////////////////////////////////////////////////////////
   //- rjf: do base MSF parse
   //
+  // NOTE(rjf): streams are not copied up-front. contiguous streams are
+  // zero-copy views into the PDB data, and fragmented streams are
+  // materialized on whichever lane first asks for them, into that lane's
+  // arena.
+  //
   MSF_Parsed *msf = 0;
+  ProfScope("do base MSF parse")
   {
-    Temp scratch2 = scratch_begin(&scratch.arena, 1);
-    
-    // rjf: setup output buckets
-    MSF_RawStreamTable *msf_raw_stream_table = 0;
     if(lane_idx() == 0)
     {
-      msf_raw_stream_table = msf_raw_stream_table_from_data(scratch2.arena, params->input_pdb_data);
-      msf = push_array(scratch.arena, MSF_Parsed, 1);
-      msf->page_size = msf_raw_stream_table->page_size;
-      msf->page_count = msf_raw_stream_table->total_page_count;
-      msf->stream_count = msf_raw_stream_table->stream_count;
-      msf->streams = push_array(scratch.arena, String8, msf->stream_count);
+      msf = msf_parsed_lazy_from_data(scratch.arena, params->input_pdb_data);
     }
     lane_sync_u64(&msf, 0);
-    lane_sync_u64(&msf_raw_stream_table, 0);
-    
-    // rjf: do wide fill
-    {
-      U64 msf_stream_take_counter = 0;
-      U64 *msf_stream_take_counter_ptr = &msf_stream_take_counter;
-      lane_sync_u64(&msf_stream_take_counter_ptr, 0);
-      for(;;)
-      {
-        U64 stream_idx = ins_atomic_u64_inc_eval(msf_stream_take_counter_ptr) - 1;
-        if(stream_idx >= msf->stream_count)
-        {
-          break;
-        }
-        msf->streams[stream_idx] = msf_data_from_stream_number(arena, params->input_pdb_data, msf_raw_stream_table, stream_idx);
-      }
-    }
-    lane_sync();
-    
-    scratch_end(scratch2);
+    msf_parsed_lazy_equip_lane_arena(msf, arena);
   }
   lane_sync();
   
@@ -4437,6 +4415,15 @@ p2r_convert(Arena *arena, P2R_ConvertParams *params)
     result.scopes           = *all_scopes;
     result.inline_sites     = *all_inline_sites;
   }
+  lane_sync();
+  
+  //////////////////////////////////////////////////////////////
+  //- rjf: release lazy MSF state
+  //
+  if(lane_idx() == 0)
+  {
+    msf_parsed_lazy_release(msf);
+  }
   
   scratch_end(scratch);
   return result;
@@ -17,8 +17,226 @@ rdim_data_model_from_os_arch(OperatingSystem os, RDI_Arch arch)
   return data_model;
 }
 
+internal int
+rdim_prev_line_table_key_qsort_compare(RDIM_PrevLineTableKey *a, RDIM_PrevLineTableKey *b)
+{
+  int result = 0;
+  if(a->input_hash < b->input_hash)
+  {
+    result = -1;
+  }
+  else if(a->input_hash > b->input_hash)
+  {
+    result = +1;
+  }
+  else if(a->line_table_idx < b->line_table_idx)
+  {
+    result = -1;
+  }
+  else if(a->line_table_idx > b->line_table_idx)
+  {
+    result = +1;
+  }
+  return result;
+}
+
+internal RDI_U64
+rdim_input_hash_from_line_table(RDIM_LineTable *line_table)
+{
+  U64 hash = 5381;
+  for(RDIM_LineSequenceNode *seq_n = line_table->first_seq; seq_n != 0; seq_n = seq_n->next)
+  {
+    RDIM_LineSequence *seq = &seq_n->v;
+    hash = u64_hash_from_seed_str8(hash, seq->src_file ? seq->src_file->path : str8_zero());
+    hash = u64_hash_from_seed_str8(hash, str8((U8 *)seq->voffs, sizeof(seq->voffs[0])*(seq->line_count+1)));
+    hash = u64_hash_from_seed_str8(hash, str8((U8 *)seq->line_nums, sizeof(seq->line_nums[0])*seq->line_count));
+    if(seq->col_nums != 0)
+    {
+      hash = u64_hash_from_seed_str8(hash, str8((U8 *)seq->col_nums, sizeof(seq->col_nums[0])*seq->line_count*2));
+    }
+  }
+  
+  // NOTE(rjf): 0 is reserved for "unknown"
+  if(hash == 0)
+  {
+    hash = 1;
+  }
+  return hash;
+}
+
+internal B32
+rdim_reuse_prev_line_table(RDI_Parsed *prev_rdi, RDI_U64 prev_line_table_idx, RDIM_LineTable *src, RDI_U64 key_count, RDI_U64 *voffs_out, RDI_Line *lines_out)
+{
+  B32 result = 0;
+  Temp scratch = scratch_begin(0, 0);
+  
+  //- rjf: unpack previous line table
+  U64 prev_line_tables_count = 0;
+  RDI_LineTable *prev_line_tables = rdi_table_from_name(prev_rdi, LineTables, &prev_line_tables_count);
+  RDI_ParsedLineTable prev = {0};
+  if(0 < prev_line_table_idx && prev_line_table_idx < prev_line_tables_count)
+  {
+    rdi_parsed_from_line_table(prev_rdi, &prev_line_tables[prev_line_table_idx], &prev);
+  }
+  
+  //- rjf: gather the new line table's source files - the previous line table's
+  // file indices must map to these, by path
+  U64 files_count = 0;
+  RDIM_SrcFile **files = push_array(scratch.arena, RDIM_SrcFile *, src->seq_count);
+  String8 *files_normal_paths = push_array(scratch.arena, String8, src->seq_count);
+  RDI_U32 *files_prev_idxs = push_array(scratch.arena, RDI_U32, src->seq_count);
+  for(RDIM_LineSequenceNode *seq_n = src->first_seq; seq_n != 0; seq_n = seq_n->next)
+  {
+    RDIM_SrcFile *src_file = seq_n->v.src_file;
+    B32 is_dupe = 0;
+    for EachIndex(idx, files_count)
+    {
+      if(files[idx] == src_file)
+      {
+        is_dupe = 1;
+        break;
+      }
+    }
+    if(!is_dupe && src_file != 0)
+    {
+      files[files_count] = src_file;
+      files_normal_paths[files_count] = rdim_lower_from_str8(scratch.arena, src_file->path);
+      files_count += 1;
+    }
+  }
+  
+  //- rjf: copy previous sorted line info, remapping file indices
+  if(prev.count == key_count && prev.voffs != 0 && prev.lines != 0)
+  {
+    result = 1;
+    for EachIndex(idx, prev.count)
+    {
+      RDI_U32 prev_file_idx = prev.lines[idx].file_idx;
+      RDI_U32 file_idx = 0;
+      if(prev_file_idx != 0)
+      {
+        U64 file_num = 0;
+        for EachIndex(file_n, files_count)
+        {
+          if(files_prev_idxs[file_n] == prev_file_idx)
+          {
+            file_num = file_n+1;
+            break;
+          }
+        }
+        if(file_num == 0)
+        {
+          RDI_SourceFile *prev_file = rdi_element_from_name_idx(prev_rdi, SourceFiles, prev_file_idx);
+          String8 prev_normal_path = {0};
+          prev_normal_path.str = rdi_string_from_idx(prev_rdi, prev_file->normal_full_path_string_idx, &prev_normal_path.size);
+          for EachIndex(file_n, files_count)
+          {
+            if(files_prev_idxs[file_n] == 0 && str8_match(files_normal_paths[file_n], prev_normal_path, 0))
+            {
+              files_prev_idxs[file_n] = prev_file_idx;
+              file_num = file_n+1;
+              break;
+            }
+          }
+        }
+        if(file_num == 0)
+        {
+          result = 0;
+          break;
+        }
+        file_idx = (RDI_U32)rdim_idx_from_src_file(files[file_num-1]); // TODO(rjf): @u64_to_u32
+      }
+      voffs_out[idx] = prev.voffs[idx];
+      lines_out[idx].file_idx = file_idx;
+      lines_out[idx].line_num = prev.lines[idx].line_num;
+    }
+    voffs_out[key_count] = ~0ull;
+  }
+  
+  scratch_end(scratch);
+  return result;
+}
+
+internal void
+rdim_bake_string_partitions_insert(Arena *arena, RDIM_BakeStringMapTopology *top, RDIM_BakeStringPartitions *partitions, RDIM_String8 string)
+{
+  if(string.size != 0)
+  {
+    RDI_U64 hash = rdi_hash(string.str, string.size);
+    
+    // rjf: the same few strings (type names, common local names, etc.) tend
+    // to show up over & over - skip anything this lane has very recently seen
+    RDIM_BakeString *cached = &partitions->cache[hash%RDIM_BAKE_STRING_PARTITION_CACHE_COUNT];
+    if(cached->hash != hash || !str8_match(cached->string, string, 0))
+    {
+      cached->hash = hash;
+      cached->string = string;
+      RDI_U64 slot_idx = hash%top->slots_count;
+      RDI_U64 partition_idx = lane_from_range_idx(slot_idx, top->slots_count);
+      RDIM_BakeString *bstr = rdim_bake_string_chunk_list_push(arena, &partitions->lists[partition_idx], RDIM_BAKE_PARTITION_CHUNK_CAP);
+      bstr->string = string;
+      bstr->hash = hash;
+    }
+  }
+}
+
+internal void
+rdim_bake_name_partitions_insert(Arena *arena, RDIM_BakeNameMapTopology *top, RDIM_BakeNameChunkList *lists, RDIM_String8 string, RDI_U64 idx)
+{
+  if(string.size != 0)
+  {
+    RDI_U64 hash = rdi_hash(string.str, string.size);
+    RDI_U64 slot_idx = hash%top->slots_count;
+    RDI_U64 partition_idx = lane_from_range_idx(slot_idx, top->slots_count);
+    RDIM_BakeName *bname = rdim_bake_name_chunk_list_push(arena, &lists[partition_idx], RDIM_BAKE_PARTITION_CHUNK_CAP);
+    bname->string = string;
+    bname->hash = hash;
+    bname->idx = idx;
+  }
+}
+
+internal RSFORCEINLINE int
+rdim_name_map_sort_node_is_before(void *l, void *r)
+{
+  return str8_is_before(((RDIM_NameMapSortNode *)l)->string, ((RDIM_NameMapSortNode *)r)->string);
+}
+
 internal RDIM_BakeResults
-rdim_bake(Arena *arena, RDIM_BakeParams *params)
+rdim_bake_results_from_shared(RDIM_Shared *shared)
+{
+  RDIM_BakeResults result = {0};
+  {
+    result.top_level_info         = shared->baked_top_level_info;
+    result.binary_sections        = shared->baked_binary_sections;
+    result.units                  = shared->baked_units;
+    result.unit_vmap              = shared->baked_unit_vmap;
+    result.src_files              = shared->baked_src_files;
+    result.checksums              = shared->baked_checksums;
+    result.line_tables            = shared->baked_line_tables;
+    result.type_nodes             = shared->baked_type_nodes;
+    result.udts                   = shared->baked_udts;
+    result.global_variables       = shared->baked_global_variables;
+    result.global_vmap            = shared->baked_global_vmap;
+    result.thread_variables       = shared->baked_thread_variables;
+    result.constants              = shared->baked_constants;
+    result.procedures             = shared->baked_procedures;
+    result.scopes                 = shared->baked_scopes;
+    result.inline_sites           = shared->baked_inline_sites;
+    result.scope_vmap             = shared->baked_scope_vmap;
+    result.top_level_name_maps    = shared->baked_top_level_name_maps;
+    result.name_maps              = shared->baked_name_maps;
+    result.file_paths             = shared->baked_file_paths;
+    result.strings                = shared->baked_strings;
+    result.idx_runs               = shared->baked_idx_runs;
+    result.locations              = shared->baked_locations;
+    result.location_blocks        = shared->baked_location_blocks;
+  }
+  
+  return result;
+}
+
+internal RDIM_BakeResults
+rdim_bake(Arena *arena, RDIM_BakeParams *params, RDI_Parsed *prev_rdi, RDIM_SectionStream *stream)
 {
   //////////////////////////////////////////////////////////////
   //- rjf: set up shared state
@@ -26,6 +244,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   if(lane_idx() == 0)
   {
     rdim_shared = push_array(arena, RDIM_Shared, 1);
+    rdim_shared->prev_rdi = prev_rdi;
+    rdim_shared->stream = stream;
   }
   lane_sync();
   
@@ -320,12 +540,13 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
       U64 records_count;
       RDI_VMapEntry **vmap_out;
       U32 *vmap_count_out;
+      RDI_SectionKind section_kind;
     }
     vmap_tasks[] =
     {
-      {str8_lit_comp("scopes"),  scope_vmap_records,   scope_vmap_records_count,  &rdim_shared->baked_scope_vmap.vmap.vmap,  &rdim_shared->baked_scope_vmap.vmap.count},
-      {str8_lit_comp("globals"), global_vmap_records,  global_vmap_records_count, &rdim_shared->baked_global_vmap.vmap.vmap, &rdim_shared->baked_global_vmap.vmap.count},
-      {str8_lit_comp("units"),   unit_vmap_records,    unit_vmap_records_count,   &rdim_shared->baked_unit_vmap.vmap.vmap,   &rdim_shared->baked_unit_vmap.vmap.count},
+      {str8_lit_comp("scopes"),  scope_vmap_records,   scope_vmap_records_count,  &rdim_shared->baked_scope_vmap.vmap.vmap,  &rdim_shared->baked_scope_vmap.vmap.count,  RDI_SectionKind_ScopeVMap},
+      {str8_lit_comp("globals"), global_vmap_records,  global_vmap_records_count, &rdim_shared->baked_global_vmap.vmap.vmap, &rdim_shared->baked_global_vmap.vmap.count, RDI_SectionKind_GlobalVMap},
+      {str8_lit_comp("units"),   unit_vmap_records,    unit_vmap_records_count,   &rdim_shared->baked_unit_vmap.vmap.vmap,   &rdim_shared->baked_unit_vmap.vmap.count,   RDI_SectionKind_UnitVMap},
     };
     ProfScope("sort & bake all vmaps")
     {
@@ -444,7 +665,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           RDI_U64 vmap_count__cap = records_count*2 + 1;
           if(lane_idx() == 0)
           {
-            vmap = push_array(arena, RDI_VMapEntry, vmap_count__cap);
+            vmap = push_array(rdim_section_arena(arena, vmap_tasks[vmap_task_idx].section_kind), RDI_VMapEntry, vmap_count__cap);
           }
           lane_sync_u64(&vmap, 0);
           
@@ -548,6 +769,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_ScopeVMap, RDI_SectionKind_GlobalVMap, RDI_SectionKind_UnitVMap);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage build interned path tree
   //
@@ -636,7 +859,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
         }
         if(lane_idx() == lane_from_task_idx(2))
         {
-          rdim_shared->baked_line_tables.line_tables = push_array(arena, RDI_LineTable, rdim_shared->baked_line_tables.line_tables_count);
+          rdim_shared->baked_line_tables.line_tables = push_array(rdim_section_arena(arena, RDI_SectionKind_LineTables), RDI_LineTable, rdim_shared->baked_line_tables.line_tables_count);
           ProfScope("lay out line tables")
           {
             U64 voffs_base_idx = 0;
@@ -658,15 +881,41 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
         }
         if(lane_idx() == lane_from_task_idx(3))
         {
-          rdim_shared->baked_line_tables.line_table_voffs   = push_array(arena, RDI_U64,       rdim_shared->baked_line_tables.line_table_voffs_count);
+          rdim_shared->baked_line_tables.line_table_voffs   = push_array(rdim_section_arena(arena, RDI_SectionKind_LineInfoVOffs), RDI_U64,       rdim_shared->baked_line_tables.line_table_voffs_count);
         }
         if(lane_idx() == lane_from_task_idx(4))
         {
-          rdim_shared->baked_line_tables.line_table_lines   = push_array(arena, RDI_Line,      rdim_shared->baked_line_tables.line_table_lines_count);
+          rdim_shared->baked_line_tables.line_table_lines   = push_array(rdim_section_arena(arena, RDI_SectionKind_LineInfoLines), RDI_Line,      rdim_shared->baked_line_tables.line_table_lines_count);
         }
         if(lane_idx() == lane_from_task_idx(5))
         {
-          rdim_shared->baked_line_tables.line_table_columns = push_array(arena, RDI_Column,    rdim_shared->baked_line_tables.line_table_columns_count);
+          rdim_shared->baked_line_tables.line_table_columns = push_array(rdim_section_arena(arena, RDI_SectionKind_LineInfoColumns), RDI_Column,    rdim_shared->baked_line_tables.line_table_columns_count);
+        }
+        if(lane_idx() == lane_from_task_idx(6))
+        {
+          rdim_shared->baked_line_tables.line_table_input_hashes = push_array(rdim_section_arena(arena, RDI_SectionKind_LineTableInputHashes), RDI_U64,  rdim_shared->baked_line_tables.line_tables_count);
+        }
+        if(lane_idx() == lane_from_task_idx(7) && rdim_shared->prev_rdi != 0) ProfScope("gather & sort previous line table keys")
+        {
+          U64 prev_hashes_count = 0;
+          U64 *prev_hashes = rdi_table_from_name(rdim_shared->prev_rdi, LineTableInputHashes, &prev_hashes_count);
+          U64 prev_line_tables_count = 0;
+          rdi_table_from_name(rdim_shared->prev_rdi, LineTables, &prev_line_tables_count);
+          prev_hashes_count = Min(prev_hashes_count, prev_line_tables_count);
+          RDIM_PrevLineTableKey *keys = push_array_no_zero(arena, RDIM_PrevLineTableKey, prev_hashes_count);
+          U64 keys_count = 0;
+          for EachIndex(idx, prev_hashes_count)
+          {
+            if(prev_hashes[idx] != 0)
+            {
+              keys[keys_count].input_hash = prev_hashes[idx];
+              keys[keys_count].line_table_idx = idx;
+              keys_count += 1;
+            }
+          }
+          quick_sort(keys, keys_count, sizeof(keys[0]), rdim_prev_line_table_key_qsort_compare);
+          rdim_shared->prev_line_table_keys = keys;
+          rdim_shared->prev_line_table_keys_count = keys_count;
         }
       }
     }
@@ -692,6 +941,39 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           RDIM_LineTable *src = rdim_shared->src_line_tables[line_table_idx];
           RDIM_UnsortedJoinedLineTable *dst = &rdim_shared->unsorted_joined_line_tables[line_table_idx];
           
+          //- rjf: hash inputs
+          RDI_U64 input_hash = rdim_input_hash_from_line_table(src);
+          rdim_shared->baked_line_tables.line_table_input_hashes[line_table_idx+1] = input_hash;
+          
+          //- rjf: unchanged from the previous RDI? -> reuse its sorted line info, skip gather & sort
+          if(rdim_shared->prev_line_table_keys_count != 0)
+          {
+            RDIM_PrevLineTableKey *keys = rdim_shared->prev_line_table_keys;
+            U64 keys_count = rdim_shared->prev_line_table_keys_count;
+            U64 lo = 0;
+            U64 hi = keys_count;
+            for(;lo < hi;)
+            {
+              U64 mid = lo + (hi-lo)/2;
+              if(keys[mid].input_hash < input_hash) { lo = mid+1; }
+              else { hi = mid; }
+            }
+            B32 reused = 0;
+            RDI_LineTable *dst_line_table = &rdim_shared->baked_line_tables.line_tables[line_table_idx+1];
+            for(U64 key_idx = lo; key_idx < keys_count && keys[key_idx].input_hash == input_hash && !reused; key_idx += 1)
+            {
+              reused = rdim_reuse_prev_line_table(rdim_shared->prev_rdi, keys[key_idx].line_table_idx, src,
+                                                  src->line_count + src->seq_count,
+                                                  rdim_shared->baked_line_tables.line_table_voffs + dst_line_table->voffs_base_idx,
+                                                  rdim_shared->baked_line_tables.line_table_lines + dst_line_table->lines_base_idx);
+            }
+            if(reused)
+            {
+              ins_atomic_u64_inc_eval(&rdim_shared->reused_line_tables_count);
+              continue;
+            }
+          }
+          
           //- rjf: gather
           dst->line_count = src->line_count;
           dst->seq_count = src->seq_count;
@@ -767,6 +1049,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   RDIM_UnsortedJoinedLineTable *unsorted_joined_line_tables = rdim_shared->unsorted_joined_line_tables;
   RDIM_SortKey **sorted_line_table_keys = rdim_shared->sorted_line_table_keys;
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_LineTables, RDI_SectionKind_LineInfoVOffs, RDI_SectionKind_LineInfoLines, RDI_SectionKind_LineInfoColumns, RDI_SectionKind_LineTableInputHashes);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage build string map
   //
@@ -774,11 +1058,12 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   {
     Temp scratch = scratch_begin(&arena, 1);
     
-    //- rjf: set up per-lane outputs
+    //- rjf: set up shared outputs
     RDIM_BakeStringMapTopology *top = 0;
-    RDIM_BakeStringMapLoose **lane_maps__loose = 0;
     RDIM_BakeStringMapLoose *map__loose = 0;
-    if(lane_idx() == 0) ProfScope("set up per-lane outputs")
+    RDIM_BakeStringPartitions *lanes_partitions = 0;
+    RDI_U64 *lane_string_counts = 0;
+    if(lane_idx() == 0) ProfScope("set up shared outputs")
     {
       top = push_array(scratch.arena, RDIM_BakeStringMapTopology, 1);
       top->slots_count = (64 +
@@ -786,35 +1071,38 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
                           params->global_variables.total_count*1 +
                           params->thread_variables.total_count*1 +
                           params->types.total_count/2);
-      lane_maps__loose = push_array(scratch.arena, RDIM_BakeStringMapLoose *, lane_count());
       map__loose = rdim_bake_string_map_loose_make(scratch.arena, top);
+      lanes_partitions = push_array(scratch.arena, RDIM_BakeStringPartitions, lane_count());
+      lane_string_counts = push_array(scratch.arena, RDI_U64, lane_count());
+      rdim_shared->bake_strings.slots_count = top->slots_count;
+      rdim_shared->bake_strings.slots = rdim_push_array(arena, RDIM_BakeStringChunkList, rdim_shared->bake_strings.slots_count);
+      rdim_shared->bake_strings.slots_base_idxs = rdim_push_array(arena, RDI_U64, rdim_shared->bake_strings.slots_count+1);
     }
     lane_sync_u64(&top, 0);
-    lane_sync_u64(&lane_maps__loose, 0);
     lane_sync_u64(&map__loose, 0);
+    lane_sync_u64(&lanes_partitions, 0);
+    lane_sync_u64(&lane_string_counts, 0);
     
-    //- rjf: set up this lane's map
-    ProfScope("set up this lane's map")
-    {
-      lane_maps__loose[lane_idx()] = rdim_bake_string_map_loose_make(scratch.arena, top);
-    }
-    RDIM_BakeStringMapLoose *lane_map = lane_maps__loose[lane_idx()];
+    //- rjf: set up this lane's partitions
+    RDIM_BakeStringPartitions *lane_partitions = &lanes_partitions[lane_idx()];
+    lane_partitions->lists = push_array(scratch.arena, RDIM_BakeStringChunkList, lane_count());
+    lane_partitions->cache = push_array(scratch.arena, RDIM_BakeString, RDIM_BAKE_STRING_PARTITION_CACHE_COUNT);
     
-    //- rjf: push all strings into this lane's map
-    ProfScope("push all strings into this lane's map")
+    //- rjf: push all strings into this lane's partitions
+    ProfScope("push all strings into this lane's partitions")
     {
       // rjf: push small top-level strings
       if(lane_idx() == 0) ProfScope("push small top-level strings")
       {
-        rdim_bake_string_map_loose_insert(arena, top, lane_map, 1, params->top_level_info.exe_name);
-        rdim_bake_string_map_loose_insert(arena, top, lane_map, 1, params->top_level_info.producer_name);
+        rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, params->top_level_info.exe_name);
+        rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, params->top_level_info.producer_name);
         for(RDIM_BinarySectionNode *n = params->binary_sections.first; n != 0; n = n->next)
         {
-          rdim_bake_string_map_loose_insert(arena, top, lane_map, 1, n->v.name);
+          rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v.name);
         }
         for(RDIM_BakePathNode *n = path_tree->first; n != 0; n = n->next_order)
         {
-          rdim_bake_string_map_loose_insert(arena, top, lane_map, 1, n->name);
+          rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->name);
         }
       }
       
@@ -827,7 +1115,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           for EachInRange(n_idx, range)
           {
             RDIM_String8 normalized_path = rdim_lower_from_str8(arena, n->v[n_idx].path);
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 1, normalized_path);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, normalized_path);
           }
         }
       }
@@ -840,12 +1128,12 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           Rng1U64 range = lane_range(n->count);
           for EachInRange(n_idx, range)
           {
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].unit_name);
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].compiler_name);
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].source_file);
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].object_file);
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].archive_file);
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].build_path);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].unit_name);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].compiler_name);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].source_file);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].object_file);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].archive_file);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].build_path);
           }
         }
       }
@@ -858,7 +1146,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           Rng1U64 range = lane_range(n->count);
           for EachInRange(n_idx, range)
           {
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].name);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].name);
           }
         }
       }
@@ -873,11 +1161,11 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           {
             for EachNode(mem, RDIM_UDTMember, n->v[idx].first_member)
             {
-              rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, mem->name);
+              rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, mem->name);
             }
             for EachNode(enum_val, RDIM_UDTEnumVal, n->v[idx].first_enum_val)
             {
-              rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, enum_val->name);
+              rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, enum_val->name);
             }
           }
         }
@@ -900,8 +1188,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
             Rng1U64 range = lane_range(n->count);
             for EachInRange(n_idx, range)
             {
-              rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].name);
-              rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].link_name);
+              rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].name);
+              rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].link_name);
             }
           }
         }
@@ -915,7 +1203,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           Rng1U64 range = lane_range(n->count);
           for EachInRange(n_idx, range)
           {
-            rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, n->v[n_idx].name);
+            rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, n->v[n_idx].name);
           }
         }
       }
@@ -930,7 +1218,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           {
             for EachNode(local, RDIM_Local, n->v[n_idx].first_local)
             {
-              rdim_bake_string_map_loose_insert(arena, top, lane_map, 4, local->name);
+              rdim_bake_string_partitions_insert(scratch.arena, top, lane_partitions, local->name);
             }
           }
         }
@@ -938,69 +1226,66 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     }
     lane_sync();
     
-    //- rjf: join
-    ProfScope("join")
+    //- rjf: gather all lanes' strings for this lane's partition into its
+    // range of map slots - no other lane touches these slots, so no joining
+    // or locking is needed
+    Rng1U64 slot_range = lane_range(top->slots_count);
+    ProfScope("gather partition")
     {
-      Rng1U64 slot_range = lane_range(top->slots_count);
-      for EachInRange(slot_idx, slot_range)
+      for EachIndex(src_lane_idx, lane_count())
       {
-        for EachIndex(src_lane_idx, lane_count())
+        RDIM_BakeStringChunkList *src_list = &lanes_partitions[src_lane_idx].lists[lane_idx()];
+        for EachNode(n, RDIM_BakeStringChunkNode, src_list->first)
         {
-          RDIM_BakeStringMapLoose *src_map = lane_maps__loose[src_lane_idx];
-          RDIM_BakeStringMapLoose *dst_map = map__loose;
-          if(dst_map->slots[slot_idx] == 0 && src_map->slots[slot_idx] != 0)
-          {
-            dst_map->slots[slot_idx] = src_map->slots[slot_idx];
-          }
-          else if(dst_map->slots[slot_idx] != 0 && src_map->slots[slot_idx] != 0)
+          for EachIndex(n_idx, n->count)
           {
-            rdim_bake_string_chunk_list_concat_in_place(dst_map->slots[slot_idx], src_map->slots[slot_idx]);
+            rdim_bake_string_map_loose_insert_hashed(scratch.arena, top, map__loose, 4, n->v[n_idx].string, n->v[n_idx].hash);
           }
         }
       }
     }
-    lane_sync();
     
-    //- rjf: sort
+    //- rjf: sort this lane's slots into the tight map
     ProfScope("sort")
     {
-      RDIM_BakeStringMapLoose *map = map__loose;
-      Rng1U64 slot_range = lane_range(top->slots_count);
+      RDI_U64 lane_string_count = 0;
       for EachInRange(slot_idx, slot_range)
       {
-        if(map->slots[slot_idx] != 0)
+        if(map__loose->slots[slot_idx] != 0)
         {
-          *map->slots[slot_idx] = rdim_bake_string_chunk_list_sorted_from_unsorted(arena, map->slots[slot_idx]);
+          rdim_shared->bake_strings.slots[slot_idx] = rdim_bake_string_chunk_list_sorted_from_unsorted(arena, map__loose->slots[slot_idx]);
+          lane_string_count += rdim_shared->bake_strings.slots[slot_idx].total_count;
         }
       }
+      lane_string_counts[lane_idx()] = lane_string_count;
     }
     lane_sync();
     
-    //- rjf: tighten string table
-    ProfScope("tighten string table")
+    //- rjf: calc base indices for this lane's slots
+    ProfScope("calc base indices")
     {
-      RDIM_BakeStringMapLoose *map = map__loose;
-      if(lane_idx() == 0) ProfScope("calc base indices, set up tight map")
-      {
-        RDIM_BakeStringMapBaseIndices bake_string_map_base_indices = rdim_bake_string_map_base_indices_from_map_loose(arena, top, map);
-        rdim_shared->bake_strings.slots_count = top->slots_count;
-        rdim_shared->bake_strings.slots = rdim_push_array(arena, RDIM_BakeStringChunkList, rdim_shared->bake_strings.slots_count);
-        rdim_shared->bake_strings.slots_base_idxs = bake_string_map_base_indices.slots_base_idxs;
-        rdim_shared->bake_strings.total_count = rdim_shared->bake_strings.slots_base_idxs[rdim_shared->bake_strings.slots_count];
-      }
-      lane_sync();
-      ProfScope("fill tight map")
+      RDI_U64 base_idx = 0;
+      RDI_U64 total_count = 0;
+      for EachIndex(l_idx, lane_count())
       {
-        Rng1U64 slot_range = lane_range(rdim_shared->bake_strings.slots_count);
-        for EachInRange(idx, slot_range)
+        if(l_idx < lane_idx())
         {
-          if(map->slots[idx] != 0)
-          {
-            rdim_memcpy_struct(&rdim_shared->bake_strings.slots[idx], map->slots[idx]);
-          }
+          base_idx += lane_string_counts[l_idx];
         }
+        total_count += lane_string_counts[l_idx];
+      }
+      for EachInRange(slot_idx, slot_range)
+      {
+        rdim_shared->bake_strings.slots_base_idxs[slot_idx] = base_idx;
+        base_idx += rdim_shared->bake_strings.slots[slot_idx].total_count;
+      }
+      if(lane_idx() == 0)
+      {
+        rdim_shared->bake_strings.slots_base_idxs[top->slots_count] = total_count;
+        rdim_shared->bake_strings.total_count = total_count;
       }
     }
+    lane_sync();
     
     scratch_end(scratch);
   }
@@ -1027,12 +1312,12 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     Temp scratch = scratch_begin(&arena, 1);
     
     //- rjf: set up
-    RDIM_BakeNameMap ***lane_maps = 0;
+    RDIM_BakeNameChunkList ***lanes_partitions = 0;
     if(lane_idx() == 0)
     {
       bake_name_maps_tops = push_array(arena, RDIM_BakeNameMapTopology, RDI_NameMapKind_COUNT);
       bake_name_maps = push_array(arena, RDIM_BakeNameMap *, RDI_NameMapKind_COUNT);
-      lane_maps = push_array(scratch.arena, RDIM_BakeNameMap **, RDI_NameMapKind_COUNT);
+      lanes_partitions = push_array(scratch.arena, RDIM_BakeNameChunkList **, RDI_NameMapKind_COUNT);
       for EachNonZeroEnumVal(RDI_NameMapKind, k)
       {
         U64 slot_count = 0;
@@ -1051,21 +1336,25 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           Case(NormalSourcePaths, params->src_files.total_count);
 #undef Case
         }
-        lane_maps[k] = push_array(arena, RDIM_BakeNameMap *, lane_count());
         bake_name_maps_tops[k].slots_count = slot_count;
+        lanes_partitions[k] = push_array(scratch.arena, RDIM_BakeNameChunkList *, lane_count());
+        if(name_maps_need_build[k])
+        {
+          bake_name_maps[k] = rdim_bake_name_map_make(arena, &bake_name_maps_tops[k]);
+        }
       }
     }
     lane_sync_u64(&bake_name_maps_tops, 0);
     lane_sync_u64(&bake_name_maps, 0);
-    lane_sync_u64(&lane_maps, 0);
+    lane_sync_u64(&lanes_partitions, 0);
     
-    //- rjf: wide build
-    for EachNonZeroEnumVal(RDI_NameMapKind, k) ProfScope("name map build %.*s", str8_varg(rdi_string_from_name_map_kind(k)))
+    //- rjf: wide partition - push all names into this lane's per-owner-lane lists
+    for EachNonZeroEnumVal(RDI_NameMapKind, k) ProfScope("name map partition %.*s", str8_varg(rdi_string_from_name_map_kind(k)))
     {
       if(!name_maps_need_build[k]) { continue; }
       RDIM_BakeNameMapTopology *top = &bake_name_maps_tops[k];
-      lane_maps[k][lane_idx()] = rdim_bake_name_map_make(scratch.arena, top);
-      RDIM_BakeNameMap *map = lane_maps[k][lane_idx()];
+      lanes_partitions[k][lane_idx()] = push_array(scratch.arena, RDIM_BakeNameChunkList, lane_count());
+      RDIM_BakeNameChunkList *lane_partitions = lanes_partitions[k][lane_idx()];
       B32 link_names = 0;
       RDIM_SymbolChunkList *symbols = 0;
       switch((RDI_NameMapKindEnum)k)
@@ -1086,7 +1375,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
             for EachInRange(n_idx, n_range)
             {
               RDIM_Symbol *symbol = &n->v[n_idx];
-              rdim_bake_name_map_insert(scratch.arena, top, map, 4, link_names ? symbol->link_name : symbol->name, rdim_idx_from_symbol(symbol));
+              rdim_bake_name_partitions_insert(scratch.arena, top, lane_partitions, link_names ? symbol->link_name : symbol->name, rdim_idx_from_symbol(symbol));
             }
           }
         }break;
@@ -1099,7 +1388,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
             for EachInRange(n_idx, n_range)
             {
               RDIM_Type *type = &n->v[n_idx];
-              rdim_bake_name_map_insert(scratch.arena, top, map, 4, type->name, rdim_idx_from_type(type));
+              rdim_bake_name_partitions_insert(scratch.arena, top, lane_partitions, type->name, rdim_idx_from_type(type));
             }
           }
         }break;
@@ -1113,7 +1402,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
             {
               RDIM_SrcFile *src_file = &n->v[n_idx];
               RDIM_String8 normalized_path = rdim_lower_from_str8(arena, src_file->path);
-              rdim_bake_name_map_insert(scratch.arena, top, map, 4, normalized_path, rdim_idx_from_src_file(src_file));
+              rdim_bake_name_partitions_insert(scratch.arena, top, lane_partitions, normalized_path, rdim_idx_from_src_file(src_file));
             }
           }
         }break;
@@ -1121,39 +1410,24 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     }
     lane_sync();
     
-    //- rjf: join & sort
-    if(lane_idx() == 0)
-    {
-      for EachNonZeroEnumVal(RDI_NameMapKind, k)
-      {
-        if(!name_maps_need_build[k]) { continue; }
-        bake_name_maps[k] = rdim_bake_name_map_make(arena, &bake_name_maps_tops[k]);
-      }
-    }
-    lane_sync();
-    for EachNonZeroEnumVal(RDI_NameMapKind, k) ProfScope("name map join & sort %.*s", str8_varg(rdi_string_from_name_map_kind(k)))
+    //- rjf: gather & sort each lane's own partition of slots
+    for EachNonZeroEnumVal(RDI_NameMapKind, k) ProfScope("name map gather & sort %.*s", str8_varg(rdi_string_from_name_map_kind(k)))
     {
       if(!name_maps_need_build[k]) { continue; }
       RDIM_BakeNameMapTopology *top = &bake_name_maps_tops[k];
       RDIM_BakeNameMap *map = bake_name_maps[k];
       
-      //- rjf: join
-      ProfScope("join")
+      //- rjf: gather
+      ProfScope("gather")
       {
-        Rng1U64 slot_range = lane_range(top->slots_count);
-        for EachInRange(slot_idx, slot_range)
+        for EachIndex(src_lane_idx, lane_count())
         {
-          for EachIndex(src_lane_idx, lane_count())
+          RDIM_BakeNameChunkList *src_list = &lanes_partitions[k][src_lane_idx][lane_idx()];
+          for EachNode(n, RDIM_BakeNameChunkNode, src_list->first)
           {
-            RDIM_BakeNameMap *src_map = lane_maps[k][src_lane_idx];
-            RDIM_BakeNameMap *dst_map = map;
-            if(dst_map->slots[slot_idx] == 0 && src_map->slots[slot_idx] != 0)
-            {
-              dst_map->slots[slot_idx] = src_map->slots[slot_idx];
-            }
-            else if(dst_map->slots[slot_idx] != 0 && src_map->slots[slot_idx] != 0)
+            for EachIndex(n_idx, n->count)
             {
-              rdim_bake_name_chunk_list_concat_in_place(dst_map->slots[slot_idx], src_map->slots[slot_idx]);
+              rdim_bake_name_map_insert_hashed(scratch.arena, top, map, 4, n->v[n_idx].string, n->v[n_idx].hash, n->v[n_idx].idx);
             }
           }
         }
@@ -1425,13 +1699,51 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   //
   ProfScope("bake strings")
   {
-    // rjf: set up 
-    if(lane_idx() == 0) ProfScope("set up; lay out strings")
+    Temp scratch = scratch_begin(&arena, 1);
+    Rng1U64 slot_idx_range = lane_range(bake_strings->slots_count);
+    
+    // rjf: set up
+    RDI_U64 *lane_data_sizes = 0;
+    if(lane_idx() == 0) ProfScope("set up")
     {
+      lane_data_sizes = push_array(scratch.arena, RDI_U64, lane_count());
       rdim_shared->baked_strings.string_offs_count = bake_strings->total_count + 1;
-      rdim_shared->baked_strings.string_offs = rdim_push_array(arena, RDI_U32, rdim_shared->baked_strings.string_offs_count);
+      rdim_shared->baked_strings.string_offs = rdim_push_array(rdim_section_arena(arena, RDI_SectionKind_StringTable), RDI_U32, rdim_shared->baked_strings.string_offs_count);
+    }
+    lane_sync_u64(&lane_data_sizes, 0);
+    
+    // rjf: measure this lane's string data
+    ProfScope("measure")
+    {
+      RDI_U64 lane_data_size = 0;
+      for EachInRange(slot_idx, slot_idx_range)
+      {
+        for EachNode(n, RDIM_BakeStringChunkNode, bake_strings->slots[slot_idx].first)
+        {
+          for EachIndex(n_idx, n->count)
+          {
+            lane_data_size += n->v[n_idx].string.size;
+          }
+        }
+      }
+      lane_data_sizes[lane_idx()] = lane_data_size;
+    }
+    lane_sync();
+    
+    // rjf: lay out this lane's strings
+    ProfScope("lay out strings")
+    {
       RDI_U64 off_cursor = 0;
-      for EachIndex(slot_idx, bake_strings->slots_count)
+      RDI_U64 total_data_size = 0;
+      for EachIndex(l_idx, lane_count())
+      {
+        if(l_idx < lane_idx())
+        {
+          off_cursor += lane_data_sizes[l_idx];
+        }
+        total_data_size += lane_data_sizes[l_idx];
+      }
+      for EachInRange(slot_idx, slot_idx_range)
       {
         for EachNode(n, RDIM_BakeStringChunkNode, bake_strings->slots[slot_idx].first)
         {
@@ -1444,15 +1756,17 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           }
         }
       }
-      rdim_shared->baked_strings.string_data_size = off_cursor;
-      rdim_shared->baked_strings.string_data = rdim_push_array(arena, RDI_U8, rdim_shared->baked_strings.string_data_size);
+      if(lane_idx() == 0)
+      {
+        rdim_shared->baked_strings.string_data_size = total_data_size;
+        rdim_shared->baked_strings.string_data = rdim_push_array(rdim_section_arena(arena, RDI_SectionKind_StringData), RDI_U8, rdim_shared->baked_strings.string_data_size);
+      }
     }
     lane_sync();
     
     // rjf: wide fill string data
     ProfScope("wide fill")
     {
-      Rng1U64 slot_idx_range = lane_range(bake_strings->slots_count);
       for EachInRange(slot_idx, slot_idx_range)
       {
         for EachNode(n, RDIM_BakeStringChunkNode, bake_strings->slots[slot_idx].first)
@@ -1467,10 +1781,15 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
         }
       }
     }
+    lane_sync();
+    
+    scratch_end(scratch);
   }
   lane_sync();
   RDIM_StringBakeResult baked_strings = rdim_shared->baked_strings;
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_StringData, RDI_SectionKind_StringTable);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake idx runs
   //
@@ -1480,7 +1799,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == 0)
     {
       rdim_shared->baked_idx_runs.idx_count = bake_idx_runs->slots_base_idxs[bake_idx_runs->slots_count];
-      rdim_shared->baked_idx_runs.idx_runs = push_array(arena, RDI_U32, rdim_shared->baked_idx_runs.idx_count);
+      rdim_shared->baked_idx_runs.idx_runs = push_array(rdim_section_arena(arena, RDI_SectionKind_IndexRuns), RDI_U32, rdim_shared->baked_idx_runs.idx_count);
     }
     lane_sync();
     
@@ -1505,6 +1824,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   lane_sync();
   RDIM_IndexRunBakeResult baked_idx_runs = rdim_shared->baked_idx_runs;
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_IndexRuns);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake name maps
   //
@@ -1573,7 +1894,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
       if(lane_idx() == lane_from_task_idx(0))
       {
         rdim_shared->baked_top_level_name_maps.name_maps_count = RDI_NameMapKind_COUNT;
-        rdim_shared->baked_top_level_name_maps.name_maps = push_array(arena, RDI_NameMap, rdim_shared->baked_top_level_name_maps.name_maps_count);
+        rdim_shared->baked_top_level_name_maps.name_maps = push_array(rdim_section_arena(arena, RDI_SectionKind_NameMaps), RDI_NameMap, rdim_shared->baked_top_level_name_maps.name_maps_count);
         RDI_U32 bucket_off = 0;
         RDI_U32 node_off = 0;
         for EachNonZeroEnumVal(RDI_NameMapKind, k)
@@ -1586,12 +1907,17 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
           node_off += rdim_shared->baked_top_level_name_maps.name_maps[k].node_count;
         }
         rdim_shared->baked_name_maps.buckets_count = bucket_off;
-        rdim_shared->baked_name_maps.buckets = push_array(arena, RDI_NameMapBucket, rdim_shared->baked_name_maps.buckets_count);
+        rdim_shared->baked_name_maps.buckets = push_array(rdim_section_arena(arena, RDI_SectionKind_NameMapBuckets), RDI_NameMapBucket, rdim_shared->baked_name_maps.buckets_count);
       }
       if(lane_idx() == lane_from_task_idx(1))
       {
         rdim_shared->baked_name_maps.nodes_count = rdim_shared->total_name_map_node_count;
-        rdim_shared->baked_name_maps.nodes = push_array(arena, RDI_NameMapNode, rdim_shared->baked_name_maps.nodes_count);
+        rdim_shared->baked_name_maps.nodes = push_array(rdim_section_arena(arena, RDI_SectionKind_NameMapNodes), RDI_NameMapNode, rdim_shared->baked_name_maps.nodes_count);
+      }
+      if(lane_idx() == lane_from_task_idx(2))
+      {
+        rdim_shared->baked_name_maps.sorted_nodes = push_array(rdim_section_arena(arena, RDI_SectionKind_NameMapSortedNodes), RDI_U32, rdim_shared->total_name_map_node_count);
+        rdim_shared->name_map_node_strings = push_array(arena, RDIM_String8, rdim_shared->total_name_map_node_count);
       }
     }
     lane_sync();
@@ -1609,6 +1935,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
         RDI_NameMap *dst_map = &rdim_shared->baked_top_level_name_maps.name_maps[k];
         RDI_NameMapBucket *dst_buckets = rdim_shared->baked_name_maps.buckets + dst_map->bucket_base_idx;
         RDI_NameMapNode *dst_nodes = rdim_shared->baked_name_maps.nodes + dst_map->node_base_idx;
+        RDIM_String8 *dst_node_strings = rdim_shared->name_map_node_strings + dst_map->node_base_idx;
         Rng1U64 slot_range = lane_range(slots_count);
         for EachInRange(slot_idx, slot_range)
         {
@@ -1628,6 +1955,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
             IdxRunNode *last_idx_run_node = 0;
             U64 active_idx_count = 0;
             String8 active_string = {0};
+            U64 active_hash = 0;
             RDIM_BakeNameChunkNode *n = src_slot->first;
             U64 n_idx = 0;
             for(;;)
@@ -1642,10 +1970,12 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
               // rjf: grab next element
               U64 idx = 0;
               String8 string = {0};
+              U64 hash = 0;
               if(n != 0)
               {
                 idx    = n->v[n_idx].idx;
                 string = n->v[n_idx].string;
+                hash   = n->v[n_idx].hash;
               }
               
               // rjf: next element doesn't match the active list? -> push index run, clear active list, start new list
@@ -1669,6 +1999,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
                   // rjf: serialize node
                   RDI_NameMapNode *dst_node = &dst_nodes[write_node_off];
                   dst_node->string_idx = rdim_bake_idx_from_string(bake_strings, active_string);
+                  dst_node->string_hash = (RDI_U32)active_hash;
                   dst_node->match_count = idxs_count;
                   if(dst_node->match_count == 1)
                   {
@@ -1678,12 +2009,14 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
                   {
                     dst_node->match_idx_or_idx_run_first = rdim_bake_idx_from_idx_run(bake_idx_runs, idxs, idxs_count);
                   }
+                  dst_node_strings[write_node_off] = active_string;
                   dst_bucket->node_count += 1;
                   write_node_off += 1;
                 }
                 
                 // rjf: start new list
                 active_string = string;
+                active_hash = hash;
                 first_idx_run_node = 0;
                 last_idx_run_node = 0;
                 active_idx_count = 0;
@@ -1713,9 +2046,36 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
         }
       }
     }
+    lane_sync();
+    
+    // rjf: build sorted node indices for all name maps, for prefix queries
+    ProfScope("build sorted node indices")
+    {
+      for EachNonZeroEnumVal(RDI_NameMapKind, k)
+      {
+        if(!name_maps_need_build[k] || lane_idx() != lane_from_task_idx(k)) { continue; }
+        Temp scratch = scratch_begin(&arena, 1);
+        RDI_NameMap *map = &rdim_shared->baked_top_level_name_maps.name_maps[k];
+        RDIM_NameMapSortNode *sort_nodes = push_array_no_zero(scratch.arena, RDIM_NameMapSortNode, map->node_count);
+        for EachIndex(idx, map->node_count)
+        {
+          sort_nodes[idx].string   = rdim_shared->name_map_node_strings[map->node_base_idx + idx];
+          sort_nodes[idx].node_idx = (RDI_U32)idx;
+        }
+        radsort(sort_nodes, map->node_count, rdim_name_map_sort_node_is_before);
+        RDI_U32 *dst_sorted_nodes = rdim_shared->baked_name_maps.sorted_nodes + map->node_base_idx;
+        for EachIndex(idx, map->node_count)
+        {
+          dst_sorted_nodes[idx] = sort_nodes[idx].node_idx;
+        }
+        scratch_end(scratch);
+      }
+    }
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_NameMaps, RDI_SectionKind_NameMapBuckets, RDI_SectionKind_NameMapNodes, RDI_SectionKind_NameMapSortedNodes);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage gather line-bucketed src line map data
   //
@@ -1921,15 +2281,15 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == 0)
     {
       rdim_shared->baked_src_files.source_files_count = params->src_files.total_count+1;
-      rdim_shared->baked_src_files.source_files = push_array(arena, RDI_SourceFile, rdim_shared->baked_src_files.source_files_count);
+      rdim_shared->baked_src_files.source_files = push_array(rdim_section_arena(arena, RDI_SectionKind_SourceFiles), RDI_SourceFile, rdim_shared->baked_src_files.source_files_count);
       rdim_shared->baked_src_files.source_line_maps_count = params->src_files.source_line_map_count+1;
-      rdim_shared->baked_src_files.source_line_maps = push_array(arena, RDI_SourceLineMap, rdim_shared->baked_src_files.source_line_maps_count);
+      rdim_shared->baked_src_files.source_line_maps = push_array(rdim_section_arena(arena, RDI_SectionKind_SourceLineMaps), RDI_SourceLineMap, rdim_shared->baked_src_files.source_line_maps_count);
       rdim_shared->baked_src_files.source_line_map_nums_count = rdim_shared->total_src_map_line_count;
-      rdim_shared->baked_src_files.source_line_map_nums = push_array(arena, RDI_U32, rdim_shared->baked_src_files.source_line_map_nums_count);
+      rdim_shared->baked_src_files.source_line_map_nums = push_array(rdim_section_arena(arena, RDI_SectionKind_SourceLineMapNumbers), RDI_U32, rdim_shared->baked_src_files.source_line_map_nums_count);
       rdim_shared->baked_src_files.source_line_map_rngs_count = rdim_shared->total_src_map_line_count + rdim_shared->baked_src_files.source_line_maps_count;
-      rdim_shared->baked_src_files.source_line_map_rngs = push_array(arena, RDI_U32, rdim_shared->baked_src_files.source_line_map_rngs_count);
+      rdim_shared->baked_src_files.source_line_map_rngs = push_array(rdim_section_arena(arena, RDI_SectionKind_SourceLineMapRanges), RDI_U32, rdim_shared->baked_src_files.source_line_map_rngs_count);
       rdim_shared->baked_src_files.source_line_map_voffs_count = rdim_shared->total_src_map_voff_count;
-      rdim_shared->baked_src_files.source_line_map_voffs = push_array(arena, RDI_U64, rdim_shared->baked_src_files.source_line_map_voffs_count);
+      rdim_shared->baked_src_files.source_line_map_voffs = push_array(rdim_section_arena(arena, RDI_SectionKind_SourceLineMapVOffs), RDI_U64, rdim_shared->baked_src_files.source_line_map_voffs_count);
     }
     lane_sync();
     
@@ -2012,6 +2372,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     }
   }
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_SourceFiles, RDI_SectionKind_SourceLineMaps, RDI_SectionKind_SourceLineMapNumbers, RDI_SectionKind_SourceLineMapRanges, RDI_SectionKind_SourceLineMapVOffs);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake checksums
   //
@@ -2024,9 +2386,9 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
       rdim_shared->baked_checksums.sha1s_count = rdim_shared->total_checksum_counts[RDI_ChecksumKind_SHA1] + 1;
       rdim_shared->baked_checksums.sha256s_count = rdim_shared->total_checksum_counts[RDI_ChecksumKind_SHA256] + 1;
       rdim_shared->baked_checksums.timestamps_count = rdim_shared->total_checksum_counts[RDI_ChecksumKind_Timestamp] + 1;
-      rdim_shared->baked_checksums.md5s = push_array(arena, RDI_MD5, rdim_shared->baked_checksums.md5s_count);
-      rdim_shared->baked_checksums.sha1s = push_array(arena, RDI_SHA1, rdim_shared->baked_checksums.sha1s_count);
-      rdim_shared->baked_checksums.sha256s = push_array(arena, RDI_SHA256, rdim_shared->baked_checksums.sha256s_count);
+      rdim_shared->baked_checksums.md5s = push_array(rdim_section_arena(arena, RDI_SectionKind_MD5Checksums), RDI_MD5, rdim_shared->baked_checksums.md5s_count);
+      rdim_shared->baked_checksums.sha1s = push_array(rdim_section_arena(arena, RDI_SectionKind_SHA1Checksums), RDI_SHA1, rdim_shared->baked_checksums.sha1s_count);
+      rdim_shared->baked_checksums.sha256s = push_array(rdim_section_arena(arena, RDI_SectionKind_SHA256Checksums), RDI_SHA256, rdim_shared->baked_checksums.sha256s_count);
       rdim_shared->baked_checksums.timestamps = push_array(arena, RDI_U64, rdim_shared->baked_checksums.timestamps_count);
     }
     lane_sync();
@@ -2070,6 +2432,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_MD5Checksums, RDI_SectionKind_SHA1Checksums, RDI_SectionKind_SHA256Checksums);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage compute lane UDT member/enum-val layouts
   //
@@ -2135,17 +2499,17 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
       if(lane_idx() == lane_from_task_idx(0))
       {
         rdim_shared->baked_udts.udts_count = params->udts.total_count+1;
-        rdim_shared->baked_udts.udts = push_array(arena, RDI_UDT, rdim_shared->baked_udts.udts_count);
+        rdim_shared->baked_udts.udts = push_array(rdim_section_arena(arena, RDI_SectionKind_UDTs), RDI_UDT, rdim_shared->baked_udts.udts_count);
       }
       if(lane_idx() == lane_from_task_idx(1))
       {
         rdim_shared->baked_udts.members_count = params->udts.total_member_count+1;
-        rdim_shared->baked_udts.members = push_array(arena, RDI_Member, rdim_shared->baked_udts.members_count);
+        rdim_shared->baked_udts.members = push_array(rdim_section_arena(arena, RDI_SectionKind_Members), RDI_Member, rdim_shared->baked_udts.members_count);
       }
       if(lane_idx() == lane_from_task_idx(2))
       {
         rdim_shared->baked_udts.enum_members_count = params->udts.total_enum_val_count+1;
-        rdim_shared->baked_udts.enum_members = push_array(arena, RDI_EnumMember, rdim_shared->baked_udts.enum_members_count);
+        rdim_shared->baked_udts.enum_members = push_array(rdim_section_arena(arena, RDI_SectionKind_EnumMembers), RDI_EnumMember, rdim_shared->baked_udts.enum_members_count);
       }
     }
     lane_sync();
@@ -2212,6 +2576,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_UDTs, RDI_SectionKind_Members, RDI_SectionKind_EnumMembers);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage compute lane location block layout
   //
@@ -2297,7 +2663,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == 0)
     {
       rdim_shared->baked_location_blocks.location_blocks_count = rdim_shared->total_location_case_count;
-      rdim_shared->baked_location_blocks.location_blocks = push_array(arena, RDI_LocationBlock, rdim_shared->baked_location_blocks.location_blocks_count);
+      rdim_shared->baked_location_blocks.location_blocks = push_array(rdim_section_arena(arena, RDI_SectionKind_LocationBlocks), RDI_LocationBlock, rdim_shared->baked_location_blocks.location_blocks_count);
     }
     lane_sync();
     
@@ -2352,6 +2718,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     }
   }
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_LocationBlocks);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake locations
   //
@@ -2360,7 +2728,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == 0)
     {
       rdim_shared->baked_locations.location_data_size = params->locations.total_encoded_size+1;
-      rdim_shared->baked_locations.location_data = push_array(arena, RDI_U8, rdim_shared->baked_locations.location_data_size);
+      rdim_shared->baked_locations.location_data = push_array(rdim_section_arena(arena, RDI_SectionKind_LocationData), RDI_U8, rdim_shared->baked_locations.location_data_size);
     }
     lane_sync();
     for EachNode(n, RDIM_LocationChunkNode, params->locations.first)
@@ -2403,6 +2771,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     }
   }
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_LocationData);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage compute layout for scope sub-lists (locals / voffs)
   //
@@ -2470,17 +2840,17 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == lane_from_task_idx(0))
     {
       rdim_shared->baked_scopes.scopes_count = params->scopes.total_count+1;
-      rdim_shared->baked_scopes.scopes = push_array(arena, RDI_Scope, rdim_shared->baked_scopes.scopes_count);
+      rdim_shared->baked_scopes.scopes = push_array(rdim_section_arena(arena, RDI_SectionKind_Scopes), RDI_Scope, rdim_shared->baked_scopes.scopes_count);
     }
     if(lane_idx() == lane_from_task_idx(1))
     {
       rdim_shared->baked_scopes.scope_voffs_count = params->scopes.scope_voff_count+1;
-      rdim_shared->baked_scopes.scope_voffs = push_array(arena, RDI_U64, rdim_shared->baked_scopes.scope_voffs_count);
+      rdim_shared->baked_scopes.scope_voffs = push_array(rdim_section_arena(arena, RDI_SectionKind_ScopeVOffData), RDI_U64, rdim_shared->baked_scopes.scope_voffs_count);
     }
     if(lane_idx() == lane_from_task_idx(2))
     {
       rdim_shared->baked_scopes.locals_count = params->scopes.local_count+1;
-      rdim_shared->baked_scopes.locals = push_array(arena, RDI_Local, rdim_shared->baked_scopes.locals_count);
+      rdim_shared->baked_scopes.locals = push_array(rdim_section_arena(arena, RDI_SectionKind_Locals), RDI_Local, rdim_shared->baked_scopes.locals_count);
     }
     lane_sync();
     
@@ -2546,6 +2916,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_Scopes, RDI_SectionKind_ScopeVOffData, RDI_SectionKind_Locals);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake procedures
   //
@@ -2554,7 +2926,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == 0)
     {
       rdim_shared->baked_procedures.procedures_count = params->procedures.total_count+1;
-      rdim_shared->baked_procedures.procedures = push_array(arena, RDI_Procedure, rdim_shared->baked_procedures.procedures_count);
+      rdim_shared->baked_procedures.procedures = push_array(rdim_section_arena(arena, RDI_SectionKind_Procedures), RDI_Procedure, rdim_shared->baked_procedures.procedures_count);
     }
     lane_sync();
     {
@@ -2598,6 +2970,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     }
   }
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_Procedures);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage compute layout for constant data
   //
@@ -2655,17 +3029,17 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == lane_from_task_idx(0))
     {
       rdim_shared->baked_constants.constant_values_count = params->constants.total_count+1;
-      rdim_shared->baked_constants.constant_values = push_array(arena, RDI_U32, rdim_shared->baked_constants.constant_values_count);
+      rdim_shared->baked_constants.constant_values = push_array(rdim_section_arena(arena, RDI_SectionKind_ConstantValueTable), RDI_U32, rdim_shared->baked_constants.constant_values_count);
     }
     if(lane_idx() == lane_from_task_idx(1))
     {
       rdim_shared->baked_constants.constant_value_data_size = params->constants.total_value_data_size;
-      rdim_shared->baked_constants.constant_value_data = push_array(arena, RDI_U8, rdim_shared->baked_constants.constant_value_data_size);
+      rdim_shared->baked_constants.constant_value_data = push_array(rdim_section_arena(arena, RDI_SectionKind_ConstantValueData), RDI_U8, rdim_shared->baked_constants.constant_value_data_size);
     }
     if(lane_idx() == lane_from_task_idx(2))
     {
       rdim_shared->baked_constants.constants_count = params->constants.total_count+1;
-      rdim_shared->baked_constants.constants = push_array(arena, RDI_Constant, rdim_shared->baked_constants.constants_count);
+      rdim_shared->baked_constants.constants = push_array(rdim_section_arena(arena, RDI_SectionKind_Constants), RDI_Constant, rdim_shared->baked_constants.constants_count);
     }
     lane_sync();
     
@@ -2696,6 +3070,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_Constants, RDI_SectionKind_ConstantValueTable, RDI_SectionKind_ConstantValueData);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake units, symbols, types, UDTs
   //
@@ -2704,27 +3080,27 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == lane_from_task_idx(0))
     {
       rdim_shared->baked_units.units_count = params->units.total_count+1;
-      rdim_shared->baked_units.units = push_array(arena, RDI_Unit, rdim_shared->baked_units.units_count);
+      rdim_shared->baked_units.units = push_array(rdim_section_arena(arena, RDI_SectionKind_Units), RDI_Unit, rdim_shared->baked_units.units_count);
     }
     if(lane_idx() == lane_from_task_idx(1))
     {
       rdim_shared->baked_type_nodes.type_nodes_count = params->types.total_count+1;
-      rdim_shared->baked_type_nodes.type_nodes = push_array(arena, RDI_TypeNode, rdim_shared->baked_type_nodes.type_nodes_count);
+      rdim_shared->baked_type_nodes.type_nodes = push_array(rdim_section_arena(arena, RDI_SectionKind_TypeNodes), RDI_TypeNode, rdim_shared->baked_type_nodes.type_nodes_count);
     }
     if(lane_idx() == lane_from_task_idx(2))
     {
       rdim_shared->baked_global_variables.global_variables_count = params->global_variables.total_count+1;
-      rdim_shared->baked_global_variables.global_variables = push_array(arena, RDI_GlobalVariable, rdim_shared->baked_global_variables.global_variables_count);
+      rdim_shared->baked_global_variables.global_variables = push_array(rdim_section_arena(arena, RDI_SectionKind_GlobalVariables), RDI_GlobalVariable, rdim_shared->baked_global_variables.global_variables_count);
     }
     if(lane_idx() == lane_from_task_idx(3))
     {
       rdim_shared->baked_thread_variables.thread_variables_count = params->thread_variables.total_count+1;
-      rdim_shared->baked_thread_variables.thread_variables = push_array(arena, RDI_ThreadVariable, rdim_shared->baked_thread_variables.thread_variables_count);
+      rdim_shared->baked_thread_variables.thread_variables = push_array(rdim_section_arena(arena, RDI_SectionKind_ThreadVariables), RDI_ThreadVariable, rdim_shared->baked_thread_variables.thread_variables_count);
     }
     if(lane_idx() == lane_from_task_idx(4))
     {
       rdim_shared->baked_inline_sites.inline_sites_count = params->inline_sites.total_count+1;
-      rdim_shared->baked_inline_sites.inline_sites = push_array(arena, RDI_InlineSite, rdim_shared->baked_inline_sites.inline_sites_count);
+      rdim_shared->baked_inline_sites.inline_sites = push_array(rdim_section_arena(arena, RDI_SectionKind_InlineSites), RDI_InlineSite, rdim_shared->baked_inline_sites.inline_sites_count);
     }
     lane_sync();
     
@@ -2906,6 +3282,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_Units, RDI_SectionKind_TypeNodes, RDI_SectionKind_GlobalVariables, RDI_SectionKind_ThreadVariables, RDI_SectionKind_InlineSites);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage bake file paths
   //
@@ -2915,7 +3293,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == 0)
     {
       rdim_shared->baked_file_paths.nodes_count = path_tree->count;
-      rdim_shared->baked_file_paths.nodes = push_array(arena, RDI_FilePathNode, rdim_shared->baked_file_paths.nodes_count);
+      rdim_shared->baked_file_paths.nodes = push_array(rdim_section_arena(arena, RDI_SectionKind_FilePathNodes), RDI_FilePathNode, rdim_shared->baked_file_paths.nodes_count);
       rdim_shared->baked_file_path_src_nodes = push_array(arena, RDIM_BakePathNode *, rdim_shared->baked_file_paths.nodes_count);
       {
         U64 idx = 0;
@@ -2954,6 +3332,8 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_FilePathNodes);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage do small final baking tasks
   //
@@ -2971,7 +3351,7 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
     if(lane_idx() == lane_from_task_idx(1)) ProfScope("bake binary sections")
     {
       RDIM_BinarySectionList *src = &params->binary_sections;
-      RDI_BinarySection *dst_base = rdim_push_array(arena, RDI_BinarySection, src->count+1);
+      RDI_BinarySection *dst_base = rdim_push_array(rdim_section_arena(arena, RDI_SectionKind_BinarySections), RDI_BinarySection, src->count+1);
       U64 dst_idx = 1;
       for(RDIM_BinarySectionNode *src_n = src->first; src_n != 0; src_n = src_n->next, dst_idx += 1)
       {
@@ -2990,35 +3370,17 @@ rdim_bake(Arena *arena, RDIM_BakeParams *params)
   }
   lane_sync();
   
+  rdim_section_stream_flush_kinds(RDI_SectionKind_TopLevelInfo, RDI_SectionKind_BinarySections);
+  
   //////////////////////////////////////////////////////////////
   //- rjf: @rdim_bake_stage package results
   //
+  // NOTE(rjf): when streaming, every section has already been written out &
+  // its memory released, so there is nothing left to hand back.
   RDIM_BakeResults result = {0};
+  if(rdim_shared->stream == 0)
   {
-    result.top_level_info         = rdim_shared->baked_top_level_info;
-    result.binary_sections        = rdim_shared->baked_binary_sections;
-    result.units                  = rdim_shared->baked_units;
-    result.unit_vmap              = rdim_shared->baked_unit_vmap;
-    result.src_files              = rdim_shared->baked_src_files;
-    result.checksums              = rdim_shared->baked_checksums;
-    result.line_tables            = rdim_shared->baked_line_tables;
-    result.type_nodes             = rdim_shared->baked_type_nodes;
-    result.udts                   = rdim_shared->baked_udts;
-    result.global_variables       = rdim_shared->baked_global_variables;
-    result.global_vmap            = rdim_shared->baked_global_vmap;
-    result.thread_variables       = rdim_shared->baked_thread_variables;
-    result.constants              = rdim_shared->baked_constants;
-    result.procedures             = rdim_shared->baked_procedures;
-    result.scopes                 = rdim_shared->baked_scopes;
-    result.inline_sites           = rdim_shared->baked_inline_sites;
-    result.scope_vmap             = rdim_shared->baked_scope_vmap;
-    result.top_level_name_maps    = rdim_shared->baked_top_level_name_maps;
-    result.name_maps              = rdim_shared->baked_name_maps;
-    result.file_paths             = rdim_shared->baked_file_paths;
-    result.strings                = rdim_shared->baked_strings;
-    result.idx_runs               = rdim_shared->baked_idx_runs;
-    result.locations              = rdim_shared->baked_locations;
-    result.location_blocks        = rdim_shared->baked_location_blocks;
+    result = rdim_bake_results_from_shared(rdim_shared);
   }
   
   return result;
@@ -3037,25 +3399,260 @@ rdim_compress(Arena *arena, RDIM_SerializedSectionBundle *in)
   ctx.m_tableSizeBits = 14;
   ctx.m_hashTable = push_array(scratch.arena, U16, 1<<ctx.m_tableSizeBits);
   
-  //- rjf: compress, or just copy, all sections
-  Rng1U64 range = lane_range(RDI_SectionKind_COUNT);
-  for EachInRange(idx, range)
+  //- rjf: plan fixed-size blocks for all sections
+  U64 *section_block_bases = 0;
+  String8 *blocks = 0;
+  if(lane_idx() == 0)
   {
-    RDI_SectionKind k = (RDI_SectionKind)idx;
-    RDIM_SerializedSection *src = &in->sections[k];
-    RDIM_SerializedSection *dst = &out->sections[k];
-    MemoryCopyStruct(dst, src);
-    if(src->encoded_size != 0)
+    section_block_bases = push_array(arena, U64, RDI_SectionKind_COUNT+1);
+    U64 block_count = 0;
+    for EachIndex(k, RDI_SectionKind_COUNT)
     {
+      section_block_bases[k] = block_count;
+      block_count += (in->sections[k].encoded_size + RDIM_COMPRESS_BLOCK_SIZE - 1) / RDIM_COMPRESS_BLOCK_SIZE;
+    }
+    section_block_bases[RDI_SectionKind_COUNT] = block_count;
+    blocks = push_array(arena, String8, block_count);
+  }
+  lane_sync_u64(&section_block_bases, 0);
+  lane_sync_u64(&blocks, 0);
+  
+  //- rjf: compress all blocks, across all sections, wide
+  {
+    U64 block_count = section_block_bases[RDI_SectionKind_COUNT];
+    Rng1U64 range = lane_range(block_count);
+    U64 k = 0;
+    for EachInRange(block_idx, range)
+    {
+      for(;section_block_bases[k+1] <= block_idx; k += 1);
+      RDIM_SerializedSection *src = &in->sections[k];
+      U64 raw_off = (block_idx - section_block_bases[k]) * RDIM_COMPRESS_BLOCK_SIZE;
+      U64 raw_size = Min(RDIM_COMPRESS_BLOCK_SIZE, src->encoded_size - raw_off);
       MemoryZero(ctx.m_hashTable, sizeof(U16)*(1<<ctx.m_tableSizeBits));
-      dst->data = push_array_no_zero(arena, U8, src->encoded_size);
-      dst->encoded_size = rr_lzb_simple_encode_veryfast(&ctx, src->data, src->encoded_size, dst->data);
-      dst->unpacked_size = src->encoded_size;
-      dst->encoding = RDI_SectionEncoding_LZB;
+      U8 *comp = push_array_no_zero(arena, U8, raw_size);
+      U64 comp_size = rr_lzb_simple_encode_veryfast(&ctx, (U8 *)src->data + raw_off, raw_size, comp);
+      blocks[block_idx] = str8(comp, comp_size);
     }
   }
   lane_sync();
   
+  //- rjf: frame compressed blocks into sections; sections which don't get
+  // any smaller after framing (tiny or incompressible) are left unpacked
+  {
+    Rng1U64 range = lane_range(RDI_SectionKind_COUNT);
+    for EachInRange(idx, range)
+    {
+      RDI_SectionKind k = (RDI_SectionKind)idx;
+      RDIM_SerializedSection *src = &in->sections[k];
+      RDIM_SerializedSection *dst = &out->sections[k];
+      MemoryCopyStruct(dst, src);
+      String8 *section_blocks = blocks + section_block_bases[k];
+      U64 section_block_count = section_block_bases[k+1] - section_block_bases[k];
+      U64 header_size = sizeof(RDI_SectionBlockHeader) + sizeof(RDI_U64)*(section_block_count+1);
+      U64 framed_size = header_size;
+      for EachIndex(block_idx, section_block_count)
+      {
+        framed_size += section_blocks[block_idx].size;
+      }
+      if(section_block_count != 0 && framed_size < src->encoded_size)
+      {
+        U8 *framed = push_array_no_zero(arena, U8, framed_size);
+        RDI_SectionBlockHeader *hdr = (RDI_SectionBlockHeader *)framed;
+        RDI_U64 *offs = (RDI_U64 *)(hdr + 1);
+        hdr->block_size  = RDIM_COMPRESS_BLOCK_SIZE;
+        hdr->block_count = section_block_count;
+        U64 off = header_size;
+        for EachIndex(block_idx, section_block_count)
+        {
+          offs[block_idx] = off;
+          MemoryCopy(framed + off, section_blocks[block_idx].str, section_blocks[block_idx].size);
+          off += section_blocks[block_idx].size;
+        }
+        offs[section_block_count] = off;
+        dst->data          = framed;
+        dst->encoded_size  = framed_size;
+        dst->unpacked_size = src->encoded_size;
+        dst->encoding      = RDI_SectionEncoding_LZBBlocks;
+      }
+      else
+      {
+        dst->unpacked_size = src->encoded_size;
+        dst->encoding      = RDI_SectionEncoding_Unpacked;
+      }
+    }
+  }
+  lane_sync();
+  
+  // NOTE(rjf): `out` lives on lane 0's stack - every lane must take its copy
+  // before lane 0 is allowed to return.
+  RDIM_SerializedSectionBundle result = *out;
+  lane_sync();
+  
   scratch_end(scratch);
-  return *out;
+  return result;
+}
+
+internal RDIM_SectionStream *
+rdim_section_stream_begin(Arena *arena, String8 path, B32 compress)
+{
+  RDIM_SectionStream *stream = 0;
+  os_delete_file_at_path(path);
+  OS_Handle file = os_file_open(OS_AccessFlag_Write|OS_AccessFlag_Read, path);
+  if(!os_handle_match(file, os_handle_zero()))
+  {
+    stream = push_array(arena, RDIM_SectionStream, 1);
+    stream->file = file;
+    stream->compress = compress;
+    
+    // rjf: reserve the header & section table - these are only known once
+    // every section has been written, so they're filled in by the end call
+    stream->data_section_off = AlignPow2(sizeof(RDI_Header), 8);
+    stream->write_off = stream->data_section_off + sizeof(RDI_Section)*RDI_SectionKind_COUNT;
+    
+    // rjf: give every section its own arena, so that it can be released as
+    // soon as it has been written
+    for EachEnumVal(RDI_SectionKind, k)
+    {
+      stream->section_arenas[k] = arena_alloc();
+    }
+  }
+  return stream;
+}
+
+internal Arena *
+rdim_section_arena(Arena *fallback, RDI_SectionKind kind)
+{
+  Arena *result = fallback;
+  if(rdim_shared != 0 && rdim_shared->stream != 0 && rdim_shared->stream->section_arenas[kind] != 0)
+  {
+    result = rdim_shared->stream->section_arenas[kind];
+  }
+  return result;
+}
+
+internal void
+rdim_section_stream_flush(RDI_SectionKind *kinds, U64 kinds_count)
+{
+  RDIM_SectionStream *stream = rdim_shared->stream;
+  if(stream == 0) { return; }
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  
+  //- rjf: gather the requested sections
+  RDIM_SerializedSectionBundle bundle = {0};
+  {
+    RDIM_BakeResults results = rdim_bake_results_from_shared(rdim_shared);
+    RDIM_SerializedSectionBundle all = rdim_serialized_section_bundle_from_bake_results(&results);
+    for EachIndex(idx, kinds_count)
+    {
+      RDI_SectionKind k = kinds[idx];
+      bundle.sections[k] = all.sections[k];
+      
+      // NOTE(rjf): the top-level info section points at the local results
+      // copy - move it somewhere which outlives this scope
+      if(k == RDI_SectionKind_TopLevelInfo && bundle.sections[k].data != 0)
+      {
+        bundle.sections[k].data = push_str8_copy(scratch.arena, str8((U8 *)bundle.sections[k].data, bundle.sections[k].encoded_size)).str;
+      }
+    }
+  }
+  
+  //- rjf: compress (wide)
+  if(stream->compress) ProfScope("compress")
+  {
+    bundle = rdim_compress(scratch.arena, &bundle);
+  }
+  
+  //- rjf: lay out sections in the file
+  if(lane_idx() == 0)
+  {
+    for EachIndex(idx, kinds_count)
+    {
+      RDI_SectionKind k = kinds[idx];
+      RDIM_SerializedSection *src = &bundle.sections[k];
+      RDI_Section *dst = &stream->sections[k];
+      dst->encoding      = src->encoding;
+      dst->off           = 0;
+      dst->encoded_size  = src->encoded_size;
+      dst->unpacked_size = src->unpacked_size;
+      if(src->encoded_size != 0)
+      {
+        stream->write_off = AlignPow2(stream->write_off, 8);
+        dst->off = stream->write_off;
+        stream->write_off += src->encoded_size;
+      }
+      stream->sections_written[k] = 1;
+    }
+  }
+  lane_sync();
+  
+  //- rjf: write (wide)
+  ProfScope("write")
+  {
+    Rng1U64 range = lane_range(kinds_count);
+    for EachInRange(idx, range)
+    {
+      RDI_SectionKind k = kinds[idx];
+      RDI_Section *dst = &stream->sections[k];
+      if(dst->encoded_size != 0)
+      {
+        U64 bytes_written = os_file_write(stream->file, r1u64(dst->off, dst->off + dst->encoded_size), bundle.sections[k].data);
+        if(bytes_written != dst->encoded_size)
+        {
+          stream->write_failed = 1;
+        }
+      }
+    }
+  }
+  lane_sync();
+  
+  //- rjf: release the memory backing these sections
+  if(lane_idx() == 0)
+  {
+    for EachIndex(idx, kinds_count)
+    {
+      RDI_SectionKind k = kinds[idx];
+      if(stream->section_arenas[k] != 0)
+      {
+        arena_release(stream->section_arenas[k]);
+        stream->section_arenas[k] = 0;
+      }
+    }
+  }
+  lane_sync();
+  
+  scratch_end(scratch);
+  ProfEnd();
+}
+
+internal B32
+rdim_section_stream_end(RDIM_SectionStream *stream)
+{
+  B32 result = 0;
+  if(stream != 0)
+  {
+    //- rjf: fill & write header / section table
+    RDI_Header header = {0};
+    header.magic              = RDI_MAGIC_CONSTANT;
+    header.encoding_version   = RDI_ENCODING_VERSION;
+    header.data_section_off   = (RDI_U32)stream->data_section_off;
+    header.data_section_count = RDI_SectionKind_COUNT;
+    U64 sections_size = sizeof(stream->sections);
+    U64 header_bytes_written = os_file_write(stream->file, r1u64(0, sizeof(header)), &header);
+    U64 sections_bytes_written = os_file_write(stream->file, r1u64(stream->data_section_off, stream->data_section_off + sections_size), stream->sections);
+    result = (!stream->write_failed && header_bytes_written == sizeof(header) && sections_bytes_written == sections_size);
+    
+    //- rjf: release anything which was never written
+    for EachEnumVal(RDI_SectionKind, k)
+    {
+      if(stream->section_arenas[k] != 0)
+      {
+        arena_release(stream->section_arenas[k]);
+        stream->section_arenas[k] = 0;
+      }
+    }
+    os_file_close(stream->file);
+    stream->file = os_handle_zero();
+  }
+  return result;
 }
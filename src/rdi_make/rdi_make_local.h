@@ -48,6 +48,10 @@
 //- rjf: main library
 #include "lib_rdi_make/rdi_make.h"
 
+//- rjf: compression block size - sections are compressed in independent blocks
+// of this size, so that both encoding & decoding can go wide
+#define RDIM_COMPRESS_BLOCK_SIZE KB(256)
+
 //- rjf: unsorted joined line table info
 
 typedef struct RDIM_UnsortedJoinedLineTable RDIM_UnsortedJoinedLineTable;
@@ -60,6 +64,58 @@ struct RDIM_UnsortedJoinedLineTable
   RDIM_LineRec *line_recs;
 };
 
+//- rjf: previous line table keys (for reusing unchanged line tables from a
+// previously-baked RDI)
+
+typedef struct RDIM_PrevLineTableKey RDIM_PrevLineTableKey;
+struct RDIM_PrevLineTableKey
+{
+  RDI_U64 input_hash;
+  RDI_U64 line_table_idx;
+};
+
+//- rjf: lane-partitioned string & name gathering - each lane buckets its
+// inputs by the lane which owns their map slot, so that every lane can then
+// build its own range of map slots without touching any other lane's slots
+
+#define RDIM_BAKE_PARTITION_CHUNK_CAP 256
+#define RDIM_BAKE_STRING_PARTITION_CACHE_COUNT 4096
+
+typedef struct RDIM_BakeStringPartitions RDIM_BakeStringPartitions;
+struct RDIM_BakeStringPartitions
+{
+  RDIM_BakeStringChunkList *lists; // [lane_count()]
+  RDIM_BakeString *cache;          // [RDIM_BAKE_STRING_PARTITION_CACHE_COUNT]
+};
+
+//- rjf: name map node sorting
+
+typedef struct RDIM_NameMapSortNode RDIM_NameMapSortNode;
+struct RDIM_NameMapSortNode
+{
+  String8 string;
+  RDI_U32 node_idx;
+};
+
+//- rjf: streaming section writer - when one is attached to a bake, each
+// stage's sections are (optionally) compressed & written to their own region
+// of the output file as soon as that stage finishes, & the memory backing
+// them is released right away, rather than the whole file being held in
+// memory (sometimes two or three times over) until the bake is done
+
+typedef struct RDIM_SectionStream RDIM_SectionStream;
+struct RDIM_SectionStream
+{
+  OS_Handle file;
+  B32 compress;
+  B32 write_failed;
+  RDI_U64 write_off;
+  RDI_U64 data_section_off;
+  RDI_Section sections[RDI_SectionKind_COUNT];
+  B32 sections_written[RDI_SectionKind_COUNT];
+  Arena *section_arenas[RDI_SectionKind_COUNT];
+};
+
 //- rjf: shared state bundle
 
 typedef struct RDIM_Shared RDIM_Shared;
@@ -78,6 +134,13 @@ struct RDIM_Shared
   
   RDIM_SortKey **sorted_line_table_keys;
   
+  RDIM_SectionStream *stream;
+  
+  RDI_Parsed *prev_rdi;
+  RDIM_PrevLineTableKey *prev_line_table_keys;
+  RDI_U64 prev_line_table_keys_count;
+  RDI_U64 reused_line_tables_count;
+  
   RDIM_LineTableBakeResult baked_line_tables;
   
   RDIM_BakeStringMapTight bake_strings;
@@ -92,6 +155,7 @@ struct RDIM_Shared
   RDI_U64 *lane_name_map_node_offs[RDI_NameMapKind_COUNT];
   RDI_U64 name_map_node_counts[RDI_NameMapKind_COUNT];
   RDI_U64 total_name_map_node_count;
+  RDIM_String8 *name_map_node_strings; // [total_name_map_node_count]
   RDIM_TopLevelNameMapBakeResult baked_top_level_name_maps;
   RDIM_NameMapBakeResult baked_name_maps;
   
@@ -161,7 +225,19 @@ struct RDIM_Shared
 global RDIM_Shared *rdim_shared = 0;
 
 internal RDIM_DataModel rdim_data_model_from_os_arch(OperatingSystem os, RDI_Arch arch);
-internal RDIM_BakeResults rdim_bake(Arena *arena, RDIM_BakeParams *params);
+internal int rdim_prev_line_table_key_qsort_compare(RDIM_PrevLineTableKey *a, RDIM_PrevLineTableKey *b);
+internal RDI_U64 rdim_input_hash_from_line_table(RDIM_LineTable *line_table);
+internal void rdim_bake_string_partitions_insert(Arena *arena, RDIM_BakeStringMapTopology *top, RDIM_BakeStringPartitions *partitions, RDIM_String8 string);
+internal void rdim_bake_name_partitions_insert(Arena *arena, RDIM_BakeNameMapTopology *top, RDIM_BakeNameChunkList *lists, RDIM_String8 string, RDI_U64 idx);
+internal B32 rdim_reuse_prev_line_table(RDI_Parsed *prev_rdi, RDI_U64 prev_line_table_idx, RDIM_LineTable *src, RDI_U64 key_count, RDI_U64 *voffs_out, RDI_Line *lines_out);
+internal RDIM_BakeResults rdim_bake_results_from_shared(RDIM_Shared *shared);
+internal RDIM_BakeResults rdim_bake(Arena *arena, RDIM_BakeParams *params, RDI_Parsed *prev_rdi, RDIM_SectionStream *stream);
 internal RDIM_SerializedSectionBundle rdim_compress(Arena *arena, RDIM_SerializedSectionBundle *in);
 
+internal RDIM_SectionStream *rdim_section_stream_begin(Arena *arena, String8 path, B32 compress);
+internal Arena *rdim_section_arena(Arena *fallback, RDI_SectionKind kind);
+internal void rdim_section_stream_flush(RDI_SectionKind *kinds, U64 kinds_count);
+internal B32 rdim_section_stream_end(RDIM_SectionStream *stream);
+#define rdim_section_stream_flush_kinds(...) do{RDI_SectionKind kinds__[] = {__VA_ARGS__}; rdim_section_stream_flush(kinds__, ArrayCount(kinds__));}while(0)
+
 #endif // RDI_MAKE_LOCAL_H
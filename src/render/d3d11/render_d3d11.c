@@ -730,6 +730,33 @@ r_fill_tex2d_region(R_Handle handle, Rng2S32 subrect, void *data)
   ProfEnd();
 }
 
+r_hook void
+r_fill_tex2d_regions(R_Handle handle, R_Tex2DRegionFillArray *fills)
+{
+  ProfBeginFunction();
+  MutexScopeW(r_d3d11_state->device_rw_mutex)
+  {
+    R_D3D11_Tex2D *texture = r_d3d11_tex2d_from_handle(handle);
+    if(texture != &r_d3d11_tex2d_nil)
+    {
+      Assert(texture->kind == R_ResourceKind_Dynamic && "only dynamic texture can update region");
+      U64 bytes_per_pixel = r_tex2d_format_bytes_per_pixel_table[texture->format];
+      for EachIndex(idx, fills->count)
+      {
+        Rng2S32 subrect = fills->v[idx].subrect;
+        Vec2S32 dim = v2s32(subrect.x1 - subrect.x0, subrect.y1 - subrect.y0);
+        D3D11_BOX dst_box =
+        {
+          (UINT)subrect.x0, (UINT)subrect.y0, 0,
+          (UINT)subrect.x1, (UINT)subrect.y1, 1,
+        };
+        r_d3d11_state->device_ctx->lpVtbl->UpdateSubresource(r_d3d11_state->device_ctx, (ID3D11Resource *)texture->texture, 0, &dst_box, fills->v[idx].data, dim.x*bytes_per_pixel, 0);
+      }
+    }
+  }
+  ProfEnd();
+}
+
 //- rjf: buffers
 
 r_hook R_Handle
@@ -311,6 +311,24 @@ r_fill_tex2d_region(R_Handle texture, Rng2S32 subrect, void *data)
   }
 }
 
+r_hook void
+r_fill_tex2d_regions(R_Handle texture, R_Tex2DRegionFillArray *fills)
+{
+  R_OGL_Tex2D *t = r_ogl_tex2d_from_handle(texture);
+  if(t && fills->count != 0)
+  {
+    R_OGL_FormatInfo fmt_info = r_ogl_format_info_from_tex2dformat(t->fmt);
+    glBindTexture(GL_TEXTURE_2D, t->id);
+    for EachIndex(idx, fills->count)
+    {
+      Rng2S32 subrect = fills->v[idx].subrect;
+      Vec2S32 rect_size = dim_2s32(subrect);
+      glTexSubImage2D(GL_TEXTURE_2D, 0, subrect.x0, subrect.y0, rect_size.x, rect_size.y, fmt_info.format, fmt_info.base_type, fills->v[idx].data);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+}
+
 //- rjf: buffers
 
 r_hook R_Handle
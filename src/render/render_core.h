@@ -90,6 +90,23 @@ union R_Handle
   U16 u16[4];
 };
 
+////////////////////////////////
+//~ rjf: Texture Upload Types
+
+typedef struct R_Tex2DRegionFill R_Tex2DRegionFill;
+struct R_Tex2DRegionFill
+{
+  Rng2S32 subrect;
+  void *data;
+};
+
+typedef struct R_Tex2DRegionFillArray R_Tex2DRegionFillArray;
+struct R_Tex2DRegionFillArray
+{
+  R_Tex2DRegionFill *v;
+  U64 count;
+};
+
 ////////////////////////////////
 //~ rjf: Instance Types
 
@@ -291,6 +308,7 @@ r_hook R_ResourceKind    r_kind_from_tex2d(R_Handle texture);
 r_hook Vec2S32           r_size_from_tex2d(R_Handle texture);
 r_hook R_Tex2DFormat     r_format_from_tex2d(R_Handle texture);
 r_hook void              r_fill_tex2d_region(R_Handle texture, Rng2S32 subrect, void *data);
+r_hook void              r_fill_tex2d_regions(R_Handle texture, R_Tex2DRegionFillArray *fills);
 
 //- rjf: buffers
 r_hook R_Handle          r_buffer_alloc(R_ResourceKind kind, U64 size, void *data);
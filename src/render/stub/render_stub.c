@@ -41,7 +41,7 @@ r_tex2d_release(R_Handle texture)
 r_hook R_ResourceKind
 r_kind_from_tex2d(R_Handle texture)
 {
-  return R_ResourceStatic;
+  return R_ResourceKind_Static;
 }
 
 r_hook Vec2S32
@@ -61,6 +61,11 @@ r_fill_tex2d_region(R_Handle texture, Rng2S32 subrect, void *data)
 {
 }
 
+r_hook void
+r_fill_tex2d_regions(R_Handle texture, R_Tex2DRegionFillArray *fills)
+{
+}
+
 //- rjf: buffers
 
 r_hook R_Handle
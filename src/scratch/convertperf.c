@@ -0,0 +1,247 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Build Options
+
+#define BUILD_TITLE "convertperf"
+#define BUILD_CONSOLE_INTERFACE 1
+
+////////////////////////////////
+//~ rjf: Includes
+
+//- rjf: [h]
+#include "base/base_inc.h"
+#include "os/os_inc.h"
+
+//- rjf: [c]
+#include "base/base_inc.c"
+#include "os/os_inc.c"
+
+////////////////////////////////
+//~ rjf: Run Types
+
+typedef struct CP_Run CP_Run;
+struct CP_Run
+{
+  U64 threads_count;
+  U64 iteration_idx;
+  U64 exit_code;
+  U64 wall_us;
+  String8 stats;
+};
+
+////////////////////////////////
+//~ rjf: Output Helpers
+
+internal void
+cp_errorf(char *fmt, ...)
+{
+  Temp scratch = scratch_begin(0, 0);
+  va_list args;
+  va_start(args, fmt);
+  String8 string = str8fv(scratch.arena, fmt, args);
+  va_end(args);
+  fwrite(string.str, 1, string.size, stderr);
+  scratch_end(scratch);
+}
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void
+entry_point(CmdLine *cmdline)
+{
+  Arena *arena = arena_alloc();
+
+  //- rjf: unpack command line
+  String8List cases = cmdline->inputs;
+  String8 radbin_path = cmd_line_string(cmdline, str8_lit("radbin"));
+  String8 out_path = cmd_line_string(cmdline, str8_lit("out"));
+  String8 temp_dir = cmd_line_string(cmdline, str8_lit("temp"));
+  String8List threads_count_strings = cmd_line_strings(cmdline, str8_lit("threads"));
+  B32 compress = cmd_line_has_flag(cmdline, str8_lit("compress"));
+  U64 iteration_count = 3;
+  try_u64_from_str8_c_rules(cmd_line_string(cmdline, str8_lit("iterations")), &iteration_count);
+  iteration_count = Max(1, iteration_count);
+  if(radbin_path.size == 0)
+  {
+    radbin_path = push_str8f(arena, "%S/radbin%s", os_get_process_info()->binary_path, OS_WINDOWS ? ".exe" : "");
+  }
+  if(temp_dir.size == 0)
+  {
+    temp_dir = os_get_current_path(arena);
+  }
+  if(cases.node_count == 0)
+  {
+    cp_errorf("usage: convertperf <input file> [<input file> ...]\n"
+              "                   [--radbin:<path>]           (default: radbin next to this binary)\n"
+              "                   [--threads:<n>[,<n>...]]    (default: 1, 2, 4, ... up to core count)\n"
+              "                   [--iterations:<n>]          (default: 3)\n"
+              "                   [--compress]                (also measure section compression)\n"
+              "                   [--temp:<dir>]              (where intermediate outputs are written)\n"
+              "                   [--out:<path>]              (JSON results; default: stdout)\n"
+              "\n"
+              "Each input is converted with radbin, at each thread count, for each iteration.\n"
+              "Per-zone timings are only reported when radbin is built with `profile_stats`.\n");
+    os_abort(1);
+  }
+
+  //- rjf: gather thread counts
+  U64 threads_counts_count = 0;
+  U64 *threads_counts = push_array(arena, U64, 64);
+  if(threads_count_strings.node_count != 0)
+  {
+    for EachNode(n, String8Node, threads_count_strings.first)
+    {
+      U64 threads_count = 0;
+      if(try_u64_from_str8_c_rules(n->string, &threads_count) && threads_count != 0 && threads_counts_count < 64)
+      {
+        threads_counts[threads_counts_count] = threads_count;
+        threads_counts_count += 1;
+      }
+    }
+  }
+  else
+  {
+    U64 max_threads_count = os_get_system_info()->logical_processor_count;
+    for(U64 threads_count = 1; threads_counts_count < 64; threads_count *= 2)
+    {
+      threads_counts[threads_counts_count] = Min(threads_count, max_threads_count);
+      threads_counts_count += 1;
+      if(threads_count >= max_threads_count)
+      {
+        break;
+      }
+    }
+  }
+
+  //- rjf: run all cases
+  String8List json = {0};
+  str8_list_pushf(arena, &json, "{\"radbin\": \"%S\", \"iterations\": %I64u, \"compress\": %s, \"cases\": [",
+                  escaped_from_raw_str8(arena, radbin_path), iteration_count, compress ? "true" : "false");
+  for EachNode(case_n, String8Node, cases.first)
+  {
+    String8 input_path = case_n->string;
+    String8 temp_rdi_path = push_str8f(arena, "%S/convertperf.tmp.rdi", temp_dir);
+    String8 temp_stats_path = push_str8f(arena, "%S/convertperf.tmp.json", temp_dir);
+    cp_errorf("%S\n", input_path);
+
+    //- rjf: do all runs
+    U64 runs_count = threads_counts_count*iteration_count;
+    CP_Run *runs = push_array(arena, CP_Run, runs_count);
+    U64 *best_wall_us = push_array(arena, U64, threads_counts_count);
+    for EachIndex(threads_idx, threads_counts_count)
+    {
+      best_wall_us[threads_idx] = max_U64;
+      for EachIndex(iteration_idx, iteration_count)
+      {
+        CP_Run *run = &runs[threads_idx*iteration_count + iteration_idx];
+        run->threads_count = threads_counts[threads_idx];
+        run->iteration_idx = iteration_idx;
+
+        // rjf: launch radbin & wait for it
+        Temp scratch = scratch_begin(&arena, 1);
+        OS_ProcessLaunchParams params = {0};
+        params.path = str8_chop_last_slash(radbin_path);
+        params.inherit_env = 1;
+        params.consoleless = 1;
+        str8_list_push(scratch.arena, &params.cmd_line, OS_WINDOWS ? radbin_path : str8_skip_last_slash(radbin_path));
+        str8_list_pushf(scratch.arena, &params.cmd_line, "--rdi");
+        str8_list_pushf(scratch.arena, &params.cmd_line, "--thread_count:%I64u", run->threads_count);
+        str8_list_pushf(scratch.arena, &params.cmd_line, "--perf_stats:%S", temp_stats_path);
+        str8_list_pushf(scratch.arena, &params.cmd_line, "--out:%S", temp_rdi_path);
+        if(compress)
+        {
+          str8_list_pushf(scratch.arena, &params.cmd_line, "--compress");
+        }
+        str8_list_push(scratch.arena, &params.cmd_line, input_path);
+        os_delete_file_at_path(temp_stats_path);
+        U64 start_us = os_now_microseconds();
+        OS_Handle process = os_process_launch(&params);
+        if(!os_handle_match(process, os_handle_zero()))
+        {
+          os_process_join(process, max_U64, &run->exit_code);
+        }
+        else
+        {
+          run->exit_code = max_U64;
+        }
+        U64 end_us = os_now_microseconds();
+        scratch_end(scratch);
+
+        // rjf: gather results
+        run->wall_us = end_us - start_us;
+        run->stats = str8_skip_chop_whitespace(os_data_from_file_path(arena, temp_stats_path));
+        if(run->stats.size == 0)
+        {
+          run->stats = str8_lit("null");
+        }
+        if(run->exit_code == 0)
+        {
+          best_wall_us[threads_idx] = Min(best_wall_us[threads_idx], run->wall_us);
+        }
+        cp_errorf("  threads %3I64u  iteration %I64u  %10I64u us%s\n",
+                  run->threads_count, run->iteration_idx, run->wall_us,
+                  run->exit_code == 0 ? "" : "  [FAILED]");
+      }
+    }
+    os_delete_file_at_path(temp_rdi_path);
+    os_delete_file_at_path(temp_stats_path);
+
+    //- rjf: emit runs
+    str8_list_pushf(arena, &json, "%s\n {\"input\": \"%S\", \"runs\": [", case_n == cases.first ? "" : ",", escaped_from_raw_str8(arena, input_path));
+    for EachIndex(run_idx, runs_count)
+    {
+      CP_Run *run = &runs[run_idx];
+      str8_list_pushf(arena, &json, "%s\n  {\"threads\": %I64u, \"iteration\": %I64u, \"exit_code\": %I64d, \"wall_us\": %I64u, \"radbin\": %S}",
+                      run_idx == 0 ? "" : ",",
+                      run->threads_count, run->iteration_idx, (S64)run->exit_code, run->wall_us, run->stats);
+    }
+    str8_list_pushf(arena, &json, "],\n  \"scaling\": [");
+
+    //- rjf: emit scaling, relative to the smallest thread count
+    U64 base_threads_idx = 0;
+    for EachIndex(threads_idx, threads_counts_count)
+    {
+      if(threads_counts[threads_idx] < threads_counts[base_threads_idx])
+      {
+        base_threads_idx = threads_idx;
+      }
+    }
+    for EachIndex(threads_idx, threads_counts_count)
+    {
+      F64 speedup = 0;
+      F64 efficiency = 0;
+      if(best_wall_us[threads_idx] != max_U64 && best_wall_us[base_threads_idx] != max_U64 && best_wall_us[threads_idx] != 0)
+      {
+        speedup = (F64)best_wall_us[base_threads_idx] / (F64)best_wall_us[threads_idx];
+        efficiency = speedup * (F64)threads_counts[base_threads_idx] / (F64)threads_counts[threads_idx];
+      }
+      str8_list_pushf(arena, &json, "%s\n   {\"threads\": %I64u, \"best_wall_us\": %I64u, \"speedup\": %.3f, \"efficiency\": %.3f}",
+                      threads_idx == 0 ? "" : ",",
+                      threads_counts[threads_idx], best_wall_us[threads_idx] == max_U64 ? 0 : best_wall_us[threads_idx], speedup, efficiency);
+      cp_errorf("  threads %3I64u  best %10I64u us  speedup %6.2fx  efficiency %5.1f%%\n",
+                threads_counts[threads_idx], best_wall_us[threads_idx] == max_U64 ? 0 : best_wall_us[threads_idx], speedup, efficiency*100.0);
+    }
+    str8_list_pushf(arena, &json, "]}");
+  }
+  str8_list_pushf(arena, &json, "]}\n");
+
+  //- rjf: write results
+  if(out_path.size != 0)
+  {
+    if(!os_write_data_list_to_file_path(out_path, json))
+    {
+      cp_errorf("error: could not write %S\n", out_path);
+      os_abort(1);
+    }
+  }
+  else
+  {
+    for EachNode(n, String8Node, json.first)
+    {
+      fwrite(n->string.str, 1, n->string.size, stdout);
+    }
+  }
+}
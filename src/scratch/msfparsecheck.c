@@ -0,0 +1,451 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Build Options
+
+#define BUILD_TITLE "msfparsecheck"
+#define BUILD_CONSOLE_INTERFACE 1
+
+////////////////////////////////
+//~ rjf: Includes
+
+//- rjf: [h]
+#include "base/base_inc.h"
+#include "os/os_inc.h"
+#include "msf/msf.h"
+#include "msf/msf_parse.h"
+
+//- rjf: [c]
+#include "base/base_inc.c"
+#include "os/os_inc.c"
+#include "msf/msf.c"
+#include "msf/msf_parse.c"
+
+////////////////////////////////
+//~ rjf: Types
+
+typedef struct MPC_LaneParams MPC_LaneParams;
+struct MPC_LaneParams
+{
+  LaneCtx lane_ctx;
+  String8 msf_data;
+  MSF_Parsed *eager;
+  MSF_Parsed **lazy_slot;
+  U64 held_sn;
+  String8 *lane_results;
+  U64 fail_count;
+};
+
+////////////////////////////////
+//~ rjf: Output Helpers
+
+internal void
+mpc_printf(char *fmt, ...)
+{
+  Temp scratch = scratch_begin(0, 0);
+  va_list args;
+  va_start(args, fmt);
+  String8 string = str8fv(scratch.arena, fmt, args);
+  va_end(args);
+  fwrite(string.str, 1, string.size, stdout);
+  scratch_end(scratch);
+}
+
+////////////////////////////////
+//~ rjf: Synthetic MSF Building
+
+internal U8
+mpc_byte_from_stream_off(U64 sn, U64 off)
+{
+  U64 x = (sn+1)*0x9e3779b97f4a7c15ull ^ (off+1)*0xbf58476d1ce4e5b9ull;
+  x ^= x >> 29;
+  return (U8)x;
+}
+
+// NOTE(rjf): builds an MSF 7.0 image with a mix of stream shapes - empty,
+// deleted, single-page, contiguous, & fragmented (pages out of order, or
+// interleaved with other streams' pages) - each filled with bytes which can
+// be regenerated from the stream number & offset.
+
+internal String8
+mpc_synthetic_msf_from_seed(Arena *arena, U64 page_size, U64 stream_count, U32 seed)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  U32 rng_state = seed;
+#define mpc_rand() (rng_state = rng_state*1664525u + 1013904223u, rng_state >> 8)
+
+  //- rjf: pick stream sizes & shapes
+  U32 *stream_sizes = push_array(scratch.arena, U32, stream_count);
+  B32 *stream_is_fragmented = push_array(scratch.arena, B32, stream_count);
+  for EachIndex(sn, stream_count)
+  {
+    switch(sn % 6)
+    {
+      case 0:{stream_sizes[sn] = 0;}break;
+      case 1:{stream_sizes[sn] = MSF_DELETED_STREAM_STAMP;}break;
+      case 2:{stream_sizes[sn] = 1 + mpc_rand() % page_size;}break;
+      case 3:{stream_sizes[sn] = page_size*(2 + mpc_rand() % 8);}break;
+      default:{stream_sizes[sn] = page_size + 1 + mpc_rand() % (page_size*16);}break;
+    }
+    stream_is_fragmented[sn] = (sn % 6 >= 3 && (mpc_rand() & 1));
+  }
+
+  //- rjf: lay out pages - page 0 is the header, 1 & 2 are the free page maps,
+  // then contiguous streams get runs of pages, and fragmented streams share
+  // one pool of pages which is shuffled afterwards
+  U64 next_page_idx = 3;
+  U32 **stream_pages = push_array(scratch.arena, U32 *, stream_count);
+  U64 *stream_page_counts = push_array(scratch.arena, U64, stream_count);
+  U64 pool_page_count = 0;
+  for EachIndex(sn, stream_count)
+  {
+    U64 size = (stream_sizes[sn] == MSF_DELETED_STREAM_STAMP ? 0 : stream_sizes[sn]);
+    stream_page_counts[sn] = CeilIntegerDiv(size, page_size);
+    stream_pages[sn] = push_array(scratch.arena, U32, stream_page_counts[sn]);
+    if(stream_is_fragmented[sn])
+    {
+      pool_page_count += stream_page_counts[sn];
+    }
+    else
+    {
+      for EachIndex(page_idx, stream_page_counts[sn])
+      {
+        stream_pages[sn][page_idx] = (U32)next_page_idx;
+        next_page_idx += 1;
+      }
+    }
+  }
+  U32 *pool = push_array(scratch.arena, U32, pool_page_count);
+  for EachIndex(idx, pool_page_count)
+  {
+    pool[idx] = (U32)(next_page_idx + idx);
+  }
+  next_page_idx += pool_page_count;
+  for(U64 idx = pool_page_count; idx > 1; idx -= 1)
+  {
+    U64 swap_idx = mpc_rand() % idx;
+    Swap(U32, pool[idx-1], pool[swap_idx]);
+  }
+  {
+    U64 pool_pos = 0;
+    for EachIndex(sn, stream_count)
+    {
+      if(stream_is_fragmented[sn])
+      {
+        MemoryCopy(stream_pages[sn], pool + pool_pos, sizeof(U32)*stream_page_counts[sn]);
+        pool_pos += stream_page_counts[sn];
+
+        // rjf: a shuffle can leave a short stream in order by chance - swap
+        // its first two pages, so it's fragmented for sure
+        if(stream_page_counts[sn] > 1 && stream_pages[sn][1] == stream_pages[sn][0] + 1)
+        {
+          Swap(U32, stream_pages[sn][0], stream_pages[sn][1]);
+        }
+      }
+    }
+  }
+
+  //- rjf: build directory - stream count, sizes, then each stream's pages
+  String8List directory_parts = {0};
+  str8_list_push(scratch.arena, &directory_parts, push_str8_copy(scratch.arena, str8_struct(&(U32){(U32)stream_count})));
+  str8_list_push(scratch.arena, &directory_parts, str8((U8 *)stream_sizes, sizeof(U32)*stream_count));
+  for EachIndex(sn, stream_count)
+  {
+    str8_list_push(scratch.arena, &directory_parts, str8((U8 *)stream_pages[sn], sizeof(U32)*stream_page_counts[sn]));
+  }
+  String8 directory = str8_list_join(scratch.arena, &directory_parts, 0);
+  U64 directory_page_count = CeilIntegerDiv(directory.size, page_size);
+  U64 directory_first_page_idx = next_page_idx;
+  next_page_idx += directory_page_count;
+  U64 map_page_idx = next_page_idx;
+  next_page_idx += 1;
+  Assert(directory_page_count*sizeof(U32) <= page_size);
+
+  //- rjf: write image
+  U64 page_count = next_page_idx;
+  String8 result = {0};
+  result.size = page_count*page_size;
+  result.str = push_array(arena, U8, result.size);
+  {
+    MSF_Header70 *header = (MSF_Header70 *)result.str;
+    MemoryCopy(header->magic, msf_msf70_magic, sizeof(msf_msf70_magic));
+    header->page_size         = (U32)page_size;
+    header->active_fpm        = 1;
+    header->page_count        = (U32)page_count;
+    header->stream_table_size = (U32)directory.size;
+    header->root_pn           = (U32)map_page_idx;
+  }
+  for EachIndex(sn, stream_count)
+  {
+    U64 size = (stream_sizes[sn] == MSF_DELETED_STREAM_STAMP ? 0 : stream_sizes[sn]);
+    for EachIndex(off, size)
+    {
+      U64 page_idx = stream_pages[sn][off/page_size];
+      result.str[page_idx*page_size + off%page_size] = mpc_byte_from_stream_off(sn, off);
+    }
+  }
+  MemoryCopy(result.str + directory_first_page_idx*page_size, directory.str, directory.size);
+  for EachIndex(idx, directory_page_count)
+  {
+    ((U32 *)(result.str + map_page_idx*page_size))[idx] = (U32)(directory_first_page_idx + idx);
+  }
+#undef mpc_rand
+  scratch_end(scratch);
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Lazy Materialization Lanes
+
+// NOTE(rjf): every lane asks for every stream, in the same order, so that
+// lanes race to materialize each fragmented stream & the losers wait on the
+// lazy MSF's condition variable. each lane checks its bytes against the eager
+// parse, & records what it got, so that the caller can check all lanes saw the
+// same (single) materialization.
+//
+// with few cores, lanes rarely actually collide, so one fragmented stream is
+// also held in the materializing state by lane 0 - exactly as an owning lane
+// would - while the others ask for it, so they must wait for it every round.
+
+internal void
+mpc_lane_entry_point(void *p)
+{
+  MPC_LaneParams *params = (MPC_LaneParams *)p;
+  lane_ctx(params->lane_ctx);
+  Arena *arena = arena_alloc();
+  if(lane_idx() == 0)
+  {
+    params->lazy_slot[0] = msf_parsed_lazy_from_data(arena, params->msf_data);
+  }
+  lane_sync();
+  MSF_Parsed *lazy = params->lazy_slot[0];
+  msf_parsed_lazy_equip_lane_arena(lazy, arena);
+  MSF_Parsed *eager = params->eager;
+  if(lane_idx() == 0 && params->held_sn < eager->stream_count)
+  {
+    MutexScope(lazy->mutex)
+    {
+      lazy->stream_states[params->held_sn] = MSF_StreamState_Materializing;
+    }
+  }
+  lane_sync();
+  if(lane_idx() == 0 && params->held_sn < eager->stream_count)
+  {
+    os_sleep_milliseconds(2);
+    String8 data = msf_data_from_stream_number(arena, lazy->msf_data, lazy->raw_stream_table, (MSF_StreamNumber)params->held_sn);
+    MutexScope(lazy->mutex)
+    {
+      lazy->streams[params->held_sn] = data;
+      ins_atomic_u64_eval_assign(&lazy->stream_states[params->held_sn], MSF_StreamState_Ready);
+    }
+    cond_var_broadcast(lazy->cv);
+  }
+  for(MSF_StreamNumber sn = 0; sn < eager->stream_count; sn += 1)
+  {
+    String8 data = msf_data_from_stream(lazy, sn);
+    params->lane_results[sn] = data;
+    if(!str8_match(data, eager->streams[sn], 0))
+    {
+      mpc_printf("  FAIL lane %I64u: stream %u differs from eager parse (%I64u vs %I64u bytes)\n",
+                 lane_idx(), sn, data.size, eager->streams[sn].size);
+      params->fail_count += 1;
+    }
+  }
+  lane_sync();
+  if(lane_idx() == 0)
+  {
+    msf_parsed_lazy_release(lazy);
+  }
+  lane_sync();
+  arena_release(arena);
+}
+
+////////////////////////////////
+//~ rjf: Checks
+
+internal U64
+mpc_fail_count_from_msf_data(String8 msf_data, U64 lanes_count, U64 rounds_count, B32 is_synthetic)
+{
+  Temp scratch = scratch_begin(0, 0);
+  U64 fail_count = 0;
+
+  //- rjf: eager parse is the reference
+  MSF_Parsed *eager = msf_parsed_from_data(scratch.arena, msf_data);
+  MSF_RawStreamTable *st = msf_raw_stream_table_from_data(scratch.arena, msf_data);
+  if(eager == 0 || st == 0)
+  {
+    mpc_printf("  FAIL: could not parse MSF\n");
+    fail_count += 1;
+    goto end;
+  }
+
+  //- rjf: synthetic -> check the eager parse against the generated bytes
+  if(is_synthetic)
+  {
+    for(MSF_StreamNumber sn = 0; sn < eager->stream_count; sn += 1)
+    {
+      String8 data = eager->streams[sn];
+      B32 good = (data.size == st->streams[sn].size);
+      for(U64 off = 0; good && off < data.size; off += 1)
+      {
+        good = (data.str[off] == mpc_byte_from_stream_off(sn, off));
+      }
+      if(!good)
+      {
+        mpc_printf("  FAIL: eager stream %u does not match the generated bytes\n", sn);
+        fail_count += 1;
+      }
+    }
+  }
+
+  //- rjf: single lane (this thread) - contiguous streams must be views into
+  // the MSF data, ready up-front; fragmented streams must start
+  // unmaterialized, & be copied on first request
+  U64 contiguous_count = 0;
+  U64 fragmented_count = 0;
+  U64 first_fragmented_sn = max_U64;
+  {
+    Arena *arena = arena_alloc();
+    MSF_Parsed *lazy = msf_parsed_lazy_from_data(arena, msf_data);
+    msf_parsed_lazy_equip_lane_arena(lazy, arena);
+    for(MSF_StreamNumber sn = 0; sn < eager->stream_count; sn += 1)
+    {
+      B32 is_contiguous = msf_stream_number_is_contiguous(msf_data, st, sn);
+      U64 state = lazy->stream_states[sn];
+      contiguous_count += (is_contiguous && st->streams[sn].page_count > 1);
+      fragmented_count += !is_contiguous;
+      if(!is_contiguous && first_fragmented_sn == max_U64)
+      {
+        first_fragmented_sn = sn;
+      }
+      if(is_contiguous != (state == MSF_StreamState_Ready))
+      {
+        mpc_printf("  FAIL: stream %u is %s, but starts %s\n", sn,
+                   is_contiguous ? "contiguous" : "fragmented",
+                   state == MSF_StreamState_Ready ? "ready" : "unmaterialized");
+        fail_count += 1;
+      }
+      String8 data = msf_data_from_stream(lazy, sn);
+      B32 is_view = (msf_data.str <= data.str && data.str + data.size <= msf_data.str + msf_data.size);
+      if(data.size != 0 && is_view != is_contiguous)
+      {
+        mpc_printf("  FAIL: stream %u is %s, but was %s\n", sn,
+                   is_contiguous ? "contiguous" : "fragmented",
+                   is_view ? "a view into the MSF data" : "copied");
+        fail_count += 1;
+      }
+      if(!str8_match(data, eager->streams[sn], 0))
+      {
+        mpc_printf("  FAIL: stream %u differs from eager parse (%I64u vs %I64u bytes)\n", sn, data.size, eager->streams[sn].size);
+        fail_count += 1;
+      }
+      if(!str8_match(msf_data_from_stream(lazy, sn), data, 0) || msf_data_from_stream(lazy, sn).str != data.str)
+      {
+        mpc_printf("  FAIL: stream %u changed on second request\n", sn);
+        fail_count += 1;
+      }
+    }
+    msf_parsed_lazy_release(lazy);
+    arena_release(arena);
+  }
+  if(is_synthetic && fragmented_count == 0)
+  {
+    mpc_printf("  FAIL: synthetic MSF has no fragmented streams\n");
+    fail_count += 1;
+  }
+
+  //- rjf: many lanes, racing to materialize the same streams
+  {
+    Thread *threads = push_array(scratch.arena, Thread, lanes_count);
+    MPC_LaneParams *lanes_params = push_array(scratch.arena, MPC_LaneParams, lanes_count);
+    MSF_Parsed *lazy_slot = 0;
+    U64 broadcast_val = 0;
+    for EachIndex(lane_idx, lanes_count)
+    {
+      lanes_params[lane_idx].lane_results = push_array(scratch.arena, String8, eager->stream_count);
+    }
+    for EachIndex(round_idx, rounds_count)
+    {
+      Barrier barrier = barrier_alloc(lanes_count);
+      for EachIndex(lane_idx, lanes_count)
+      {
+        MPC_LaneParams *params = &lanes_params[lane_idx];
+        params->lane_ctx.lane_idx         = lane_idx;
+        params->lane_ctx.lane_count       = lanes_count;
+        params->lane_ctx.barrier          = barrier;
+        params->lane_ctx.broadcast_memory = &broadcast_val;
+        params->msf_data                  = msf_data;
+        params->eager                     = eager;
+        params->lazy_slot                 = &lazy_slot;
+        params->held_sn                   = first_fragmented_sn;
+        threads[lane_idx] = thread_launch(mpc_lane_entry_point, params);
+      }
+      for EachIndex(lane_idx, lanes_count)
+      {
+        thread_join(threads[lane_idx], max_U64);
+      }
+      barrier_release(barrier);
+      for(MSF_StreamNumber sn = 0; sn < eager->stream_count; sn += 1)
+      {
+        for(U64 lane_idx = 1; lane_idx < lanes_count; lane_idx += 1)
+        {
+          if(lanes_params[lane_idx].lane_results[sn].str != lanes_params[0].lane_results[sn].str)
+          {
+            mpc_printf("  FAIL round %I64u: lanes 0 & %I64u got different copies of stream %u\n", round_idx, lane_idx, sn);
+            fail_count += 1;
+            break;
+          }
+        }
+      }
+    }
+    for EachIndex(lane_idx, lanes_count)
+    {
+      fail_count += lanes_params[lane_idx].fail_count;
+    }
+  }
+
+  mpc_printf("  %I64u streams (%I64u multi-page contiguous, %I64u fragmented), %I64u lanes x %I64u rounds, %I64u failures\n",
+             eager->stream_count, contiguous_count, fragmented_count, lanes_count, rounds_count, fail_count);
+  end:;
+  scratch_end(scratch);
+  return fail_count;
+}
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void
+entry_point(CmdLine *cmdline)
+{
+  Arena *arena = arena_alloc();
+
+  //- rjf: unpack command line
+  U64 lanes_count = 4;
+  U64 rounds_count = 64;
+  try_u64_from_str8_c_rules(cmd_line_string(cmdline, str8_lit("lanes")), &lanes_count);
+  try_u64_from_str8_c_rules(cmd_line_string(cmdline, str8_lit("rounds")), &rounds_count);
+  lanes_count = Max(1, lanes_count);
+
+  //- rjf: check synthetic MSFs, at a few page sizes, then each given PDB
+  U64 fail_count = 0;
+  U64 page_sizes[] = {512, 1024, 4096};
+  for EachElement(idx, page_sizes)
+  {
+    String8 msf_data = mpc_synthetic_msf_from_seed(arena, page_sizes[idx], 64, 0x9e3779b9u + (U32)idx);
+    mpc_printf("synthetic MSF, %I64u byte pages: %I64u bytes\n", page_sizes[idx], msf_data.size);
+    fail_count += mpc_fail_count_from_msf_data(msf_data, lanes_count, rounds_count, 1);
+  }
+  for(String8Node *n = cmdline->inputs.first; n != 0; n = n->next)
+  {
+    String8 msf_data = os_data_from_file_path(arena, n->string);
+    mpc_printf("%.*s: %I64u bytes\n", str8_varg(n->string), msf_data.size);
+    fail_count += mpc_fail_count_from_msf_data(msf_data, lanes_count, rounds_count, 0);
+  }
+  mpc_printf("%I64u failures\n", fail_count);
+
+  if(fail_count != 0)
+  {
+    os_abort(1);
+  }
+}
@@ -0,0 +1,195 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Build Options
+
+#define BUILD_TITLE "rdidecodeperf"
+#define BUILD_CONSOLE_INTERFACE 1
+
+////////////////////////////////
+//~ rjf: Includes
+
+//- rjf: [h]
+#include "base/base_inc.h"
+#include "os/os_inc.h"
+#include "rdi/rdi_local.h"
+
+//- rjf: [c]
+#include "base/base_inc.c"
+#include "os/os_inc.c"
+#include "rdi/rdi_local.c"
+
+////////////////////////////////
+//~ rjf: Output Helpers
+
+internal void
+rdp_printf(char *fmt, ...)
+{
+  Temp scratch = scratch_begin(0, 0);
+  va_list args;
+  va_start(args, fmt);
+  String8 string = str8fv(scratch.arena, fmt, args);
+  va_end(args);
+  fwrite(string.str, 1, string.size, stdout);
+  scratch_end(scratch);
+}
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void
+entry_point(CmdLine *cmdline)
+{
+  Arena *arena = arena_alloc();
+
+  //- rjf: unpack command line
+  String8 rdi_path = cmdline->inputs.first ? cmdline->inputs.first->string : str8_zero();
+  U64 ranges_per_section = 256;
+  U64 iteration_count = 8;
+  try_u64_from_str8_c_rules(cmd_line_string(cmdline, str8_lit("ranges")), &ranges_per_section);
+  try_u64_from_str8_c_rules(cmd_line_string(cmdline, str8_lit("iterations")), &iteration_count);
+  iteration_count = Max(1, iteration_count);
+  if(rdi_path.size == 0)
+  {
+    fprintf(stderr, "usage: rdidecodeperf <path to .rdi> [--ranges:<n per section>] [--iterations:<n>]\n");
+    os_abort(1);
+  }
+
+  //- rjf: load & parse RDI
+  RDI_Parsed rdi = {0};
+  String8 data = os_data_from_file_path(arena, rdi_path);
+  if(rdi_parse(data.str, data.size, &rdi) != RDI_ParseStatus_Good)
+  {
+    fprintf(stderr, "error: could not parse %.*s as RDI\n", str8_varg(rdi_path));
+    os_abort(1);
+  }
+
+  //- rjf: decompress the whole file, as the reference for every range decode
+  U64 decompressed_size = rdi_decompressed_size_from_parsed(&rdi);
+  U8 *decompressed_data = push_array_no_zero(arena, U8, decompressed_size);
+  RDI_Parsed rdi_decompressed = {0};
+  U64 whole_decode_us = max_U64;
+  for EachIndex(iteration_idx, iteration_count)
+  {
+    U64 start_us = os_now_microseconds();
+    rdi_decompress_parsed(decompressed_data, decompressed_size, &rdi);
+    U64 end_us = os_now_microseconds();
+    whole_decode_us = Min(whole_decode_us, end_us - start_us);
+  }
+  if(rdi_parse(decompressed_data, decompressed_size, &rdi_decompressed) != RDI_ParseStatus_Good)
+  {
+    fprintf(stderr, "error: could not parse decompressed %.*s\n", str8_varg(rdi_path));
+    os_abort(1);
+  }
+  rdp_printf("%.*s: %I64u bytes, %I64u decompressed, whole-file decode: %I64u us\n",
+             str8_varg(rdi_path), data.size, decompressed_size, whole_decode_us);
+
+  //- rjf: round-trip every section - whole, then random sub-ranges, each
+  // checked against the matching bytes of the whole-file decode
+  U64 fail_count = 0;
+  U64 range_count = 0;
+  U32 rng_state = 0x9e3779b9;
+  for EachIndex(kind_idx, rdi.sections_count)
+  {
+    RDI_SectionKind kind = (RDI_SectionKind)kind_idx;
+    RDI_Section *section = &rdi.sections[kind];
+    RDI_U8 *expected = rdi_decompressed.raw_data + rdi_decompressed.sections[kind].off;
+    U64 section_size = section->unpacked_size;
+    if(section_size == 0)
+    {
+      continue;
+    }
+    Temp scratch = scratch_begin(0, 0);
+    U64 decode_scratch_size = rdi_decompress_section_range_scratch_size(&rdi, kind);
+    RDI_U8 *decode_scratch = push_array_no_zero(scratch.arena, RDI_U8, decode_scratch_size);
+    RDI_U8 *dst = push_array_no_zero(scratch.arena, RDI_U8, section_size);
+
+    //- rjf: whole section
+    {
+      B32 good = rdi_decompress_section_range(&rdi, kind, 0, section_size, dst, decode_scratch, decode_scratch_size);
+      if(!good || !MemoryMatch(dst, expected, section_size))
+      {
+        rdp_printf("  FAIL section %I64u: whole-section decode (good=%i)\n", kind_idx, good);
+        fail_count += 1;
+      }
+      range_count += 1;
+    }
+
+    //- rjf: random sub-ranges; half of them are small & placed to straddle
+    // a block boundary, if the section has more than one block
+    RDI_SectionBlockHeader *hdr = rdi_section_block_header_from_section(&rdi, section, 0);
+    for EachIndex(range_idx, ranges_per_section)
+    {
+      rng_state = rng_state*1664525u + 1013904223u;
+      U64 off = (U64)rng_state % section_size;
+      rng_state = rng_state*1664525u + 1013904223u;
+      U64 size = (U64)rng_state % (section_size - off + 1);
+      if(range_idx & 1 && hdr != 0 && hdr->block_count > 1)
+      {
+        U64 boundary = hdr->block_size * (1 + (U64)rng_state % (hdr->block_count - 1));
+        off = boundary - Min(boundary, 1 + (U64)rng_state % 64);
+        size = Min(section_size - off, 1 + (U64)(rng_state >> 8) % 128);
+      }
+      MemoryZero(dst, size);
+      B32 good = rdi_decompress_section_range(&rdi, kind, off, size, dst, decode_scratch, decode_scratch_size);
+      if(!good || !MemoryMatch(dst, expected + off, size))
+      {
+        rdp_printf("  FAIL section %I64u: range [%I64u, %I64u) (good=%i)\n", kind_idx, off, off+size, good);
+        fail_count += 1;
+      }
+      range_count += 1;
+    }
+
+    //- rjf: a range not starting on a block boundary, with too little scratch,
+    // must fail rather than overrun
+    if(decode_scratch_size != 0 && section_size > 1)
+    {
+      B32 good = rdi_decompress_section_range(&rdi, kind, 1, section_size - 1, dst, decode_scratch, decode_scratch_size - 1);
+      if(good)
+      {
+        rdp_printf("  FAIL section %I64u: decoded with undersized scratch\n", kind_idx);
+        fail_count += 1;
+      }
+      range_count += 1;
+    }
+    scratch_end(scratch);
+  }
+  rdp_printf("round-trip: %I64u ranges, %I64u failures\n", range_count, fail_count);
+
+  //- rjf: time decoding a small range out of the largest section, vs. the
+  // whole-file decode above
+  {
+    RDI_SectionKind largest_kind = RDI_SectionKind_NULL;
+    for EachIndex(kind_idx, rdi.sections_count)
+    {
+      if(rdi.sections[kind_idx].unpacked_size > rdi.sections[largest_kind].unpacked_size)
+      {
+        largest_kind = (RDI_SectionKind)kind_idx;
+      }
+    }
+    U64 section_size = rdi.sections[largest_kind].unpacked_size;
+    U64 size = Min(section_size, KB(4));
+    U64 off = (section_size - size) / 2;
+    Temp scratch = scratch_begin(0, 0);
+    U64 decode_scratch_size = rdi_decompress_section_range_scratch_size(&rdi, largest_kind);
+    RDI_U8 *decode_scratch = push_array_no_zero(scratch.arena, RDI_U8, decode_scratch_size);
+    RDI_U8 *dst = push_array_no_zero(scratch.arena, RDI_U8, size);
+    U64 range_decode_us = max_U64;
+    for EachIndex(iteration_idx, iteration_count)
+    {
+      U64 start_us = os_now_microseconds();
+      rdi_decompress_section_range(&rdi, largest_kind, off, size, dst, decode_scratch, decode_scratch_size);
+      U64 end_us = os_now_microseconds();
+      range_decode_us = Min(range_decode_us, end_us - start_us);
+    }
+    scratch_end(scratch);
+    rdp_printf("range decode: %I64u bytes of section %i (%I64u bytes, encoding %i): %I64u us\n",
+               size, (int)largest_kind, section_size, (int)rdi.sections[largest_kind].encoding, range_decode_us);
+  }
+
+  if(fail_count != 0)
+  {
+    os_abort(1);
+  }
+}
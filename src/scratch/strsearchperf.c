@@ -0,0 +1,327 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Build Options
+
+#define BUILD_TITLE "strsearchperf"
+#define BUILD_CONSOLE_INTERFACE 1
+
+////////////////////////////////
+//~ rjf: Includes
+
+//- rjf: [h]
+#include "base/base_inc.h"
+#include "os/os_inc.h"
+#include "rdi/rdi_local.h"
+
+//- rjf: [c]
+#include "base/base_inc.c"
+#include "os/os_inc.c"
+#include "rdi/rdi_local.c"
+
+////////////////////////////////
+//~ rjf: Kernel Table
+
+typedef U64 StrSearchPerfKernelFunctionType(String8 string, U64 start_pos, String8 needle, StringMatchFlags flags);
+
+typedef struct StrSearchPerfKernel StrSearchPerfKernel;
+struct StrSearchPerfKernel
+{
+  String8 name;
+  StrSearchPerfKernelFunctionType *function;
+  CPUFeatureFlags required_cpu_flags;
+};
+
+////////////////////////////////
+//~ rjf: Output Helpers
+
+internal void
+ssp_printf(char *fmt, ...)
+{
+  Temp scratch = scratch_begin(0, 0);
+  va_list args;
+  va_start(args, fmt);
+  String8 string = str8fv(scratch.arena, fmt, args);
+  va_end(args);
+  fwrite(string.str, 1, string.size, stdout);
+  scratch_end(scratch);
+}
+
+////////////////////////////////
+//~ rjf: Reference Fuzzy Matching
+
+// NOTE(rjf): this is fuzzy_match_find, pinned to the scalar needle search. it's
+// used both as the baseline for timing & as the reference for correctness.
+
+internal FuzzyMatchRangeList
+ssp_fuzzy_match_find__scalar(Arena *arena, String8 needle, String8 haystack)
+{
+  FuzzyMatchRangeList result = {0};
+  Temp scratch = scratch_begin(&arena, 1);
+  String8List needles = str8_split(scratch.arena, needle, (U8*)" ", 1, 0);
+  StringMatchFlags flags = StringMatchFlag_CaseInsensitive|StringMatchFlag_SlashInsensitive;
+  result.needle_part_count = needles.node_count;
+  for(String8Node *needle_n = needles.first; needle_n != 0; needle_n = needle_n->next)
+  {
+    U64 find_pos = 0;
+    for(;find_pos < haystack.size;)
+    {
+      find_pos = str8_find_needle__scalar(haystack, find_pos, needle_n->string, flags);
+      B32 is_in_gathered_ranges = 0;
+      for(FuzzyMatchRangeNode *n = result.first; n != 0; n = n->next)
+      {
+        if(n->range.min <= find_pos && find_pos < n->range.max)
+        {
+          is_in_gathered_ranges = 1;
+          find_pos = n->range.max;
+          break;
+        }
+      }
+      if(!is_in_gathered_ranges)
+      {
+        break;
+      }
+    }
+    if(find_pos < haystack.size)
+    {
+      Rng1U64 range = r1u64(find_pos, find_pos+needle_n->string.size);
+      FuzzyMatchRangeNode *n = push_array(arena, FuzzyMatchRangeNode, 1);
+      n->range = range;
+      SLLQueuePush(result.first, result.last, n);
+      result.count += 1;
+      result.total_dim += dim_1u64(range);
+    }
+  }
+  scratch_end(scratch);
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void
+entry_point(CmdLine *cmdline)
+{
+  Arena *arena = arena_alloc();
+
+  //- rjf: unpack command line
+  String8 rdi_path = cmdline->inputs.first ? cmdline->inputs.first->string : str8_zero();
+  String8List queries = cmd_line_strings(cmdline, str8_lit("query"));
+  U64 iteration_count = 4;
+  try_u64_from_str8_c_rules(cmd_line_string(cmdline, str8_lit("iterations")), &iteration_count);
+  iteration_count = Max(1, iteration_count);
+  if(queries.node_count == 0)
+  {
+    str8_list_push(arena, &queries, str8_lit("a"));
+    str8_list_push(arena, &queries, str8_lit("rd_"));
+    str8_list_push(arena, &queries, str8_lit("frame"));
+    str8_list_push(arena, &queries, str8_lit("a b"));
+    str8_list_push(arena, &queries, str8_lit("Create"));
+    str8_list_push(arena, &queries, str8_lit("base/base_strings"));
+    str8_list_push(arena, &queries, str8_lit("nonexistent_identifier"));
+    str8_list_push(arena, &queries, str8_lit("rd frame"));
+    str8_list_push(arena, &queries, str8_lit("str8 list push"));
+  }
+  if(rdi_path.size == 0)
+  {
+    fprintf(stderr, "usage: strsearchperf <path to .rdi> [--query:<needle>[,<needle>...]] [--iterations:<n>]\n");
+    os_abort(1);
+  }
+
+  //- rjf: load & parse RDI
+  RDI_Parsed rdi = {0};
+  {
+    String8 data = os_data_from_file_path(arena, rdi_path);
+    RDI_ParseStatus status = rdi_parse(data.str, data.size, &rdi);
+    U64 decompressed_size = rdi_decompressed_size_from_parsed(&rdi);
+    if(status == RDI_ParseStatus_Good && decompressed_size > rdi.raw_data_size)
+    {
+      U8 *decompressed_data = push_array_no_zero(arena, U8, decompressed_size);
+      rdi_decompress_parsed(decompressed_data, decompressed_size, &rdi);
+      status = rdi_parse(decompressed_data, decompressed_size, &rdi);
+    }
+    if(status != RDI_ParseStatus_Good)
+    {
+      fprintf(stderr, "error: could not parse %.*s as RDI\n", str8_varg(rdi_path));
+      os_abort(1);
+    }
+  }
+
+  //- rjf: gather string table
+  U64 strings_count = 0;
+  rdi_section_raw_table_from_kind(&rdi, RDI_SectionKind_StringTable, &strings_count);
+  String8 *strings = push_array(arena, String8, strings_count);
+  U64 strings_total_size = 0;
+  for EachIndex(idx, strings_count)
+  {
+    strings[idx].str = rdi_string_from_idx(&rdi, (U32)idx, &strings[idx].size);
+    strings_total_size += strings[idx].size;
+  }
+  ssp_printf("%.*s: %I64u strings, %I64u bytes\n", str8_varg(rdi_path), strings_count, strings_total_size);
+
+  //- rjf: build one long haystack out of the string table, to measure throughput
+  // on large buffers (e.g. source files) as well as on many short names
+  String8 joined = {0};
+  {
+    String8List parts = {0};
+    for EachIndex(idx, strings_count)
+    {
+      str8_list_push(arena, &parts, strings[idx]);
+    }
+    StringJoin join = {0};
+    join.sep = str8_lit("\n");
+    joined = str8_list_join(arena, &parts, &join);
+  }
+  ssp_printf("cpu features:%s%s%s\n",
+         (cpu_feature_flags() & CPUFeatureFlag_SSE2)  ? " sse2" : "",
+         (cpu_feature_flags() & CPUFeatureFlag_SSE42) ? " sse4.2" : "",
+         (cpu_feature_flags() & CPUFeatureFlag_AVX2)  ? " avx2" : "");
+
+  //- rjf: set up kernels
+  StrSearchPerfKernel kernels[] =
+  {
+    {str8_lit_comp("scalar"), str8_find_needle__scalar},
+#if ARCH_X64
+    {str8_lit_comp("sse2"),   str8_find_needle__sse2, CPUFeatureFlag_SSE2},
+    {str8_lit_comp("avx2"),   str8_find_needle__avx2, CPUFeatureFlag_AVX2},
+#endif
+    {str8_lit_comp("dispatch"), str8_find_needle},
+  };
+  StringMatchFlags flags = StringMatchFlag_CaseInsensitive|StringMatchFlag_SlashInsensitive;
+
+  //- rjf: time each kernel against each query
+  for EachNode(n, String8Node, queries.first)
+  {
+    String8 query = n->string;
+    ssp_printf("\nquery \"%.*s\"\n", str8_varg(query));
+    U64 scalar_us = 0;
+    U64 scalar_hit_count = 0;
+    U64 scalar_hit_pos_sum = 0;
+    U64 scalar_joined_us = 0;
+    U64 scalar_joined_hit_count = 0;
+    U64 scalar_joined_hit_pos_sum = 0;
+    for EachElement(kernel_idx, kernels)
+    {
+      StrSearchPerfKernel *kernel = &kernels[kernel_idx];
+      if((cpu_feature_flags() & kernel->required_cpu_flags) != kernel->required_cpu_flags)
+      {
+        ssp_printf("  %-10.*s  (unsupported on this cpu)\n", str8_varg(kernel->name));
+        continue;
+      }
+      //- rjf: many short haystacks
+      U64 hit_count = 0;
+      U64 hit_pos_sum = 0;
+      U64 best_us = max_U64;
+      for EachIndex(iteration_idx, iteration_count)
+      {
+        hit_count = 0;
+        hit_pos_sum = 0;
+        U64 start_us = os_now_microseconds();
+        for EachIndex(idx, strings_count)
+        {
+          U64 pos = kernel->function(strings[idx], 0, query, flags);
+          if(pos < strings[idx].size)
+          {
+            hit_count += 1;
+            hit_pos_sum += pos;
+          }
+        }
+        U64 end_us = os_now_microseconds();
+        best_us = Min(best_us, end_us - start_us);
+      }
+
+      //- rjf: one long haystack, scanning for every occurrence
+      U64 joined_hit_count = 0;
+      U64 joined_hit_pos_sum = 0;
+      U64 joined_best_us = max_U64;
+      for EachIndex(iteration_idx, iteration_count)
+      {
+        joined_hit_count = 0;
+        joined_hit_pos_sum = 0;
+        U64 start_us = os_now_microseconds();
+        for(U64 pos = kernel->function(joined, 0, query, flags);
+            pos < joined.size;
+            pos = kernel->function(joined, pos+1, query, flags))
+        {
+          joined_hit_count += 1;
+          joined_hit_pos_sum += pos;
+        }
+        U64 end_us = os_now_microseconds();
+        joined_best_us = Min(joined_best_us, end_us - start_us);
+      }
+
+      //- rjf: report
+      if(kernel_idx == 0)
+      {
+        scalar_us = best_us;
+        scalar_hit_count = hit_count;
+        scalar_hit_pos_sum = hit_pos_sum;
+        scalar_joined_us = joined_best_us;
+        scalar_joined_hit_count = joined_hit_count;
+        scalar_joined_hit_pos_sum = joined_hit_pos_sum;
+      }
+      F64 gb_per_s = best_us ? ((F64)strings_total_size / (F64)best_us) / 1000.0 : 0.0;
+      F64 speedup = best_us ? (F64)scalar_us / (F64)best_us : 0.0;
+      F64 joined_gb_per_s = joined_best_us ? ((F64)joined.size / (F64)joined_best_us) / 1000.0 : 0.0;
+      F64 joined_speedup = joined_best_us ? (F64)scalar_joined_us / (F64)joined_best_us : 0.0;
+      B32 agrees = (hit_count == scalar_hit_count && hit_pos_sum == scalar_hit_pos_sum &&
+                    joined_hit_count == scalar_joined_hit_count && joined_hit_pos_sum == scalar_joined_hit_pos_sum);
+      ssp_printf("  %-10.*s  short: %8I64u us %6.2f GB/s %5.2fx  long: %8I64u us %6.2f GB/s %5.2fx  %I64u/%I64u hits%s\n",
+                 str8_varg(kernel->name),
+                 best_us, gb_per_s, speedup,
+                 joined_best_us, joined_gb_per_s, joined_speedup,
+                 hit_count, joined_hit_count,
+                 agrees ? "" : "  [MISMATCH vs scalar]");
+    }
+
+    //- rjf: time full fuzzy matching - reference (scalar needle search) vs.
+    // fuzzy_match_find (dispatched needle search)
+    {
+      U64 scalar_fuzzy_us = 0;
+      U64 scalar_fuzzy_match_count = 0;
+      U64 scalar_fuzzy_range_sum = 0;
+      for EachIndex(impl_idx, 2)
+      {
+        U64 match_count = 0;
+        U64 range_sum = 0;
+        U64 best_us = max_U64;
+        for EachIndex(iteration_idx, iteration_count)
+        {
+          Temp scratch = scratch_begin(0, 0);
+          match_count = 0;
+          range_sum = 0;
+          U64 start_us = os_now_microseconds();
+          for EachIndex(idx, strings_count)
+          {
+            Temp temp = temp_begin(scratch.arena);
+            FuzzyMatchRangeList matches = (impl_idx == 0
+                                           ? ssp_fuzzy_match_find__scalar(temp.arena, query, strings[idx])
+                                           : fuzzy_match_find(temp.arena, query, strings[idx]));
+            match_count += (matches.count == matches.needle_part_count);
+            for EachNode(range_n, FuzzyMatchRangeNode, matches.first)
+            {
+              range_sum += range_n->range.min*31 + range_n->range.max;
+            }
+            temp_end(temp);
+          }
+          U64 end_us = os_now_microseconds();
+          best_us = Min(best_us, end_us - start_us);
+          scratch_end(scratch);
+        }
+        if(impl_idx == 0)
+        {
+          scalar_fuzzy_us = best_us;
+          scalar_fuzzy_match_count = match_count;
+          scalar_fuzzy_range_sum = range_sum;
+        }
+        F64 speedup = best_us ? (F64)scalar_fuzzy_us / (F64)best_us : 0.0;
+        B32 agrees = (match_count == scalar_fuzzy_match_count && range_sum == scalar_fuzzy_range_sum);
+        ssp_printf("  %-10s  short: %8I64u us %5.2fx  %I64u matches%s\n",
+                   impl_idx == 0 ? "fuzzy_ref" : "fuzzy",
+                   best_us, speedup, match_count,
+                   agrees ? "" : "  [MISMATCH vs reference]");
+      }
+    }
+  }
+}
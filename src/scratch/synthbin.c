@@ -0,0 +1,1285 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Build Options
+
+#define BUILD_TITLE "synthbin"
+#define BUILD_CONSOLE_INTERFACE 1
+
+////////////////////////////////
+//~ rjf: Includes
+
+//- rjf: [h]
+#include "base/base_inc.h"
+#include "os/os_inc.h"
+#include "coff/coff.h"
+#include "coff/coff_parse.h"
+#include "coff/coff_obj_writer.h"
+#include "codeview/codeview.h"
+#include "elf/elf.h"
+#include "dwarf/dwarf.h"
+
+//- rjf: [c]
+#include "base/base_inc.c"
+#include "os/os_inc.c"
+#include "coff/coff.c"
+#include "coff/coff_parse.c"
+#include "coff/coff_obj_writer.c"
+#include "codeview/codeview.c"
+
+////////////////////////////////
+//~ rjf: Generation Parameters
+//
+// Everything a generated binary contains is a pure function of these counts
+// and of (unit index, element index), so each output section can be produced
+// in its own pass over the units, with only one unit's worth of data in
+// memory at a time. That is what lets the outputs scale to tens of GB.
+//
+// Each unit has:
+//  - `functions` functions, each `lines` rows long, each with
+//    `inline_sites` inline sites of that unit's `inlinees` inline functions
+//  - `types` structs of `members` int members, each (but the first) also
+//    pointing at the previous one
+//  - `templates` instantiations of `SB_Tmpl<T>` & `sb_tmpl_func<T>`, with
+//    `T` drawn from `template_args` args which are shared by all units, so
+//    that the same instantiations show up in many units (as COMDATs in COFF,
+//    and as duplicated types in DWARF)
+//
+
+typedef struct SB_Params SB_Params;
+struct SB_Params
+{
+  U64 units_count;
+  U64 functions_count;
+  U64 types_count;
+  U64 members_count;
+  U64 inline_sites_count;
+  U64 inlinees_count;
+  U64 lines_count;
+  U64 templates_count;
+  U64 template_args_count;
+};
+
+#define SB_ROW_SIZE 4
+#define SB_ELF_TEXT_OFF   0x1000
+#define SB_ELF_TEXT_VADDR 0x401000
+
+////////////////////////////////
+//~ rjf: Output Helpers
+
+internal void
+sb_errorf(char *fmt, ...)
+{
+  Temp scratch = scratch_begin(0, 0);
+  va_list args;
+  va_start(args, fmt);
+  String8 string = str8fv(scratch.arena, fmt, args);
+  va_end(args);
+  fwrite(string.str, 1, string.size, stderr);
+  scratch_end(scratch);
+}
+
+////////////////////////////////
+//~ rjf: Shared Layout Helpers
+
+internal U64
+sb_function_size(SB_Params *p)
+{
+  U64 result = AlignPow2(p->lines_count*SB_ROW_SIZE + 1, 16);
+  return result;
+}
+
+internal U64
+sb_unit_text_size(SB_Params *p)
+{
+  U64 result = (p->functions_count + p->templates_count)*sb_function_size(p);
+  return result;
+}
+
+internal Rng1U64
+sb_inline_site_row_range(SB_Params *p, U64 site_idx)
+{
+  // NOTE(rjf): rows are split into `inline_sites+1` chunks - the first chunk
+  // belongs to the function itself, each following one to one inline site.
+  U64 chunk_size = p->lines_count / (p->inline_sites_count+1);
+  Rng1U64 result = r1u64((site_idx+1)*chunk_size, (site_idx+2)*chunk_size);
+  return result;
+}
+
+internal U64
+sb_inlinee_idx_from_site(SB_Params *p, U64 function_idx, U64 site_idx)
+{
+  U64 result = (function_idx*7 + site_idx) % p->inlinees_count;
+  return result;
+}
+
+internal U64
+sb_template_arg_from_unit(SB_Params *p, U64 unit_idx, U64 template_idx)
+{
+  U64 result = (unit_idx*13 + template_idx) % p->template_args_count;
+  return result;
+}
+
+internal U32 sb_function_line(SB_Params *p, U64 function_idx)     {return (U32)(1 + function_idx*(p->lines_count+2));}
+internal U32 sb_inlinee_line(SB_Params *p, U64 inlinee_idx)       {return (U32)(1 + inlinee_idx*(p->lines_count+2));}
+internal U32 sb_template_arg_line(SB_Params *p, U64 arg_idx)      {return (U32)(1 + arg_idx*(p->lines_count+2));}
+
+internal String8 sb_unit_source_path(Arena *arena, U64 unit_idx)  {return push_str8f(arena, "synthbin/unit%I64u.cpp", unit_idx);}
+internal String8 sb_unit_header_path(Arena *arena, U64 unit_idx)  {return push_str8f(arena, "synthbin/unit%I64u.h", unit_idx);}
+internal String8 sb_shared_header_path(Arena *arena)              {return str8_lit("synthbin/shared.h");}
+internal String8 sb_function_name(Arena *arena, U64 unit_idx, U64 function_idx) {return push_str8f(arena, "sb_unit%I64u_func%I64u", unit_idx, function_idx);}
+internal String8 sb_inlinee_name(Arena *arena, U64 unit_idx, U64 inlinee_idx)   {return push_str8f(arena, "sb_unit%I64u_inline%I64u", unit_idx, inlinee_idx);}
+internal String8 sb_type_name(Arena *arena, U64 unit_idx, U64 type_idx)         {return push_str8f(arena, "SB_Unit%I64u_Type%I64u", unit_idx, type_idx);}
+internal String8 sb_template_arg_name(Arena *arena, U64 arg_idx)                {return push_str8f(arena, "SB_Arg%I64u", arg_idx);}
+internal String8 sb_template_type_name(Arena *arena, U64 arg_idx)               {return push_str8f(arena, "SB_Tmpl<SB_Arg%I64u>", arg_idx);}
+internal String8 sb_template_func_name(Arena *arena, U64 arg_idx)               {return push_str8f(arena, "sb_tmpl_func<SB_Arg%I64u>", arg_idx);}
+
+internal String8
+sb_function_body(Arena *arena, SB_Params *p)
+{
+  U64 size = sb_function_size(p);
+  U8 *body = push_array_no_zero(arena, U8, size);
+  MemorySet(body, 0x90, size);
+  body[p->lines_count*SB_ROW_SIZE] = 0xC3;
+  String8 result = str8(body, size);
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: CodeView Serialization Helpers
+
+typedef struct SB_CVReloc SB_CVReloc;
+struct SB_CVReloc
+{
+  SB_CVReloc *next;
+  U32 off;
+  COFF_ObjSymbol *symbol;
+  COFF_RelocType kind;
+};
+
+typedef struct SB_CVSection SB_CVSection;
+struct SB_CVSection
+{
+  String8List srl;
+  SB_CVReloc *first_reloc;
+  SB_CVReloc *last_reloc;
+  U32 *subsection_size;
+  U64 subsection_start_off;
+};
+
+internal void
+sb_cv_push_reloc(Arena *arena, SB_CVSection *s, U64 off, COFF_ObjSymbol *symbol, COFF_RelocType kind)
+{
+  SB_CVReloc *r = push_array(arena, SB_CVReloc, 1);
+  r->off = (U32)off;
+  r->symbol = symbol;
+  r->kind = kind;
+  SLLQueuePush(s->first_reloc, s->last_reloc, r);
+}
+
+internal void
+sb_cv_push_numeric(Arena *arena, String8List *srl, U64 value)
+{
+  if(value < CV_NumericKind_CHAR)
+  {
+    str8_serial_push_u16(arena, srl, (U16)value);
+  }
+  else
+  {
+    str8_serial_push_u16(arena, srl, CV_NumericKind_ULONG);
+    str8_serial_push_u32(arena, srl, (U32)value);
+  }
+}
+
+internal void
+sb_cv_push_leaf_pad(Arena *arena, String8List *srl)
+{
+  for(U64 pad_size = AlignPadPow2(srl->total_size, 4); pad_size > 0; pad_size -= 1)
+  {
+    str8_serial_push_u8(arena, srl, (U8)(0xF0 | pad_size));
+  }
+}
+
+internal CV_TypeId
+sb_cv_push_leaf(Arena *arena, String8List *srl, CV_TypeId *next_itype, CV_LeafKind kind, String8List data)
+{
+  U64 size = sizeof(CV_LeafKind) + data.total_size;
+  U64 padded_size = AlignPow2(size + sizeof(U16), 4) - sizeof(U16);
+  str8_serial_push_u16(arena, srl, (U16)padded_size);
+  str8_serial_push_u16(arena, srl, kind);
+  str8_serial_push_data_list(arena, srl, data.first);
+  sb_cv_push_leaf_pad(arena, srl);
+  CV_TypeId itype = *next_itype;
+  *next_itype += 1;
+  return itype;
+}
+
+internal U64
+sb_cv_push_symbol(Arena *arena, SB_CVSection *s, CV_SymKind kind, void *fixed, U64 fixed_size, String8 name)
+{
+  U64 record_off = s->srl.total_size;
+  U64 size = sizeof(CV_SymKind) + fixed_size + (name.str ? name.size+1 : 0);
+  U64 padded_size = AlignPow2(size + sizeof(U16), 4) - sizeof(U16);
+  str8_serial_push_u16(arena, &s->srl, (U16)padded_size);
+  str8_serial_push_u16(arena, &s->srl, kind);
+  str8_serial_push_data(arena, &s->srl, fixed, fixed_size);
+  if(name.str != 0)
+  {
+    str8_serial_push_cstr(arena, &s->srl, name);
+  }
+  str8_serial_push_align(arena, &s->srl, 4);
+  return record_off;
+}
+
+internal void
+sb_cv_subsection_begin(Arena *arena, SB_CVSection *s, CV_C13SubSectionKind kind)
+{
+  str8_serial_push_u32(arena, &s->srl, kind);
+  s->subsection_size = str8_serial_push_size(arena, &s->srl, sizeof(U32));
+  s->subsection_start_off = s->srl.total_size;
+}
+
+internal void
+sb_cv_subsection_end(Arena *arena, SB_CVSection *s)
+{
+  *s->subsection_size = (U32)(s->srl.total_size - s->subsection_start_off);
+  str8_serial_push_align(arena, &s->srl, 4);
+}
+
+internal void
+sb_cv_push_annot_u32(Arena *arena, String8List *srl, U32 value)
+{
+  if(value <= 0x7F)
+  {
+    str8_serial_push_u8(arena, srl, (U8)value);
+  }
+  else if(value <= 0x3FFF)
+  {
+    str8_serial_push_u8(arena, srl, (U8)((value >> 8) | 0x80));
+    str8_serial_push_u8(arena, srl, (U8)(value & 0xFF));
+  }
+  else
+  {
+    str8_serial_push_u8(arena, srl, (U8)((value >> 24) | 0xC0));
+    str8_serial_push_u8(arena, srl, (U8)((value >> 16) & 0xFF));
+    str8_serial_push_u8(arena, srl, (U8)((value >> 8) & 0xFF));
+    str8_serial_push_u8(arena, srl, (U8)(value & 0xFF));
+  }
+}
+
+internal U32
+sb_cv_annot_operand_from_s32(S32 value)
+{
+  U32 result = (value >= 0) ? ((U32)value << 1) : (((U32)-value << 1) | 1);
+  return result;
+}
+
+internal void
+sb_cv_push_proc(Arena *arena, SB_CVSection *s, SB_Params *p, CV_TypeId itype, COFF_ObjSymbol *symbol, String8 name,
+                U64 unit_idx, U64 function_idx, CV_TypeId *inlinee_itypes)
+{
+  CV_SymProc32 proc = {0};
+  proc.len       = (U32)sb_function_size(p);
+  proc.dbg_end   = (U32)(p->lines_count*SB_ROW_SIZE);
+  proc.itype     = itype;
+  U64 proc_off = sb_cv_push_symbol(arena, s, CV_SymKind_GPROC32, &proc, sizeof(proc), name);
+  sb_cv_push_reloc(arena, s, proc_off + 4 + OffsetOf(CV_SymProc32, off), symbol, COFF_Reloc_X64_SecRel);
+  sb_cv_push_reloc(arena, s, proc_off + 4 + OffsetOf(CV_SymProc32, sec), symbol, COFF_Reloc_X64_Section);
+  if(inlinee_itypes != 0)
+  {
+    for EachIndex(site_idx, p->inline_sites_count)
+    {
+      Temp scratch = scratch_begin(&arena, 1);
+      Rng1U64 rows = sb_inline_site_row_range(p, site_idx);
+      String8List annots = {0};
+      str8_serial_begin(scratch.arena, &annots);
+      sb_cv_push_annot_u32(scratch.arena, &annots, CV_InlineBinaryAnnotation_ChangeLineOffset);
+      sb_cv_push_annot_u32(scratch.arena, &annots, sb_cv_annot_operand_from_s32(1));
+      sb_cv_push_annot_u32(scratch.arena, &annots, CV_InlineBinaryAnnotation_ChangeCodeOffset);
+      sb_cv_push_annot_u32(scratch.arena, &annots, (U32)(rows.min*SB_ROW_SIZE));
+      for(U64 row_idx = rows.min+1; row_idx < rows.max; row_idx += 1)
+      {
+        sb_cv_push_annot_u32(scratch.arena, &annots, CV_InlineBinaryAnnotation_ChangeCodeOffsetAndLineOffset);
+        sb_cv_push_annot_u32(scratch.arena, &annots, (sb_cv_annot_operand_from_s32(1) << 4) | SB_ROW_SIZE);
+      }
+      sb_cv_push_annot_u32(scratch.arena, &annots, CV_InlineBinaryAnnotation_ChangeCodeLength);
+      sb_cv_push_annot_u32(scratch.arena, &annots, SB_ROW_SIZE);
+      str8_serial_push_align(scratch.arena, &annots, 4);
+      String8 annots_data = str8_serial_end(scratch.arena, &annots);
+      U64 site_fixed_size = sizeof(CV_SymInlineSite) + annots_data.size;
+      U8 *site_fixed = push_array(scratch.arena, U8, site_fixed_size);
+      ((CV_SymInlineSite *)site_fixed)->inlinee = inlinee_itypes[sb_inlinee_idx_from_site(p, function_idx, site_idx)];
+      MemoryCopy(site_fixed + sizeof(CV_SymInlineSite), annots_data.str, annots_data.size);
+      sb_cv_push_symbol(arena, s, CV_SymKind_INLINESITE, site_fixed, site_fixed_size, str8_zero());
+      sb_cv_push_symbol(arena, s, CV_SymKind_INLINESITE_END, 0, 0, str8_zero());
+      scratch_end(scratch);
+    }
+  }
+  sb_cv_push_symbol(arena, s, CV_SymKind_END, 0, 0, str8_zero());
+}
+
+internal void
+sb_cv_push_lines(Arena *arena, SB_CVSection *s, SB_Params *p, COFF_ObjSymbol *symbol, U32 file_off, U32 first_line)
+{
+  sb_cv_subsection_begin(arena, s, CV_C13SubSectionKind_Lines);
+  CV_C13SubSecLinesHeader header = {0};
+  header.len = (U32)sb_function_size(p);
+  U64 header_off = s->srl.total_size;
+  str8_serial_push_struct(arena, &s->srl, &header);
+  sb_cv_push_reloc(arena, s, header_off + OffsetOf(CV_C13SubSecLinesHeader, sec_off), symbol, COFF_Reloc_X64_SecRel);
+  sb_cv_push_reloc(arena, s, header_off + OffsetOf(CV_C13SubSecLinesHeader, sec), symbol, COFF_Reloc_X64_Section);
+  CV_C13File file = {0};
+  file.file_off   = file_off;
+  file.num_lines  = (U32)p->lines_count;
+  file.block_size = (U32)(sizeof(CV_C13File) + sizeof(CV_C13Line)*p->lines_count);
+  str8_serial_push_struct(arena, &s->srl, &file);
+  for EachIndex(row_idx, p->lines_count)
+  {
+    CV_C13Line line = {0};
+    line.off   = (U32)(row_idx*SB_ROW_SIZE);
+    line.flags = (first_line + 1 + (U32)row_idx) | (1u << 31);
+    str8_serial_push_struct(arena, &s->srl, &line);
+  }
+  sb_cv_subsection_end(arena, s);
+}
+
+////////////////////////////////
+//~ rjf: COFF Object Generation
+
+internal String8
+sb_coff_obj_from_unit(Arena *arena, SB_Params *p, U64 unit_idx)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  COFF_ObjWriter *obj_writer = coff_obj_writer_alloc(0, COFF_MachineType_X64);
+  COFF_SectionFlags debug_flags = COFF_SectionFlag_CntInitializedData|COFF_SectionFlag_MemDiscardable|COFF_SectionFlag_MemRead|COFF_SectionFlag_Align1Bytes;
+  COFF_SectionFlags text_flags = COFF_SectionFlag_CntCode|COFF_SectionFlag_MemExecute|COFF_SectionFlag_MemRead|COFF_SectionFlag_Align16Bytes;
+  String8 body = sb_function_body(scratch.arena, p);
+
+  //- rjf: build types & ids
+  CV_TypeId *type_itypes = push_array(scratch.arena, CV_TypeId, p->types_count);
+  CV_TypeId *inlinee_itypes = push_array(scratch.arena, CV_TypeId, p->inlinees_count);
+  CV_TypeId proc_itype = 0;
+  String8 debug_t = {0};
+  {
+    String8List srl = {0};
+    str8_serial_begin(scratch.arena, &srl);
+    str8_serial_push_u32(scratch.arena, &srl, CV_Signature_C13);
+    CV_TypeId next_itype = CV_MinComplexTypeIndex;
+
+    // rjf: function type
+    {
+      String8List data = {0};
+      str8_serial_begin(scratch.arena, &data);
+      str8_serial_push_u32(scratch.arena, &data, 0);
+      CV_TypeId arglist_itype = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_ARGLIST, data);
+      CV_LeafProcedure proc = {0};
+      proc.ret_itype = CV_BasicType_INT32;
+      proc.call_kind = CV_CallKind_NearC;
+      proc.arg_itype = arglist_itype;
+      str8_serial_begin(scratch.arena, &data);
+      str8_serial_push_struct(scratch.arena, &data, &proc);
+      proc_itype = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_PROCEDURE, data);
+    }
+
+    // rjf: unit structs
+    for EachIndex(type_idx, p->types_count)
+    {
+      CV_TypeId ptr_itype = 0;
+      if(type_idx > 0)
+      {
+        CV_LeafPointer ptr = {0};
+        ptr.itype   = type_itypes[type_idx-1];
+        ptr.attribs = CV_PointerKind_64 | (8 << 13);
+        String8List data = {0};
+        str8_serial_begin(scratch.arena, &data);
+        str8_serial_push_struct(scratch.arena, &data, &ptr);
+        ptr_itype = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_POINTER, data);
+      }
+      String8List fields = {0};
+      str8_serial_begin(scratch.arena, &fields);
+      U64 fields_count = 0;
+      for EachIndex(member_idx, p->members_count + !!ptr_itype)
+      {
+        CV_LeafMember member = {0};
+        member.attribs = CV_MemberAccess_Public;
+        member.itype   = member_idx < p->members_count ? CV_BasicType_INT32 : ptr_itype;
+        str8_serial_push_u16(scratch.arena, &fields, CV_LeafKind_MEMBER);
+        str8_serial_push_struct(scratch.arena, &fields, &member);
+        sb_cv_push_numeric(scratch.arena, &fields, member_idx < p->members_count ? member_idx*4 : AlignPow2(p->members_count*4, 8));
+        str8_serial_push_cstr(scratch.arena, &fields, member_idx < p->members_count ? push_str8f(scratch.arena, "m%I64u", member_idx) : str8_lit("next"));
+        sb_cv_push_leaf_pad(scratch.arena, &fields);
+        fields_count += 1;
+      }
+      CV_TypeId field_itype = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_FIELDLIST, fields);
+      CV_LeafStruct udt = {0};
+      udt.count       = (U16)fields_count;
+      udt.field_itype = field_itype;
+      String8List data = {0};
+      str8_serial_begin(scratch.arena, &data);
+      str8_serial_push_struct(scratch.arena, &data, &udt);
+      sb_cv_push_numeric(scratch.arena, &data, AlignPow2(p->members_count*4, 8) + (ptr_itype ? 8 : 0));
+      str8_serial_push_cstr(scratch.arena, &data, sb_type_name(scratch.arena, unit_idx, type_idx));
+      type_itypes[type_idx] = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_STRUCTURE, data);
+    }
+
+    // rjf: template instantiations; identical in every unit which uses the same arg
+    for EachIndex(template_idx, p->templates_count)
+    {
+      U64 arg_idx = sb_template_arg_from_unit(p, unit_idx, template_idx);
+      CV_TypeId arg_itype = 0;
+      for EachIndex(udt_idx, 2)
+      {
+        String8List fields = {0};
+        str8_serial_begin(scratch.arena, &fields);
+        CV_LeafMember member = {0};
+        member.attribs = CV_MemberAccess_Public;
+        member.itype   = udt_idx == 0 ? CV_BasicType_INT32 : arg_itype;
+        str8_serial_push_u16(scratch.arena, &fields, CV_LeafKind_MEMBER);
+        str8_serial_push_struct(scratch.arena, &fields, &member);
+        sb_cv_push_numeric(scratch.arena, &fields, 0);
+        str8_serial_push_cstr(scratch.arena, &fields, udt_idx == 0 ? str8_lit("value") : str8_lit("arg"));
+        sb_cv_push_leaf_pad(scratch.arena, &fields);
+        CV_TypeId field_itype = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_FIELDLIST, fields);
+        CV_LeafStruct udt = {0};
+        udt.count       = 1;
+        udt.field_itype = field_itype;
+        String8List data = {0};
+        str8_serial_begin(scratch.arena, &data);
+        str8_serial_push_struct(scratch.arena, &data, &udt);
+        sb_cv_push_numeric(scratch.arena, &data, 4);
+        str8_serial_push_cstr(scratch.arena, &data, udt_idx == 0 ? sb_template_arg_name(scratch.arena, arg_idx) : sb_template_type_name(scratch.arena, arg_idx));
+        arg_itype = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_STRUCTURE, data);
+      }
+    }
+
+    // rjf: inlinee ids
+    for EachIndex(inlinee_idx, p->inlinees_count)
+    {
+      CV_LeafFuncId func_id = {0};
+      func_id.itype = proc_itype;
+      String8List data = {0};
+      str8_serial_begin(scratch.arena, &data);
+      str8_serial_push_struct(scratch.arena, &data, &func_id);
+      str8_serial_push_cstr(scratch.arena, &data, sb_inlinee_name(scratch.arena, unit_idx, inlinee_idx));
+      inlinee_itypes[inlinee_idx] = sb_cv_push_leaf(scratch.arena, &srl, &next_itype, CV_LeafKind_FUNC_ID, data);
+    }
+    debug_t = str8_serial_end(scratch.arena, &srl);
+  }
+
+  //- rjf: build string table & file checksums; files are [source, header, shared header]
+  U32 file_offs[3] = {0};
+  String8 string_table = {0};
+  String8 file_chksms = {0};
+  {
+    String8 file_paths[3] =
+    {
+      sb_unit_source_path(scratch.arena, unit_idx),
+      sb_unit_header_path(scratch.arena, unit_idx),
+      sb_shared_header_path(scratch.arena),
+    };
+    String8List strings = {0};
+    String8List chksms = {0};
+    str8_serial_begin(scratch.arena, &strings);
+    str8_serial_begin(scratch.arena, &chksms);
+    str8_serial_push_u8(scratch.arena, &strings, 0);
+    for EachElement(file_idx, file_paths)
+    {
+      CV_C13Checksum chksm = {0};
+      chksm.name_off = (U32)strings.total_size;
+      file_offs[file_idx] = (U32)chksms.total_size;
+      str8_serial_push_cstr(scratch.arena, &strings, file_paths[file_idx]);
+      str8_serial_push_struct(scratch.arena, &chksms, &chksm);
+      str8_serial_push_align(scratch.arena, &chksms, 4);
+    }
+    string_table = str8_serial_end(scratch.arena, &strings);
+    file_chksms = str8_serial_end(scratch.arena, &chksms);
+  }
+
+  //- rjf: .text & function symbols
+  COFF_ObjSection *text = coff_obj_writer_push_section(obj_writer, str8_lit(".text$mn"), text_flags, str8_zero());
+  COFF_ObjSymbol **function_symbols = push_array(scratch.arena, COFF_ObjSymbol *, p->functions_count);
+  for EachIndex(function_idx, p->functions_count)
+  {
+    str8_list_push(obj_writer->arena, &text->data, body);
+    function_symbols[function_idx] = coff_obj_writer_push_symbol_extern_func(obj_writer, sb_function_name(obj_writer->arena, unit_idx, function_idx), (U32)(function_idx*body.size), text);
+  }
+  if(unit_idx == 0 && p->functions_count != 0)
+  {
+    coff_obj_writer_push_symbol_extern_func(obj_writer, str8_lit("main"), 0, text);
+  }
+
+  //- rjf: .debug$S
+  {
+    SB_CVSection s = {0};
+    str8_serial_begin(obj_writer->arena, &s.srl);
+    str8_serial_push_u32(obj_writer->arena, &s.srl, CV_Signature_C13);
+
+    // rjf: symbols
+    sb_cv_subsection_begin(obj_writer->arena, &s, CV_C13SubSectionKind_Symbols);
+    {
+      CV_SymObjName obj_name = {0};
+      sb_cv_push_symbol(obj_writer->arena, &s, CV_SymKind_OBJNAME, &obj_name, sizeof(obj_name), push_str8f(scratch.arena, "unit%I64u.obj", unit_idx));
+      CV_SymCompile3 comp = {0};
+      comp.flags   = CV_Language_CXX;
+      comp.machine = CV_Arch_X64;
+      sb_cv_push_symbol(obj_writer->arena, &s, CV_SymKind_COMPILE3, &comp, sizeof(comp), str8_lit(BUILD_TITLE));
+      for EachIndex(function_idx, p->functions_count)
+      {
+        sb_cv_push_proc(obj_writer->arena, &s, p, proc_itype, function_symbols[function_idx], sb_function_name(scratch.arena, unit_idx, function_idx),
+                        unit_idx, function_idx, p->inlinees_count ? inlinee_itypes : 0);
+      }
+    }
+    sb_cv_subsection_end(obj_writer->arena, &s);
+
+    // rjf: lines
+    for EachIndex(function_idx, p->functions_count)
+    {
+      sb_cv_push_lines(obj_writer->arena, &s, p, function_symbols[function_idx], file_offs[0], sb_function_line(p, function_idx));
+    }
+
+    // rjf: inlinee lines
+    if(p->inlinees_count != 0)
+    {
+      sb_cv_subsection_begin(obj_writer->arena, &s, CV_C13SubSectionKind_InlineeLines);
+      str8_serial_push_u32(obj_writer->arena, &s.srl, CV_C13InlineeLinesSig_NORMAL);
+      for EachIndex(inlinee_idx, p->inlinees_count)
+      {
+        CV_C13InlineeSourceLineHeader inlinee = {0};
+        inlinee.inlinee         = inlinee_itypes[inlinee_idx];
+        inlinee.file_off        = file_offs[1];
+        inlinee.first_source_ln = sb_inlinee_line(p, inlinee_idx);
+        str8_serial_push_struct(obj_writer->arena, &s.srl, &inlinee);
+      }
+      sb_cv_subsection_end(obj_writer->arena, &s);
+    }
+
+    // rjf: files & strings
+    sb_cv_subsection_begin(obj_writer->arena, &s, CV_C13SubSectionKind_FileChksms);
+    str8_serial_push_string(obj_writer->arena, &s.srl, file_chksms);
+    sb_cv_subsection_end(obj_writer->arena, &s);
+    sb_cv_subsection_begin(obj_writer->arena, &s, CV_C13SubSectionKind_StringTable);
+    str8_serial_push_string(obj_writer->arena, &s.srl, string_table);
+    sb_cv_subsection_end(obj_writer->arena, &s);
+
+    COFF_ObjSection *debug_s = coff_obj_writer_push_section(obj_writer, str8_lit(".debug$S"), debug_flags, str8_serial_end(obj_writer->arena, &s.srl));
+    for EachNode(r, SB_CVReloc, s.first_reloc)
+    {
+      coff_obj_writer_section_push_reloc(obj_writer, debug_s, r->off, r->symbol, r->kind);
+    }
+  }
+
+  //- rjf: template functions, as COMDATs w/ associative .debug$S
+  for EachIndex(template_idx, p->templates_count)
+  {
+    U64 arg_idx = sb_template_arg_from_unit(p, unit_idx, template_idx);
+    String8 name = sb_template_func_name(obj_writer->arena, arg_idx);
+    COFF_ObjSection *tmpl_text = coff_obj_writer_push_section(obj_writer, str8_lit(".text$mn"), text_flags|COFF_SectionFlag_LnkCOMDAT, body);
+    coff_obj_writer_push_symbol_secdef(obj_writer, tmpl_text, COFF_ComdatSelect_Any);
+    COFF_ObjSymbol *symbol = coff_obj_writer_push_symbol_extern_func(obj_writer, name, 0, tmpl_text);
+    SB_CVSection s = {0};
+    str8_serial_begin(obj_writer->arena, &s.srl);
+    str8_serial_push_u32(obj_writer->arena, &s.srl, CV_Signature_C13);
+    sb_cv_subsection_begin(obj_writer->arena, &s, CV_C13SubSectionKind_Symbols);
+    sb_cv_push_proc(obj_writer->arena, &s, p, proc_itype, symbol, name, unit_idx, 0, 0);
+    sb_cv_subsection_end(obj_writer->arena, &s);
+    sb_cv_push_lines(obj_writer->arena, &s, p, symbol, file_offs[2], sb_template_arg_line(p, arg_idx));
+    COFF_ObjSection *tmpl_debug_s = coff_obj_writer_push_section(obj_writer, str8_lit(".debug$S"), debug_flags|COFF_SectionFlag_LnkCOMDAT, str8_serial_end(obj_writer->arena, &s.srl));
+    coff_obj_writer_push_symbol_associative(obj_writer, tmpl_debug_s, tmpl_text);
+    for EachNode(r, SB_CVReloc, s.first_reloc)
+    {
+      coff_obj_writer_section_push_reloc(obj_writer, tmpl_debug_s, r->off, r->symbol, r->kind);
+    }
+  }
+
+  //- rjf: .debug$T
+  coff_obj_writer_push_section(obj_writer, str8_lit(".debug$T"), debug_flags, debug_t);
+
+  //- rjf: serialize
+  String8 result = coff_obj_writer_serialize(arena, obj_writer);
+  coff_obj_writer_release(&obj_writer);
+  scratch_end(scratch);
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: DWARF Serialization Helpers
+
+internal void
+sb_dw_push_uleb128(Arena *arena, String8List *srl, U64 value)
+{
+  do
+  {
+    U8 byte = value & 0x7F;
+    value >>= 7;
+    str8_serial_push_u8(arena, srl, byte | (value != 0 ? 0x80 : 0));
+  } while(value != 0);
+}
+
+internal void
+sb_dw_push_sleb128(Arena *arena, String8List *srl, S64 value)
+{
+  for(B32 more = 1; more;)
+  {
+    U8 byte = value & 0x7F;
+    value >>= 7;
+    more = !((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40)));
+    str8_serial_push_u8(arena, srl, byte | (more ? 0x80 : 0));
+  }
+}
+
+typedef enum SB_DWAbbrev
+{
+  SB_DWAbbrev_Null,
+  SB_DWAbbrev_CompileUnit,
+  SB_DWAbbrev_BaseType,
+  SB_DWAbbrev_StructureType,
+  SB_DWAbbrev_Member,
+  SB_DWAbbrev_PointerType,
+  SB_DWAbbrev_AbstractSubProgram,
+  SB_DWAbbrev_SubProgram,
+  SB_DWAbbrev_InlinedSubroutine,
+  SB_DWAbbrev_TemplateTypeParameter,
+  SB_DWAbbrev_COUNT
+}
+SB_DWAbbrev;
+
+internal String8
+sb_dw_abbrev_table(Arena *arena)
+{
+  struct
+  {
+    DW_TagKind tag;
+    B32 has_children;
+    U64 attribs[8][2];
+  }
+  abbrevs[] =
+  {
+    {0},
+    {DW_TagKind_CompileUnit, 1, {{DW_AttribKind_Producer, DW_Form_String}, {DW_AttribKind_Language, DW_Form_Data2}, {DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_CompDir, DW_Form_String}, {DW_AttribKind_LowPc, DW_Form_Addr}, {DW_AttribKind_HighPc, DW_Form_Data8}, {DW_AttribKind_StmtList, DW_Form_SecOffset}}},
+    {DW_TagKind_BaseType, 0, {{DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_Encoding, DW_Form_Data1}, {DW_AttribKind_ByteSize, DW_Form_Data1}}},
+    {DW_TagKind_StructureType, 1, {{DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_ByteSize, DW_Form_Data4}}},
+    {DW_TagKind_Member, 0, {{DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_Type, DW_Form_Ref4}, {DW_AttribKind_DataMemberLocation, DW_Form_Data4}}},
+    {DW_TagKind_PointerType, 0, {{DW_AttribKind_Type, DW_Form_Ref4}, {DW_AttribKind_ByteSize, DW_Form_Data1}}},
+    {DW_TagKind_SubProgram, 0, {{DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_Type, DW_Form_Ref4}, {DW_AttribKind_Inline, DW_Form_Data1}, {DW_AttribKind_DeclFile, DW_Form_Data1}, {DW_AttribKind_DeclLine, DW_Form_Data4}}},
+    {DW_TagKind_SubProgram, 1, {{DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_LowPc, DW_Form_Addr}, {DW_AttribKind_HighPc, DW_Form_Data8}, {DW_AttribKind_Type, DW_Form_Ref4}, {DW_AttribKind_External, DW_Form_FlagPresent}, {DW_AttribKind_DeclFile, DW_Form_Data1}, {DW_AttribKind_DeclLine, DW_Form_Data4}}},
+    {DW_TagKind_InlinedSubroutine, 0, {{DW_AttribKind_AbstractOrigin, DW_Form_Ref4}, {DW_AttribKind_LowPc, DW_Form_Addr}, {DW_AttribKind_HighPc, DW_Form_Data8}, {DW_AttribKind_CallFile, DW_Form_Data1}, {DW_AttribKind_CallLine, DW_Form_Data4}}},
+    {DW_TagKind_TemplateTypeParameter, 0, {{DW_AttribKind_Name, DW_Form_String}, {DW_AttribKind_Type, DW_Form_Ref4}}},
+  };
+  String8List srl = {0};
+  str8_serial_begin(arena, &srl);
+  for(U64 abbrev_idx = 1; abbrev_idx < ArrayCount(abbrevs); abbrev_idx += 1)
+  {
+    sb_dw_push_uleb128(arena, &srl, abbrev_idx);
+    sb_dw_push_uleb128(arena, &srl, abbrevs[abbrev_idx].tag);
+    str8_serial_push_u8(arena, &srl, (U8)abbrevs[abbrev_idx].has_children);
+    for EachElement(attrib_idx, abbrevs[abbrev_idx].attribs)
+    {
+      if(abbrevs[abbrev_idx].attribs[attrib_idx][0] == 0) { break; }
+      sb_dw_push_uleb128(arena, &srl, abbrevs[abbrev_idx].attribs[attrib_idx][0]);
+      sb_dw_push_uleb128(arena, &srl, abbrevs[abbrev_idx].attribs[attrib_idx][1]);
+    }
+    sb_dw_push_uleb128(arena, &srl, 0);
+    sb_dw_push_uleb128(arena, &srl, 0);
+  }
+  sb_dw_push_uleb128(arena, &srl, 0);
+  String8 result = str8_serial_end(arena, &srl);
+  return result;
+}
+
+internal void
+sb_dw_push_line_sequence(Arena *arena, String8List *srl, SB_Params *p, U64 addr, U32 first_line, U32 file, U32 *inlinee_lines)
+{
+  str8_serial_push_u8(arena, srl, DW_StdOpcode_ExtendedOpcode);
+  sb_dw_push_uleb128(arena, srl, 1 + sizeof(U64));
+  str8_serial_push_u8(arena, srl, DW_ExtOpcode_SetAddress);
+  str8_serial_push_u64(arena, srl, addr);
+  U32 current_file = 1;
+  S64 current_line = 1;
+  U64 current_off = 0;
+  for EachIndex(row_idx, p->lines_count)
+  {
+    U32 row_file = file;
+    S64 row_line = first_line + 1 + row_idx;
+    if(inlinee_lines != 0)
+    {
+      for EachIndex(site_idx, p->inline_sites_count)
+      {
+        Rng1U64 rows = sb_inline_site_row_range(p, site_idx);
+        if(contains_1u64(rows, row_idx))
+        {
+          row_file = 2;
+          row_line = inlinee_lines[site_idx] + 1 + (row_idx - rows.min);
+        }
+      }
+    }
+    if(row_file != current_file)
+    {
+      str8_serial_push_u8(arena, srl, DW_StdOpcode_SetFile);
+      sb_dw_push_uleb128(arena, srl, row_file);
+      current_file = row_file;
+    }
+    if(row_line != current_line)
+    {
+      str8_serial_push_u8(arena, srl, DW_StdOpcode_AdvanceLine);
+      sb_dw_push_sleb128(arena, srl, row_line - current_line);
+      current_line = row_line;
+    }
+    if(row_idx*SB_ROW_SIZE != current_off)
+    {
+      str8_serial_push_u8(arena, srl, DW_StdOpcode_AdvancePc);
+      sb_dw_push_uleb128(arena, srl, row_idx*SB_ROW_SIZE - current_off);
+      current_off = row_idx*SB_ROW_SIZE;
+    }
+    str8_serial_push_u8(arena, srl, DW_StdOpcode_Copy);
+  }
+  str8_serial_push_u8(arena, srl, DW_StdOpcode_AdvancePc);
+  sb_dw_push_uleb128(arena, srl, sb_function_size(p) - current_off);
+  str8_serial_push_u8(arena, srl, DW_StdOpcode_ExtendedOpcode);
+  sb_dw_push_uleb128(arena, srl, 1);
+  str8_serial_push_u8(arena, srl, DW_ExtOpcode_EndSequence);
+}
+
+////////////////////////////////
+//~ rjf: ELF/DWARF Per-Unit Generation
+
+internal U64
+sb_elf_function_addr(SB_Params *p, U64 unit_idx, U64 function_idx)
+{
+  U64 result = SB_ELF_TEXT_VADDR + unit_idx*sb_unit_text_size(p) + function_idx*sb_function_size(p);
+  return result;
+}
+
+internal String8
+sb_dw_line_unit_from_unit(Arena *arena, SB_Params *p, U64 unit_idx)
+{
+  String8List srl = {0};
+  str8_serial_begin(arena, &srl);
+  U32 *unit_length = str8_serial_push_size(arena, &srl, sizeof(U32));
+  str8_serial_push_u16(arena, &srl, DW_Version_4);
+  U32 *header_length = str8_serial_push_size(arena, &srl, sizeof(U32));
+  U64 header_start = srl.total_size;
+  U8 std_opcode_lengths[] = {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1};
+  str8_serial_push_u8(arena, &srl, 1);      // min_inst_length
+  str8_serial_push_u8(arena, &srl, 1);      // max_ops_per_inst
+  str8_serial_push_u8(arena, &srl, 1);      // default_is_stmt
+  str8_serial_push_u8(arena, &srl, (U8)-5); // line_base
+  str8_serial_push_u8(arena, &srl, 14);     // line_range
+  str8_serial_push_u8(arena, &srl, ArrayCount(std_opcode_lengths)+1);
+  str8_serial_push_array(arena, &srl, std_opcode_lengths, ArrayCount(std_opcode_lengths));
+  str8_serial_push_u8(arena, &srl, 0);
+  String8 file_paths[] = {sb_unit_source_path(arena, unit_idx), sb_unit_header_path(arena, unit_idx), sb_shared_header_path(arena)};
+  for EachElement(file_idx, file_paths)
+  {
+    str8_serial_push_cstr(arena, &srl, file_paths[file_idx]);
+    sb_dw_push_uleb128(arena, &srl, 0);
+    sb_dw_push_uleb128(arena, &srl, 0);
+    sb_dw_push_uleb128(arena, &srl, 0);
+  }
+  str8_serial_push_u8(arena, &srl, 0);
+  *header_length = (U32)(srl.total_size - header_start);
+  U32 *inlinee_lines = push_array(arena, U32, p->inline_sites_count);
+  for EachIndex(function_idx, p->functions_count)
+  {
+    for EachIndex(site_idx, p->inline_sites_count)
+    {
+      inlinee_lines[site_idx] = sb_inlinee_line(p, sb_inlinee_idx_from_site(p, function_idx, site_idx));
+    }
+    sb_dw_push_line_sequence(arena, &srl, p, sb_elf_function_addr(p, unit_idx, function_idx), sb_function_line(p, function_idx), 1, p->inlinees_count ? inlinee_lines : 0);
+  }
+  for EachIndex(template_idx, p->templates_count)
+  {
+    U64 arg_idx = sb_template_arg_from_unit(p, unit_idx, template_idx);
+    sb_dw_push_line_sequence(arena, &srl, p, sb_elf_function_addr(p, unit_idx, p->functions_count + template_idx), sb_template_arg_line(p, arg_idx), 3, 0);
+  }
+  *unit_length = (U32)(srl.total_size - sizeof(U32));
+  String8 result = str8_serial_end(arena, &srl);
+  return result;
+}
+
+internal String8
+sb_dw_info_unit_from_unit(Arena *arena, SB_Params *p, U64 unit_idx, U64 stmt_list_off)
+{
+  // NOTE(rjf): units whose line table lands past 4GB need the 64-bit format
+  // for DW_AT_stmt_list; DWARF allows mixing both formats within a section.
+  Temp scratch = scratch_begin(&arena, 1);
+  DW_Format format = DW_FormatFromSize(stmt_list_off);
+  U64 header_size = (format == DW_Format_64Bit) ? (4+8+2+8+1) : (4+2+4+1);
+  String8List srl = {0};
+  str8_serial_begin(arena, &srl);
+#define SB_DIE_OFF ((U32)(header_size + srl.total_size))
+#define sb_push_sec_offset(x) (format == DW_Format_64Bit ? str8_serial_push_u64(arena, &srl, (x)) : str8_serial_push_u32(arena, &srl, (U32)(x)))
+
+  //- rjf: unit
+  sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_CompileUnit);
+  str8_serial_push_cstr(arena, &srl, str8_lit(BUILD_TITLE));
+  str8_serial_push_u16(arena, &srl, DW_Language_CPlusPlus);
+  str8_serial_push_cstr(arena, &srl, sb_unit_source_path(scratch.arena, unit_idx));
+  str8_serial_push_cstr(arena, &srl, str8_lit("/"));
+  str8_serial_push_u64(arena, &srl, sb_elf_function_addr(p, unit_idx, 0));
+  str8_serial_push_u64(arena, &srl, sb_unit_text_size(p));
+  sb_push_sec_offset(stmt_list_off);
+
+  //- rjf: types
+  U32 int_off = SB_DIE_OFF;
+  sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_BaseType);
+  str8_serial_push_cstr(arena, &srl, str8_lit("int"));
+  str8_serial_push_u8(arena, &srl, DW_ATE_Signed);
+  str8_serial_push_u8(arena, &srl, 4);
+  U32 prev_type_off = 0;
+  for EachIndex(type_idx, p->types_count)
+  {
+    U32 ptr_off = 0;
+    if(type_idx > 0)
+    {
+      ptr_off = SB_DIE_OFF;
+      sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_PointerType);
+      str8_serial_push_u32(arena, &srl, prev_type_off);
+      str8_serial_push_u8(arena, &srl, 8);
+    }
+    prev_type_off = SB_DIE_OFF;
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_StructureType);
+    str8_serial_push_cstr(arena, &srl, sb_type_name(scratch.arena, unit_idx, type_idx));
+    str8_serial_push_u32(arena, &srl, (U32)(AlignPow2(p->members_count*4, 8) + (ptr_off ? 8 : 0)));
+    for EachIndex(member_idx, p->members_count)
+    {
+      sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_Member);
+      str8_serial_push_cstr(arena, &srl, push_str8f(scratch.arena, "m%I64u", member_idx));
+      str8_serial_push_u32(arena, &srl, int_off);
+      str8_serial_push_u32(arena, &srl, (U32)(member_idx*4));
+    }
+    if(ptr_off != 0)
+    {
+      sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_Member);
+      str8_serial_push_cstr(arena, &srl, str8_lit("next"));
+      str8_serial_push_u32(arena, &srl, ptr_off);
+      str8_serial_push_u32(arena, &srl, (U32)AlignPow2(p->members_count*4, 8));
+    }
+    sb_dw_push_uleb128(arena, &srl, 0);
+  }
+  U32 *arg_offs = push_array(scratch.arena, U32, p->templates_count);
+  for EachIndex(template_idx, p->templates_count)
+  {
+    U64 arg_idx = sb_template_arg_from_unit(p, unit_idx, template_idx);
+    arg_offs[template_idx] = SB_DIE_OFF;
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_StructureType);
+    str8_serial_push_cstr(arena, &srl, sb_template_arg_name(scratch.arena, arg_idx));
+    str8_serial_push_u32(arena, &srl, 4);
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_Member);
+    str8_serial_push_cstr(arena, &srl, str8_lit("value"));
+    str8_serial_push_u32(arena, &srl, int_off);
+    str8_serial_push_u32(arena, &srl, 0);
+    sb_dw_push_uleb128(arena, &srl, 0);
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_StructureType);
+    str8_serial_push_cstr(arena, &srl, sb_template_type_name(scratch.arena, arg_idx));
+    str8_serial_push_u32(arena, &srl, 4);
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_TemplateTypeParameter);
+    str8_serial_push_cstr(arena, &srl, str8_lit("T"));
+    str8_serial_push_u32(arena, &srl, arg_offs[template_idx]);
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_Member);
+    str8_serial_push_cstr(arena, &srl, str8_lit("arg"));
+    str8_serial_push_u32(arena, &srl, arg_offs[template_idx]);
+    str8_serial_push_u32(arena, &srl, 0);
+    sb_dw_push_uleb128(arena, &srl, 0);
+  }
+
+  //- rjf: abstract inline functions
+  U32 *inlinee_offs = push_array(scratch.arena, U32, p->inlinees_count);
+  for EachIndex(inlinee_idx, p->inlinees_count)
+  {
+    inlinee_offs[inlinee_idx] = SB_DIE_OFF;
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_AbstractSubProgram);
+    str8_serial_push_cstr(arena, &srl, sb_inlinee_name(scratch.arena, unit_idx, inlinee_idx));
+    str8_serial_push_u32(arena, &srl, int_off);
+    str8_serial_push_u8(arena, &srl, DW_Inl_DeclaredInlined);
+    str8_serial_push_u8(arena, &srl, 2);
+    str8_serial_push_u32(arena, &srl, sb_inlinee_line(p, inlinee_idx));
+  }
+
+  //- rjf: functions
+  for EachIndex(function_idx, p->functions_count)
+  {
+    U64 addr = sb_elf_function_addr(p, unit_idx, function_idx);
+    U32 line = sb_function_line(p, function_idx);
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_SubProgram);
+    str8_serial_push_cstr(arena, &srl, sb_function_name(scratch.arena, unit_idx, function_idx));
+    str8_serial_push_u64(arena, &srl, addr);
+    str8_serial_push_u64(arena, &srl, sb_function_size(p));
+    str8_serial_push_u32(arena, &srl, int_off);
+    str8_serial_push_u8(arena, &srl, 1);
+    str8_serial_push_u32(arena, &srl, line);
+    for EachIndex(site_idx, p->inlinees_count ? p->inline_sites_count : 0)
+    {
+      Rng1U64 rows = sb_inline_site_row_range(p, site_idx);
+      sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_InlinedSubroutine);
+      str8_serial_push_u32(arena, &srl, inlinee_offs[sb_inlinee_idx_from_site(p, function_idx, site_idx)]);
+      str8_serial_push_u64(arena, &srl, addr + rows.min*SB_ROW_SIZE);
+      str8_serial_push_u64(arena, &srl, dim_1u64(rows)*SB_ROW_SIZE);
+      str8_serial_push_u8(arena, &srl, 1);
+      str8_serial_push_u32(arena, &srl, line + 1 + (U32)rows.min);
+    }
+    sb_dw_push_uleb128(arena, &srl, 0);
+  }
+  for EachIndex(template_idx, p->templates_count)
+  {
+    U64 arg_idx = sb_template_arg_from_unit(p, unit_idx, template_idx);
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_SubProgram);
+    str8_serial_push_cstr(arena, &srl, sb_template_func_name(scratch.arena, arg_idx));
+    str8_serial_push_u64(arena, &srl, sb_elf_function_addr(p, unit_idx, p->functions_count + template_idx));
+    str8_serial_push_u64(arena, &srl, sb_function_size(p));
+    str8_serial_push_u32(arena, &srl, int_off);
+    str8_serial_push_u8(arena, &srl, 3);
+    str8_serial_push_u32(arena, &srl, sb_template_arg_line(p, arg_idx));
+    sb_dw_push_uleb128(arena, &srl, SB_DWAbbrev_TemplateTypeParameter);
+    str8_serial_push_cstr(arena, &srl, str8_lit("T"));
+    str8_serial_push_u32(arena, &srl, arg_offs[template_idx]);
+    sb_dw_push_uleb128(arena, &srl, 0);
+  }
+  sb_dw_push_uleb128(arena, &srl, 0);
+#undef SB_DIE_OFF
+#undef sb_push_sec_offset
+
+  //- rjf: prepend header
+  String8List header = {0};
+  str8_serial_begin(arena, &header);
+  if(format == DW_Format_64Bit)
+  {
+    str8_serial_push_u32(arena, &header, max_U32);
+    str8_serial_push_u64(arena, &header, header_size - 12 + srl.total_size);
+    str8_serial_push_u16(arena, &header, DW_Version_4);
+    str8_serial_push_u64(arena, &header, 0);
+  }
+  else
+  {
+    str8_serial_push_u32(arena, &header, (U32)(header_size - 4 + srl.total_size));
+    str8_serial_push_u16(arena, &header, DW_Version_4);
+    str8_serial_push_u32(arena, &header, 0);
+  }
+  str8_serial_push_u8(arena, &header, 8);
+  str8_serial_push_data_list(arena, &header, srl.first);
+  String8 result = str8_serial_end(arena, &header);
+  scratch_end(scratch);
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: ELF Executable Generation
+
+internal U64
+sb_file_write(OS_Handle file, U64 off, String8 data)
+{
+  U64 written = os_file_write(file, r1u64(off, off+data.size), data.str);
+  if(written != data.size)
+  {
+    sb_errorf("error: write failed at offset %I64u\n", off);
+    os_abort(1);
+  }
+  return off + data.size;
+}
+
+internal U64
+sb_elf_write(SB_Params *p, String8 path)
+{
+  Temp scratch = scratch_begin(0, 0);
+  OS_Handle file = os_file_open(OS_AccessFlag_Write, path);
+  if(os_handle_match(file, os_handle_zero()))
+  {
+    sb_errorf("error: could not open %S for writing\n", path);
+    os_abort(1);
+  }
+  String8 body = sb_function_body(scratch.arena, p);
+  U64 unit_text_size = sb_unit_text_size(p);
+  U64 text_size = p->units_count*unit_text_size;
+  U64 functions_per_unit = p->functions_count + p->templates_count;
+
+  //- rjf: section table, filled in as each section is written
+  enum
+  {
+    SB_ElfSection_Null,
+    SB_ElfSection_Text,
+    SB_ElfSection_DebugAbbrev,
+    SB_ElfSection_DebugLine,
+    SB_ElfSection_DebugInfo,
+    SB_ElfSection_SymTab,
+    SB_ElfSection_StrTab,
+    SB_ElfSection_ShStrTab,
+    SB_ElfSection_COUNT
+  };
+  String8 section_names[SB_ElfSection_COUNT] =
+  {
+    str8_lit_comp(""), str8_lit_comp(".text"), str8_lit_comp(".debug_abbrev"), str8_lit_comp(".debug_line"),
+    str8_lit_comp(".debug_info"), str8_lit_comp(".symtab"), str8_lit_comp(".strtab"), str8_lit_comp(".shstrtab"),
+  };
+  ELF_Shdr64 shdrs[SB_ElfSection_COUNT] = {0};
+
+  //- rjf: .text; one pass, writing each unit's functions back-to-back
+  U64 off = SB_ELF_TEXT_OFF;
+  shdrs[SB_ElfSection_Text].sh_type      = ELF_ShType_ProgBits;
+  shdrs[SB_ElfSection_Text].sh_flags     = ELF_Shf_Alloc|ELF_Shf_ExecInstr;
+  shdrs[SB_ElfSection_Text].sh_addr      = SB_ELF_TEXT_VADDR;
+  shdrs[SB_ElfSection_Text].sh_offset    = off;
+  shdrs[SB_ElfSection_Text].sh_size      = text_size;
+  shdrs[SB_ElfSection_Text].sh_addralign = 16;
+  {
+    U8 *unit_text = push_array_no_zero(scratch.arena, U8, unit_text_size);
+    for EachIndex(function_idx, functions_per_unit)
+    {
+      MemoryCopy(unit_text + function_idx*body.size, body.str, body.size);
+    }
+    for EachIndex(unit_idx, p->units_count)
+    {
+      off = sb_file_write(file, off, str8(unit_text, unit_text_size));
+    }
+  }
+
+  //- rjf: .debug_abbrev
+  String8 abbrev = sb_dw_abbrev_table(scratch.arena);
+  shdrs[SB_ElfSection_DebugAbbrev].sh_type      = ELF_ShType_ProgBits;
+  shdrs[SB_ElfSection_DebugAbbrev].sh_offset    = off;
+  shdrs[SB_ElfSection_DebugAbbrev].sh_size      = abbrev.size;
+  shdrs[SB_ElfSection_DebugAbbrev].sh_addralign = 1;
+  off = sb_file_write(file, off, abbrev);
+
+  //- rjf: .debug_line; one pass, remembering where each unit's table starts
+  U64 *stmt_list_offs = push_array(scratch.arena, U64, p->units_count);
+  shdrs[SB_ElfSection_DebugLine].sh_type      = ELF_ShType_ProgBits;
+  shdrs[SB_ElfSection_DebugLine].sh_offset    = off;
+  shdrs[SB_ElfSection_DebugLine].sh_addralign = 1;
+  for EachIndex(unit_idx, p->units_count)
+  {
+    Temp temp = temp_begin(scratch.arena);
+    stmt_list_offs[unit_idx] = off - shdrs[SB_ElfSection_DebugLine].sh_offset;
+    off = sb_file_write(file, off, sb_dw_line_unit_from_unit(temp.arena, p, unit_idx));
+    temp_end(temp);
+  }
+  shdrs[SB_ElfSection_DebugLine].sh_size = off - shdrs[SB_ElfSection_DebugLine].sh_offset;
+
+  //- rjf: .debug_info
+  shdrs[SB_ElfSection_DebugInfo].sh_type      = ELF_ShType_ProgBits;
+  shdrs[SB_ElfSection_DebugInfo].sh_offset    = off;
+  shdrs[SB_ElfSection_DebugInfo].sh_addralign = 1;
+  for EachIndex(unit_idx, p->units_count)
+  {
+    Temp temp = temp_begin(scratch.arena);
+    off = sb_file_write(file, off, sb_dw_info_unit_from_unit(temp.arena, p, unit_idx, stmt_list_offs[unit_idx]));
+    temp_end(temp);
+  }
+  shdrs[SB_ElfSection_DebugInfo].sh_size = off - shdrs[SB_ElfSection_DebugInfo].sh_offset;
+
+  //- rjf: .symtab & .strtab; the symbol count is known up front, so both are
+  // written in the same pass, with .strtab directly following .symtab
+  {
+    off = AlignPow2(off, 8);
+    U64 symbols_count = 1 + p->units_count*functions_per_unit;
+    U64 symtab_off = off;
+    U64 strtab_off = symtab_off + symbols_count*sizeof(ELF_Sym64);
+    U64 symtab_cursor = symtab_off;
+    U64 strtab_cursor = strtab_off;
+    ELF_Sym64 null_symbol = {0};
+    symtab_cursor = sb_file_write(file, symtab_cursor, str8_struct(&null_symbol));
+    strtab_cursor = sb_file_write(file, strtab_cursor, str8_lit("\0"));
+    for EachIndex(unit_idx, p->units_count)
+    {
+      Temp temp = temp_begin(scratch.arena);
+      ELF_Sym64 *symbols = push_array(temp.arena, ELF_Sym64, functions_per_unit);
+      String8List names = {0};
+      for EachIndex(function_idx, functions_per_unit)
+      {
+        B32 is_template = (function_idx >= p->functions_count);
+        String8 name = (is_template
+                        ? sb_template_func_name(temp.arena, sb_template_arg_from_unit(p, unit_idx, function_idx - p->functions_count))
+                        : sb_function_name(temp.arena, unit_idx, function_idx));
+        symbols[function_idx].st_name  = (U32)(strtab_cursor - strtab_off + names.total_size);
+        symbols[function_idx].st_info  = ELF_ST_INFO(is_template ? ELF_SymBind_Weak : ELF_SymBind_Global, ELF_SymType_Func);
+        symbols[function_idx].st_shndx = SB_ElfSection_Text;
+        symbols[function_idx].st_value = sb_elf_function_addr(p, unit_idx, function_idx);
+        symbols[function_idx].st_size  = body.size;
+        str8_list_push(temp.arena, &names, name);
+        str8_list_push(temp.arena, &names, str8_lit("\0"));
+      }
+      symtab_cursor = sb_file_write(file, symtab_cursor, str8((U8 *)symbols, sizeof(ELF_Sym64)*functions_per_unit));
+      strtab_cursor = sb_file_write(file, strtab_cursor, str8_list_join(temp.arena, &names, 0));
+      temp_end(temp);
+    }
+    shdrs[SB_ElfSection_SymTab].sh_type      = ELF_ShType_Symtab;
+    shdrs[SB_ElfSection_SymTab].sh_offset    = symtab_off;
+    shdrs[SB_ElfSection_SymTab].sh_size      = symtab_cursor - symtab_off;
+    shdrs[SB_ElfSection_SymTab].sh_link      = SB_ElfSection_StrTab;
+    shdrs[SB_ElfSection_SymTab].sh_info      = 1;
+    shdrs[SB_ElfSection_SymTab].sh_addralign = 8;
+    shdrs[SB_ElfSection_SymTab].sh_entsize   = sizeof(ELF_Sym64);
+    shdrs[SB_ElfSection_StrTab].sh_type      = ELF_ShType_Strtab;
+    shdrs[SB_ElfSection_StrTab].sh_offset    = strtab_off;
+    shdrs[SB_ElfSection_StrTab].sh_size      = strtab_cursor - strtab_off;
+    shdrs[SB_ElfSection_StrTab].sh_addralign = 1;
+    off = strtab_cursor;
+  }
+
+  //- rjf: .shstrtab
+  {
+    String8List srl = {0};
+    str8_serial_begin(scratch.arena, &srl);
+    for EachElement(section_idx, section_names)
+    {
+      shdrs[section_idx].sh_name = (U32)srl.total_size;
+      str8_serial_push_cstr(scratch.arena, &srl, section_names[section_idx]);
+    }
+    String8 shstrtab = str8_serial_end(scratch.arena, &srl);
+    shdrs[SB_ElfSection_ShStrTab].sh_type      = ELF_ShType_Strtab;
+    shdrs[SB_ElfSection_ShStrTab].sh_offset    = off;
+    shdrs[SB_ElfSection_ShStrTab].sh_size      = shstrtab.size;
+    shdrs[SB_ElfSection_ShStrTab].sh_addralign = 1;
+    off = sb_file_write(file, off, shstrtab);
+  }
+
+  //- rjf: section headers
+  off = AlignPow2(off, 8);
+  U64 shdrs_off = off;
+  off = sb_file_write(file, off, str8((U8 *)shdrs, sizeof(shdrs)));
+
+  //- rjf: file & program headers
+  {
+    ELF_Hdr64 hdr = {0};
+    hdr.e_ident[ELF_Identifier_Mag0]    = 0x7F;
+    hdr.e_ident[ELF_Identifier_Mag1]    = 'E';
+    hdr.e_ident[ELF_Identifier_Mag2]    = 'L';
+    hdr.e_ident[ELF_Identifier_Mag3]    = 'F';
+    hdr.e_ident[ELF_Identifier_Class]   = ELF_Class_64;
+    hdr.e_ident[ELF_Identifier_Data]    = ELF_Data_2LSB;
+    hdr.e_ident[ELF_Identifier_Version] = ELF_Version_Current;
+    hdr.e_ident[ELF_Identifier_OsAbi]   = ELF_OsAbi_SYSV;
+    hdr.e_type      = ELF_Type_Exec;
+    hdr.e_machine   = ELF_MachineKind_X86_64;
+    hdr.e_version   = ELF_Version_Current;
+    hdr.e_entry     = SB_ELF_TEXT_VADDR;
+    hdr.e_phoff     = sizeof(ELF_Hdr64);
+    hdr.e_shoff     = shdrs_off;
+    hdr.e_ehsize    = sizeof(ELF_Hdr64);
+    hdr.e_phentsize = sizeof(ELF_Phdr64);
+    hdr.e_phnum     = 1;
+    hdr.e_shentsize = sizeof(ELF_Shdr64);
+    hdr.e_shnum     = SB_ElfSection_COUNT;
+    hdr.e_shstrndx  = SB_ElfSection_ShStrTab;
+    ELF_Phdr64 phdr = {0};
+    phdr.p_type   = ELF_PType_Load;
+    phdr.p_flags  = ELF_PFlag_Read|ELF_PFlag_Exec;
+    phdr.p_offset = SB_ELF_TEXT_OFF;
+    phdr.p_vaddr  = SB_ELF_TEXT_VADDR;
+    phdr.p_paddr  = SB_ELF_TEXT_VADDR;
+    phdr.p_filesz = text_size;
+    phdr.p_memsz  = text_size;
+    phdr.p_align  = 0x1000;
+    sb_file_write(file, 0, str8_struct(&hdr));
+    sb_file_write(file, sizeof(hdr), str8_struct(&phdr));
+  }
+  os_file_close(file);
+  scratch_end(scratch);
+  return off;
+}
+
+////////////////////////////////
+//~ rjf: COFF Objects Generation
+
+internal U64
+sb_coff_write(SB_Params *p, String8 dir_path)
+{
+  Temp scratch = scratch_begin(0, 0);
+  os_make_directory(dir_path);
+  U64 total_size = 0;
+  String8List rsp = {0};
+  str8_list_pushf(scratch.arena, &rsp, "/entry:main /subsystem:console /nodefaultlib /fixed /debug:full /out:synthbin.exe /pdb:synthbin.pdb\n");
+  for EachIndex(unit_idx, p->units_count)
+  {
+    Temp temp = temp_begin(scratch.arena);
+    String8 obj_name = push_str8f(temp.arena, "unit%I64u.obj", unit_idx);
+    String8 obj = sb_coff_obj_from_unit(temp.arena, p, unit_idx);
+    if(!os_write_data_to_file_path(push_str8f(temp.arena, "%S/%S", dir_path, obj_name), obj))
+    {
+      sb_errorf("error: could not write %S/%S\n", dir_path, obj_name);
+      os_abort(1);
+    }
+    total_size += obj.size;
+    temp_end(temp);
+    str8_list_pushf(scratch.arena, &rsp, "unit%I64u.obj\n", unit_idx);
+  }
+  os_write_data_list_to_file_path(push_str8f(scratch.arena, "%S/synthbin.rsp", dir_path), rsp);
+  scratch_end(scratch);
+  return total_size;
+}
+
+////////////////////////////////
+//~ rjf: Entry Point
+
+internal void
+entry_point(CmdLine *cmdline)
+{
+  //- rjf: unpack command line
+  SB_Params params = {0};
+  {
+    struct
+    {
+      String8 name;
+      U64 *value;
+      U64 default_value;
+    }
+    options[] =
+    {
+      {str8_lit_comp("units"),         &params.units_count,         16},
+      {str8_lit_comp("functions"),     &params.functions_count,     1024},
+      {str8_lit_comp("types"),         &params.types_count,         256},
+      {str8_lit_comp("members"),       &params.members_count,       8},
+      {str8_lit_comp("inline_sites"),  &params.inline_sites_count,  2},
+      {str8_lit_comp("inlinees"),      &params.inlinees_count,      64},
+      {str8_lit_comp("lines"),         &params.lines_count,         16},
+      {str8_lit_comp("templates"),     &params.templates_count,     32},
+      {str8_lit_comp("template_args"), &params.template_args_count, 128},
+    };
+    for EachElement(idx, options)
+    {
+      *options[idx].value = options[idx].default_value;
+      try_u64_from_str8_c_rules(cmd_line_string(cmdline, options[idx].name), options[idx].value);
+    }
+  }
+  String8 out_path = cmd_line_string(cmdline, str8_lit("out"));
+  B32 coff = cmd_line_has_flag(cmdline, str8_lit("coff"));
+  B32 elf = cmd_line_has_flag(cmdline, str8_lit("elf"));
+  if(out_path.size == 0 || coff == elf)
+  {
+    sb_errorf("usage: synthbin (--coff | --elf) --out:<path>\n"
+              "                [--units:<n>]          (default: 16)\n"
+              "                [--functions:<n>]      (per unit; default: 1024)\n"
+              "                [--types:<n>]          (per unit; default: 256)\n"
+              "                [--members:<n>]        (per type; default: 8)\n"
+              "                [--inline_sites:<n>]   (per function; default: 2)\n"
+              "                [--inlinees:<n>]       (inline functions per unit; default: 64)\n"
+              "                [--lines:<n>]          (line records per function; default: 16)\n"
+              "                [--templates:<n>]      (instantiations per unit; default: 32)\n"
+              "                [--template_args:<n>]  (args shared by all units' instantiations; default: 128)\n"
+              "\n"
+              "--coff writes one CodeView-annotated object per unit to the --out directory,\n"
+              "along with a response file, so that `radlink @synthbin.rsp` produces an EXE & PDB.\n"
+              "--elf writes a single DWARF-annotated ELF executable to --out.\n"
+              "Either output may be passed to radbin.\n");
+    os_abort(1);
+  }
+
+  //- rjf: clamp to what the layout can represent
+  params.units_count = Max(1, params.units_count);
+  params.lines_count = Clamp(1, params.lines_count, 0xFFFF);
+  params.inline_sites_count = Min(params.inline_sites_count, params.lines_count-1);
+  params.template_args_count = Max(1, params.template_args_count);
+  params.templates_count = Min(params.templates_count, params.template_args_count);
+  if(params.inlinees_count == 0)
+  {
+    params.inline_sites_count = 0;
+  }
+
+  //- rjf: generate
+  U64 start_us = os_now_microseconds();
+  U64 size = coff ? sb_coff_write(&params, out_path) : sb_elf_write(&params, out_path);
+  U64 end_us = os_now_microseconds();
+  sb_errorf("%S: %I64u units, %I64u functions, %I64u bytes, %.2f s\n",
+            out_path, params.units_count,
+            params.units_count*(params.functions_count + params.templates_count),
+            size, (F64)(end_us - start_us) / 1000000.0);
+}
@@ -39,6 +39,7 @@ internal B32
 frame(void)
 {
   ProfBeginFunction();
+  update_tick_advance();
   B32 quit = 0;
   Temp scratch = scratch_begin(0, 0);
   OS_EventList events = os_get_events(scratch.arena, 0);
@@ -0,0 +1,270 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Helpers
+
+internal SS_LNX_Url
+ss_lnx_url_from_string(Arena *arena, String8 string)
+{
+  SS_LNX_Url url = {0};
+  String8 rest = string;
+  if(str8_match(str8_prefix(rest, 8), str8_lit("https://"), StringMatchFlag_CaseInsensitive))
+  {
+    url.is_https = 1;
+    rest = str8_skip(rest, 8);
+  }
+  else if(str8_match(str8_prefix(rest, 7), str8_lit("http://"), StringMatchFlag_CaseInsensitive))
+  {
+    rest = str8_skip(rest, 7);
+  }
+  U64 path_pos = str8_find_needle(rest, 0, str8_lit("/"), 0);
+  String8 authority = str8_prefix(rest, path_pos);
+  url.authority = push_str8_copy(arena, authority);
+  url.path = push_str8_copy(arena, path_pos < rest.size ? str8_skip(rest, path_pos) : str8_lit("/"));
+  
+  //- rjf: split host & port - "[...]" hosts are IPv6 literals, which contain
+  // colons themselves, so the port separator is the first colon after "]"
+  String8 host = authority;
+  String8 port = {0};
+  if(str8_match(str8_prefix(authority, 1), str8_lit("["), 0))
+  {
+    U64 close_pos = str8_find_needle(authority, 1, str8_lit("]"), 0);
+    host = (close_pos < authority.size ? str8_substr(authority, r1u64(1, close_pos)) : str8_zero());
+    String8 after_host = str8_skip(authority, close_pos+1);
+    if(str8_match(str8_prefix(after_host, 1), str8_lit(":"), 0))
+    {
+      port = str8_skip(after_host, 1);
+    }
+  }
+  else
+  {
+    U64 port_pos = str8_find_needle(authority, 0, str8_lit(":"), 0);
+    host = str8_prefix(authority, port_pos);
+    port = str8_skip(authority, port_pos+1);
+  }
+  url.host = push_str8_copy(arena, host);
+  url.port = push_str8_copy(arena, port.size != 0 ? port : url.is_https ? str8_lit("443") : str8_lit("80"));
+  return url;
+}
+
+internal int
+ss_lnx_socket_from_url(SS_LNX_Url *url)
+{
+  int result = -1;
+  struct addrinfo hints = {0};
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *addrs = 0;
+  if(getaddrinfo((char *)url->host.str, (char *)url->port.str, &hints, &addrs) == 0)
+  {
+    for(struct addrinfo *a = addrs; a != 0 && result == -1; a = a->ai_next)
+    {
+      int fd = socket(a->ai_family, a->ai_socktype | SOCK_CLOEXEC, a->ai_protocol);
+      if(fd == -1)
+      {
+        continue;
+      }
+      struct timeval timeout = {SS_LNX_HTTP_TIMEOUT_SECONDS, 0};
+      setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+      setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+      if(connect(fd, a->ai_addr, a->ai_addrlen) == 0)
+      {
+        result = fd;
+      }
+      else
+      {
+        close(fd);
+      }
+    }
+    freeaddrinfo(addrs);
+  }
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Backend Hooks
+
+internal B32
+ss_os_http_fetch(String8 url_string, String8 dst_path, B32 *cancel_signal)
+{
+  // NOTE(rjf): this is a minimal HTTP/1.0 client - just enough to GET a file
+  // from a symsrv or debuginfod endpoint, following redirects. there is no TLS
+  // implementation on this backend, so https endpoints are skipped (those can
+  // be used through a local caching proxy, or by plugging in a fetch hook),
+  // with a user error naming the endpoint.
+  Temp scratch = scratch_begin(0, 0);
+  B32 result = 0;
+  String8 current_url = url_string;
+  for(U64 redirect_idx = 0; redirect_idx < SS_LNX_HTTP_REDIRECT_MAX; redirect_idx += 1)
+  {
+    //- rjf: parse url; connect
+    SS_LNX_Url url = ss_lnx_url_from_string(scratch.arena, current_url);
+    if(url.is_https)
+    {
+      if(redirect_idx == 0)
+      {
+        log_user_errorf("Symbol store https://%S was skipped; https is not supported on this platform. Use an http caching proxy instead.", url.authority);
+      }
+      else
+      {
+        log_user_errorf("Symbol store redirected to https://%S, which was skipped; https is not supported on this platform. Use an http caching proxy instead.", url.authority);
+      }
+      break;
+    }
+    if(url.host.size == 0)
+    {
+      break;
+    }
+    int fd = ss_lnx_socket_from_url(&url);
+    if(fd == -1)
+    {
+      break;
+    }
+
+    //- rjf: send request
+    String8 request = push_str8f(scratch.arena,
+                                 "GET %S HTTP/1.0\r\n"
+                                 "Host: %S\r\n"
+                                 "User-Agent: raddbg\r\n"
+                                 "Accept: */*\r\n"
+                                 "Connection: close\r\n"
+                                 "\r\n",
+                                 url.path, url.authority);
+    B32 request_good = 1;
+    for(U64 off = 0; off < request.size;)
+    {
+      ssize_t sent = send(fd, request.str + off, request.size - off, MSG_NOSIGNAL);
+      if(sent <= 0)
+      {
+        request_good = 0;
+        break;
+      }
+      off += sent;
+    }
+
+    //- rjf: receive header
+    U64 buffer_size = KB(64);
+    U8 *buffer = push_array_no_zero(scratch.arena, U8, buffer_size);
+    U64 buffer_pos = 0;
+    U64 header_end = 0;
+    for(;request_good && header_end == 0 && buffer_pos < buffer_size;)
+    {
+      ssize_t recvd = recv(fd, buffer + buffer_pos, buffer_size - buffer_pos, 0);
+      if(recvd <= 0)
+      {
+        break;
+      }
+      buffer_pos += recvd;
+      U64 sep_pos = str8_find_needle(str8(buffer, buffer_pos), 0, str8_lit("\r\n\r\n"), 0);
+      if(sep_pos < buffer_pos)
+      {
+        header_end = sep_pos + 4;
+      }
+    }
+
+    //- rjf: parse status & headers
+    String8 header = str8(buffer, header_end);
+    U64 status = 0;
+    String8 location = {0};
+    U64 content_length = max_U64;
+    if(header_end != 0)
+    {
+      U8 splits[] = {'\r', '\n'};
+      String8List lines = str8_split(scratch.arena, header, splits, ArrayCount(splits), 0);
+      if(lines.first != 0)
+      {
+        U64 status_pos = str8_find_needle(lines.first->string, 0, str8_lit(" "), 0);
+        String8 status_string = str8_prefix(str8_skip(lines.first->string, status_pos+1), 3);
+        try_u64_from_str8_c_rules(status_string, &status);
+        for EachNode(n, String8Node, lines.first->next)
+        {
+          String8 location_prefix = str8_lit("location:");
+          if(str8_match(str8_prefix(n->string, location_prefix.size), location_prefix, StringMatchFlag_CaseInsensitive))
+          {
+            location = push_str8_copy(scratch.arena, str8_skip_chop_whitespace(str8_skip(n->string, location_prefix.size)));
+          }
+          String8 content_length_prefix = str8_lit("content-length:");
+          if(str8_match(str8_prefix(n->string, content_length_prefix.size), content_length_prefix, StringMatchFlag_CaseInsensitive))
+          {
+            String8 content_length_string = str8_skip_chop_whitespace(str8_skip(n->string, content_length_prefix.size));
+            if(!try_u64_from_str8_c_rules(content_length_string, &content_length))
+            {
+              content_length = max_U64;
+            }
+          }
+        }
+      }
+    }
+
+    //- rjf: 200 -> stream body into destination file
+    //
+    // NOTE(rjf): the connection closing is the only end-of-body marker in
+    // HTTP/1.0, and it looks the same as a connection dropped part-way
+    // through. fetched files are moved into a persistent cache, so a body is
+    // only accepted if its length was given up-front & fully received.
+    //
+    B32 done = 1;
+    if(status == 200 && content_length != max_U64)
+    {
+      os_delete_file_at_path(dst_path);
+      OS_Handle file = os_file_open(OS_AccessFlag_Write, dst_path);
+      if(!os_handle_match(file, os_handle_zero()))
+      {
+        U64 file_off = 0;
+        B32 write_good = 1;
+        U64 body_start = header_end;
+        for(;;)
+        {
+          if(body_start < buffer_pos)
+          {
+            U64 write_size = buffer_pos - body_start;
+            write_good = (os_file_write(file, r1u64(file_off, file_off + write_size), buffer + body_start) == write_size);
+            file_off += write_size;
+          }
+          if(!write_good || (cancel_signal != 0 && ins_atomic_u32_eval(cancel_signal)))
+          {
+            write_good = 0;
+            break;
+          }
+          body_start = 0;
+          ssize_t recvd = recv(fd, buffer, buffer_size, 0);
+          if(recvd == 0)
+          {
+            break;
+          }
+          if(recvd < 0)
+          {
+            write_good = 0;
+            break;
+          }
+          buffer_pos = recvd;
+        }
+        os_file_close(file);
+        result = (write_good && file_off == content_length);
+      }
+    }
+
+    //- rjf: redirect -> follow location
+    else if((status == 301 || status == 302 || status == 303 || status == 307 || status == 308) && location.size != 0)
+    {
+      if(str8_match(str8_prefix(location, 1), str8_lit("/"), 0))
+      {
+        current_url = push_str8f(scratch.arena, "http://%S%S", url.authority, location);
+      }
+      else
+      {
+        current_url = location;
+      }
+      done = 0;
+    }
+
+    close(fd);
+    if(done)
+    {
+      break;
+    }
+  }
+  scratch_end(scratch);
+  return result;
+}
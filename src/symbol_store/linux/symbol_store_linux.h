@@ -0,0 +1,38 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#ifndef SYMBOL_STORE_LINUX_H
+#define SYMBOL_STORE_LINUX_H
+
+////////////////////////////////
+//~ rjf: Includes
+
+#include <sys/socket.h>
+#include <netdb.h>
+
+////////////////////////////////
+//~ rjf: Constants
+
+#define SS_LNX_HTTP_TIMEOUT_SECONDS 15
+#define SS_LNX_HTTP_REDIRECT_MAX    8
+
+////////////////////////////////
+//~ rjf: Parsed URL Type
+
+typedef struct SS_LNX_Url SS_LNX_Url;
+struct SS_LNX_Url
+{
+  B32 is_https;
+  String8 authority;
+  String8 host;
+  String8 port;
+  String8 path;
+};
+
+////////////////////////////////
+//~ rjf: Helpers
+
+internal SS_LNX_Url ss_lnx_url_from_string(Arena *arena, String8 string);
+internal int ss_lnx_socket_from_url(SS_LNX_Url *url);
+
+#endif // SYMBOL_STORE_LINUX_H
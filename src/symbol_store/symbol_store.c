@@ -0,0 +1,648 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#undef LAYER_COLOR
+#define LAYER_COLOR 0x6b9fb8ff
+
+////////////////////////////////
+//~ rjf: Main Layer Initialization
+
+internal void
+ss_init(void)
+{
+  Arena *arena = arena_alloc();
+  ss_shared = push_array(arena, SS_Shared, 1);
+  ss_shared->arena = arena;
+  ss_shared->sources_rw_mutex = rw_mutex_alloc();
+  ss_shared->sources_arena = arena_alloc();
+  ss_shared->sources.cache_dir = ss_default_cache_dir(ss_shared->sources_arena);
+  ss_shared->fetch_hook = ss_fetch_default;
+  ss_shared->fetch_mutex = mutex_alloc();
+  ss_shared->fetch_cv = cond_var_alloc();
+  ss_shared->fetch_arena = arena_alloc();
+  ss_shared->fetch_slots_count = 256;
+  ss_shared->fetch_slots = push_array(arena, SS_FetchTask *, ss_shared->fetch_slots_count);
+  ss_shared->user_errors_arena = arena_alloc();
+  ss_shared->fetch_threads_count = Min(os_get_system_info()->logical_processor_count, 4);
+  ss_shared->fetch_threads = push_array(arena, Thread, ss_shared->fetch_threads_count);
+  for EachIndex(idx, ss_shared->fetch_threads_count)
+  {
+    ss_shared->fetch_threads[idx] = thread_launch(ss_fetch_thread__entry_point, (void *)idx);
+  }
+}
+
+////////////////////////////////
+//~ rjf: Key Functions
+
+internal B32
+ss_key_is_nil(SS_Key *key)
+{
+  B32 result = (key->kind == SS_KeyKind_Null ||
+                (key->kind == SS_KeyKind_PDB && key->name.size == 0) ||
+                (key->kind == SS_KeyKind_BuildId && key->build_id_size == 0));
+  return result;
+}
+
+internal String8
+ss_serialized_from_key(Arena *arena, SS_Key *key)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  U32 build_id_size = Min(key->build_id_size, SS_BUILD_ID_MAX);
+  String8List parts = {0};
+  str8_list_push(scratch.arena, &parts, str8_struct(&key->kind));
+  str8_list_push(scratch.arena, &parts, str8_struct(&key->guid));
+  str8_list_push(scratch.arena, &parts, str8_struct(&key->age));
+  str8_list_push(scratch.arena, &parts, str8_struct(&build_id_size));
+  str8_list_push(scratch.arena, &parts, str8(key->build_id, build_id_size));
+  str8_list_push(scratch.arena, &parts, key->name);
+  String8 result = str8_list_join(arena, &parts, 0);
+  scratch_end(scratch);
+  return result;
+}
+
+internal SS_Key
+ss_key_from_serialized(String8 string)
+{
+  SS_Key key = {0};
+  U64 off = 0;
+  off += str8_deserial_read_struct(string, off, &key.kind);
+  off += str8_deserial_read_struct(string, off, &key.guid);
+  off += str8_deserial_read_struct(string, off, &key.age);
+  off += str8_deserial_read_struct(string, off, &key.build_id_size);
+  key.build_id_size = Min(key.build_id_size, SS_BUILD_ID_MAX);
+  off += str8_deserial_read(string, off, key.build_id, key.build_id_size, 1);
+  key.name = str8_skip(string, off);
+  return key;
+}
+
+internal String8
+ss_store_subpath_from_key(Arena *arena, SS_Key *key)
+{
+  String8 result = {0};
+  if(!ss_key_is_nil(key)) switch(key->kind)
+  {
+    default:{}break;
+
+    //- rjf: symsrv layout: name.pdb/<GUID><age>/name.pdb
+    case SS_KeyKind_PDB:
+    {
+      Guid g = key->guid;
+      String8 name = str8_skip_last_slash(key->name);
+      result = push_str8f(arena, "%S/%08X%04X%04X%02X%02X%02X%02X%02X%02X%02X%02X%X/%S",
+                          name,
+                          g.data1, g.data2, g.data3,
+                          g.data4[0], g.data4[1], g.data4[2], g.data4[3],
+                          g.data4[4], g.data4[5], g.data4[6], g.data4[7],
+                          key->age,
+                          name);
+    }break;
+
+    //- rjf: debuginfod layout: buildid/<hex>/debuginfo
+    case SS_KeyKind_BuildId:
+    {
+      Temp scratch = scratch_begin(&arena, 1);
+      String8List hex_parts = {0};
+      for EachIndex(idx, key->build_id_size)
+      {
+        str8_list_pushf(scratch.arena, &hex_parts, "%02x", key->build_id[idx]);
+      }
+      String8 hex = str8_list_join(scratch.arena, &hex_parts, 0);
+      result = push_str8f(arena, "buildid/%S/debuginfo", hex);
+      scratch_end(scratch);
+    }break;
+  }
+  return result;
+}
+
+internal String8List
+ss_local_paths_from_dir_key(Arena *arena, String8 dir, SS_Key *key)
+{
+  String8List result = {0};
+  String8 subpath = ss_store_subpath_from_key(arena, key);
+  if(dir.size != 0 && subpath.size != 0)
+  {
+    str8_list_pushf(arena, &result, "%S/%S", dir, subpath);
+
+    // rjf: build-ids -> also try the .build-id/<xx>/<rest>.debug layout, which
+    // is what distribution debug packages install (e.g. into /usr/lib/debug)
+    if(key->kind == SS_KeyKind_BuildId && key->build_id_size >= 2)
+    {
+      Temp scratch = scratch_begin(&arena, 1);
+      String8List rest_parts = {0};
+      for(U64 idx = 1; idx < key->build_id_size; idx += 1)
+      {
+        str8_list_pushf(scratch.arena, &rest_parts, "%02x", key->build_id[idx]);
+      }
+      String8 rest = str8_list_join(scratch.arena, &rest_parts, 0);
+      str8_list_pushf(arena, &result, "%S/.build-id/%02x/%S.debug", dir, key->build_id[0], rest);
+      scratch_end(scratch);
+    }
+  }
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Sources
+
+internal B32
+ss_string_is_url(String8 string)
+{
+  B32 result = (str8_match(str8_prefix(string, 7), str8_lit("http://"), StringMatchFlag_CaseInsensitive) ||
+                str8_match(str8_prefix(string, 8), str8_lit("https://"), StringMatchFlag_CaseInsensitive));
+  return result;
+}
+
+internal void
+ss_source_list_push_from_string(Arena *arena, String8List *list, String8 string)
+{
+  // NOTE(rjf): this accepts the _NT_SYMBOL_PATH syntax - `;`-separated
+  // elements, each of which may be a `*`-separated `srv*<dir>*<url>` chain.
+  // the `srv`/`symsrv`/`cache` markers are dropped; every directory and URL
+  // in a chain is used as a source.
+  Temp scratch = scratch_begin(&arena, 1);
+  U8 splits[] = {';', '*'};
+  String8List tokens = str8_split(scratch.arena, string, splits, ArrayCount(splits), 0);
+  for EachNode(n, String8Node, tokens.first)
+  {
+    String8 token = str8_skip_chop_whitespace(n->string);
+    if(str8_match(str8_prefix(token, 7), str8_lit("file://"), StringMatchFlag_CaseInsensitive))
+    {
+      token = str8_skip(token, 7);
+    }
+    if(token.size == 0 ||
+       str8_match(token, str8_lit("srv"), StringMatchFlag_CaseInsensitive) ||
+       str8_match(token, str8_lit("symsrv"), StringMatchFlag_CaseInsensitive) ||
+       str8_match(token, str8_lit("symsrv.dll"), StringMatchFlag_CaseInsensitive) ||
+       str8_match(token, str8_lit("cache"), StringMatchFlag_CaseInsensitive))
+    {
+      continue;
+    }
+    str8_list_push(arena, list, push_str8_copy(arena, token));
+  }
+  scratch_end(scratch);
+}
+
+internal String8List
+ss_source_list_from_environment(Arena *arena)
+{
+  Temp scratch = scratch_begin(&arena, 1);
+  String8List result = {0};
+  for EachNode(n, String8Node, os_get_process_info()->environment.first)
+  {
+    U64 eq_pos = str8_find_needle(n->string, 0, str8_lit("="), 0);
+    String8 name = str8_prefix(n->string, eq_pos);
+    String8 value = str8_skip(n->string, eq_pos+1);
+    if(str8_match(name, str8_lit("_NT_SYMBOL_PATH"), StringMatchFlag_CaseInsensitive) ||
+       str8_match(name, str8_lit("_NT_ALT_SYMBOL_PATH"), StringMatchFlag_CaseInsensitive))
+    {
+      ss_source_list_push_from_string(arena, &result, value);
+    }
+    else if(str8_match(name, str8_lit("DEBUGINFOD_URLS"), 0))
+    {
+      U8 splits[] = {' ', '\t'};
+      String8List urls = str8_split(scratch.arena, value, splits, ArrayCount(splits), 0);
+      for EachNode(url_n, String8Node, urls.first)
+      {
+        str8_list_push(arena, &result, push_str8_copy(arena, url_n->string));
+      }
+    }
+  }
+#if OS_LINUX
+  str8_list_push(arena, &result, str8_lit("/usr/lib/debug"));
+#endif
+  scratch_end(scratch);
+  return result;
+}
+
+internal String8
+ss_default_cache_dir(Arena *arena)
+{
+  String8 result = push_str8f(arena, "%S/raddbg/symbols", os_get_process_info()->user_program_data_path);
+  return result;
+}
+
+internal void
+ss_set_sources(String8 cache_dir, String8List sources)
+{
+  Temp scratch = scratch_begin(0, 0);
+
+  //- rjf: hash new sources; early-out if nothing changed
+  String8List hash_parts = {0};
+  str8_list_push(scratch.arena, &hash_parts, cache_dir);
+  for EachNode(n, String8Node, sources.first)
+  {
+    str8_list_push(scratch.arena, &hash_parts, n->string);
+  }
+  U8 hash_sep = 0;
+  StringJoin hash_join = {.sep = str8(&hash_sep, 1)};
+  U64 hash = u64_hash_from_str8(str8_list_join(scratch.arena, &hash_parts, &hash_join));
+  B32 changed = 0;
+  RWMutexScope(ss_shared->sources_rw_mutex, 0)
+  {
+    changed = (hash != ss_shared->sources_hash);
+  }
+
+  //- rjf: changed -> store new sources, classified into directories & urls
+  if(changed)
+  {
+    RWMutexScope(ss_shared->sources_rw_mutex, 1)
+    {
+      Arena *arena = ss_shared->sources_arena;
+      arena_clear(arena);
+      MemoryZeroStruct(&ss_shared->sources);
+      ss_shared->sources_hash = hash;
+      ss_shared->sources.cache_dir = (cache_dir.size != 0 ? push_str8_copy(arena, cache_dir) : ss_default_cache_dir(arena));
+      for EachNode(n, String8Node, sources.first)
+      {
+        if(ss_string_is_url(n->string))
+        {
+          String8 url = n->string;
+          for(;url.size != 0 && url.str[url.size-1] == '/'; url.size -= 1);
+          str8_list_push(arena, &ss_shared->sources.urls, push_str8_copy(arena, url));
+        }
+        else if(n->string.size != 0)
+        {
+          str8_list_push(arena, &ss_shared->sources.dirs, push_str8_copy(arena, n->string));
+        }
+      }
+      ins_atomic_u64_inc_eval(&ss_shared->sources_gen);
+    }
+
+    // rjf: cancel in-flight fetches - they're for the old set of sources, and
+    // will be re-requested if they're still needed; errors about the old
+    // sources are dropped, & may be reported again for the new ones
+    MutexScope(ss_shared->fetch_mutex)
+    {
+      arena_clear(ss_shared->user_errors_arena);
+      MemoryZeroStruct(&ss_shared->user_errors);
+      MemoryZeroStruct(&ss_shared->reported_user_errors);
+      for EachIndex(slot_idx, ss_shared->fetch_slots_count)
+      {
+        for(SS_FetchTask *t = ss_shared->fetch_slots[slot_idx]; t != 0; t = t->hash_next)
+        {
+          if(t->status == SS_FetchStatus_Active)
+          {
+            ins_atomic_u32_eval_assign(&t->cancelled, 1);
+          }
+        }
+      }
+    }
+    ins_atomic_u64_inc_eval(&ss_shared->gen);
+  }
+
+  scratch_end(scratch);
+}
+
+internal SS_Sources
+ss_sources_copy(Arena *arena, U64 *gen_out)
+{
+  SS_Sources result = {0};
+  RWMutexScope(ss_shared->sources_rw_mutex, 0)
+  {
+    result.cache_dir = push_str8_copy(arena, ss_shared->sources.cache_dir);
+    result.dirs = str8_list_copy(arena, &ss_shared->sources.dirs);
+    result.urls = str8_list_copy(arena, &ss_shared->sources.urls);
+    if(gen_out != 0)
+    {
+      *gen_out = ins_atomic_u64_eval(&ss_shared->sources_gen);
+    }
+  }
+  return result;
+}
+
+internal U64
+ss_gen(void)
+{
+  U64 result = ins_atomic_u64_eval(&ss_shared->gen);
+  return result;
+}
+
+internal U64
+ss_active_fetch_count(void)
+{
+  U64 result = 0;
+  MutexScope(ss_shared->fetch_mutex)
+  {
+    result = ss_shared->active_fetch_count;
+    for(SS_FetchTask *t = ss_shared->first_queued_fetch; t != 0; t = t->queue_next)
+    {
+      result += 1;
+    }
+  }
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Hooks
+
+internal void
+ss_set_fetch_hook(SS_FetchFunctionType *fetch_hook)
+{
+  ss_shared->fetch_hook = (fetch_hook != 0 ? fetch_hook : ss_fetch_default);
+}
+
+internal void
+ss_set_wakeup_hook(SS_WakeupFunctionType *wakeup_hook)
+{
+  ss_shared->wakeup_hook = wakeup_hook;
+}
+
+internal SS_FETCH_FUNCTION_DEF(ss_fetch_default)
+{
+  B32 result = 0;
+  if(ss_string_is_url(url))
+  {
+    result = ss_os_http_fetch(url, dst_path, cancel_signal);
+  }
+  else
+  {
+    result = os_copy_file_path(dst_path, url);
+  }
+  return result;
+}
+
+////////////////////////////////
+//~ rjf: Fetch Threads
+
+internal B32
+ss_make_parent_directories(String8 path)
+{
+  Temp scratch = scratch_begin(0, 0);
+  String8 parent = str8_chop_last_slash(path);
+  for EachIndex(idx, parent.size)
+  {
+    if(idx != 0 && (parent.str[idx] == '/' || parent.str[idx] == '\\') && parent.str[idx-1] != ':')
+    {
+      String8 prefix = push_str8_copy(scratch.arena, str8_prefix(parent, idx));
+      if(!os_folder_path_exists(prefix))
+      {
+        os_make_directory(prefix);
+      }
+    }
+  }
+  if(!os_folder_path_exists(parent))
+  {
+    os_make_directory(parent);
+  }
+  B32 result = os_folder_path_exists(parent);
+  scratch_end(scratch);
+  return result;
+}
+
+internal SS_FetchStatus
+ss_fetch_status_from_subpath(String8 subpath, B32 request)
+{
+  SS_FetchStatus result = SS_FetchStatus_Failed;
+  U64 sources_gen = ins_atomic_u64_eval(&ss_shared->sources_gen);
+  U64 hash = u64_hash_from_str8(subpath);
+  U64 slot_idx = hash%ss_shared->fetch_slots_count;
+  B32 queued = 0;
+  MutexScope(ss_shared->fetch_mutex)
+  {
+    SS_FetchTask *task = 0;
+    for(SS_FetchTask *t = ss_shared->fetch_slots[slot_idx]; t != 0; t = t->hash_next)
+    {
+      if(str8_match(t->subpath, subpath, 0))
+      {
+        task = t;
+        break;
+      }
+    }
+    B32 need_queue = 0;
+    if(task == 0 && request)
+    {
+      task = push_array(ss_shared->fetch_arena, SS_FetchTask, 1);
+      task->subpath = push_str8_copy(ss_shared->fetch_arena, subpath);
+      task->hash_next = ss_shared->fetch_slots[slot_idx];
+      ss_shared->fetch_slots[slot_idx] = task;
+      need_queue = 1;
+    }
+
+    // rjf: requeue tasks which failed (or were cancelled) against an older set
+    // of sources, or whose result has since gone missing from the cache
+    else if(task != 0 && request &&
+            ((task->status == SS_FetchStatus_Failed && task->sources_gen != sources_gen) ||
+             task->status == SS_FetchStatus_Done))
+    {
+      need_queue = 1;
+    }
+    if(need_queue)
+    {
+      task->status = SS_FetchStatus_Queued;
+      task->sources_gen = sources_gen;
+      task->cancelled = 0;
+      SLLQueuePush_N(ss_shared->first_queued_fetch, ss_shared->last_queued_fetch, task, queue_next);
+      queued = 1;
+    }
+    if(task != 0)
+    {
+      result = task->status;
+    }
+  }
+  if(queued)
+  {
+    cond_var_broadcast(ss_shared->fetch_cv);
+  }
+  return result;
+}
+
+internal void
+ss_push_user_error(String8 error)
+{
+  MutexScope(ss_shared->fetch_mutex)
+  {
+    B32 is_reported = 0;
+    for EachNode(n, String8Node, ss_shared->reported_user_errors.first)
+    {
+      if(str8_match(n->string, error, 0))
+      {
+        is_reported = 1;
+        break;
+      }
+    }
+    if(!is_reported)
+    {
+      String8 error_copy = push_str8_copy(ss_shared->user_errors_arena, error);
+      str8_list_push(ss_shared->user_errors_arena, &ss_shared->user_errors, error_copy);
+      str8_list_push(ss_shared->user_errors_arena, &ss_shared->reported_user_errors, error_copy);
+    }
+  }
+}
+
+internal String8List
+ss_take_user_errors(Arena *arena)
+{
+  String8List result = {0};
+  MutexScope(ss_shared->fetch_mutex)
+  {
+    result = str8_list_copy(arena, &ss_shared->user_errors);
+    MemoryZeroStruct(&ss_shared->user_errors);
+  }
+  return result;
+}
+
+internal void
+ss_fetch_thread__entry_point(void *p)
+{
+  U64 thread_idx = (U64)p;
+  ThreadNameF("ss_fetch_thread_%I64u", thread_idx);
+  log_select(log_alloc());
+  for(;;)
+  {
+    Temp scratch = scratch_begin(0, 0);
+    log_scope_begin();
+
+    //- rjf: take next task
+    SS_FetchTask *task = 0;
+    String8 subpath = {0};
+    MutexScope(ss_shared->fetch_mutex) for(;;)
+    {
+      if(ss_shared->first_queued_fetch != 0)
+      {
+        task = ss_shared->first_queued_fetch;
+        SLLQueuePop_N(ss_shared->first_queued_fetch, ss_shared->last_queued_fetch, queue_next);
+        task->queue_next = 0;
+        task->status = SS_FetchStatus_Active;
+        subpath = push_str8_copy(scratch.arena, task->subpath);
+        ss_shared->active_fetch_count += 1;
+        break;
+      }
+      cond_var_wait(ss_shared->fetch_cv, ss_shared->fetch_mutex, max_U64);
+    }
+
+    //- rjf: try each url, in order; download into a temporary file in the
+    // cache, and move it into place only once it's complete
+    U64 sources_gen = 0;
+    SS_Sources sources = ss_sources_copy(scratch.arena, &sources_gen);
+    String8 dst_path = push_str8f(scratch.arena, "%S/%S", sources.cache_dir, subpath);
+    String8 tmp_path = push_str8f(scratch.arena, "%S.partial_%u_%I64u", dst_path, os_get_process_info()->pid, thread_idx);
+    B32 good = 0;
+    if(ss_make_parent_directories(dst_path))
+    {
+      for(String8Node *n = sources.urls.first; n != 0 && !good && !ins_atomic_u32_eval(&task->cancelled); n = n->next)
+      {
+        String8 url = push_str8f(scratch.arena, "%S/%S", n->string, subpath);
+        ProfScope("fetch %.*s", str8_varg(url))
+        {
+          B32 fetched = ss_shared->fetch_hook(url, tmp_path, &task->cancelled);
+          FileProperties props = os_properties_from_file_path(tmp_path);
+          if(fetched && props.size != 0 && !ins_atomic_u32_eval(&task->cancelled))
+          {
+            good = (os_move_file_path(dst_path, tmp_path) || os_file_path_exists(dst_path));
+          }
+          os_delete_file_at_path(tmp_path);
+        }
+      }
+    }
+
+    //- rjf: mark task as complete; bump generation so that resolutions
+    // re-check the cache, & wake up any interested threads
+    MutexScope(ss_shared->fetch_mutex)
+    {
+      task->status = (good ? SS_FetchStatus_Done : SS_FetchStatus_Failed);
+      task->sources_gen = sources_gen;
+      ss_shared->active_fetch_count -= 1;
+    }
+    //- rjf: forward user errors from this fetch (e.g. unsupported endpoints)
+    {
+      LogScopeResult log = log_scope_end(scratch.arena);
+      if(log.strings[LogMsgKind_UserError].size != 0)
+      {
+        ss_push_user_error(log.strings[LogMsgKind_UserError]);
+      }
+    }
+    ins_atomic_u64_inc_eval(&ss_shared->gen);
+    if(ss_shared->wakeup_hook != 0)
+    {
+      ss_shared->wakeup_hook();
+    }
+
+    scratch_end(scratch);
+  }
+}
+
+////////////////////////////////
+//~ rjf: Path Resolution Artifact Cache Hooks / Lookups
+
+internal AC_Artifact
+ss_path_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out)
+{
+  ProfBeginFunction();
+  Temp scratch = scratch_begin(0, 0);
+  *gen_out = ss_gen();
+
+  //- rjf: unpack key
+  SS_Key ss_key = ss_key_from_serialized(key);
+  SS_Sources sources = ss_sources_copy(scratch.arena, 0);
+  String8 subpath = ss_store_subpath_from_key(scratch.arena, &ss_key);
+
+  //- rjf: gather local candidates - the cache first, then all local stores
+  String8List candidates = ss_local_paths_from_dir_key(scratch.arena, sources.cache_dir, &ss_key);
+  for EachNode(n, String8Node, sources.dirs.first)
+  {
+    String8List dir_candidates = ss_local_paths_from_dir_key(scratch.arena, n->string, &ss_key);
+    str8_list_concat_in_place(&candidates, &dir_candidates);
+  }
+
+  //- rjf: find first existing candidate
+  String8 path = {0};
+  for EachNode(n, String8Node, candidates.first)
+  {
+    FileProperties props = os_properties_from_file_path(n->string);
+    if(props.size != 0 && !(props.flags & FilePropertyFlag_IsFolder))
+    {
+      path = n->string;
+      break;
+    }
+  }
+
+  //- rjf: not found locally -> request fetch from remote stores
+  if(path.size == 0 && subpath.size != 0 && sources.urls.node_count != 0)
+  {
+    ss_fetch_status_from_subpath(subpath, 1);
+  }
+
+  //- rjf: package result
+  AC_Artifact artifact = {0};
+  if(path.size != 0)
+  {
+    Arena *arena = arena_alloc(.reserve_size = KB(64), .commit_size = KB(4));
+    String8 *path_copy = push_array(arena, String8, 1);
+    *path_copy = push_str8_copy(arena, path);
+    artifact.u64[0] = (U64)arena;
+    artifact.u64[1] = (U64)path_copy;
+  }
+
+  scratch_end(scratch);
+  ProfEnd();
+  return artifact;
+}
+
+internal void
+ss_path_artifact_destroy(AC_Artifact artifact)
+{
+  Arena *arena = (Arena *)artifact.u64[0];
+  if(arena != 0)
+  {
+    arena_release(arena);
+  }
+}
+
+internal String8
+ss_path_from_key(Arena *arena, Access *access, SS_Key *key, U64 endt_us)
+{
+  String8 result = {0};
+  if(!ss_key_is_nil(key))
+  {
+    Temp scratch = scratch_begin(&arena, 1);
+    String8 serialized_key = ss_serialized_from_key(scratch.arena, key);
+    AC_Artifact artifact = ac_artifact_from_key(access, serialized_key, ss_path_artifact_create, ss_path_artifact_destroy, endt_us, .gen = ss_gen());
+    String8 *path = (String8 *)artifact.u64[1];
+    if(path != 0)
+    {
+      result = push_str8_copy(arena, *path);
+    }
+    scratch_end(scratch);
+  }
+  return result;
+}
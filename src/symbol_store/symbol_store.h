@@ -0,0 +1,201 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#ifndef SYMBOL_STORE_H
+#define SYMBOL_STORE_H
+
+////////////////////////////////
+//~ rjf: Symbol Store Overview
+//
+// Modules whose debug info can't be found next to the image are looked up by
+// identity - the PDB70 GUID + age + PDB file name for PE modules, and the GNU
+// build-id for ELF modules - in a list of "symbol stores". A store is either
+// a local directory, or an HTTP endpoint. Directories are searched using the
+// symsrv layout (`name.pdb/<GUID><age>/name.pdb`), the debuginfod layout
+// (`buildid/<hex>/debuginfo`), and the `.build-id/<xx>/<rest>.debug` layout
+// used by distribution debug packages. Endpoints are fetched from using the
+// symsrv & debuginfod URL schemes.
+//
+// Everything fetched is written into a single on-disk cache directory, laid
+// out exactly like a symsrv/debuginfod store, so the cache is itself a valid
+// store for other tools, and is shared between debugger instances. Fetches
+// are written to a temporary file, then moved into place, so a partially
+// downloaded file is never visible.
+//
+// Resolutions are artifacts, keyed by module identity. They never block on
+// the network - a resolution which misses locally queues a fetch to a small
+// pool of fetch threads, and produces an empty path. When a fetch completes,
+// the resolution generation is bumped, and the next lookup finds the file in
+// the cache.
+
+////////////////////////////////
+//~ rjf: Key Types
+
+typedef enum SS_KeyKind
+{
+  SS_KeyKind_Null,
+  SS_KeyKind_PDB,
+  SS_KeyKind_BuildId,
+  SS_KeyKind_COUNT
+}
+SS_KeyKind;
+
+#define SS_BUILD_ID_MAX 64
+
+typedef struct SS_Key SS_Key;
+struct SS_Key
+{
+  SS_KeyKind kind;
+  Guid guid;
+  U32 age;
+  U32 build_id_size;
+  U8 build_id[SS_BUILD_ID_MAX];
+  String8 name;
+};
+
+////////////////////////////////
+//~ rjf: Source Types
+
+typedef struct SS_Sources SS_Sources;
+struct SS_Sources
+{
+  String8 cache_dir;
+  String8List dirs;
+  String8List urls;
+};
+
+////////////////////////////////
+//~ rjf: Hook Types
+
+#define SS_FETCH_FUNCTION_DEF(name) B32 name(String8 url, String8 dst_path, B32 *cancel_signal)
+typedef SS_FETCH_FUNCTION_DEF(SS_FetchFunctionType);
+
+#define SS_WAKEUP_FUNCTION_DEF(name) void name(void)
+typedef SS_WAKEUP_FUNCTION_DEF(SS_WakeupFunctionType);
+
+////////////////////////////////
+//~ rjf: Fetch Task Types
+
+typedef enum SS_FetchStatus
+{
+  SS_FetchStatus_Queued,
+  SS_FetchStatus_Active,
+  SS_FetchStatus_Done,
+  SS_FetchStatus_Failed,
+}
+SS_FetchStatus;
+
+typedef struct SS_FetchTask SS_FetchTask;
+struct SS_FetchTask
+{
+  SS_FetchTask *hash_next;
+  SS_FetchTask *queue_next;
+  String8 subpath;
+  SS_FetchStatus status;
+  U64 sources_gen;
+  B32 cancelled;
+};
+
+////////////////////////////////
+//~ rjf: Shared State
+
+typedef struct SS_Shared SS_Shared;
+struct SS_Shared
+{
+  Arena *arena;
+
+  // rjf: resolution generation (bumped on source changes & fetch completions)
+  U64 gen;
+
+  // rjf: sources
+  RWMutex sources_rw_mutex;
+  Arena *sources_arena;
+  U64 sources_hash;
+  U64 sources_gen;
+  SS_Sources sources;
+
+  // rjf: hooks
+  SS_FetchFunctionType *fetch_hook;
+  SS_WakeupFunctionType *wakeup_hook;
+
+  // rjf: fetch tasks
+  Mutex fetch_mutex;
+  CondVar fetch_cv;
+  Arena *fetch_arena;
+  U64 fetch_slots_count;
+  SS_FetchTask **fetch_slots;
+  SS_FetchTask *first_queued_fetch;
+  SS_FetchTask *last_queued_fetch;
+  U64 active_fetch_count;
+
+  // rjf: user errors, gathered from fetch threads' logs; each distinct error
+  // is reported once per set of sources
+  Arena *user_errors_arena;
+  String8List user_errors;
+  String8List reported_user_errors;
+
+  // rjf: fetch threads
+  U64 fetch_threads_count;
+  Thread *fetch_threads;
+};
+
+////////////////////////////////
+//~ rjf: Globals
+
+global SS_Shared *ss_shared = 0;
+
+////////////////////////////////
+//~ rjf: Main Layer Initialization
+
+internal void ss_init(void);
+
+////////////////////////////////
+//~ rjf: Key Functions
+
+internal B32 ss_key_is_nil(SS_Key *key);
+internal String8 ss_serialized_from_key(Arena *arena, SS_Key *key);
+internal SS_Key ss_key_from_serialized(String8 string);
+internal String8 ss_store_subpath_from_key(Arena *arena, SS_Key *key);
+internal String8List ss_local_paths_from_dir_key(Arena *arena, String8 dir, SS_Key *key);
+
+////////////////////////////////
+//~ rjf: Sources
+
+internal B32 ss_string_is_url(String8 string);
+internal void ss_source_list_push_from_string(Arena *arena, String8List *list, String8 string);
+internal String8List ss_source_list_from_environment(Arena *arena);
+internal String8 ss_default_cache_dir(Arena *arena);
+internal void ss_set_sources(String8 cache_dir, String8List sources);
+internal SS_Sources ss_sources_copy(Arena *arena, U64 *gen_out);
+internal U64 ss_gen(void);
+internal U64 ss_active_fetch_count(void);
+
+////////////////////////////////
+//~ rjf: Hooks
+
+internal void ss_set_fetch_hook(SS_FetchFunctionType *fetch_hook);
+internal void ss_set_wakeup_hook(SS_WakeupFunctionType *wakeup_hook);
+internal SS_FETCH_FUNCTION_DEF(ss_fetch_default);
+
+////////////////////////////////
+//~ rjf: Fetch Threads
+
+internal B32 ss_make_parent_directories(String8 path);
+internal SS_FetchStatus ss_fetch_status_from_subpath(String8 subpath, B32 request);
+internal void ss_push_user_error(String8 error);
+internal String8List ss_take_user_errors(Arena *arena);
+internal void ss_fetch_thread__entry_point(void *p);
+
+////////////////////////////////
+//~ rjf: Path Resolution Artifact Cache Hooks / Lookups
+
+internal AC_Artifact ss_path_artifact_create(String8 key, B32 *cancel_signal, B32 *retry_out, U64 *gen_out);
+internal void ss_path_artifact_destroy(AC_Artifact artifact);
+internal String8 ss_path_from_key(Arena *arena, Access *access, SS_Key *key, U64 endt_us);
+
+////////////////////////////////
+//~ rjf: Backend Hooks
+
+internal B32 ss_os_http_fetch(String8 url, String8 dst_path, B32 *cancel_signal);
+
+#endif // SYMBOL_STORE_H
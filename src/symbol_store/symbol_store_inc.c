@@ -0,0 +1,12 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#include "symbol_store/symbol_store.c"
+
+#if OS_WINDOWS
+# include "symbol_store/win32/symbol_store_win32.c"
+#elif OS_LINUX
+# include "symbol_store/linux/symbol_store_linux.c"
+#else
+# error Symbol store layer backend not defined for this operating system.
+#endif
@@ -0,0 +1,17 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#ifndef SYMBOL_STORE_INC_H
+#define SYMBOL_STORE_INC_H
+
+#include "symbol_store/symbol_store.h"
+
+#if OS_WINDOWS
+# include "symbol_store/win32/symbol_store_win32.h"
+#elif OS_LINUX
+# include "symbol_store/linux/symbol_store_linux.h"
+#else
+# error Symbol store layer backend not defined for this operating system.
+#endif
+
+#endif // SYMBOL_STORE_INC_H
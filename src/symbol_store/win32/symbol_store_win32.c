@@ -0,0 +1,111 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+////////////////////////////////
+//~ rjf: Backend Hooks
+
+internal B32
+ss_os_http_fetch(String8 url, String8 dst_path, B32 *cancel_signal)
+{
+  Temp scratch = scratch_begin(0, 0);
+  B32 result = 0;
+
+  //- rjf: crack url
+  String16 url16 = str16_from_8(scratch.arena, url);
+  WCHAR host_name[256] = {0};
+  URL_COMPONENTS url_parts = {sizeof(url_parts)};
+  url_parts.lpszHostName     = host_name;
+  url_parts.dwHostNameLength = ArrayCount(host_name);
+  url_parts.dwUrlPathLength  = (DWORD)-1;
+  url_parts.dwExtraInfoLength = (DWORD)-1;
+  BOOL cracked = WinHttpCrackUrl((WCHAR *)url16.str, (DWORD)url16.size, 0, &url_parts);
+
+  //- rjf: open session/connection/request; winhttp follows redirects itself
+  HINTERNET session = 0;
+  HINTERNET connection = 0;
+  HINTERNET request = 0;
+  if(cracked)
+  {
+    session = WinHttpOpen(L"raddbg", WINHTTP_ACCESS_TYPE_AUTOMATIC_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+  }
+  if(session != 0)
+  {
+    WinHttpSetTimeouts(session, SS_W32_HTTP_TIMEOUT_MS, SS_W32_HTTP_TIMEOUT_MS, SS_W32_HTTP_TIMEOUT_MS, SS_W32_HTTP_TIMEOUT_MS);
+    connection = WinHttpConnect(session, host_name, url_parts.nPort, 0);
+  }
+  if(connection != 0)
+  {
+    DWORD flags = (url_parts.nScheme == INTERNET_SCHEME_HTTPS ? WINHTTP_FLAG_SECURE : 0);
+    request = WinHttpOpenRequest(connection, L"GET", url_parts.lpszUrlPath, 0, WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES, flags);
+  }
+
+  //- rjf: send; check status & expected length
+  B32 status_good = 0;
+  U64 content_length = max_U64;
+  if(request != 0 &&
+     WinHttpSendRequest(request, WINHTTP_NO_ADDITIONAL_HEADERS, 0, WINHTTP_NO_REQUEST_DATA, 0, 0, 0) &&
+     WinHttpReceiveResponse(request, 0))
+  {
+    DWORD status = 0;
+    DWORD status_size = sizeof(status);
+    WinHttpQueryHeaders(request, WINHTTP_QUERY_STATUS_CODE|WINHTTP_QUERY_FLAG_NUMBER, WINHTTP_HEADER_NAME_BY_INDEX, &status, &status_size, WINHTTP_NO_HEADER_INDEX);
+    status_good = (status == 200);
+    WCHAR content_length_buffer[32] = {0};
+    DWORD content_length_buffer_size = sizeof(content_length_buffer);
+    if(WinHttpQueryHeaders(request, WINHTTP_QUERY_CONTENT_LENGTH, WINHTTP_HEADER_NAME_BY_INDEX, content_length_buffer, &content_length_buffer_size, WINHTTP_NO_HEADER_INDEX))
+    {
+      String8 content_length_string = str8_from_16(scratch.arena, str16((U16 *)content_length_buffer, content_length_buffer_size/sizeof(WCHAR)));
+      if(!try_u64_from_str8_c_rules(str8_skip_chop_whitespace(content_length_string), &content_length))
+      {
+        content_length = max_U64;
+      }
+    }
+  }
+
+  //- rjf: stream body into destination file
+  if(status_good)
+  {
+    OS_Handle file = os_file_open(OS_AccessFlag_Write, dst_path);
+    if(!os_handle_match(file, os_handle_zero()))
+    {
+      U64 buffer_size = KB(64);
+      U8 *buffer = push_array_no_zero(scratch.arena, U8, buffer_size);
+      U64 file_off = 0;
+      B32 write_good = 1;
+      for(;;)
+      {
+        DWORD read_size = 0;
+        if(!WinHttpReadData(request, buffer, (DWORD)buffer_size, &read_size))
+        {
+          write_good = 0;
+          break;
+        }
+        if(read_size == 0)
+        {
+          break;
+        }
+        if(os_file_write(file, r1u64(file_off, file_off + read_size), buffer) != read_size ||
+           (cancel_signal != 0 && ins_atomic_u32_eval(cancel_signal)))
+        {
+          write_good = 0;
+          break;
+        }
+        file_off += read_size;
+      }
+      os_file_close(file);
+      
+      // rjf: a body with a known length must have been fully received, or
+      // a dropped connection would leave a truncated file in the cache.
+      // without one, winhttp's chunked framing marks the end of the body.
+      result = (write_good && (content_length == max_U64 || file_off == content_length));
+    }
+  }
+
+  //- rjf: close handles
+  if(request != 0)    { WinHttpCloseHandle(request); }
+  if(connection != 0) { WinHttpCloseHandle(connection); }
+  if(session != 0)    { WinHttpCloseHandle(session); }
+
+  scratch_end(scratch);
+  return result;
+}
@@ -0,0 +1,18 @@
+// Copyright (c) Epic Games Tools
+// Licensed under the MIT license (https://opensource.org/license/mit/)
+
+#ifndef SYMBOL_STORE_WIN32_H
+#define SYMBOL_STORE_WIN32_H
+
+////////////////////////////////
+//~ rjf: Includes
+
+#include <winhttp.h>
+#pragma comment(lib, "winhttp")
+
+////////////////////////////////
+//~ rjf: Constants
+
+#define SS_W32_HTTP_TIMEOUT_MS 15000
+
+#endif // SYMBOL_STORE_WIN32_H
@@ -447,6 +447,12 @@ ui_animating_from_state(UI_State *state)
   return state->is_animating;
 }
 
+internal UI_BuildStats
+ui_build_stats_from_state(UI_State *state)
+{
+  return state->last_build_stats;
+}
+
 internal void
 ui_select_state(UI_State *state)
 {
@@ -798,8 +804,11 @@ ui_box_from_key(UI_Key key)
 internal void
 ui_begin_build(OS_Handle window, UI_EventList *events, UI_IconInfo *icon_info, UI_Theme *theme, UI_AnimationInfo *animation_info, F32 real_dt, F32 animation_dt)
 {
+  U64 begin_build_start_us = os_now_microseconds();
+  
   //- rjf: reset per-build ui state
   {
+    MemoryZeroStruct(&ui_state->build_stats);
     UI_InitStacks(ui_state);
     ui_state->root = &ui_nil_box;
     ui_state->ctx_menu_touched_this_frame = 0;
@@ -1110,15 +1119,10 @@ ui_begin_build(OS_Handle window, UI_EventList *events, UI_IconInfo *icon_info, U
   }
   
   //- rjf: next-default-nav-focus keys -> current-default-nav-focus-keys
-  for(U64 slot_idx = 0; slot_idx < ui_state->box_table_size; slot_idx += 1)
+  for(UI_Box *box = ui_state->lru_box; !ui_box_is_nil(box); box = box->lru_next)
   {
-    for(UI_Box *box = ui_state->box_table[slot_idx].hash_first;
-        !ui_box_is_nil(box);
-        box = box->hash_next)
-    {
-      box->default_nav_focus_hot_key = box->default_nav_focus_next_hot_key;
-      box->default_nav_focus_active_key = box->default_nav_focus_next_active_key;
-    }
+    box->default_nav_focus_hot_key = box->default_nav_focus_next_hot_key;
+    box->default_nav_focus_active_key = box->default_nav_focus_next_active_key;
   }
   
   //- rjf: build top-level root
@@ -1213,31 +1217,43 @@ ui_begin_build(OS_Handle window, UI_EventList *events, UI_IconInfo *icon_info, U
   {
     ui_ctx_menu_close();
   }
+  
+  //- rjf: mark end of begin-build work; the build itself is timed from here
+  ui_state->build_begin_us = os_now_microseconds();
+  ui_state->build_stats.begin_build_us = ui_state->build_begin_us - begin_build_start_us;
 }
 
 internal void
 ui_end_build(void)
 {
   ProfBeginFunction();
+  U64 end_build_start_us = os_now_microseconds();
+  ui_state->build_stats.build_us = end_build_start_us - ui_state->build_begin_us;
   
-  //- rjf: prune untouched or transient boxes in the cache
+  //- rjf: prune untouched boxes in the cache
+  //
+  // every touch moves a box to the MRU end of the LRU list, so all boxes
+  // which were not touched in this build are at the front. transient boxes
+  // are never in the cache, so they don't need to be checked here.
+  //
   ProfScope("ui prune unused boxes")
   {
-    for(U64 slot_idx = 0; slot_idx < ui_state->box_table_size; slot_idx += 1)
+    for(UI_Box *box = ui_state->lru_box, *next = &ui_nil_box; !ui_box_is_nil(box); box = next)
     {
-      for(UI_Box *box = ui_state->box_table[slot_idx].hash_first, *next = 0;
-          !ui_box_is_nil(box);
-          box = next)
+      next = box->lru_next;
+      if(box->last_touched_build_index < ui_state->build_index)
       {
-        next = box->hash_next;
-        if(box->last_touched_build_index < ui_state->build_index ||
-           ui_key_match(box->key, ui_key_zero()))
-        {
-          DLLRemove_NPZ(&ui_nil_box, ui_state->box_table[slot_idx].hash_first, ui_state->box_table[slot_idx].hash_last, box, hash_next, hash_prev);
-          SLLStackPush(ui_state->first_free_box, box);
-        }
+        U64 slot_idx = box->key.u64[0] % ui_state->box_table_size;
+        DLLRemove_NPZ(&ui_nil_box, ui_state->box_table[slot_idx].hash_first, ui_state->box_table[slot_idx].hash_last, box, hash_next, hash_prev);
+        DLLRemove_NPZ(&ui_nil_box, ui_state->lru_box, ui_state->mru_box, box, lru_next, lru_prev);
+        SLLStackPush(ui_state->first_free_box, box);
+      }
+      else
+      {
+        break;
       }
     }
+    ui_state->build_stats.prune_us = os_now_microseconds() - end_build_start_us;
   }
   
   //- rjf: layout box tree
@@ -1326,53 +1342,44 @@ ui_end_build(void)
       root->rect = new_root_rect;
       for(Axis2 axis = (Axis2)0; axis < Axis2_COUNT; axis = (Axis2)(axis + 1))
       {
-        ui_calc_sizes_standalone__in_place(root, axis);
-        ui_calc_sizes_upwards_dependent__in_place(root, axis);
-        ui_calc_sizes_downwards_dependent__in_place(root, axis);
-        ui_layout_enforce_constraints__in_place(root, axis);
-        ui_layout_position__in_place(root, axis);
+        ui_layout_root(root, axis);
       }
     }
   }
   
   //- rjf: enforce child-rounding
   {
-    for(U64 slot_idx = 0; slot_idx < ui_state->box_table_size; slot_idx += 1)
+    for(UI_Box *box = ui_state->lru_box; !ui_box_is_nil(box); box = box->lru_next)
     {
-      for(UI_Box *box = ui_state->box_table[slot_idx].hash_first;
-          !ui_box_is_nil(box);
-          box = box->hash_next)
+      if(box->flags & UI_BoxFlag_RoundChildrenByParent)
       {
-        if(box->flags & UI_BoxFlag_RoundChildrenByParent)
+        for(UI_Box *b = box; !ui_box_is_nil(b); b = ui_box_rec_df_pre(b, box).next)
         {
-          for(UI_Box *b = box; !ui_box_is_nil(b); b = ui_box_rec_df_pre(b, box).next)
+          if(floor_f32(b->rect.x0) <= floor_f32(box->rect.x0) &&
+             floor_f32(b->rect.y0) <= floor_f32(box->rect.y0))
           {
-            if(floor_f32(b->rect.x0) <= floor_f32(box->rect.x0) &&
-               floor_f32(b->rect.y0) <= floor_f32(box->rect.y0))
-            {
-              b->corner_radii[Corner_00] = box->corner_radii[Corner_00];
-            }
-            if(floor_f32(b->rect.x1) >= floor_f32(box->rect.x1) &&
-               floor_f32(b->rect.y0) <= floor_f32(box->rect.y0))
-            {
-              b->corner_radii[Corner_10] = box->corner_radii[Corner_10];
-            }
-            if(floor_f32(b->rect.x0) <= floor_f32(box->rect.x0) &&
-               floor_f32(b->rect.y1) >= floor_f32(box->rect.y1))
-            {
-              b->corner_radii[Corner_01] = box->corner_radii[Corner_01];
-            }
-            if(floor_f32(b->rect.x1) >= floor_f32(box->rect.x1) &&
-               floor_f32(b->rect.y1) >= floor_f32(box->rect.y1))
-            {
-              b->corner_radii[Corner_11] = box->corner_radii[Corner_11];
-            }
+            b->corner_radii[Corner_00] = box->corner_radii[Corner_00];
+          }
+          if(floor_f32(b->rect.x1) >= floor_f32(box->rect.x1) &&
+             floor_f32(b->rect.y0) <= floor_f32(box->rect.y0))
+          {
+            b->corner_radii[Corner_10] = box->corner_radii[Corner_10];
+          }
+          if(floor_f32(b->rect.x0) <= floor_f32(box->rect.x0) &&
+             floor_f32(b->rect.y1) >= floor_f32(box->rect.y1))
+          {
+            b->corner_radii[Corner_01] = box->corner_radii[Corner_01];
+          }
+          if(floor_f32(b->rect.x1) >= floor_f32(box->rect.x1) &&
+             floor_f32(b->rect.y1) >= floor_f32(box->rect.y1))
+          {
+            b->corner_radii[Corner_11] = box->corner_radii[Corner_11];
           }
-          box->first->corner_radii[Corner_00] = box->corner_radii[Corner_00];
-          box->first->corner_radii[Corner_10] = box->corner_radii[Corner_10];
-          box->last->corner_radii[Corner_01] = box->corner_radii[Corner_01];
-          box->last->corner_radii[Corner_11] = box->corner_radii[Corner_11];
         }
+        box->first->corner_radii[Corner_00] = box->corner_radii[Corner_00];
+        box->first->corner_radii[Corner_10] = box->corner_radii[Corner_10];
+        box->last->corner_radii[Corner_01] = box->corner_radii[Corner_01];
+        box->last->corner_radii[Corner_11] = box->corner_radii[Corner_11];
       }
     }
   }
@@ -1417,101 +1424,96 @@ ui_end_build(void)
     {
       ui_state->tooltip_open_t = 1.f;
     }
-    for(U64 slot_idx = 0; slot_idx < ui_state->box_table_size; slot_idx += 1)
-    {
-      for(UI_Box *box = ui_state->box_table[slot_idx].hash_first;
-          !ui_box_is_nil(box);
-          box = box->hash_next)
-      {
-        // rjf: grab states informing animation
-        B32 is_hot            = (ui_key_match(box->key, ui_state->hot_box_key) ||
-                                 ui_key_match(box->key, ui_state->drop_hot_box_key));
-        B32 is_active         = ui_key_match(box->key, ui_state->active_box_key[UI_MouseButtonKind_Left]);
-        B32 is_disabled       = !!(box->flags & UI_BoxFlag_Disabled) && (box->first_disabled_build_index+2 < ui_state->build_index ||
-                                                                         box->first_touched_build_index == box->first_disabled_build_index);
-        B32 is_focus_hot      = !!(box->flags & UI_BoxFlag_FocusHot) && !(box->flags & UI_BoxFlag_FocusHotDisabled);
-        B32 is_focus_active   = !!(box->flags & UI_BoxFlag_FocusActive) && !(box->flags & UI_BoxFlag_FocusActiveDisabled);
-        B32 is_focus_active_disabled = !!(box->flags & UI_BoxFlag_FocusActiveDisabled);
-        
-        // rjf: determine rates
-        F32 hot_rate      = ui_state->animation_info.hot_animation_rate;
-        F32 active_rate   = ui_state->animation_info.active_animation_rate;
-        F32 disabled_rate = slow_rate;
-        F32 focus_rate    = ui_state->animation_info.focus_animation_rate;
-        
-        // rjf: determine animating status
-        B32 box_is_animating = 0;
-        box_is_animating = (box_is_animating || abs_f32((F32)is_hot          - box->hot_t) > 0.01f);
-        box_is_animating = (box_is_animating || abs_f32((F32)is_active       - box->active_t) > 0.01f);
-        box_is_animating = (box_is_animating || abs_f32((F32)is_disabled     - box->disabled_t) > 0.01f);
-        box_is_animating = (box_is_animating || abs_f32((F32)is_focus_hot    - box->focus_hot_t) > 0.01f);
-        box_is_animating = (box_is_animating || abs_f32((F32)is_focus_active - box->focus_active_t) > 0.01f);
-        box_is_animating = (box_is_animating || abs_f32((F32)is_focus_active_disabled - box->focus_active_disabled_t) > 0.01f);
-        box_is_animating = (box_is_animating || abs_f32(box->view_off_target.x - box->view_off.x) > 0.5f);
-        box_is_animating = (box_is_animating || abs_f32(box->view_off_target.y - box->view_off.y) > 0.5f);
-        if(box->flags & UI_BoxFlag_AnimatePosX)
-        {
-          box_is_animating = (box_is_animating || abs_f32(box->fixed_position_animated.x - box->fixed_position.x) > 0.5f);
-        }
-        if(box->flags & UI_BoxFlag_AnimatePosY)
-        {
-          box_is_animating = (box_is_animating || abs_f32(box->fixed_position_animated.y - box->fixed_position.y) > 0.5f);
-        }
-        ui_state->is_animating = (ui_state->is_animating || box_is_animating);
+    for(UI_Box *box = ui_state->lru_box; !ui_box_is_nil(box); box = box->lru_next)
+    {
+      // rjf: grab states informing animation
+      B32 is_hot            = (ui_key_match(box->key, ui_state->hot_box_key) ||
+                               ui_key_match(box->key, ui_state->drop_hot_box_key));
+      B32 is_active         = ui_key_match(box->key, ui_state->active_box_key[UI_MouseButtonKind_Left]);
+      B32 is_disabled       = !!(box->flags & UI_BoxFlag_Disabled) && (box->first_disabled_build_index+2 < ui_state->build_index ||
+                                                                       box->first_touched_build_index == box->first_disabled_build_index);
+      B32 is_focus_hot      = !!(box->flags & UI_BoxFlag_FocusHot) && !(box->flags & UI_BoxFlag_FocusHotDisabled);
+      B32 is_focus_active   = !!(box->flags & UI_BoxFlag_FocusActive) && !(box->flags & UI_BoxFlag_FocusActiveDisabled);
+      B32 is_focus_active_disabled = !!(box->flags & UI_BoxFlag_FocusActiveDisabled);
+      
+      // rjf: determine rates
+      F32 hot_rate      = ui_state->animation_info.hot_animation_rate;
+      F32 active_rate   = ui_state->animation_info.active_animation_rate;
+      F32 disabled_rate = slow_rate;
+      F32 focus_rate    = ui_state->animation_info.focus_animation_rate;
+      
+      // rjf: determine animating status
+      B32 box_is_animating = 0;
+      box_is_animating = (box_is_animating || abs_f32((F32)is_hot          - box->hot_t) > 0.01f);
+      box_is_animating = (box_is_animating || abs_f32((F32)is_active       - box->active_t) > 0.01f);
+      box_is_animating = (box_is_animating || abs_f32((F32)is_disabled     - box->disabled_t) > 0.01f);
+      box_is_animating = (box_is_animating || abs_f32((F32)is_focus_hot    - box->focus_hot_t) > 0.01f);
+      box_is_animating = (box_is_animating || abs_f32((F32)is_focus_active - box->focus_active_t) > 0.01f);
+      box_is_animating = (box_is_animating || abs_f32((F32)is_focus_active_disabled - box->focus_active_disabled_t) > 0.01f);
+      box_is_animating = (box_is_animating || abs_f32(box->view_off_target.x - box->view_off.x) > 0.5f);
+      box_is_animating = (box_is_animating || abs_f32(box->view_off_target.y - box->view_off.y) > 0.5f);
+      if(box->flags & UI_BoxFlag_AnimatePosX)
+      {
+        box_is_animating = (box_is_animating || abs_f32(box->fixed_position_animated.x - box->fixed_position.x) > 0.5f);
+      }
+      if(box->flags & UI_BoxFlag_AnimatePosY)
+      {
+        box_is_animating = (box_is_animating || abs_f32(box->fixed_position_animated.y - box->fixed_position.y) > 0.5f);
+      }
+      ui_state->is_animating = (ui_state->is_animating || box_is_animating);
 #if 0 // NOTE(rjf): enable to debug animation-causing-frames (or not)
-        if(box_is_animating)
+      if(box_is_animating)
+      {
+        box->overlay_color = v4f32(1, 0, 0, 0.1f);
+        box->flags |= UI_BoxFlag_DrawOverlay;
+      }
+#endif
+      
+      // rjf: animate interaction transition states
+      box->hot_t                   += hot_rate      * ((F32)is_hot - box->hot_t);
+      box->active_t                = is_active ? 1.f : box->active_t + (active_rate   * ((F32)is_active - box->active_t));
+      box->disabled_t              += disabled_rate * ((F32)is_disabled - box->disabled_t);
+      box->focus_hot_t             += focus_rate    * ((F32)is_focus_hot - box->focus_hot_t);
+      box->focus_active_t          += focus_rate    * ((F32)is_focus_active - box->focus_active_t);
+      box->focus_active_disabled_t += focus_rate    * ((F32)is_focus_active_disabled - box->focus_active_disabled_t);
+      
+      // rjf: animate positions
+      {
+        box->fixed_position_animated.x += fast_rate * (box->fixed_position.x - box->fixed_position_animated.x);
+        box->fixed_position_animated.y += fast_rate * (box->fixed_position.y - box->fixed_position_animated.y);
+        if(abs_f32(box->fixed_position.x - box->fixed_position_animated.x) < 1)
         {
-          box->overlay_color = v4f32(1, 0, 0, 0.1f);
-          box->flags |= UI_BoxFlag_DrawOverlay;
+          box->fixed_position_animated.x = box->fixed_position.x;
         }
-#endif
-        
-        // rjf: animate interaction transition states
-        box->hot_t                   += hot_rate      * ((F32)is_hot - box->hot_t);
-        box->active_t                = is_active ? 1.f : box->active_t + (active_rate   * ((F32)is_active - box->active_t));
-        box->disabled_t              += disabled_rate * ((F32)is_disabled - box->disabled_t);
-        box->focus_hot_t             += focus_rate    * ((F32)is_focus_hot - box->focus_hot_t);
-        box->focus_active_t          += focus_rate    * ((F32)is_focus_active - box->focus_active_t);
-        box->focus_active_disabled_t += focus_rate    * ((F32)is_focus_active_disabled - box->focus_active_disabled_t);
-        
-        // rjf: animate positions
+        if(abs_f32(box->fixed_position.y - box->fixed_position_animated.y) < 1)
         {
-          box->fixed_position_animated.x += fast_rate * (box->fixed_position.x - box->fixed_position_animated.x);
-          box->fixed_position_animated.y += fast_rate * (box->fixed_position.y - box->fixed_position_animated.y);
-          if(abs_f32(box->fixed_position.x - box->fixed_position_animated.x) < 1)
-          {
-            box->fixed_position_animated.x = box->fixed_position.x;
-          }
-          if(abs_f32(box->fixed_position.y - box->fixed_position_animated.y) < 1)
-          {
-            box->fixed_position_animated.y = box->fixed_position.y;
-          }
+          box->fixed_position_animated.y = box->fixed_position.y;
         }
-        
-        // rjf: clamp view
-        if(box->flags & UI_BoxFlag_ViewClamp)
+      }
+      
+      // rjf: clamp view
+      if(box->flags & UI_BoxFlag_ViewClamp)
+      {
+        Vec2F32 max_view_off_target =
         {
-          Vec2F32 max_view_off_target =
-          {
-            ClampBot(0, box->view_bounds.x - box->fixed_size.x),
-            ClampBot(0, box->view_bounds.y - box->fixed_size.y),
-          };
-          if(box->flags & UI_BoxFlag_ViewClampX) { box->view_off_target.x = Clamp(0, box->view_off_target.x, max_view_off_target.x); }
-          if(box->flags & UI_BoxFlag_ViewClampY) { box->view_off_target.y = Clamp(0, box->view_off_target.y, max_view_off_target.y); }
+          ClampBot(0, box->view_bounds.x - box->fixed_size.x),
+          ClampBot(0, box->view_bounds.y - box->fixed_size.y),
+        };
+        if(box->flags & UI_BoxFlag_ViewClampX) { box->view_off_target.x = Clamp(0, box->view_off_target.x, max_view_off_target.x); }
+        if(box->flags & UI_BoxFlag_ViewClampY) { box->view_off_target.y = Clamp(0, box->view_off_target.y, max_view_off_target.y); }
+      }
+      
+      // rjf: animate view offset
+      {
+        box->view_off.x += ui_state->animation_info.scroll_animation_rate * (box->view_off_target.x - box->view_off.x);
+        box->view_off.y += ui_state->animation_info.scroll_animation_rate * (box->view_off_target.y - box->view_off.y);
+        if(abs_f32(box->view_off.x - box->view_off_target.x) < 2)
+        {
+          box->view_off.x = box->view_off_target.x;
         }
-        
-        // rjf: animate view offset
+        if(abs_f32(box->view_off.y - box->view_off_target.y) < 2)
         {
-          box->view_off.x += ui_state->animation_info.scroll_animation_rate * (box->view_off_target.x - box->view_off.x);
-          box->view_off.y += ui_state->animation_info.scroll_animation_rate * (box->view_off_target.y - box->view_off.y);
-          if(abs_f32(box->view_off.x - box->view_off_target.x) < 2)
-          {
-            box->view_off.x = box->view_off_target.x;
-          }
-          if(abs_f32(box->view_off.y - box->view_off_target.y) < 2)
-          {
-            box->view_off.y = box->view_off_target.y;
-          }
+          box->view_off.y = box->view_off_target.y;
         }
       }
     }
@@ -1674,6 +1676,11 @@ ui_end_build(void)
     }
   }
   
+  //- rjf: finish build stats
+  ui_state->build_stats.box_count = ui_state->build_box_count;
+  ui_state->build_stats.end_build_us = os_now_microseconds() - end_build_start_us;
+  ui_state->last_build_stats = ui_state->build_stats;
+  
   ui_state->build_index += 1;
   arena_clear(ui_build_arena());
   ProfEnd();
@@ -1950,11 +1957,19 @@ internal void
 ui_layout_root(UI_Box *root, Axis2 axis)
 {
   ProfBegin("ui layout pass (%s)", axis == Axis2_X ? "x" : "y");
+  U64 sizes_start_us = os_now_microseconds();
   ui_calc_sizes_standalone__in_place(root, axis);
   ui_calc_sizes_upwards_dependent__in_place(root, axis);
   ui_calc_sizes_downwards_dependent__in_place(root, axis);
+  U64 layout_start_us = os_now_microseconds();
   ui_layout_enforce_constraints__in_place(root, axis);
   ui_layout_position__in_place(root, axis);
+  U64 layout_end_us = os_now_microseconds();
+  if(ui_state != 0)
+  {
+    ui_state->build_stats.calc_sizes_us += layout_start_us - sizes_start_us;
+    ui_state->build_stats.layout_us += layout_end_us - layout_start_us;
+  }
   ProfEnd();
 }
 
@@ -2463,6 +2478,16 @@ ui_build_box_from_key(UI_BoxFlags flags, UI_Key key)
     DLLInsert_NPZ(&ui_nil_box, ui_state->box_table[slot].hash_first, ui_state->box_table[slot].hash_last, ui_state->box_table[slot].hash_last, box, hash_next, hash_prev);
   }
   
+  //- rjf: touch in LRU list (persistent boxes only)
+  if(!box_is_transient)
+  {
+    if(!box_first_frame)
+    {
+      DLLRemove_NPZ(&ui_nil_box, ui_state->lru_box, ui_state->mru_box, box, lru_next, lru_prev);
+    }
+    DLLPushBack_NPZ(&ui_nil_box, ui_state->lru_box, ui_state->mru_box, box, lru_next, lru_prev);
+  }
+  
   //- rjf: hook into per-frame tree structure
   if(!ui_box_is_nil(parent))
   {
@@ -368,6 +368,8 @@ struct UI_Box
   //- rjf: persistent links
   UI_Box *hash_next;
   UI_Box *hash_prev;
+  UI_Box *lru_next;
+  UI_Box *lru_prev;
   
   //- rjf: per-build links/data
   UI_Box *first;
@@ -644,6 +646,20 @@ struct UI_BoxHashSlot
   UI_Box *hash_last;
 };
 
+//- rjf: per-build timing stats (times of the last completed build)
+
+typedef struct UI_BuildStats UI_BuildStats;
+struct UI_BuildStats
+{
+  U64 begin_build_us;
+  U64 build_us;
+  U64 prune_us;
+  U64 calc_sizes_us;
+  U64 layout_us;
+  U64 end_build_us;
+  U64 box_count;
+};
+
 //- rjf: main state bundle
 
 typedef struct UI_State UI_State;
@@ -661,6 +677,8 @@ struct UI_State
   
   //- rjf: box cache
   UI_Box *first_free_box;
+  UI_Box *lru_box;
+  UI_Box *mru_box;
   U64 box_table_size;
   UI_BoxHashSlot *box_table;
   
@@ -697,6 +715,9 @@ struct UI_State
   UI_Key default_nav_root_key;
   U64 build_box_count;
   U64 last_build_box_count;
+  U64 build_begin_us;
+  UI_BuildStats build_stats;
+  UI_BuildStats last_build_stats;
   B32 ctx_menu_touched_this_frame;
   B32 is_animating;
   
@@ -817,6 +838,7 @@ internal UI_State *ui_state_alloc(void);
 internal void      ui_state_release(UI_State *state);
 internal UI_Box *  ui_root_from_state(UI_State *state);
 internal B32       ui_animating_from_state(UI_State *state);
+internal UI_BuildStats ui_build_stats_from_state(UI_State *state);
 internal void      ui_select_state(UI_State *state);
 internal UI_State *ui_get_selected_state(void);
 